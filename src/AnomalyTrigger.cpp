@@ -0,0 +1,237 @@
+#include "AnomalyTrigger.h"
+#include "FlightRecorder.h"
+#include "Logger.h"
+#include "Version.h"
+#include <chrono>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+namespace {
+
+struct AnomalyInfo {
+    AnomalyType type;
+    const char* name;
+    const char* file_tag;
+    int min_interval_ms; // Per-type rate limit
+};
+
+// Indexed by AnomalyType
+constexpr AnomalyInfo kAnomalies[] = {
+    { AnomalyType::TorqueSpike,    "Torque Spike",     "torque_spike",    30000 },
+    { AnomalyType::NonFinite,      "Non-Finite Value", "non_finite",      30000 },
+    { AnomalyType::ClippingBurst,  "Clipping Burst",   "clipping_burst",  60000 },
+    { AnomalyType::LowRate,        "Low Sample Rate",  "low_rate",        60000 },
+    { AnomalyType::LockTimeout,    "Lock Timeout",     "lock_timeout",    60000 },
+    { AnomalyType::StaleTelemetry, "Stale Telemetry",  "stale_telemetry", 60000 },
+};
+static_assert(sizeof(kAnomalies) / sizeof(kAnomalies[0]) == (size_t)AnomalyType::Count, "kAnomalies must cover every AnomalyType");
+
+constexpr uint64_t PRE_RECORDS = (uint64_t)AnomalyTrigger::PRE_SECONDS * FlightRecorder::RATE_HZ;
+constexpr uint64_t POST_RECORDS = (uint64_t)AnomalyTrigger::POST_SECONDS * FlightRecorder::RATE_HZ;
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+std::string TimestampNow() {
+    auto in_time_t = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
+    std::tm time_info;
+#ifdef _WIN32
+    localtime_s(&time_info, &in_time_t);
+#else
+    localtime_r(&in_time_t, &time_info);
+#endif
+    std::stringstream ss;
+    ss << std::put_time(&time_info, "%Y-%m-%d_%H-%M-%S");
+    return ss.str();
+}
+
+// One sink only: the debug Logger echoes to the console once it has a file
+void Report(const std::string& line) {
+    if (Logger::Get().IsInitialized()) {
+        Logger::Get().LogStr(line);
+    } else {
+        std::cout << line << std::endl;
+    }
+}
+
+} // namespace
+
+AnomalyTrigger& AnomalyTrigger::Get() {
+    static AnomalyTrigger instance;
+    return instance;
+}
+
+AnomalyTrigger::~AnomalyTrigger() {
+    // No final dump here: the recorder and Logger singletons may already be gone.
+    m_armed = false;
+    m_running = false;
+    if (m_worker.joinable()) m_worker.join();
+}
+
+bool AnomalyTrigger::Fire(AnomalyType type, double value) {
+    if (type >= AnomalyType::Count || !m_armed.load(std::memory_order_acquire)) return false;
+    Counters& c = m_counters[(size_t)type];
+
+    // Rate limit: only one caller per interval wins the CAS
+    int64_t now = NowMs();
+    int64_t last = c.last_fire_ms.load(std::memory_order_relaxed);
+    if ((last != INT64_MIN && now - last < kAnomalies[(size_t)type].min_interval_ms) ||
+        !c.last_fire_ms.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        c.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    if (m_accepted.load(std::memory_order_relaxed) >= MAX_DUMPS) {
+        c.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    for (Pending& p : m_pending) {
+        int expected = 0;
+        if (!p.state.compare_exchange_strong(expected, 1, std::memory_order_acquire)) continue;
+        // Only a claimed slot counts against the budget; a racing caller may have used it up
+        if (m_accepted.fetch_add(1, std::memory_order_relaxed) >= MAX_DUMPS) {
+            m_accepted.fetch_sub(1, std::memory_order_relaxed);
+            p.state.store(0, std::memory_order_release);
+            c.suppressed.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        p.type = type;
+        p.value = value;
+        p.trigger_seq = FlightRecorder::Get().GetHead();
+        p.fired_ms = now;
+        p.state.store(2, std::memory_order_release);
+        c.fired.fetch_add(1, std::memory_order_relaxed);
+        return true;
+    }
+    c.dropped.fetch_add(1, std::memory_order_relaxed); // Every slot is waiting for its window
+    return false;
+}
+
+void AnomalyTrigger::Start(const std::string& dir, bool background) {
+    {
+        std::lock_guard<std::mutex> lock(m_service_mutex);
+        m_dir = dir;
+    }
+    m_armed = true;
+    if (background && !m_running.exchange(true)) {
+        m_worker = std::thread(&AnomalyTrigger::ServiceLoop, this);
+    }
+}
+
+void AnomalyTrigger::Stop() {
+    m_armed = false;
+    if (m_running.exchange(false) && m_worker.joinable()) m_worker.join();
+    Service(true);
+}
+
+void AnomalyTrigger::ServiceLoop() {
+    while (m_running) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(SERVICE_PERIOD_MS));
+        Service(false);
+    }
+}
+
+size_t AnomalyTrigger::Service(bool flush) {
+    std::lock_guard<std::mutex> lock(m_service_mutex);
+    uint64_t head = FlightRecorder::Get().GetHead();
+    int64_t now = NowMs();
+    size_t written = 0;
+    for (Pending& p : m_pending) {
+        if (p.state.load(std::memory_order_acquire) != 2) continue;
+        // Wait for the post-trigger window, unless recording has stopped (stale telemetry)
+        bool ready = flush || head >= p.trigger_seq + POST_RECORDS ||
+                     now - p.fired_ms > (POST_SECONDS + 1) * 1000;
+        if (!ready) continue;
+        if (Dump(p)) written++;
+        p.state.store(0, std::memory_order_release);
+    }
+    return written;
+}
+
+bool AnomalyTrigger::Dump(const Pending& p) {
+    const char* name = GetName(p.type);
+    FlightRecorder& recorder = FlightRecorder::Get();
+    std::vector<FlightRecord> records;
+    if (recorder.IsOpen()) {
+        uint64_t first = (p.trigger_seq > PRE_RECORDS) ? p.trigger_seq - PRE_RECORDS + 1 : 1;
+        records.reserve((size_t)(p.trigger_seq + POST_RECORDS - first + 1));
+        recorder.Copy(first, (size_t)(p.trigger_seq + POST_RECORDS - first + 1), records);
+    }
+    if (records.empty()) {
+        Report(std::string("[Anomaly] ") + name + ": no flight recorder data to save");
+        return false;
+    }
+
+    std::string path;
+    try {
+        std::filesystem::create_directories(m_dir);
+        path = (std::filesystem::path(m_dir) /
+                ("anomaly_" + TimestampNow() + "_" + kAnomalies[(size_t)p.type].file_tag + ".csv")).string();
+    } catch (...) {
+        path.clear();
+    }
+    std::ofstream out(path);
+    if (path.empty() || !out.is_open()) {
+        std::cerr << "[Anomaly] Failed to write " << path << std::endl;
+        return false;
+    }
+    out << "# lmuFFB Anomaly: " << name << " | Value: " << p.value << " | Trigger Seq: " << p.trigger_seq
+        << " | Version: " << LMUFFB_VERSION << "\n";
+    FlightRecorder::WriteCsv(out, records.data(), records.size());
+    out.close();
+
+    m_last_dump = path;
+    m_dumps.fetch_add(1, std::memory_order_relaxed);
+    m_counters[(size_t)p.type].dumped.fetch_add(1, std::memory_order_relaxed);
+
+    std::ostringstream line;
+    line << "[Anomaly] " << name << " (" << p.value << "): saved " << records.size() << " records to " << path;
+    Report(line.str());
+    return true;
+}
+
+AnomalyStats AnomalyTrigger::GetStats(AnomalyType type) const {
+    if (type >= AnomalyType::Count) return { "Unknown", 0, 0, 0, 0 };
+    const Counters& c = m_counters[(size_t)type];
+    return { GetName(type),
+             c.fired.load(std::memory_order_relaxed),
+             c.suppressed.load(std::memory_order_relaxed),
+             c.dropped.load(std::memory_order_relaxed),
+             c.dumped.load(std::memory_order_relaxed) };
+}
+
+std::string AnomalyTrigger::GetLastDumpPath() const {
+    std::lock_guard<std::mutex> lock(m_service_mutex);
+    return m_last_dump;
+}
+
+const char* AnomalyTrigger::GetName(AnomalyType type) {
+    if (type >= AnomalyType::Count) return "Unknown";
+    return kAnomalies[(size_t)type].name;
+}
+
+void AnomalyTrigger::Reset() {
+    std::lock_guard<std::mutex> lock(m_service_mutex);
+    for (Pending& p : m_pending) p.state = 0;
+    for (auto& c : m_counters) {
+        c.fired = 0;
+        c.suppressed = 0;
+        c.dropped = 0;
+        c.dumped = 0;
+        c.last_fire_ms = INT64_MIN;
+    }
+    m_accepted = 0;
+    m_dumps = 0;
+    m_last_dump.clear();
+}
+
+void AnomalyTrigger::ResetRateLimits() {
+    for (auto& c : m_counters) c.last_fire_ms = INT64_MIN;
+}
@@ -0,0 +1,113 @@
+#ifndef ANOMALYTRIGGER_H
+#define ANOMALYTRIGGER_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+
+// Anomaly Triggers (v0.7.112)
+// Conditions worth a closer look after the session (torque spikes, non-finite values,
+// sustained clipping, low sample rates, shared memory lock timeouts, stale telemetry)
+// fire a trigger from the FFB thread. Fire() only rate limits and marks the current
+// FlightRecorder position in a pre-allocated slot. A background thread waits until the
+// post-trigger window has been recorded, copies the PRE_SECONDS + POST_SECONDS around
+// the trigger out of the recorder and writes them as CSV to the anomalies directory.
+// Each type has its own minimum interval and a run writes at most MAX_DUMPS files,
+// so a bad session cannot flood the disk.
+enum class AnomalyType : uint8_t {
+    TorqueSpike = 0,    // value = |torque| [Nm]
+    NonFinite,          // value = 0 input torque, 1 output force
+    ClippingBurst,      // value = normalized force
+    LowRate,            // value = lowest unhealthy rate [Hz]
+    LockTimeout,        // value = timeouts since the last trigger check
+    StaleTelemetry,     // value = 0
+    Count
+};
+
+struct AnomalyStats {
+    const char* name;
+    uint64_t fired;       // Accepted and queued for a dump
+    uint64_t suppressed;  // Rejected by the rate limit or the MAX_DUMPS budget
+    uint64_t dropped;     // Rejected because every pending slot was taken
+    uint64_t dumped;      // Files written
+};
+
+class AnomalyTrigger {
+public:
+    static constexpr int PRE_SECONDS = 3;
+    static constexpr int POST_SECONDS = 1;
+    static constexpr int MAX_DUMPS = 20;          // Per run
+    static constexpr size_t MAX_PENDING = 8;
+    static constexpr int SERVICE_PERIOD_MS = 100;
+    static constexpr int CLIP_BURST_TICKS = 100;  // 250 ms of continuous clipping at 400 Hz
+
+    static AnomalyTrigger& Get();
+
+    // Real-time safe: no locks, no allocation, no I/O. Ignored until Start().
+    bool Fire(AnomalyType type, double value = 0.0);
+
+    // Arms the triggers; dumps go to `dir`. Without a background thread the caller
+    // runs Service() itself (tests).
+    void Start(const std::string& dir, bool background = true);
+    // Disarms, then writes whatever is still pending
+    void Stop();
+    bool IsArmed() const { return m_armed.load(std::memory_order_acquire); }
+
+    // Writes every pending trigger whose window is complete (all of them if `flush`).
+    // Returns the number of files written.
+    size_t Service(bool flush = false);
+
+    AnomalyStats GetStats(AnomalyType type) const;
+    uint64_t GetDumpCount() const { return m_dumps.load(std::memory_order_relaxed); }
+    // Triggers that claimed a slot this run (counts against MAX_DUMPS)
+    int GetAcceptedCount() const { return m_accepted.load(std::memory_order_relaxed); }
+    std::string GetLastDumpPath() const;
+
+    static const char* GetName(AnomalyType type);
+
+    // Clears pending triggers, counters and rate-limit history (tests)
+    void Reset();
+    // Clears only the per-type rate limits (tests)
+    void ResetRateLimits();
+
+private:
+    AnomalyTrigger() = default;
+    ~AnomalyTrigger();
+
+    struct Pending {
+        std::atomic<int> state{0};   // 0 free, 1 being written, 2 queued
+        AnomalyType type = AnomalyType::TorqueSpike;
+        double value = 0.0;
+        uint64_t trigger_seq = 0;    // FlightRecorder sequence at the trigger
+        int64_t fired_ms = 0;
+    };
+
+    struct Counters {
+        std::atomic<uint64_t> fired{0};
+        std::atomic<uint64_t> suppressed{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<uint64_t> dumped{0};
+        std::atomic<int64_t> last_fire_ms{INT64_MIN};
+    };
+
+    bool Dump(const Pending& p);
+    void ServiceLoop();
+
+    Pending m_pending[MAX_PENDING];
+    Counters m_counters[(size_t)AnomalyType::Count];
+    std::atomic<int> m_accepted{0};     // Slots claimed, checked against MAX_DUMPS
+    std::atomic<uint64_t> m_dumps{0};
+    std::atomic<bool> m_armed{false};
+
+    mutable std::mutex m_service_mutex;  // Guards m_dir and m_last_dump
+    std::string m_dir;
+    std::string m_last_dump;
+
+    std::atomic<bool> m_running{false};
+    std::thread m_worker;
+};
+
+#endif // ANOMALYTRIGGER_H
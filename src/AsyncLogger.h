@@ -14,75 +14,14 @@
 #include <algorithm> // For std::max
 #include <filesystem>
 
+#include "LogCodec.h"
+#include "LogFrame.h"
+#include "LogIndex.h"
+
 // Forward declaration
 struct TelemInfoV01;
 class FFBEngine;
 
-// Log frame structure - captures one physics tick
-struct LogFrame {
-    double timestamp;
-    double delta_time;
-    
-    // Driver Inputs
-    float steering;
-    float throttle;
-    float brake;
-    
-    // Vehicle State
-    float speed;             // m/s
-    float lat_accel;         // m/sÂ²
-    float long_accel;        // m/sÂ²
-    float yaw_rate;          // rad/s
-    
-    // Front Axle - Raw Telemetry
-    float slip_angle_fl;
-    float slip_angle_fr;
-    float slip_ratio_fl;
-    float slip_ratio_fr;
-    float grip_fl;
-    float grip_fr;
-    float load_fl;
-    float load_fr;
-    
-    // Front Axle - Calculated
-    float calc_slip_angle_front;
-    float calc_grip_front;
-    
-    // Slope Detection Specific
-    float dG_dt;             // Derivative of lateral G
-    float dAlpha_dt;         // Derivative of slip angle
-    float slope_current;     // dG/dAlpha ratio
-    float slope_raw_unclamped; // NEW v0.7.38
-    float slope_numerator;     // NEW v0.7.38
-    float slope_denominator;   // NEW v0.7.38
-    float hold_timer;          // NEW v0.7.38
-    float input_slip_smoothed; // NEW v0.7.38
-    float slope_smoothed;    // Smoothed grip output
-    float confidence;        // Confidence factor (v0.7.3)
-    float surface_type_fl;   // NEW v0.7.39
-    float surface_type_fr;   // NEW v0.7.39
-    float slope_torque;      // NEW v0.7.40
-    float slew_limited_g;    // NEW v0.7.40
-    
-    // Rear Axle
-    float calc_grip_rear;
-    float grip_delta;        // Front - Rear
-    
-    // FFB Output
-    float ffb_total;         // Normalized output
-    float ffb_base;          // Base steering shaft force
-    float ffb_shaft_torque;  // NEW v0.7.62 (Issue #138)
-    float ffb_gen_torque;    // NEW v0.7.62 (Issue #138)
-    float ffb_sop;           // Seat of Pants force
-    float ffb_grip_factor;   // Applied grip modulation
-    float speed_gate;        // Speed gate factor
-    float load_peak_ref;     // NEW: Dynamic normalization reference
-    bool clipping;           // Output clipping flag
-    
-    // User Markers
-    bool marker;             // User-triggered marker
-};
-
 // Session metadata for header
 struct SessionInfo {
     std::string driver_name;
@@ -110,7 +49,8 @@ public:
     }
 
     // Start logging - called from GUI
-    void Start(const SessionInfo& info, const std::string& base_path = "") {
+    // compress: write a .lmz (LogCodec) instead of a .csv (v0.7.112)
+    void Start(const SessionInfo& info, const std::string& base_path = "", bool compress = false) {
         std::lock_guard<std::mutex> lock(m_mutex);
         if (m_running) return;
 
@@ -119,6 +59,11 @@ public:
         m_frame_count = 0;
         m_pending_marker = false;
         m_decimation_counter = 0;
+        m_file_size_bytes = 0;
+        m_index.Clear();
+        m_index_chunks_written = 0;
+        m_index_marks_written = 0;
+        m_compress = compress;
 
         // Generate filename
         auto now = std::chrono::system_clock::now();
@@ -153,12 +98,16 @@ public:
             }
         }
 
-        m_filename = path_prefix + "lmuffb_log_" + timestamp_str + "_" + car + "_" + track + ".csv";
+        m_filename = path_prefix + "lmuffb_log_" + timestamp_str + "_" + car + "_" + track + (compress ? ".lmz" : ".csv");
 
-        // Open file
-        m_file.open(m_filename);
+        // Open file (binary: index offsets count exactly the bytes written)
+        m_file.open(m_filename, std::ios::binary);
         if (m_file.is_open()) {
             WriteHeader(info);
+            m_index_file.open(LogIndex::PathFor(m_filename), std::ios::binary);
+            if (m_index_file.is_open()) {
+                LogIndex::WriteHeader(m_index_file, std::filesystem::path(m_filename).filename().string(), m_index.GetChunkFrames());
+            }
             m_running = true;
             m_worker = std::thread(&AsyncLogger::WorkerThread, this);
         }
@@ -176,9 +125,19 @@ public:
             if (m_worker.joinable()) {
                 m_worker.join();
             }
+            // The worker may have left on !m_running while rows were queued during its
+            // last write: with it gone, write them here
+            if (m_file.is_open() && !m_buffer_active.empty()) WriteBatch(m_buffer_active);
             if (m_file.is_open()) {
+                FlushBlock();
                 m_file.close();
             }
+            if (m_index_file.is_open()) {
+                m_index.Finish(m_file_size_bytes);
+                m_index.WriteRecords(m_index_file, m_index_chunks_written, m_index_marks_written);
+                m_index.WriteEnd(m_index_file);
+                m_index_file.close();
+            }
             m_buffer_active.clear();
             m_buffer_writing.clear();
         } catch (...) {
@@ -224,8 +183,41 @@ public:
     bool IsLogging() const { return m_running; }
     size_t GetFrameCount() const { return m_frame_count; }
     std::string GetFilename() const { return m_filename; }
+    std::string GetIndexFilename() const { return LogIndex::PathFor(m_filename); }
     size_t GetFileSizeBytes() const { return m_file_size_bytes; }
 
+    // One CSV row; also used by LogCodec to turn compressed logs back into CSV
+    static void FormatRow(std::ostream& out, const LogFrame& frame) {
+        out << std::fixed << std::setprecision(4)
+            << frame.timestamp << "," << frame.delta_time << "," 
+            << frame.speed << "," << frame.lat_accel << "," << frame.long_accel << "," << frame.yaw_rate << ","
+            << frame.steering << "," << frame.throttle << "," << frame.brake << ","
+               
+            << frame.slip_angle_fl << "," << frame.slip_angle_fr << "," 
+            << frame.slip_ratio_fl << "," << frame.slip_ratio_fr << ","
+            << frame.grip_fl << "," << frame.grip_fr << ","
+            << frame.load_fl << "," << frame.load_fr << ","
+            << frame.slip_angle_rl << "," << frame.slip_angle_rr << ","
+            << frame.slip_ratio_rl << "," << frame.slip_ratio_rr << ","
+            << frame.grip_rl << "," << frame.grip_rr << ","
+            << frame.load_rl << "," << frame.load_rr << ","
+            << frame.calc_load[0] << "," << frame.calc_load[1] << "," << frame.calc_load[2] << "," << frame.calc_load[3] << ","
+            << frame.calc_grip[0] << "," << frame.calc_grip[1] << "," << frame.calc_grip[2] << "," << frame.calc_grip[3] << ","
+               
+            << frame.calc_slip_angle_front << "," << frame.calc_grip_front << "," << frame.calc_grip_rear << "," << frame.grip_delta << ","
+               
+            << frame.dG_dt << "," << frame.dAlpha_dt << "," << frame.slope_current << ","
+            << frame.slope_raw_unclamped << "," << frame.slope_numerator << "," << frame.slope_denominator << ","
+            << frame.hold_timer << "," << frame.input_slip_smoothed << ","
+            << frame.slope_smoothed << "," << frame.confidence << ","
+            << frame.surface_type_fl << "," << frame.surface_type_fr << ","
+            << frame.slope_torque << "," << frame.slew_limited_g << ","
+               
+            << frame.ffb_total << "," << frame.ffb_base << "," << frame.ffb_shaft_torque << "," << frame.ffb_gen_torque << "," << frame.ffb_sop << ","
+            << frame.ffb_grip_factor << "," << frame.speed_gate << "," << frame.load_peak_ref << ","
+            << (frame.clipping ? 1 : 0) << "," << (frame.marker ? 1 : 0) << "\n";
+    }
+
 private:
     AsyncLogger() : m_running(false), m_pending_marker(false), m_frame_count(0), m_decimation_counter(0), 
                     m_file_size_bytes(0), m_last_flush_time(std::chrono::steady_clock::now()) {}
@@ -252,17 +244,14 @@ private:
             
             lock.unlock();
             
-            // Write buffer to disk
-            for (const auto& frame : m_buffer_writing) {
-                WriteFrame(frame);
-            }
-            m_buffer_writing.clear();
+            WriteBatch(m_buffer_writing);
             
             // Periodic flush to minimize data loss on crash
             auto now = std::chrono::steady_clock::now();
             auto elapsed = std::chrono::duration_cast<std::chrono::seconds>(now - m_last_flush_time).count();
             if (elapsed >= FLUSH_INTERVAL_SECONDS) {
                 m_file.flush();
+                m_index_file.flush();
                 m_last_flush_time = now;
             }
             
@@ -270,64 +259,85 @@ private:
         }
     }
 
+    // Writes a batch to disk, indexing each row at the offset it starts at
+    // (compressed: the offset of the block that will hold it)
+    void WriteBatch(std::vector<LogFrame>& batch) {
+        for (const auto& frame : batch) {
+            if (m_compress) {
+                if (m_block.GetCount() >= (size_t)LogCodec::BLOCK_FRAMES) FlushBlock();
+                m_index.AddFrame(frame, m_file_size_bytes);
+                m_block.Add(frame);
+            } else {
+                m_index.AddFrame(frame, m_file_size_bytes);
+                WriteFrame(frame);
+            }
+        }
+        batch.clear();
+        if (m_index_file.is_open()) {
+            m_index.WriteRecords(m_index_file, m_index_chunks_written, m_index_marks_written);
+        }
+    }
+
     void WriteHeader(const SessionInfo& info) {
-        m_file << "# LMUFFB Telemetry Log v1.0\n";
-        m_file << "# App Version: " << info.app_version << "\n";
-        m_file << "# ========================\n";
-        m_file << "# Session Info\n";
-        m_file << "# ========================\n";
-        m_file << "# Driver: " << info.driver_name << "\n";
-        m_file << "# Vehicle: " << info.vehicle_name << "\n";
-        m_file << "# Track: " << info.track_name << "\n";
-        m_file << "# ========================\n";
-        m_file << "# FFB Settings\n";
-        m_file << "# ========================\n";
-        m_file << "# Gain: " << info.gain << "\n";
-        m_file << "# Understeer Effect: " << info.understeer_effect << "\n";
-        m_file << "# SoP Effect: " << info.sop_effect << "\n";
-        m_file << "# Slope Detection: " << (info.slope_enabled ? "Enabled" : "Disabled") << "\n";
-        m_file << "# Slope Sensitivity: " << info.slope_sensitivity << "\n";
-        m_file << "# Slope Threshold: " << info.slope_threshold << "\n";
-        m_file << "# Slope Alpha Threshold: " << info.slope_alpha_threshold << "\n";
-        m_file << "# Slope Decay Rate: " << info.slope_decay_rate << "\n";
-        m_file << "# Torque Passthrough: " << (info.torque_passthrough ? "Enabled" : "Disabled") << "\n";
-        m_file << "# ========================\n";
+        std::ostringstream out;
+        out << "# LMUFFB Telemetry Log v1.0\n";
+        out << "# App Version: " << info.app_version << "\n";
+        out << "# ========================\n";
+        out << "# Session Info\n";
+        out << "# ========================\n";
+        out << "# Driver: " << info.driver_name << "\n";
+        out << "# Vehicle: " << info.vehicle_name << "\n";
+        out << "# Track: " << info.track_name << "\n";
+        out << "# ========================\n";
+        out << "# FFB Settings\n";
+        out << "# ========================\n";
+        out << "# Gain: " << info.gain << "\n";
+        out << "# Understeer Effect: " << info.understeer_effect << "\n";
+        out << "# SoP Effect: " << info.sop_effect << "\n";
+        out << "# Slope Detection: " << (info.slope_enabled ? "Enabled" : "Disabled") << "\n";
+        out << "# Slope Sensitivity: " << info.slope_sensitivity << "\n";
+        out << "# Slope Threshold: " << info.slope_threshold << "\n";
+        out << "# Slope Alpha Threshold: " << info.slope_alpha_threshold << "\n";
+        out << "# Slope Decay Rate: " << info.slope_decay_rate << "\n";
+        out << "# Torque Passthrough: " << (info.torque_passthrough ? "Enabled" : "Disabled") << "\n";
+        out << "# ========================\n";
         
         // CSV Header
-        m_file << "Time,DeltaTime,Speed,LatAccel,LongAccel,YawRate,Steering,Throttle,Brake,"
-               << "SlipAngleFL,SlipAngleFR,SlipRatioFL,SlipRatioFR,GripFL,GripFR,LoadFL,LoadFR,"
-               << "CalcSlipAngle,CalcGripFront,CalcGripRear,GripDelta,"
-               << "dG_dt,dAlpha_dt,SlopeCurrent,SlopeRaw,SlopeNum,SlopeDenom,HoldTimer,InputSlipSmooth,SlopeSmoothed,Confidence,"
-               << "SurfaceFL,SurfaceFR,SlopeTorque,SlewLimitedG,"
-               << "FFBTotal,FFBBase,FFBShaftTorque,FFBGenTorque,FFBSoP,GripFactor,SpeedGate,LoadPeakRef,Clipping,Marker\n";
+        out << "Time,DeltaTime,Speed,LatAccel,LongAccel,YawRate,Steering,Throttle,Brake,"
+            << "SlipAngleFL,SlipAngleFR,SlipRatioFL,SlipRatioFR,GripFL,GripFR,LoadFL,LoadFR,"
+            << "SlipAngleRL,SlipAngleRR,SlipRatioRL,SlipRatioRR,GripRL,GripRR,LoadRL,LoadRR,"
+            << "CalcLoadFL,CalcLoadFR,CalcLoadRL,CalcLoadRR,CalcGripFL,CalcGripFR,CalcGripRL,CalcGripRR,"
+            << "CalcSlipAngle,CalcGripFront,CalcGripRear,GripDelta,"
+            << "dG_dt,dAlpha_dt,SlopeCurrent,SlopeRaw,SlopeNum,SlopeDenom,HoldTimer,InputSlipSmooth,SlopeSmoothed,Confidence,"
+            << "SurfaceFL,SurfaceFR,SlopeTorque,SlewLimitedG,"
+            << "FFBTotal,FFBBase,FFBShaftTorque,FFBGenTorque,FFBSoP,GripFactor,SpeedGate,LoadPeakRef,Clipping,Marker\n";
+        if (m_compress) {
+            std::string file_header;
+            LogCodec::AppendFileHeader(file_header, out.str());
+            WriteText(file_header);
+        } else {
+            WriteText(out.str());
+        }
     }
 
     void WriteFrame(const LogFrame& frame) {
-        m_file << std::fixed << std::setprecision(4)
-               << frame.timestamp << "," << frame.delta_time << "," 
-               << frame.speed << "," << frame.lat_accel << "," << frame.long_accel << "," << frame.yaw_rate << ","
-               << frame.steering << "," << frame.throttle << "," << frame.brake << ","
-               
-               << frame.slip_angle_fl << "," << frame.slip_angle_fr << "," 
-               << frame.slip_ratio_fl << "," << frame.slip_ratio_fr << ","
-               << frame.grip_fl << "," << frame.grip_fr << ","
-               << frame.load_fl << "," << frame.load_fr << ","
-               
-               << frame.calc_slip_angle_front << "," << frame.calc_grip_front << "," << frame.calc_grip_rear << "," << frame.grip_delta << ","
-               
-               << frame.dG_dt << "," << frame.dAlpha_dt << "," << frame.slope_current << ","
-               << frame.slope_raw_unclamped << "," << frame.slope_numerator << "," << frame.slope_denominator << ","
-               << frame.hold_timer << "," << frame.input_slip_smoothed << ","
-               << frame.slope_smoothed << "," << frame.confidence << ","
-               << frame.surface_type_fl << "," << frame.surface_type_fr << ","
-               << frame.slope_torque << "," << frame.slew_limited_g << ","
-               
-               << frame.ffb_total << "," << frame.ffb_base << "," << frame.ffb_shaft_torque << "," << frame.ffb_gen_torque << "," << frame.ffb_sop << ","
-               << frame.ffb_grip_factor << "," << frame.speed_gate << "," << frame.load_peak_ref << ","
-               << (frame.clipping ? 1 : 0) << "," << (frame.marker ? 1 : 0) << "\n";
-        
-        // Track file size for monitoring
-        m_file_size_bytes += 200; // Approximate bytes per line
+        m_row.str("");
+        FormatRow(m_row, frame);
+        WriteText(m_row.str());
+    }
+
+    // Compresses the rows buffered so far into one block (worker thread, or Stop after the join)
+    void FlushBlock() {
+        if (!m_compress || m_block.GetCount() == 0) return;
+        m_block_bytes.clear();
+        m_block.Encode(m_block_bytes);
+        WriteText(m_block_bytes);
+    }
+
+    // Exact byte count: the log index stores offsets into the file
+    void WriteText(const std::string& text) {
+        m_file.write(text.data(), (std::streamsize)text.size());
+        m_file_size_bytes += text.size();
     }
 
     std::string SanitizeFilename(const std::string& input) {
@@ -347,6 +357,14 @@ private:
     }
     
     std::ofstream m_file;
+    std::ostringstream m_row;     // Reused row buffer (worker thread)
+    LogIndex m_index;             // Sidecar seek index (v0.7.112), fed by the worker
+    std::ofstream m_index_file;
+    size_t m_index_chunks_written = 0;
+    size_t m_index_marks_written = 0;
+    bool m_compress = false;
+    LogCodec::BlockEncoder m_block; // Rows waiting for the next compressed block
+    std::string m_block_bytes;
     std::string m_filename;
     std::thread m_worker;
     
@@ -0,0 +1,71 @@
+#include "ChassisStateEstimator.h"
+#include "lmu_sm_interface/InternalsPluginWrapper.h"
+#include <cmath>
+
+using ffb_math::Matrix;
+
+namespace {
+
+// Constant-derivative chain [value, derivative] driven by white noise of intensity q
+void SetChain(Matrix<6, 6>& F, Matrix<6, 6>& Q, int i, double dt, double q) {
+    F(i, i + 1) = dt;
+    double dt2 = dt * dt;
+    Q(i, i) = q * dt2 * dt / 3.0;
+    Q(i, i + 1) = Q(i + 1, i) = q * dt2 / 2.0;
+    Q(i + 1, i + 1) = q * dt;
+}
+
+} // namespace
+
+void ChassisStateEstimator::Update(const TelemInfoV01* data, double dt) {
+    if (!data) return;
+    Update(data->mLocalVel.z, data->mLocalAccel.z, data->mLocalAccel.x,
+           data->mLocalRot.y, data->mLocalRotAccel.y, dt);
+}
+
+void ChassisStateEstimator::Update(double long_vel, double long_accel, double lat_accel,
+                                   double yaw_rate, double yaw_accel, double dt) {
+    Matrix<MEASUREMENTS, 1> z;
+    z(0, 0) = long_vel;
+    z(1, 0) = long_accel;
+    z(2, 0) = lat_accel;
+    z(3, 0) = yaw_rate;
+    z(4, 0) = yaw_accel;
+    for (int i = 0; i < MEASUREMENTS; ++i) {
+        if (!std::isfinite(z(i, 0))) return;
+    }
+
+    // Each measurement observes one state; lateral jerk is hidden
+    Matrix<MEASUREMENTS, STATES> H;
+    H(0, LongVel) = 1.0;
+    H(1, LongAccel) = 1.0;
+    H(2, LatAccel) = 1.0;
+    H(3, YawRate) = 1.0;
+    H(4, YawAccel) = 1.0;
+
+    Matrix<MEASUREMENTS, MEASUREMENTS> R;
+    R(0, 0) = R_LONG_VEL * R_LONG_VEL;
+    R(1, 1) = R_LONG_ACCEL * R_LONG_ACCEL;
+    R(2, 2) = R_LAT_ACCEL * R_LAT_ACCEL;
+    R(3, 3) = R_YAW_RATE * R_YAW_RATE;
+    R(4, 4) = R_YAW_ACCEL * R_YAW_ACCEL;
+
+    if (!m_initialized || dt <= 0.0 || dt > MAX_DT) {
+        // (Re)start from the measurements, trusting them as much as their noise allows
+        Matrix<STATES, 1> x0 = H.Transposed() * z;
+        Matrix<STATES, STATES> P0 = H.Transposed() * R * H;
+        P0(LatJerk, LatJerk) = 100.0;
+        m_kf.Reset(x0, P0);
+        m_initialized = true;
+        return;
+    }
+
+    Matrix<STATES, STATES> F = Matrix<STATES, STATES>::Identity();
+    Matrix<STATES, STATES> Q;
+    SetChain(F, Q, LongVel, dt, Q_LONG_JERK);
+    SetChain(F, Q, LatAccel, dt, Q_LAT_SNAP);
+    SetChain(F, Q, YawRate, dt, Q_YAW_JERK);
+
+    m_kf.Predict(F, Q);
+    m_kf.Update(z, H, R);
+}
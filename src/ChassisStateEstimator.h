@@ -0,0 +1,68 @@
+#ifndef CHASSISSTATEESTIMATOR_H
+#define CHASSISSTATEESTIMATOR_H
+
+#include "MathUtils.h"
+
+struct TelemInfoV01;
+
+// Chassis State Estimator (v0.7.112)
+// Small linear Kalman filter over the chassis state, replacing the cascaded one-pole
+// smoothers on lateral G (SoP), yaw acceleration (Yaw Kick) and the accelerations
+// behind the kinematic load model.
+//
+// State (LMU local frame, +X left, +Z rear):
+//   0 long_vel   mLocalVel.z          1 long_accel  mLocalAccel.z
+//   2 lat_accel  mLocalAccel.x        3 lat_jerk    (not measured)
+//   4 yaw_rate   mLocalRot.y          5 yaw_accel   mLocalRotAccel.y
+// Three decoupled constant-derivative chains: velocity/accel, accel/jerk, rate/accel.
+// The yaw chain is where fusion pays off most: the clean yaw rate constrains the
+// noisy yaw acceleration channel, so the estimate needs little smoothing and no lag.
+// Load transfer is derived from the fused accelerations.
+//
+// Fixed 6x5 system, constant time per Update, no allocation.
+class ChassisStateEstimator {
+public:
+    static constexpr int STATES = 6;
+    static constexpr int MEASUREMENTS = 5;
+
+    enum State { LongVel = 0, LongAccel, LatAccel, LatJerk, YawRate, YawAccel };
+
+    // Process noise (white noise intensity on the highest derivative of each chain)
+    static constexpr double Q_LONG_JERK = 400.0;     // (m/s^3)^2 / Hz
+    static constexpr double Q_LAT_SNAP = 40000.0;    // (m/s^4)^2 / Hz
+    static constexpr double Q_YAW_JERK = 25.0;       // (rad/s^3)^2 / Hz
+    // Measurement noise (standard deviation)
+    static constexpr double R_LONG_VEL = 0.02;       // m/s
+    static constexpr double R_LONG_ACCEL = 2.0;      // m/s^2 (kerbs, engine vibration)
+    static constexpr double R_LAT_ACCEL = 1.5;       // m/s^2
+    static constexpr double R_YAW_RATE = 0.002;      // rad/s
+    static constexpr double R_YAW_ACCEL = 1.0;       // rad/s^2
+
+    static constexpr double MAX_DT = 0.1;            // Longer gaps restart the filter
+
+    ChassisStateEstimator() { Reset(); }
+
+    void Reset() { m_initialized = false; }
+    bool IsInitialized() const { return m_initialized; }
+
+    void Update(const TelemInfoV01* data, double dt);
+    // Same step from raw channel values (tests, replay)
+    void Update(double long_vel, double long_accel, double lat_accel,
+                double yaw_rate, double yaw_accel, double dt);
+
+    double GetLongVel() const { return m_kf.x(LongVel, 0); }
+    double GetLongAccel() const { return m_kf.x(LongAccel, 0); }
+    double GetLatAccel() const { return m_kf.x(LatAccel, 0); }
+    double GetYawRate() const { return m_kf.x(YawRate, 0); }
+    double GetYawAccel() const { return m_kf.x(YawAccel, 0); }
+
+    // Load transfer in g (same scaling the kinematic load model applies)
+    double GetLongTransferG() const { return GetLongAccel() / 9.81; }
+    double GetLatTransferG() const { return GetLatAccel() / 9.81; }
+
+private:
+    ffb_math::KalmanFilter<STATES, MEASUREMENTS> m_kf;
+    bool m_initialized = false;
+};
+
+#endif // CHASSISSTATEESTIMATOR_H
@@ -1,10 +1,17 @@
 #include "Config.h"
 #include "Version.h"
+#include "VehicleProfileStore.h"
 #include <fstream>
 #include <sstream>
 #include <iostream>
 #include <algorithm>
 #include <mutex>
+#include <string_view>
+#include <chrono>
+#include <condition_variable>
+#include <cstdio>
+#include <filesystem>
+#include <thread>
 
 extern std::recursive_mutex g_engine_mutex;
 
@@ -14,6 +21,10 @@ std::string Config::m_last_preset_name = "Default";
 std::string Config::m_config_path = "config.ini";
 bool Config::m_auto_start_logging = false;
 std::string Config::m_log_path = "logs/";
+bool Config::m_log_compress = false;
+bool Config::m_flight_recorder = true;
+int Config::m_flight_recorder_seconds = 30;
+bool Config::m_anomaly_dumps = true;
 
 // Window Geometry Defaults (v0.5.5)
 int Config::win_pos_x = 100;
@@ -23,9 +34,8 @@ int Config::win_h_small = 800;
 int Config::win_w_large = 1400;  // Wide (Config + Graphs)
 int Config::win_h_large = 800;
 bool Config::show_graphs = false;
+std::string Config::plot_panels = "";
 
-std::map<std::string, double> Config::m_saved_static_loads;
-std::recursive_mutex Config::m_static_loads_mutex;
 std::atomic<bool> Config::m_needs_save{ false };
 
 std::vector<Preset> Config::presets;
@@ -57,126 +67,243 @@ static bool IsVersionLessEqual(const std::string& v1, const std::string& v2) {
     return true;
 }
 
-void Config::ParsePresetLine(const std::string& line, Preset& current_preset, std::string& current_preset_version, bool& needs_save, bool& legacy_torque_hack, float& legacy_torque_val) {
-    std::istringstream is_line(line);
-    std::string key;
-    if (std::getline(is_line, key, '=')) {
-        std::string value;
-        if (std::getline(is_line, value)) {
-            try {
-                // Map keys to struct members
-                if (key == "app_version") current_preset_version = value;
-                else if (key == "gain") current_preset.gain = std::stof(value);
-                else if (key == "understeer") {
-                    float val = std::stof(value);
-                    if (val > 2.0f) {
-                        float old_val = val;
-                        val = val / 100.0f; // Migrating 0-200 range to 0-2
-                        std::cout << "[Preset] Migrated legacy understeer: " << old_val
-                                    << " -> " << val << std::endl;
-                        needs_save = true;
-                    }
-                    current_preset.understeer = (std::min)(2.0f, (std::max)(0.0f, val));
+// --- INI Parsing (v0.7.112) ---
+// Config files are read into memory once and scanned with string_views. Keys are
+// resolved through the FieldRegistry's sorted index and values converted with
+// std::from_chars, so parsing neither allocates per line nor throws.
+namespace {
+
+using FieldRegistry::ParseNumber;
+using FieldRegistry::ParseBool;
+
+std::string_view TrimView(std::string_view s) {
+    size_t start = s.find_first_not_of(" \t\r\n");
+    if (start == std::string_view::npos) return std::string_view();
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(start, end - start + 1);
+}
+
+bool ReadFileText(const std::string& path, std::string& out) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+    file.seekg(0, std::ios::end);
+    std::streamoff size = file.tellg();
+    file.seekg(0, std::ios::beg);
+    out.assign(size > 0 ? (size_t)size : 0, '\0');
+    if (!out.empty()) file.read(&out[0], (std::streamsize)out.size());
+    return true;
+}
+
+// Yields trimmed lines, skipping blank lines and ';' comments.
+class IniLineReader {
+public:
+    explicit IniLineReader(std::string_view text) : m_rest(text) {}
+
+    bool Next(std::string_view& line) {
+        while (!m_rest.empty()) {
+            size_t nl = m_rest.find('\n');
+            line = TrimView(m_rest.substr(0, nl));
+            m_rest = (nl == std::string_view::npos) ? std::string_view() : m_rest.substr(nl + 1);
+            if (!line.empty() && line[0] != ';') return true;
+        }
+        return false;
+    }
+
+private:
+    std::string_view m_rest;
+};
+
+bool SplitKeyValue(std::string_view line, std::string_view& key, std::string_view& value) {
+    size_t eq = line.find('=');
+    if (eq == std::string_view::npos) return false;
+    key = TrimView(line.substr(0, eq));
+    value = TrimView(line.substr(eq + 1));
+    return !key.empty() && !value.empty();
+}
+
+} // namespace
+
+// --- Background Saving (v0.7.112) ---
+// Settings are serialized under g_engine_mutex (microseconds) and written to disk
+// without it, so a slow disk or AV scanner can no longer stall the FFB thread.
+namespace {
+
+// Writes <path>.tmp and renames it over the target: a crash or full disk mid-write
+// leaves the previous config intact instead of a truncated one.
+bool WriteFileAtomic(const std::string& path, const std::string& text) {
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::trunc);
+        if (!file.is_open()) return false;
+        file.write(text.data(), (std::streamsize)text.size());
+        file.flush();
+        if (!file) {
+            file.close();
+            std::remove(tmp_path.c_str());
+            return false;
+        }
+    }
+    std::error_code ec;
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    return true;
+}
+
+// Keeps the latest snapshot per path. Requests inside the debounce window are
+// coalesced into one write; a continuous stream of requests is still flushed
+// at least every SAVE_MAX_DELAY_MS.
+class ConfigSaveWorker {
+public:
+    static ConfigSaveWorker& Get() {
+        static ConfigSaveWorker instance;
+        return instance;
+    }
+
+    ~ConfigSaveWorker() { Flush(); }
+
+    void Enqueue(const std::string& path, std::string text) {
+        auto now = std::chrono::steady_clock::now();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_pending.find(path);
+        if (it == m_pending.end()) {
+            it = m_pending.emplace(path, Pending{}).first;
+            it->second.first_request = now;
+        }
+        it->second.text = std::move(text);
+        it->second.due = (std::min)(now + std::chrono::milliseconds(Config::SAVE_DEBOUNCE_MS),
+                                    it->second.first_request + std::chrono::milliseconds(Config::SAVE_MAX_DELAY_MS));
+        if (!m_thread.joinable()) m_thread = std::thread(&ConfigSaveWorker::Run, this);
+        m_cv.notify_one();
+    }
+
+    // Synchronous write that supersedes any queued snapshot for the same path.
+    // m_write_mutex is taken while m_mutex is held (same order as Run) so writes
+    // reach the disk in request order.
+    bool WriteNow(const std::string& path, const std::string& text) {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_pending.erase(path);
+        std::lock_guard<std::mutex> write_lock(m_write_mutex);
+        lock.unlock();
+        return WriteFileAtomic(path, text);
+    }
+
+    // Writes everything still queued and stops the thread (restarted on demand).
+    void Flush() {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (!m_thread.joinable()) return;
+            m_stop = true;
+        }
+        m_cv.notify_one();
+        m_thread.join();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = false;
+    }
+
+private:
+    struct Pending {
+        std::string text;
+        std::chrono::steady_clock::time_point first_request;
+        std::chrono::steady_clock::time_point due;
+    };
+
+    void Run() {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for (;;) {
+            if (m_pending.empty()) {
+                if (m_stop) return;
+                m_cv.wait(lock);
+                continue;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            auto next_due = std::chrono::steady_clock::time_point::max();
+            std::vector<std::pair<std::string, std::string>> batch;
+            for (auto it = m_pending.begin(); it != m_pending.end();) {
+                if (m_stop || it->second.due <= now) {
+                    batch.emplace_back(it->first, std::move(it->second.text));
+                    it = m_pending.erase(it);
+                } else {
+                    next_due = (std::min)(next_due, it->second.due);
+                    ++it;
                 }
-                else if (key == "sop") current_preset.sop = (std::min)(2.0f, std::stof(value));
-                else if (key == "sop_scale") current_preset.sop_scale = std::stof(value);
-                else if (key == "sop_smoothing_factor") current_preset.sop_smoothing = std::stof(value);
-                else if (key == "min_force") current_preset.min_force = std::stof(value);
-                else if (key == "oversteer_boost") current_preset.oversteer_boost = std::stof(value);
-                else if (key == "dynamic_weight_gain") current_preset.dynamic_weight_gain = std::stof(value);
-                else if (key == "dynamic_weight_smoothing") current_preset.dynamic_weight_smoothing = std::stof(value);
-                else if (key == "grip_smoothing_steady") current_preset.grip_smoothing_steady = std::stof(value);
-                else if (key == "grip_smoothing_fast") current_preset.grip_smoothing_fast = std::stof(value);
-                else if (key == "grip_smoothing_sensitivity") current_preset.grip_smoothing_sensitivity = std::stof(value);
-                else if (key == "lockup_enabled") current_preset.lockup_enabled = std::stoi(value);
-                else if (key == "lockup_gain") current_preset.lockup_gain = (std::min)(3.0f, std::stof(value));
-                else if (key == "lockup_start_pct") current_preset.lockup_start_pct = std::stof(value);
-                else if (key == "lockup_full_pct") current_preset.lockup_full_pct = std::stof(value);
-                else if (key == "lockup_rear_boost") current_preset.lockup_rear_boost = std::stof(value);
-                else if (key == "lockup_gamma") current_preset.lockup_gamma = std::stof(value);
-                else if (key == "lockup_prediction_sens") current_preset.lockup_prediction_sens = std::stof(value);
-                else if (key == "lockup_bump_reject") current_preset.lockup_bump_reject = std::stof(value);
-                else if (key == "brake_load_cap") current_preset.brake_load_cap = (std::min)(10.0f, std::stof(value));
-                else if (key == "texture_load_cap" || key == "max_load_factor") current_preset.texture_load_cap = std::stof(value); // Includes Legacy Backward Compatibility
-                else if (key == "abs_pulse_enabled") current_preset.abs_pulse_enabled = std::stoi(value);
-                else if (key == "abs_gain") current_preset.abs_gain = std::stof(value);
-                else if (key == "spin_enabled") current_preset.spin_enabled = std::stoi(value);
-                else if (key == "spin_gain") current_preset.spin_gain = (std::min)(2.0f, std::stof(value));
-                else if (key == "slide_enabled") current_preset.slide_enabled = std::stoi(value);
-                else if (key == "slide_gain") current_preset.slide_gain = (std::min)(2.0f, std::stof(value));
-                else if (key == "slide_freq") current_preset.slide_freq = std::stof(value);
-                else if (key == "road_enabled") current_preset.road_enabled = std::stoi(value);
-                else if (key == "road_gain") current_preset.road_gain = (std::min)(2.0f, std::stof(value));
-                else if (key == "tactile_gain") current_preset.tactile_gain = (std::min)(2.0f, std::stof(value));
-                else if (key == "dynamic_normalization_enabled") current_preset.dynamic_normalization_enabled = (value == "1" || value == "true");
-                else if (key == "auto_load_normalization_enabled") current_preset.auto_load_normalization_enabled = (value == "1" || value == "true");
-                else if (key == "soft_lock_enabled") current_preset.soft_lock_enabled = std::stoi(value);
-                else if (key == "soft_lock_stiffness") current_preset.soft_lock_stiffness = std::stof(value);
-                else if (key == "soft_lock_damping") current_preset.soft_lock_damping = std::stof(value);
-                else if (key == "wheelbase_max_nm") current_preset.wheelbase_max_nm = std::stof(value);
-                else if (key == "target_rim_nm") current_preset.target_rim_nm = std::stof(value);
-                else if (key == "max_torque_ref") {
-                    // MIGRATION LOGIC (Issue #153 & #211)
-                    float old_val = std::stof(value);
-                    if (old_val > 40.0f) {
-                        // Likely the 100Nm clipping hack. Reset to safe DD defaults.
-                        current_preset.wheelbase_max_nm = 15.0f;
-                        current_preset.target_rim_nm = 10.0f;
-                        legacy_torque_hack = true;
-                        legacy_torque_val = old_val;
-                    } else {
-                        // User actually tuned it to their wheelbase (e.g. 20Nm or 4Nm)
-                        current_preset.wheelbase_max_nm = old_val;
-                        current_preset.target_rim_nm = old_val;
-                    }
-                    needs_save = true;
+            }
+
+            if (batch.empty()) {
+                m_cv.wait_until(lock, next_due);
+                continue;
+            }
+
+            std::unique_lock<std::mutex> write_lock(m_write_mutex);
+            lock.unlock();
+            for (const auto& item : batch) {
+                if (!WriteFileAtomic(item.first, item.second)) {
+                    std::cerr << "[Config] Failed to save to " << item.first << std::endl;
                 }
-                else if (key == "abs_freq") current_preset.abs_freq = std::stof(value);
-                else if (key == "lockup_freq_scale") current_preset.lockup_freq_scale = std::stof(value);
-                else if (key == "spin_freq_scale") current_preset.spin_freq_scale = std::stof(value);
-                else if (key == "bottoming_method") current_preset.bottoming_method = std::stoi(value);
-                else if (key == "scrub_drag_gain") current_preset.scrub_drag_gain = (std::min)(1.0f, std::stof(value));
-                else if (key == "rear_align_effect") current_preset.rear_align_effect = (std::min)(2.0f, std::stof(value));
-                else if (key == "sop_yaw_gain") current_preset.sop_yaw_gain = (std::min)(2.0f, std::stof(value));
-                else if (key == "steering_shaft_gain") current_preset.steering_shaft_gain = std::stof(value);
-                else if (key == "ingame_ffb_gain") current_preset.ingame_ffb_gain = std::stof(value);
-                else if (key == "slip_angle_smoothing") current_preset.slip_smoothing = std::stof(value);
-                else if (key == "torque_source") current_preset.torque_source = std::stoi(value);
-                else if (key == "torque_passthrough") current_preset.torque_passthrough = (value == "1" || value == "true");
-                else if (key == "gyro_gain") current_preset.gyro_gain = (std::min)(1.0f, std::stof(value));
-                else if (key == "flatspot_suppression") current_preset.flatspot_suppression = std::stoi(value);
-                else if (key == "notch_q") current_preset.notch_q = std::stof(value);
-                else if (key == "flatspot_strength") current_preset.flatspot_strength = std::stof(value);
-                else if (key == "static_notch_enabled") current_preset.static_notch_enabled = std::stoi(value);
-                else if (key == "static_notch_freq") current_preset.static_notch_freq = std::stof(value);
-                else if (key == "static_notch_width") current_preset.static_notch_width = std::stof(value);
-                else if (key == "yaw_kick_threshold") current_preset.yaw_kick_threshold = std::stof(value);
-                else if (key == "optimal_slip_angle") current_preset.optimal_slip_angle = std::stof(value);
-                else if (key == "optimal_slip_ratio") current_preset.optimal_slip_ratio = std::stof(value);
-                else if (key == "slope_detection_enabled") current_preset.slope_detection_enabled = (value == "1");
-                else if (key == "slope_sg_window") current_preset.slope_sg_window = std::stoi(value);
-                else if (key == "slope_sensitivity") current_preset.slope_sensitivity = std::stof(value);
-                else if (key == "slope_negative_threshold" || key == "slope_min_threshold") current_preset.slope_min_threshold = std::stof(value);
-                else if (key == "slope_smoothing_tau") current_preset.slope_smoothing_tau = std::stof(value);
-                else if (key == "slope_max_threshold") current_preset.slope_max_threshold = std::stof(value);
-                else if (key == "slope_alpha_threshold") current_preset.slope_alpha_threshold = std::stof(value);
-                else if (key == "slope_decay_rate") current_preset.slope_decay_rate = std::stof(value);
-                else if (key == "slope_confidence_enabled") current_preset.slope_confidence_enabled = (value == "1");
-                else if (key == "steering_shaft_smoothing") current_preset.steering_shaft_smoothing = std::stof(value);
-                else if (key == "gyro_smoothing_factor") current_preset.gyro_smoothing = std::stof(value);
-                else if (key == "yaw_accel_smoothing") current_preset.yaw_smoothing = std::stof(value);
-                else if (key == "chassis_inertia_smoothing") current_preset.chassis_smoothing = std::stof(value);
-                else if (key == "speed_gate_lower") current_preset.speed_gate_lower = std::stof(value); // NEW v0.6.25
-                else if (key == "speed_gate_upper") current_preset.speed_gate_upper = std::stof(value); // NEW v0.6.25
-                else if (key == "road_fallback_scale") current_preset.road_fallback_scale = std::stof(value); // NEW v0.6.25
-                else if (key == "understeer_affects_sop") current_preset.understeer_affects_sop = std::stoi(value); // NEW v0.6.25
-                else if (key == "slope_g_slew_limit") current_preset.slope_g_slew_limit = std::stof(value); // NEW v0.7.40
-                else if (key == "slope_use_torque") current_preset.slope_use_torque = (value == "1"); // NEW v0.7.40
-                else if (key == "slope_torque_sensitivity") current_preset.slope_torque_sensitivity = std::stof(value); // NEW v0.7.40
-                else if (key == "slope_confidence_max_rate") current_preset.slope_confidence_max_rate = std::stof(value); // NEW v0.7.42
-            } catch (...) { std::cerr << "[Config] ParsePresetLine Error." << std::endl; }
+            }
+            write_lock.unlock();
+            lock.lock();
         }
     }
+
+    std::mutex m_mutex;
+    std::mutex m_write_mutex;
+    std::condition_variable m_cv;
+    std::thread m_thread;
+    std::map<std::string, Pending> m_pending;
+    bool m_stop = false;
+};
+
+} // namespace
+
+void Config::ParsePresetLine(std::string_view line, Preset& current_preset, std::string& current_preset_version, bool& needs_save, bool& legacy_torque_hack, float& legacy_torque_val) {
+    std::string_view key, value;
+    if (!SplitKeyValue(line, key, value)) return;
+
+    if (key == "app_version") {
+        current_preset_version.assign(value.data(), value.size());
+        return;
+    }
+
+    if (key == "understeer") {
+        float val = 0.0f;
+        if (!ParseNumber(value, val)) { std::cerr << "[Config] ParsePresetLine Error." << std::endl; return; }
+        if (val > 2.0f) {
+            float old_val = val;
+            val = val / 100.0f; // Migrating 0-200 range to 0-2
+            std::cout << "[Preset] Migrated legacy understeer: " << old_val
+                        << " -> " << val << std::endl;
+            needs_save = true;
+        }
+        current_preset.understeer = (std::min)(2.0f, (std::max)(0.0f, val));
+        return;
+    }
+
+    if (key == "max_torque_ref") {
+        // MIGRATION LOGIC (Issue #153 & #211)
+        float old_val = 0.0f;
+        if (!ParseNumber(value, old_val)) { std::cerr << "[Config] ParsePresetLine Error." << std::endl; return; }
+        if (old_val > 40.0f) {
+            // Likely the 100Nm clipping hack. Reset to safe DD defaults.
+            current_preset.wheelbase_max_nm = 15.0f;
+            current_preset.target_rim_nm = 10.0f;
+            legacy_torque_hack = true;
+            legacy_torque_val = old_val;
+        } else {
+            // User actually tuned it to their wheelbase (e.g. 20Nm or 4Nm)
+            current_preset.wheelbase_max_nm = old_val;
+            current_preset.target_rim_nm = old_val;
+        }
+        needs_save = true;
+        return;
+    }
+
+    if (FieldRegistry::Parse(key, value, current_preset) == FieldRegistry::ParseResult::Invalid) {
+        std::cerr << "[Config] ParsePresetLine Error." << std::endl;
+    }
 }
 
 void Config::LoadPresets() {
@@ -757,10 +884,11 @@ void Config::LoadPresets() {
 
     // --- Parse User Presets from config.ini ---
     // (Keep the existing parsing logic below, it works fine for file I/O)
-    std::ifstream file(m_config_path);
-    if (!file.is_open()) return;
+    std::string text;
+    if (!ReadFileText(m_config_path, text)) return;
 
-    std::string line;
+    IniLineReader reader(text);
+    std::string_view line;
     bool in_presets = false;
     bool needs_save = false;
     
@@ -771,13 +899,7 @@ void Config::LoadPresets() {
     bool legacy_torque_hack = false;
     float legacy_torque_val = 100.0f;
 
-    while (std::getline(file, line)) {
-        // Strip whitespace
-        line.erase(0, line.find_first_not_of(" \t\r\n"));
-        line.erase(line.find_last_not_of(" \t\r\n") + 1);
-        
-        if (line.empty() || line[0] == ';') continue;
-
+    while (reader.Next(line)) {
         if (line[0] == '[') {
             if (preset_pending && !current_preset_name.empty()) {
                 current_preset.name = current_preset_name;
@@ -809,8 +931,8 @@ void Config::LoadPresets() {
             } else if (line.rfind("[Preset:", 0) == 0) { 
                 in_presets = false; 
                 size_t end_pos = line.find(']');
-                if (end_pos != std::string::npos) {
-                    current_preset_name = line.substr(8, end_pos - 8);
+                if (end_pos != std::string_view::npos) {
+                    current_preset_name.assign(line.substr(8, end_pos - 8));
                     current_preset = Preset(current_preset_name, false); // Reset to defaults, not builtin
                     preset_pending = true;
                     current_preset_version = "";
@@ -868,103 +990,17 @@ void Config::ApplyPreset(int index, FFBEngine& engine) {
     }
 }
 
-void Config::WritePresetFields(std::ofstream& file, const Preset& p) {
+void Config::WritePresetFields(std::ostream& file, const Preset& p) {
     file << "app_version=" << p.app_version << "\n";
-    file << "gain=" << p.gain << "\n";
-    file << "wheelbase_max_nm=" << p.wheelbase_max_nm << "\n";
-    file << "target_rim_nm=" << p.target_rim_nm << "\n";
-    file << "min_force=" << p.min_force << "\n";
-
-    file << "steering_shaft_gain=" << p.steering_shaft_gain << "\n";
-    file << "ingame_ffb_gain=" << p.ingame_ffb_gain << "\n";
-    file << "steering_shaft_smoothing=" << p.steering_shaft_smoothing << "\n";
-    file << "understeer=" << p.understeer << "\n";
-    file << "torque_source=" << p.torque_source << "\n";
-    file << "torque_passthrough=" << p.torque_passthrough << "\n";
-    file << "flatspot_suppression=" << p.flatspot_suppression << "\n";
-    file << "notch_q=" << p.notch_q << "\n";
-    file << "flatspot_strength=" << p.flatspot_strength << "\n";
-    file << "static_notch_enabled=" << p.static_notch_enabled << "\n";
-    file << "static_notch_freq=" << p.static_notch_freq << "\n";
-    file << "static_notch_width=" << p.static_notch_width << "\n";
-
-    file << "oversteer_boost=" << p.oversteer_boost << "\n";
-    file << "dynamic_weight_gain=" << p.dynamic_weight_gain << "\n";
-    file << "dynamic_weight_smoothing=" << p.dynamic_weight_smoothing << "\n";
-    file << "grip_smoothing_steady=" << p.grip_smoothing_steady << "\n";
-    file << "grip_smoothing_fast=" << p.grip_smoothing_fast << "\n";
-    file << "grip_smoothing_sensitivity=" << p.grip_smoothing_sensitivity << "\n";
-    file << "sop=" << p.sop << "\n";
-    file << "rear_align_effect=" << p.rear_align_effect << "\n";
-    file << "sop_yaw_gain=" << p.sop_yaw_gain << "\n";
-    file << "yaw_kick_threshold=" << p.yaw_kick_threshold << "\n";
-    file << "yaw_accel_smoothing=" << p.yaw_smoothing << "\n";
-    file << "gyro_gain=" << p.gyro_gain << "\n";
-    file << "gyro_smoothing_factor=" << p.gyro_smoothing << "\n";
-    file << "sop_smoothing_factor=" << p.sop_smoothing << "\n";
-    file << "sop_scale=" << p.sop_scale << "\n";
-    file << "understeer_affects_sop=" << p.understeer_affects_sop << "\n";
-    file << "slope_detection_enabled=" << p.slope_detection_enabled << "\n";
-    file << "slope_sg_window=" << p.slope_sg_window << "\n";
-    file << "slope_sensitivity=" << p.slope_sensitivity << "\n";
-
-    file << "slope_smoothing_tau=" << p.slope_smoothing_tau << "\n";
-    file << "slope_min_threshold=" << p.slope_min_threshold << "\n";
-    file << "slope_max_threshold=" << p.slope_max_threshold << "\n";
-    file << "slope_alpha_threshold=" << p.slope_alpha_threshold << "\n";
-    file << "slope_decay_rate=" << p.slope_decay_rate << "\n";
-    file << "slope_confidence_enabled=" << p.slope_confidence_enabled << "\n";
-    file << "slope_g_slew_limit=" << p.slope_g_slew_limit << "\n";
-    file << "slope_use_torque=" << (p.slope_use_torque ? "1" : "0") << "\n";
-    file << "slope_torque_sensitivity=" << p.slope_torque_sensitivity << "\n";
-    file << "slope_confidence_max_rate=" << p.slope_confidence_max_rate << "\n";
-
-    file << "slip_angle_smoothing=" << p.slip_smoothing << "\n";
-    file << "chassis_inertia_smoothing=" << p.chassis_smoothing << "\n";
-    file << "optimal_slip_angle=" << p.optimal_slip_angle << "\n";
-    file << "optimal_slip_ratio=" << p.optimal_slip_ratio << "\n";
-
-    file << "lockup_enabled=" << (p.lockup_enabled ? "1" : "0") << "\n";
-    file << "lockup_gain=" << p.lockup_gain << "\n";
-    file << "brake_load_cap=" << p.brake_load_cap << "\n";
-    file << "lockup_freq_scale=" << p.lockup_freq_scale << "\n";
-    file << "lockup_gamma=" << p.lockup_gamma << "\n";
-    file << "lockup_start_pct=" << p.lockup_start_pct << "\n";
-    file << "lockup_full_pct=" << p.lockup_full_pct << "\n";
-    file << "lockup_prediction_sens=" << p.lockup_prediction_sens << "\n";
-    file << "lockup_bump_reject=" << p.lockup_bump_reject << "\n";
-    file << "lockup_rear_boost=" << p.lockup_rear_boost << "\n";
-    file << "abs_pulse_enabled=" << (p.abs_pulse_enabled ? "1" : "0") << "\n";
-    file << "abs_gain=" << p.abs_gain << "\n";
-    file << "abs_freq=" << p.abs_freq << "\n";
-
-    file << "texture_load_cap=" << p.texture_load_cap << "\n";
-    file << "slide_enabled=" << (p.slide_enabled ? "1" : "0") << "\n";
-    file << "slide_gain=" << p.slide_gain << "\n";
-    file << "slide_freq=" << p.slide_freq << "\n";
-    file << "road_enabled=" << (p.road_enabled ? "1" : "0") << "\n";
-    file << "road_gain=" << p.road_gain << "\n";
-    file << "tactile_gain=" << p.tactile_gain << "\n";
-    file << "road_fallback_scale=" << p.road_fallback_scale << "\n";
-    file << "dynamic_normalization_enabled=" << (p.dynamic_normalization_enabled ? "1" : "0") << "\n";
-    file << "auto_load_normalization_enabled=" << (p.auto_load_normalization_enabled ? "1" : "0") << "\n";
-    file << "soft_lock_enabled=" << (p.soft_lock_enabled ? "1" : "0") << "\n";
-    file << "soft_lock_stiffness=" << p.soft_lock_stiffness << "\n";
-    file << "soft_lock_damping=" << p.soft_lock_damping << "\n";
-    file << "spin_enabled=" << (p.spin_enabled ? "1" : "0") << "\n";
-    file << "spin_gain=" << p.spin_gain << "\n";
-    file << "spin_freq_scale=" << p.spin_freq_scale << "\n";
-    file << "scrub_drag_gain=" << p.scrub_drag_gain << "\n";
-    file << "bottoming_method=" << p.bottoming_method << "\n";
-
-    file << "speed_gate_lower=" << p.speed_gate_lower << "\n";
-    file << "speed_gate_upper=" << p.speed_gate_upper << "\n";
+    FieldRegistry::Write(file, p);
 }
 
 void Config::ExportPreset(int index, const std::string& filename) {
     if (index < 0 || index >= presets.size()) return;
+    ExportPreset(presets[index], filename);
+}
 
-    const Preset& p = presets[index];
+void Config::ExportPreset(const Preset& p, const std::string& filename) {
     std::ofstream file(filename);
     if (file.is_open()) {
         file << "[Preset:" << p.name << "]\n";
@@ -977,10 +1013,11 @@ void Config::ExportPreset(int index, const std::string& filename) {
 }
 
 bool Config::ImportPreset(const std::string& filename, const FFBEngine& engine) {
-    std::ifstream file(filename);
-    if (!file.is_open()) return false;
+    std::string text;
+    if (!ReadFileText(filename, text)) return false;
 
-    std::string line;
+    IniLineReader reader(text);
+    std::string_view line;
     std::string current_preset_name = "";
     Preset current_preset;
     std::string current_preset_version = "";
@@ -989,18 +1026,12 @@ bool Config::ImportPreset(const std::string& filename, const FFBEngine& engine)
     bool legacy_torque_hack = false;
     float legacy_torque_val = 100.0f;
 
-    while (std::getline(file, line)) {
-        // Strip whitespace
-        line.erase(0, line.find_first_not_of(" \t\r\n"));
-        line.erase(line.find_last_not_of(" \t\r\n") + 1);
-
-        if (line.empty() || line[0] == ';') continue;
-
+    while (reader.Next(line)) {
         if (line[0] == '[') {
             if (line.rfind("[Preset:", 0) == 0) {
                 size_t end_pos = line.find(']');
-                if (end_pos != std::string::npos) {
-                    current_preset_name = line.substr(8, end_pos - 8);
+                if (end_pos != std::string_view::npos) {
+                    current_preset_name.assign(line.substr(8, end_pos - 8));
                     current_preset = Preset(current_preset_name, false);
                     preset_pending = true;
                     current_preset_version = "";
@@ -1129,196 +1160,117 @@ void Config::DuplicatePreset(int index, const FFBEngine& engine) {
 bool Config::IsEngineDirtyRelativeToPreset(int index, const FFBEngine& engine) {
     if (index < 0 || index >= (int)presets.size()) return false;
 
-    Preset current_state;
-    current_state.UpdateFromEngine(engine);
-
-    return !presets[index].Equals(current_state);
+    return !FieldRegistry::Matches(presets[index], engine);
 }
 
 void Config::SetSavedStaticLoad(const std::string& vehicleName, double value) {
-    std::lock_guard<std::recursive_mutex> lock(m_static_loads_mutex);
-    m_saved_static_loads[vehicleName] = value;
+    VehicleProfileStore::Get().SetField(vehicleName.c_str(), ProfileField::StaticFrontLoad, value);
 }
 
 bool Config::GetSavedStaticLoad(const std::string& vehicleName, double& value) {
-    std::lock_guard<std::recursive_mutex> lock(m_static_loads_mutex);
-    auto it = m_saved_static_loads.find(vehicleName);
-    if (it != m_saved_static_loads.end()) {
-        value = it->second;
-        return true;
-    }
-    return false;
+    return VehicleProfileStore::Get().GetField(vehicleName.c_str(), ProfileField::StaticFrontLoad, value);
 }
 
-void Config::Save(const FFBEngine& engine, const std::string& filename) {
+std::string Config::SerializeSnapshot(const FFBEngine& engine) {
     std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
-    std::string final_path = filename.empty() ? m_config_path : filename;
-    std::ofstream file(final_path);
-    if (file.is_open()) {
-        file << "; --- System & Window ---\n";
-        // Config Version Tracking: The ini_version field serves dual purposes:
-        // 1. Records the app version that last saved this config
-        // 2. Acts as an implicit config format version for migration logic
-        // NOTE: Currently migration is threshold-based (e.g., understeer > 2.0 = legacy).
-        //       For more complex migrations, consider adding explicit config_format_version field.
-        file << "ini_version=" << LMUFFB_VERSION << "\n";
-        file << "always_on_top=" << m_always_on_top << "\n";
-        file << "last_device_guid=" << m_last_device_guid << "\n";
-        file << "last_preset_name=" << m_last_preset_name << "\n";
-        file << "win_pos_x=" << win_pos_x << "\n";
-        file << "win_pos_y=" << win_pos_y << "\n";
-        file << "win_w_small=" << win_w_small << "\n";
-        file << "win_h_small=" << win_h_small << "\n";
-        file << "win_w_large=" << win_w_large << "\n";
-        file << "win_h_large=" << win_h_large << "\n";
-        file << "show_graphs=" << show_graphs << "\n";
-        file << "auto_start_logging=" << m_auto_start_logging << "\n";
-        file << "log_path=" << m_log_path << "\n";
-
-        file << "\n; --- General FFB ---\n";
-        file << "invert_force=" << engine.m_invert_force << "\n";
-        file << "gain=" << engine.m_gain << "\n";
-        file << "dynamic_normalization_enabled=" << engine.m_dynamic_normalization_enabled << "\n";
-        file << "auto_load_normalization_enabled=" << engine.m_auto_load_normalization_enabled << "\n";
-        file << "soft_lock_enabled=" << engine.m_soft_lock_enabled << "\n";
-        file << "soft_lock_stiffness=" << engine.m_soft_lock_stiffness << "\n";
-        file << "soft_lock_damping=" << engine.m_soft_lock_damping << "\n";
-        file << "wheelbase_max_nm=" << engine.m_wheelbase_max_nm << "\n";
-        file << "target_rim_nm=" << engine.m_target_rim_nm << "\n";
-        file << "min_force=" << engine.m_min_force << "\n";
-
-        file << "\n; --- Front Axle (Understeer) ---\n";
-        file << "steering_shaft_gain=" << engine.m_steering_shaft_gain << "\n";
-        file << "ingame_ffb_gain=" << engine.m_ingame_ffb_gain << "\n";
-        file << "steering_shaft_smoothing=" << engine.m_steering_shaft_smoothing << "\n";
-        file << "understeer=" << engine.m_understeer_effect << "\n";
-        file << "torque_source=" << engine.m_torque_source << "\n";
-        file << "torque_passthrough=" << engine.m_torque_passthrough << "\n";
-        file << "flatspot_suppression=" << engine.m_flatspot_suppression << "\n";
-        file << "notch_q=" << engine.m_notch_q << "\n";
-        file << "flatspot_strength=" << engine.m_flatspot_strength << "\n";
-        file << "static_notch_enabled=" << engine.m_static_notch_enabled << "\n";
-        file << "static_notch_freq=" << engine.m_static_notch_freq << "\n";
-        file << "static_notch_width=" << engine.m_static_notch_width << "\n";
-
-        file << "\n; --- Rear Axle (Oversteer) ---\n";
-        file << "oversteer_boost=" << engine.m_oversteer_boost << "\n";
-        file << "dynamic_weight_gain=" << engine.m_dynamic_weight_gain << "\n";
-        file << "dynamic_weight_smoothing=" << engine.m_dynamic_weight_smoothing << "\n";
-        file << "grip_smoothing_steady=" << engine.m_grip_smoothing_steady << "\n";
-        file << "grip_smoothing_fast=" << engine.m_grip_smoothing_fast << "\n";
-        file << "grip_smoothing_sensitivity=" << engine.m_grip_smoothing_sensitivity << "\n";
-        file << "sop=" << engine.m_sop_effect << "\n";
-        file << "rear_align_effect=" << engine.m_rear_align_effect << "\n";
-        file << "sop_yaw_gain=" << engine.m_sop_yaw_gain << "\n";
-        file << "yaw_kick_threshold=" << engine.m_yaw_kick_threshold << "\n";
-        file << "yaw_accel_smoothing=" << engine.m_yaw_accel_smoothing << "\n";
-        file << "gyro_gain=" << engine.m_gyro_gain << "\n";
-        file << "gyro_smoothing_factor=" << engine.m_gyro_smoothing << "\n";
-        file << "sop_smoothing_factor=" << engine.m_sop_smoothing_factor << "\n";
-        file << "sop_scale=" << engine.m_sop_scale << "\n";
-        file << "understeer_affects_sop=" << engine.m_understeer_affects_sop << "\n";
-
-        file << "\n; --- Physics (Grip & Slip Angle) ---\n";
-        file << "slip_angle_smoothing=" << engine.m_slip_angle_smoothing << "\n";
-        file << "chassis_inertia_smoothing=" << engine.m_chassis_inertia_smoothing << "\n";
-        file << "optimal_slip_angle=" << engine.m_optimal_slip_angle << "\n";
-        file << "optimal_slip_ratio=" << engine.m_optimal_slip_ratio << "\n";
-        file << "slope_detection_enabled=" << engine.m_slope_detection_enabled << "\n";
-        file << "slope_sg_window=" << engine.m_slope_sg_window << "\n";
-        file << "slope_sensitivity=" << engine.m_slope_sensitivity << "\n";
-
-        file << "slope_smoothing_tau=" << engine.m_slope_smoothing_tau << "\n";
-        file << "slope_min_threshold=" << engine.m_slope_min_threshold << "\n";
-        file << "slope_max_threshold=" << engine.m_slope_max_threshold << "\n";
-        file << "slope_alpha_threshold=" << engine.m_slope_alpha_threshold << "\n";
-        file << "slope_decay_rate=" << engine.m_slope_decay_rate << "\n";
-        file << "slope_confidence_enabled=" << engine.m_slope_confidence_enabled << "\n";
-        file << "slope_g_slew_limit=" << engine.m_slope_g_slew_limit << "\n";
-        file << "slope_use_torque=" << (engine.m_slope_use_torque ? "1" : "0") << "\n";
-        file << "slope_torque_sensitivity=" << engine.m_slope_torque_sensitivity << "\n";
-        file << "slope_confidence_max_rate=" << engine.m_slope_confidence_max_rate << "\n";
-
-        file << "\n; --- Braking & Lockup ---\n";
-        file << "lockup_enabled=" << engine.m_lockup_enabled << "\n";
-        file << "lockup_gain=" << engine.m_lockup_gain << "\n";
-        file << "brake_load_cap=" << engine.m_brake_load_cap << "\n";
-        file << "lockup_freq_scale=" << engine.m_lockup_freq_scale << "\n";
-        file << "lockup_gamma=" << engine.m_lockup_gamma << "\n";
-        file << "lockup_start_pct=" << engine.m_lockup_start_pct << "\n";
-        file << "lockup_full_pct=" << engine.m_lockup_full_pct << "\n";
-        file << "lockup_prediction_sens=" << engine.m_lockup_prediction_sens << "\n";
-        file << "lockup_bump_reject=" << engine.m_lockup_bump_reject << "\n";
-        file << "lockup_rear_boost=" << engine.m_lockup_rear_boost << "\n";
-        file << "abs_pulse_enabled=" << engine.m_abs_pulse_enabled << "\n";
-        file << "abs_gain=" << engine.m_abs_gain << "\n";
-        file << "abs_freq=" << engine.m_abs_freq_hz << "\n";
-
-        file << "\n; --- Tactile Textures ---\n";
-        file << "texture_load_cap=" << engine.m_texture_load_cap << "\n";
-        file << "slide_enabled=" << engine.m_slide_texture_enabled << "\n";
-        file << "slide_gain=" << engine.m_slide_texture_gain << "\n";
-        file << "slide_freq=" << engine.m_slide_freq_scale << "\n";
-        file << "road_enabled=" << engine.m_road_texture_enabled << "\n";
-        file << "road_gain=" << engine.m_road_texture_gain << "\n";
-        file << "tactile_gain=" << engine.m_tactile_gain << "\n";
-        file << "road_fallback_scale=" << engine.m_road_fallback_scale << "\n";
-        file << "spin_enabled=" << engine.m_spin_enabled << "\n";
-        file << "spin_gain=" << engine.m_spin_gain << "\n";
-        file << "spin_freq_scale=" << engine.m_spin_freq_scale << "\n";
-        file << "scrub_drag_gain=" << engine.m_scrub_drag_gain << "\n";
-        file << "bottoming_method=" << engine.m_bottoming_method << "\n";
-
-        file << "\n; --- Advanced Settings ---\n";
-        file << "speed_gate_lower=" << engine.m_speed_gate_lower << "\n";
-        file << "speed_gate_upper=" << engine.m_speed_gate_upper << "\n";
-
-        file << "\n[StaticLoads]\n";
-        {
-            std::lock_guard<std::recursive_mutex> static_lock(m_static_loads_mutex);
-            for (const auto& pair : m_saved_static_loads) {
-                file << pair.first << "=" << pair.second << "\n";
-            }
+    std::ostringstream file;
+    file << "; --- System & Window ---\n";
+    // Config Version Tracking: The ini_version field serves dual purposes:
+    // 1. Records the app version that last saved this config
+    // 2. Acts as an implicit config format version for migration logic
+    // NOTE: Currently migration is threshold-based (e.g., understeer > 2.0 = legacy).
+    //       For more complex migrations, consider adding explicit config_format_version field.
+    file << "ini_version=" << LMUFFB_VERSION << "\n";
+    file << "always_on_top=" << m_always_on_top << "\n";
+    file << "last_device_guid=" << m_last_device_guid << "\n";
+    file << "last_preset_name=" << m_last_preset_name << "\n";
+    file << "win_pos_x=" << win_pos_x << "\n";
+    file << "win_pos_y=" << win_pos_y << "\n";
+    file << "win_w_small=" << win_w_small << "\n";
+    file << "win_h_small=" << win_h_small << "\n";
+    file << "win_w_large=" << win_w_large << "\n";
+    file << "win_h_large=" << win_h_large << "\n";
+    file << "show_graphs=" << show_graphs << "\n";
+    file << "plot_panels=" << plot_panels << "\n";
+    file << "auto_start_logging=" << m_auto_start_logging << "\n";
+    file << "log_path=" << m_log_path << "\n";
+    file << "log_compress=" << m_log_compress << "\n";
+    file << "flight_recorder=" << m_flight_recorder << "\n";
+    file << "flight_recorder_seconds=" << m_flight_recorder_seconds << "\n";
+    file << "anomaly_dumps=" << m_anomaly_dumps << "\n";
+
+    FieldRegistry::Write(file, engine);
+
+    file << "\n[Presets]\n";
+    for (const auto& p : presets) {
+        if (!p.is_builtin) {
+            file << "[Preset:" << p.name << "]\n";
+            WritePresetFields(file, p);
+            file << "\n";
         }
+    }
+    return file.str();
+}
 
-        file << "\n[Presets]\n";
-        for (const auto& p : presets) {
-            if (!p.is_builtin) {
-                file << "[Preset:" << p.name << "]\n";
-                WritePresetFields(file, p);
-                file << "\n";
-            }
-        }
-        
-        file.close();
-
-    } else {
+void Config::Save(const FFBEngine& engine, const std::string& filename) {
+    std::string final_path = filename.empty() ? m_config_path : filename;
+    std::string text = SerializeSnapshot(engine);
+    if (!ConfigSaveWorker::Get().WriteNow(final_path, text)) {
         std::cerr << "[Config] Failed to save to " << final_path << std::endl;
     }
 }
 
+void Config::RequestSave(const FFBEngine& engine, const std::string& filename) {
+    std::string final_path = filename.empty() ? m_config_path : filename;
+    ConfigSaveWorker::Get().Enqueue(final_path, SerializeSnapshot(engine));
+}
+
+void Config::FlushPendingSaves() {
+    ConfigSaveWorker::Get().Flush();
+}
+
 void Config::Load(FFBEngine& engine, const std::string& filename) {
     std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
     std::string final_path = filename.empty() ? m_config_path : filename;
-    std::ifstream file(final_path);
-    if (!file.is_open()) {
+    std::string text;
+    if (!ReadFileText(final_path, text)) {
         std::cout << "[Config] No config found, using defaults." << std::endl;
         return;
     }
 
-    std::string line;
+    // Global app settings (not part of the engine)
+    struct AppSetting { std::string_view key; int* i; bool* b; std::string* s; };
+    const AppSetting app_settings[] = {
+        { "always_on_top", nullptr, &m_always_on_top, nullptr },
+        { "last_device_guid", nullptr, nullptr, &m_last_device_guid },
+        { "last_preset_name", nullptr, nullptr, &m_last_preset_name },
+        // Window Geometry (v0.5.5)
+        { "win_pos_x", &win_pos_x, nullptr, nullptr },
+        { "win_pos_y", &win_pos_y, nullptr, nullptr },
+        { "win_w_small", &win_w_small, nullptr, nullptr },
+        { "win_h_small", &win_h_small, nullptr, nullptr },
+        { "win_w_large", &win_w_large, nullptr, nullptr },
+        { "win_h_large", &win_h_large, nullptr, nullptr },
+        { "show_graphs", nullptr, &show_graphs, nullptr },
+        { "plot_panels", nullptr, nullptr, &plot_panels },
+        { "auto_start_logging", nullptr, &m_auto_start_logging, nullptr },
+        { "log_path", nullptr, nullptr, &m_log_path },
+        { "log_compress", nullptr, &m_log_compress, nullptr },
+        { "flight_recorder", nullptr, &m_flight_recorder, nullptr },
+        { "flight_recorder_seconds", &m_flight_recorder_seconds, nullptr, nullptr },
+        { "anomaly_dumps", nullptr, &m_anomaly_dumps, nullptr },
+    };
+
+    IniLineReader reader(text);
+    std::string_view line;
     bool in_static_loads = false;
     bool in_presets = false;
     std::string config_version = "";
     bool legacy_torque_hack = false;
     float legacy_torque_val = 100.0f;
 
-    while (std::getline(file, line)) {
-        // Strip whitespace and check for section headers
-        line.erase(0, line.find_first_not_of(" \t\r\n"));
-        line.erase(line.find_last_not_of(" \t\r\n") + 1);
-        if (line.empty() || line[0] == ';') continue;
-
+    while (reader.Next(line)) {
+        // Check for section headers
         if (line[0] == '[') {
             if (line == "[StaticLoads]") {
                 in_static_loads = true;
@@ -1335,143 +1287,54 @@ void Config::Load(FFBEngine& engine, const std::string& filename) {
 
         if (in_presets) continue;
 
-        std::istringstream is_line(line);
-        std::string key;
-        if (std::getline(is_line, key, '=')) {
-            std::string value;
-            if (std::getline(is_line, value)) {
-                try {
-                    if (in_static_loads) {
-                        SetSavedStaticLoad(key, std::stod(value));
-                        continue;
-                    }
-
-                    if (key == "ini_version") {
-                        // Config Version Tracking: This field records the app version that last saved the config.
-                        // It serves as an implicit config format version for migration decisions.
-                        // Current approach: Threshold-based detection (e.g., understeer > 2.0 = legacy format).
-                        // Future improvement: Add explicit config_format_version field if migrations become
-                        // more complex (e.g., structural changes, removed fields, renamed keys).
-                        config_version = value;
-                        std::cout << "[Config] Loading config version: " << config_version << std::endl;
-                    }
-                    else if (key == "always_on_top") m_always_on_top = std::stoi(value);
-                    else if (key == "last_device_guid") m_last_device_guid = value;
-                    else if (key == "last_preset_name") m_last_preset_name = value;
-                    // Window Geometry (v0.5.5)
-                    else if (key == "win_pos_x") win_pos_x = std::stoi(value);
-                    else if (key == "win_pos_y") win_pos_y = std::stoi(value);
-                    else if (key == "win_w_small") win_w_small = std::stoi(value);
-                    else if (key == "win_h_small") win_h_small = std::stoi(value);
-                    else if (key == "win_w_large") win_w_large = std::stoi(value);
-                    else if (key == "win_h_large") win_h_large = std::stoi(value);
-                    else if (key == "show_graphs") show_graphs = std::stoi(value);
-                    else if (key == "auto_start_logging") m_auto_start_logging = std::stoi(value);
-                    else if (key == "log_path") m_log_path = value;
-                    else if (key == "invert_force") engine.m_invert_force = std::stoi(value);
-                    else if (key == "gain") engine.m_gain = std::stof(value);
-                    else if (key == "dynamic_normalization_enabled") engine.m_dynamic_normalization_enabled = (value == "1" || value == "true");
-                    else if (key == "auto_load_normalization_enabled") engine.m_auto_load_normalization_enabled = (value == "1" || value == "true");
-                    else if (key == "sop_smoothing_factor" || key == "smoothing") engine.m_sop_smoothing_factor = std::stof(value); // "smoothing" is a legacy alias
-                    else if (key == "sop_scale") engine.m_sop_scale = std::stof(value);
-                    else if (key == "slip_angle_smoothing") engine.m_slip_angle_smoothing = std::stof(value);
-                    else if (key == "texture_load_cap" || key == "max_load_factor") engine.m_texture_load_cap = std::stof(value);
-                    else if (key == "brake_load_cap") engine.m_brake_load_cap = std::stof(value);
-                    else if (key == "understeer") engine.m_understeer_effect = std::stof(value);
-                    else if (key == "torque_source") engine.m_torque_source = std::stoi(value);
-                    else if (key == "torque_passthrough") engine.m_torque_passthrough = (value == "1" || value == "true");
-                    else if (key == "sop") engine.m_sop_effect = std::stof(value);
-                    else if (key == "min_force") engine.m_min_force = std::stof(value);
-                    else if (key == "oversteer_boost") engine.m_oversteer_boost = std::stof(value);
-                    else if (key == "dynamic_weight_gain") engine.m_dynamic_weight_gain = std::stof(value);
-                    else if (key == "dynamic_weight_smoothing") engine.m_dynamic_weight_smoothing = std::stof(value);
-                    else if (key == "grip_smoothing_steady") engine.m_grip_smoothing_steady = std::stof(value);
-                    else if (key == "grip_smoothing_fast") engine.m_grip_smoothing_fast = std::stof(value);
-                    else if (key == "grip_smoothing_sensitivity") engine.m_grip_smoothing_sensitivity = std::stof(value);
-                    // v0.4.50: SAFETY CLAMPING for Generator Effects (Gain Compensation Migration)
-                    // Legacy configs may have high gains (e.g., 5.0) to compensate for lack of auto-scaling.
-                    // With new decoupling, these would cause 25x force explosions. Clamp to safe maximums.
-                    else if (key == "lockup_enabled") engine.m_lockup_enabled = std::stoi(value);
-                    else if (key == "lockup_gain") engine.m_lockup_gain = std::stof(value);
-                    else if (key == "lockup_start_pct") engine.m_lockup_start_pct = std::stof(value);
-                    else if (key == "lockup_full_pct") engine.m_lockup_full_pct = std::stof(value);
-                    else if (key == "lockup_rear_boost") engine.m_lockup_rear_boost = std::stof(value);
-                    else if (key == "lockup_gamma") engine.m_lockup_gamma = std::stof(value);
-                    else if (key == "lockup_prediction_sens") engine.m_lockup_prediction_sens = std::stof(value);
-                    else if (key == "lockup_bump_reject") engine.m_lockup_bump_reject = std::stof(value);
-                    else if (key == "abs_pulse_enabled") engine.m_abs_pulse_enabled = std::stoi(value);
-                    else if (key == "abs_gain") engine.m_abs_gain = std::stof(value);
-                    else if (key == "spin_enabled") engine.m_spin_enabled = std::stoi(value);
-                    else if (key == "spin_gain") engine.m_spin_gain = std::stof(value);
-                    else if (key == "slide_enabled") engine.m_slide_texture_enabled = std::stoi(value);
-                    else if (key == "slide_gain") engine.m_slide_texture_gain = std::stof(value);
-                    else if (key == "slide_freq") engine.m_slide_freq_scale = std::stof(value);
-                    else if (key == "road_enabled") engine.m_road_texture_enabled = std::stoi(value);
-                    else if (key == "road_gain") engine.m_road_texture_gain = std::stof(value);
-                    else if (key == "tactile_gain") engine.m_tactile_gain = std::stof(value);
-                    else if (key == "soft_lock_enabled") engine.m_soft_lock_enabled = std::stoi(value);
-                    else if (key == "soft_lock_stiffness") engine.m_soft_lock_stiffness = std::stof(value);
-                    else if (key == "soft_lock_damping") engine.m_soft_lock_damping = std::stof(value);
-                    else if (key == "wheelbase_max_nm") engine.m_wheelbase_max_nm = std::stof(value);
-                    else if (key == "target_rim_nm") engine.m_target_rim_nm = std::stof(value);
-                    else if (key == "max_torque_ref") {
-                        // MIGRATION LOGIC (Issue #153)
-                        float old_val = std::stof(value);
-                        if (old_val > 40.0f) {
-                            engine.m_wheelbase_max_nm = 15.0f;
-                            engine.m_target_rim_nm = 10.0f;
-                            legacy_torque_hack = true;
-                            legacy_torque_val = old_val;
-                        } else {
-                            engine.m_wheelbase_max_nm = old_val;
-                            engine.m_target_rim_nm = old_val;
-                        }
-                    }
-                    else if (key == "abs_freq") engine.m_abs_freq_hz = std::stof(value);
-                    else if (key == "lockup_freq_scale") engine.m_lockup_freq_scale = std::stof(value);
-                    else if (key == "spin_freq_scale") engine.m_spin_freq_scale = std::stof(value);
-                    else if (key == "bottoming_method") engine.m_bottoming_method = std::stoi(value);
-                    else if (key == "scrub_drag_gain") engine.m_scrub_drag_gain = (std::min)(1.0f, std::stof(value));
-                    else if (key == "rear_align_effect") engine.m_rear_align_effect = std::stof(value);
-                    else if (key == "sop_yaw_gain") engine.m_sop_yaw_gain = std::stof(value);
-                    else if (key == "steering_shaft_gain") engine.m_steering_shaft_gain = std::stof(value);
-                    else if (key == "ingame_ffb_gain") engine.m_ingame_ffb_gain = std::stof(value);
-                    else if (key == "gyro_gain") engine.m_gyro_gain = (std::min)(1.0f, std::stof(value));
-                    else if (key == "flatspot_suppression") engine.m_flatspot_suppression = std::stoi(value);
-                    else if (key == "notch_q") engine.m_notch_q = std::stof(value);
-                    else if (key == "flatspot_strength") engine.m_flatspot_strength = std::stof(value);
-                    else if (key == "static_notch_enabled") engine.m_static_notch_enabled = std::stoi(value);
-                    else if (key == "static_notch_freq") engine.m_static_notch_freq = std::stof(value);
-                    else if (key == "static_notch_width") engine.m_static_notch_width = std::stof(value);
-                    else if (key == "yaw_kick_threshold") engine.m_yaw_kick_threshold = std::stof(value);
-                    else if (key == "optimal_slip_angle") engine.m_optimal_slip_angle = std::stof(value);
-                    else if (key == "optimal_slip_ratio") engine.m_optimal_slip_ratio = std::stof(value);
-                    else if (key == "slope_detection_enabled") engine.m_slope_detection_enabled = (value == "1");
-                    else if (key == "slope_sg_window") engine.m_slope_sg_window = std::stoi(value);
-                    else if (key == "slope_sensitivity") engine.m_slope_sensitivity = std::stof(value);
-                    else if (key == "slope_negative_threshold" || key == "slope_min_threshold") engine.m_slope_min_threshold = std::stof(value);
-                    else if (key == "slope_smoothing_tau") engine.m_slope_smoothing_tau = std::stof(value);
-                    else if (key == "slope_max_threshold") engine.m_slope_max_threshold = std::stof(value);
-                    else if (key == "slope_alpha_threshold") engine.m_slope_alpha_threshold = std::stof(value);
-                    else if (key == "slope_decay_rate") engine.m_slope_decay_rate = std::stof(value);
-                    else if (key == "slope_confidence_enabled") engine.m_slope_confidence_enabled = (value == "1");
-                    else if (key == "steering_shaft_smoothing") engine.m_steering_shaft_smoothing = std::stof(value);
-                    else if (key == "gyro_smoothing_factor") engine.m_gyro_smoothing = std::stof(value);
-                    else if (key == "yaw_accel_smoothing") engine.m_yaw_accel_smoothing = std::stof(value);
-                    else if (key == "chassis_inertia_smoothing") engine.m_chassis_inertia_smoothing = std::stof(value);
-                    else if (key == "speed_gate_lower") engine.m_speed_gate_lower = std::stof(value); // NEW v0.6.25
-                    else if (key == "speed_gate_upper") engine.m_speed_gate_upper = std::stof(value); // NEW v0.6.25
-                    else if (key == "road_fallback_scale") engine.m_road_fallback_scale = std::stof(value); // NEW v0.6.25
-                    else if (key == "understeer_affects_sop") engine.m_understeer_affects_sop = std::stoi(value); // NEW v0.6.25
-                    else if (key == "slope_g_slew_limit") engine.m_slope_g_slew_limit = std::stof(value); // NEW v0.7.40
-                    else if (key == "slope_use_torque") engine.m_slope_use_torque = (value == "1"); // NEW v0.7.40
-                    else if (key == "slope_torque_sensitivity") engine.m_slope_torque_sensitivity = std::stof(value); // NEW v0.7.40
-                    else if (key == "slope_confidence_max_rate") engine.m_slope_confidence_max_rate = std::stof(value); // NEW v0.7.42
-                } catch (...) {
-                    std::cerr << "[Config] Error parsing line: " << line << std::endl;
-                }
+        std::string_view key, value;
+        if (!SplitKeyValue(line, key, value)) continue;
+
+        bool ok = true;
+        if (in_static_loads) {
+            double load = 0.0;
+            ok = ParseNumber(value, load);
+            if (ok) SetSavedStaticLoad(std::string(key), load);
+        }
+        else if (key == "ini_version") {
+            // Config Version Tracking: This field records the app version that last saved the config.
+            // It serves as an implicit config format version for migration decisions.
+            // Current approach: Threshold-based detection (e.g., understeer > 2.0 = legacy format).
+            // Future improvement: Add explicit config_format_version field if migrations become
+            // more complex (e.g., structural changes, removed fields, renamed keys).
+            config_version.assign(value);
+            std::cout << "[Config] Loading config version: " << config_version << std::endl;
+        }
+        else if (key == "max_torque_ref") {
+            // MIGRATION LOGIC (Issue #153)
+            float old_val = 0.0f;
+            ok = ParseNumber(value, old_val);
+            if (ok && old_val > 40.0f) {
+                engine.m_wheelbase_max_nm = 15.0f;
+                engine.m_target_rim_nm = 10.0f;
+                legacy_torque_hack = true;
+                legacy_torque_val = old_val;
+            } else if (ok) {
+                engine.m_wheelbase_max_nm = old_val;
+                engine.m_target_rim_nm = old_val;
             }
         }
+        else if (FieldRegistry::ParseResult res = FieldRegistry::Parse(key, value, engine); res != FieldRegistry::ParseResult::Unknown) {
+            ok = (res == FieldRegistry::ParseResult::Ok);
+        }
+        else {
+            for (const AppSetting& s : app_settings) {
+                if (s.key != key) continue;
+                if (s.i) ok = ParseNumber(value, *s.i);
+                else if (s.b) ok = ParseBool(value, *s.b);
+                else s.s->assign(value);
+                break;
+            }
+        }
+
+        if (!ok) {
+            std::cerr << "[Config] Error parsing line: " << line << std::endl;
+        }
     }
     
     // v0.7.16: Comprehensive Safety Validation & Clamping
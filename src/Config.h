@@ -3,11 +3,13 @@
 
 #include "FFBEngine.h"
 #include <string>
+#include <string_view>
 #include <vector>
 #include <chrono>
 #include <map>
 #include <atomic>
 #include "Version.h"
+#include "FieldRegistry.h"
 
 struct Preset {
     std::string name;
@@ -66,6 +68,7 @@ struct Preset {
     
     bool road_enabled = true;
     float road_gain = 0.0f;
+    float road_prediction = 0.0f; // New v0.7.112: blend of the learned per-track texture (0 = off)
     float tactile_gain = 1.0f; // New v0.7.110 (Issue #206)
 
     bool dynamic_normalization_enabled = false;
@@ -94,17 +97,21 @@ struct Preset {
     // NEW: Grip & Smoothing (v0.5.7)
     float optimal_slip_angle = 0.1f;
     float optimal_slip_ratio = 0.12f;
+    bool adaptive_slip_angle = false; // New v0.7.112: learn the slip angle peak per car
     float steering_shaft_smoothing = 0.0f;
+    float torque_prediction_ms = 0.0f; // New v0.7.112: shaft torque latency compensation
     
     // NEW: Advanced Smoothing (v0.5.8)
     float gyro_smoothing = 0.0f;
     float yaw_smoothing = 0.001f;
     float chassis_smoothing = 0.0f;
+    bool chassis_estimator = false; // New v0.7.112: Kalman chassis state instead of one-pole smoothers
 
     // v0.4.41: Signal Filtering
     bool flatspot_suppression = false;
     float notch_q = 2.0f;
     float flatspot_strength = 1.0f;
+    bool notch_auto_tune = false; // New v0.7.112: notch centers follow the measured torque spectrum
     
     bool static_notch_enabled = false;
     float static_notch_freq = 11.0f;
@@ -284,107 +291,18 @@ struct Preset {
 
     // Apply this preset to an engine instance
     // v0.7.16: Added comprehensive safety clamping to prevent crashes/NaN from invalid config values
+    // v0.7.112: Per-field copy and range clamping come from FieldRegistry
     void Apply(FFBEngine& engine) const {
-        engine.m_dynamic_normalization_enabled = dynamic_normalization_enabled;
-        engine.m_auto_load_normalization_enabled = auto_load_normalization_enabled;
-        engine.m_gain = (std::max)(0.0f, gain);
-        engine.m_understeer_effect = (std::max)(0.0f, (std::min)(2.0f, understeer));
-        engine.m_sop_effect = (std::max)(0.0f, (std::min)(2.0f, sop));
-        engine.m_sop_scale = (std::max)(0.01f, sop_scale);
-        engine.m_sop_smoothing_factor = (std::max)(0.0f, (std::min)(1.0f, sop_smoothing));
-        engine.m_slip_angle_smoothing = (std::max)(0.0001f, slip_smoothing);
-        engine.m_min_force = (std::max)(0.0f, min_force);
-        engine.m_oversteer_boost = (std::max)(0.0f, oversteer_boost);
-        engine.m_dynamic_weight_gain = (std::max)(0.0f, (std::min)(2.0f, dynamic_weight_gain));
-        engine.m_dynamic_weight_smoothing = (std::max)(0.0f, dynamic_weight_smoothing);
-        engine.m_grip_smoothing_steady = (std::max)(0.0f, grip_smoothing_steady);
-        engine.m_grip_smoothing_fast = (std::max)(0.0f, grip_smoothing_fast);
-        engine.m_grip_smoothing_sensitivity = (std::max)(0.001f, grip_smoothing_sensitivity);
-
-        engine.m_lockup_enabled = lockup_enabled;
-        engine.m_lockup_gain = (std::max)(0.0f, lockup_gain);
-        engine.m_lockup_start_pct = (std::max)(0.1f, lockup_start_pct);
-        engine.m_lockup_full_pct = (std::max)(0.2f, lockup_full_pct);
-        engine.m_lockup_rear_boost = (std::max)(0.0f, lockup_rear_boost);
-        engine.m_lockup_gamma = (std::max)(0.1f, lockup_gamma); // Critical: prevent pow(0, negative) crash
-        engine.m_lockup_prediction_sens = (std::max)(1.0f, lockup_prediction_sens);
-        engine.m_lockup_bump_reject = (std::max)(0.01f, lockup_bump_reject);
-        engine.m_brake_load_cap = (std::max)(1.0f, brake_load_cap);
-        engine.m_texture_load_cap = (std::max)(1.0f, texture_load_cap);
-
-        engine.m_abs_pulse_enabled = abs_pulse_enabled;
-        engine.m_abs_gain = (std::max)(0.0f, abs_gain);
-
-        engine.m_spin_enabled = spin_enabled;
-        engine.m_spin_gain = (std::max)(0.0f, spin_gain);
-        engine.m_slide_texture_enabled = slide_enabled;
-        engine.m_slide_texture_gain = (std::max)(0.0f, slide_gain);
-        engine.m_slide_freq_scale = (std::max)(0.1f, slide_freq);
-        engine.m_road_texture_enabled = road_enabled;
-        engine.m_road_texture_gain = (std::max)(0.0f, road_gain);
-        engine.m_tactile_gain = (std::max)(0.0f, (std::min)(2.0f, tactile_gain));
-
-        engine.m_soft_lock_enabled = soft_lock_enabled;
-        engine.m_soft_lock_stiffness = (std::max)(0.0f, soft_lock_stiffness);
-        engine.m_soft_lock_damping = (std::max)(0.0f, soft_lock_damping);
-
-        engine.m_wheelbase_max_nm = (std::max)(1.0f, wheelbase_max_nm);
-        engine.m_target_rim_nm = (std::max)(1.0f, target_rim_nm);
-        engine.m_abs_freq_hz = (std::max)(1.0f, abs_freq);
-        engine.m_lockup_freq_scale = (std::max)(0.1f, lockup_freq_scale);
-        engine.m_spin_freq_scale = (std::max)(0.1f, spin_freq_scale);
-        engine.m_bottoming_method = bottoming_method;
-        engine.m_scrub_drag_gain = (std::max)(0.0f, scrub_drag_gain);
-        engine.m_rear_align_effect = (std::max)(0.0f, rear_align_effect);
-        engine.m_sop_yaw_gain = (std::max)(0.0f, sop_yaw_gain);
-        engine.m_gyro_gain = (std::max)(0.0f, gyro_gain);
-        engine.m_steering_shaft_gain = (std::max)(0.0f, steering_shaft_gain);
-        engine.m_ingame_ffb_gain = (std::max)(0.0f, ingame_ffb_gain);
-        engine.m_torque_source = torque_source;
-        engine.m_torque_passthrough = torque_passthrough;
-        engine.m_flatspot_suppression = flatspot_suppression;
-        engine.m_notch_q = (std::max)(0.1f, notch_q); // Critical for biquad division
-        engine.m_flatspot_strength = (std::max)(0.0f, (std::min)(1.0f, flatspot_strength));
-        engine.m_static_notch_enabled = static_notch_enabled;
-        engine.m_static_notch_freq = (std::max)(1.0f, static_notch_freq);
-        engine.m_static_notch_width = (std::max)(0.1f, static_notch_width);
+        FieldRegistry::Apply(*this, engine);
+
+        // Clamps Validate does not apply (pre-registry behaviour)
         engine.m_yaw_kick_threshold = (std::max)(0.0f, yaw_kick_threshold);
         engine.m_speed_gate_lower = (std::max)(0.0f, speed_gate_lower);
-        engine.m_speed_gate_upper = (std::max)(0.1f, speed_gate_upper);
-        
-        // NEW: Grip & Smoothing (v0.5.7/v0.5.8)
-        engine.m_optimal_slip_angle = (std::max)(0.01f, optimal_slip_angle); // Critical for grip division
-        engine.m_optimal_slip_ratio = (std::max)(0.01f, optimal_slip_ratio); // Critical for grip division
-        engine.m_steering_shaft_smoothing = (std::max)(0.0f, steering_shaft_smoothing);
-        engine.m_gyro_smoothing = (std::max)(0.0f, gyro_smoothing);
-        engine.m_yaw_accel_smoothing = (std::max)(0.0f, yaw_smoothing);
-        engine.m_chassis_inertia_smoothing = (std::max)(0.0f, chassis_smoothing);
-        engine.m_road_fallback_scale = (std::max)(0.0f, road_fallback_scale);
-        engine.m_understeer_affects_sop = understeer_affects_sop;
-        
-        // Slope Detection (v0.7.0)
-        engine.m_slope_detection_enabled = slope_detection_enabled;
-        engine.m_slope_sg_window = (std::max)(5, (std::min)(41, slope_sg_window));
-        if (engine.m_slope_sg_window % 2 == 0) engine.m_slope_sg_window++; // Must be odd for SG
-        engine.m_slope_sensitivity = (std::max)(0.1f, slope_sensitivity);
 
-        engine.m_slope_smoothing_tau = (std::max)(0.001f, slope_smoothing_tau);
-
-        // v0.7.3: Slope stability fixes
-        engine.m_slope_alpha_threshold = (std::max)(0.001f, slope_alpha_threshold); // Critical for slope division
-        engine.m_slope_decay_rate = (std::max)(0.1f, slope_decay_rate);
-        engine.m_slope_confidence_enabled = slope_confidence_enabled;
+        // Cross-field constraints
+        if (engine.m_slope_sg_window % 2 == 0) engine.m_slope_sg_window++; // Must be odd for SG
         engine.m_slope_confidence_max_rate = (std::max)(engine.m_slope_alpha_threshold + 0.01f, slope_confidence_max_rate);
 
-        // v0.7.11: Min/Max thresholds
-        engine.m_slope_min_threshold = slope_min_threshold;
-        engine.m_slope_max_threshold = slope_max_threshold;
-
-        // NEW v0.7.40: Advanced Slope Settings
-        engine.m_slope_g_slew_limit = (std::max)(1.0f, slope_g_slew_limit);
-        engine.m_slope_use_torque = slope_use_torque;
-        engine.m_slope_torque_sensitivity = (std::max)(0.01f, slope_torque_sensitivity);
-
         // Stage 1 & 2 Normalization (Issue #152 & #153)
         // Initialize session peak from target rim torque to provide a sane starting point.
         engine.m_session_peak_torque = (std::max)(1.0, (double)target_rim_nm);
@@ -393,277 +311,20 @@ struct Preset {
 
     // NEW: Ensure values are within safe ranges (v0.7.16)
     void Validate() {
-        gain = (std::max)(0.0f, gain);
-        understeer = (std::max)(0.0f, (std::min)(2.0f, understeer));
-        sop = (std::max)(0.0f, (std::min)(2.0f, sop));
-        sop_scale = (std::max)(0.01f, sop_scale);
-        sop_smoothing = (std::max)(0.0f, (std::min)(1.0f, sop_smoothing));
-        slip_smoothing = (std::max)(0.0001f, slip_smoothing);
-        min_force = (std::max)(0.0f, min_force);
-        oversteer_boost = (std::max)(0.0f, oversteer_boost);
-        dynamic_weight_gain = (std::max)(0.0f, (std::min)(2.0f, dynamic_weight_gain));
-        dynamic_weight_smoothing = (std::max)(0.0f, dynamic_weight_smoothing);
-        grip_smoothing_steady = (std::max)(0.0f, grip_smoothing_steady);
-        grip_smoothing_fast = (std::max)(0.0f, grip_smoothing_fast);
-        grip_smoothing_sensitivity = (std::max)(0.001f, grip_smoothing_sensitivity);
-        lockup_gain = (std::max)(0.0f, lockup_gain);
-        lockup_start_pct = (std::max)(0.1f, lockup_start_pct);
-        lockup_full_pct = (std::max)(0.2f, lockup_full_pct);
-        lockup_rear_boost = (std::max)(0.0f, lockup_rear_boost);
-        lockup_gamma = (std::max)(0.1f, lockup_gamma);
-        lockup_prediction_sens = (std::max)(1.0f, lockup_prediction_sens);
-        lockup_bump_reject = (std::max)(0.01f, lockup_bump_reject);
-        brake_load_cap = (std::max)(1.0f, brake_load_cap);
-        texture_load_cap = (std::max)(1.0f, texture_load_cap);
-        abs_gain = (std::max)(0.0f, abs_gain);
-        spin_gain = (std::max)(0.0f, spin_gain);
-        slide_gain = (std::max)(0.0f, slide_gain);
-        slide_freq = (std::max)(0.1f, slide_freq);
-        road_gain = (std::max)(0.0f, road_gain);
-        tactile_gain = (std::max)(0.0f, (std::min)(2.0f, tactile_gain));
-        soft_lock_stiffness = (std::max)(0.0f, soft_lock_stiffness);
-        soft_lock_damping = (std::max)(0.0f, soft_lock_damping);
-        wheelbase_max_nm = (std::max)(1.0f, wheelbase_max_nm);
-        target_rim_nm = (std::max)(1.0f, target_rim_nm);
-        abs_freq = (std::max)(1.0f, abs_freq);
-        lockup_freq_scale = (std::max)(0.1f, lockup_freq_scale);
-        spin_freq_scale = (std::max)(0.1f, spin_freq_scale);
-        scrub_drag_gain = (std::max)(0.0f, scrub_drag_gain);
-        rear_align_effect = (std::max)(0.0f, rear_align_effect);
-        sop_yaw_gain = (std::max)(0.0f, sop_yaw_gain);
-        gyro_gain = (std::max)(0.0f, gyro_gain);
-        steering_shaft_gain = (std::max)(0.0f, steering_shaft_gain);
-        ingame_ffb_gain = (std::max)(0.0f, ingame_ffb_gain);
-        torque_source = (std::max)(0, (std::min)(1, torque_source));
-        // torque_passthrough is bool, no clamp needed
-        notch_q = (std::max)(0.1f, notch_q);
-        flatspot_strength = (std::max)(0.0f, (std::min)(1.0f, flatspot_strength));
-        static_notch_freq = (std::max)(1.0f, static_notch_freq);
-        static_notch_width = (std::max)(0.1f, static_notch_width);
-        speed_gate_upper = (std::max)(0.1f, speed_gate_upper);
-        optimal_slip_angle = (std::max)(0.01f, optimal_slip_angle);
-        optimal_slip_ratio = (std::max)(0.01f, optimal_slip_ratio);
-        steering_shaft_smoothing = (std::max)(0.0f, steering_shaft_smoothing);
-        gyro_smoothing = (std::max)(0.0f, gyro_smoothing);
-        yaw_smoothing = (std::max)(0.0f, yaw_smoothing);
-        chassis_smoothing = (std::max)(0.0f, chassis_smoothing);
-        road_fallback_scale = (std::max)(0.0f, road_fallback_scale);
-        slope_sg_window = (std::max)(5, (std::min)(41, slope_sg_window));
+        FieldRegistry::Clamp(*this);
+        torque_source = (std::max)(0, (std::min)(1, torque_source)); // Apply passes it through unclamped
         if (slope_sg_window % 2 == 0) slope_sg_window++;
-        slope_sensitivity = (std::max)(0.1f, slope_sensitivity);
-        slope_smoothing_tau = (std::max)(0.001f, slope_smoothing_tau);
-        slope_alpha_threshold = (std::max)(0.001f, slope_alpha_threshold);
-        slope_decay_rate = (std::max)(0.1f, slope_decay_rate);
-        slope_g_slew_limit = (std::max)(1.0f, slope_g_slew_limit);
-        slope_torque_sensitivity = (std::max)(0.01f, slope_torque_sensitivity);
         slope_confidence_max_rate = (std::max)(slope_alpha_threshold + 0.01f, slope_confidence_max_rate);
     }
 
     // NEW: Capture current engine state into this preset
     void UpdateFromEngine(const FFBEngine& engine) {
-        dynamic_normalization_enabled = engine.m_dynamic_normalization_enabled;
-        auto_load_normalization_enabled = engine.m_auto_load_normalization_enabled;
-        gain = engine.m_gain;
-        understeer = engine.m_understeer_effect;
-        sop = engine.m_sop_effect;
-        sop_scale = engine.m_sop_scale;
-        sop_smoothing = engine.m_sop_smoothing_factor;
-        slip_smoothing = engine.m_slip_angle_smoothing;
-        min_force = engine.m_min_force;
-        oversteer_boost = engine.m_oversteer_boost;
-        dynamic_weight_gain = engine.m_dynamic_weight_gain;
-        dynamic_weight_smoothing = engine.m_dynamic_weight_smoothing;
-        grip_smoothing_steady = engine.m_grip_smoothing_steady;
-        grip_smoothing_fast = engine.m_grip_smoothing_fast;
-        grip_smoothing_sensitivity = engine.m_grip_smoothing_sensitivity;
-        lockup_enabled = engine.m_lockup_enabled;
-        lockup_gain = engine.m_lockup_gain;
-        lockup_start_pct = engine.m_lockup_start_pct;
-        lockup_full_pct = engine.m_lockup_full_pct;
-        lockup_rear_boost = engine.m_lockup_rear_boost;
-        lockup_gamma = engine.m_lockup_gamma;
-        lockup_prediction_sens = engine.m_lockup_prediction_sens;
-        lockup_bump_reject = engine.m_lockup_bump_reject;
-        brake_load_cap = engine.m_brake_load_cap;
-        texture_load_cap = engine.m_texture_load_cap;  // NEW v0.6.25
-        abs_pulse_enabled = engine.m_abs_pulse_enabled;
-        abs_gain = engine.m_abs_gain;
-        
-        spin_enabled = engine.m_spin_enabled;
-        spin_gain = engine.m_spin_gain;
-        slide_enabled = engine.m_slide_texture_enabled;
-        slide_gain = engine.m_slide_texture_gain;
-        slide_freq = engine.m_slide_freq_scale;
-        road_enabled = engine.m_road_texture_enabled;
-        road_gain = engine.m_road_texture_gain;
-        tactile_gain = engine.m_tactile_gain;
-
-        soft_lock_enabled = engine.m_soft_lock_enabled;
-        soft_lock_stiffness = engine.m_soft_lock_stiffness;
-        soft_lock_damping = engine.m_soft_lock_damping;
-
-        wheelbase_max_nm = engine.m_wheelbase_max_nm;
-        target_rim_nm = engine.m_target_rim_nm;
-        abs_freq = engine.m_abs_freq_hz;
-        lockup_freq_scale = engine.m_lockup_freq_scale;
-        spin_freq_scale = engine.m_spin_freq_scale;
-        bottoming_method = engine.m_bottoming_method;
-        scrub_drag_gain = engine.m_scrub_drag_gain;
-        rear_align_effect = engine.m_rear_align_effect;
-        sop_yaw_gain = engine.m_sop_yaw_gain;
-        gyro_gain = engine.m_gyro_gain;
-        steering_shaft_gain = engine.m_steering_shaft_gain;
-        ingame_ffb_gain = engine.m_ingame_ffb_gain;
-        torque_source = engine.m_torque_source;
-        torque_passthrough = engine.m_torque_passthrough;
-        flatspot_suppression = engine.m_flatspot_suppression;
-        notch_q = engine.m_notch_q;
-        flatspot_strength = engine.m_flatspot_strength;
-        static_notch_enabled = engine.m_static_notch_enabled;
-        static_notch_freq = engine.m_static_notch_freq;
-        static_notch_width = engine.m_static_notch_width;
-        yaw_kick_threshold = engine.m_yaw_kick_threshold;
-        speed_gate_lower = engine.m_speed_gate_lower;
-        speed_gate_upper = engine.m_speed_gate_upper;
-
-        // NEW: Grip & Smoothing (v0.5.7/v0.5.8)
-        optimal_slip_angle = engine.m_optimal_slip_angle;
-        optimal_slip_ratio = engine.m_optimal_slip_ratio;
-        steering_shaft_smoothing = engine.m_steering_shaft_smoothing;
-        gyro_smoothing = engine.m_gyro_smoothing;
-        yaw_smoothing = engine.m_yaw_accel_smoothing;
-        chassis_smoothing = engine.m_chassis_inertia_smoothing;
-        road_fallback_scale = engine.m_road_fallback_scale;
-        understeer_affects_sop = engine.m_understeer_affects_sop;
-
-        // Slope Detection (v0.7.0)
-        slope_detection_enabled = engine.m_slope_detection_enabled;
-        slope_sg_window = engine.m_slope_sg_window;
-        slope_sensitivity = engine.m_slope_sensitivity;
-
-        slope_smoothing_tau = engine.m_slope_smoothing_tau;
-
-        // v0.7.3: Slope stability fixes
-        slope_alpha_threshold = engine.m_slope_alpha_threshold;
-        slope_decay_rate = engine.m_slope_decay_rate;
-        slope_confidence_enabled = engine.m_slope_confidence_enabled;
-        slope_confidence_max_rate = engine.m_slope_confidence_max_rate;
-
-        // v0.7.11: Min/Max thresholds
-        slope_min_threshold = engine.m_slope_min_threshold;
-        slope_max_threshold = engine.m_slope_max_threshold;
-
-        // NEW v0.7.40: Advanced Slope Settings
-        slope_g_slew_limit = engine.m_slope_g_slew_limit;
-        slope_use_torque = engine.m_slope_use_torque;
-        slope_torque_sensitivity = engine.m_slope_torque_sensitivity;
+        FieldRegistry::Capture(*this, engine);
         app_version = LMUFFB_VERSION;
     }
 
     bool Equals(const Preset& p) const {
-        const float eps = 0.0001f;
-        auto is_near = [](float a, float b, float epsilon) { return std::abs(a - b) < epsilon; };
-
-        if (!is_near(gain, p.gain, eps)) return false;
-        if (!is_near(understeer, p.understeer, eps)) return false;
-        if (!is_near(sop, p.sop, eps)) return false;
-        if (!is_near(sop_scale, p.sop_scale, eps)) return false;
-        if (!is_near(sop_smoothing, p.sop_smoothing, eps)) return false;
-        if (!is_near(slip_smoothing, p.slip_smoothing, eps)) return false;
-        if (!is_near(min_force, p.min_force, eps)) return false;
-        if (!is_near(oversteer_boost, p.oversteer_boost, eps)) return false;
-        if (!is_near(dynamic_weight_gain, p.dynamic_weight_gain, eps)) return false;
-        if (!is_near(dynamic_weight_smoothing, p.dynamic_weight_smoothing, eps)) return false;
-        if (!is_near(grip_smoothing_steady, p.grip_smoothing_steady, eps)) return false;
-        if (!is_near(grip_smoothing_fast, p.grip_smoothing_fast, eps)) return false;
-        if (!is_near(grip_smoothing_sensitivity, p.grip_smoothing_sensitivity, eps)) return false;
-
-        if (lockup_enabled != p.lockup_enabled) return false;
-        if (!is_near(lockup_gain, p.lockup_gain, eps)) return false;
-        if (!is_near(lockup_start_pct, p.lockup_start_pct, eps)) return false;
-        if (!is_near(lockup_full_pct, p.lockup_full_pct, eps)) return false;
-        if (!is_near(lockup_rear_boost, p.lockup_rear_boost, eps)) return false;
-        if (!is_near(lockup_gamma, p.lockup_gamma, eps)) return false;
-        if (!is_near(lockup_prediction_sens, p.lockup_prediction_sens, eps)) return false;
-        if (!is_near(lockup_bump_reject, p.lockup_bump_reject, eps)) return false;
-        if (!is_near(brake_load_cap, p.brake_load_cap, eps)) return false;
-        if (!is_near(texture_load_cap, p.texture_load_cap, eps)) return false;
-
-        if (abs_pulse_enabled != p.abs_pulse_enabled) return false;
-        if (!is_near(abs_gain, p.abs_gain, eps)) return false;
-        if (!is_near(abs_freq, p.abs_freq, eps)) return false;
-
-        if (spin_enabled != p.spin_enabled) return false;
-        if (!is_near(spin_gain, p.spin_gain, eps)) return false;
-        if (!is_near(spin_freq_scale, p.spin_freq_scale, eps)) return false;
-
-        if (slide_enabled != p.slide_enabled) return false;
-        if (!is_near(slide_gain, p.slide_gain, eps)) return false;
-        if (!is_near(slide_freq, p.slide_freq, eps)) return false;
-
-        if (road_enabled != p.road_enabled) return false;
-        if (!is_near(road_gain, p.road_gain, eps)) return false;
-        if (!is_near(tactile_gain, p.tactile_gain, eps)) return false;
-
-        if (dynamic_normalization_enabled != p.dynamic_normalization_enabled) return false;
-        if (auto_load_normalization_enabled != p.auto_load_normalization_enabled) return false;
-
-        if (soft_lock_enabled != p.soft_lock_enabled) return false;
-        if (!is_near(soft_lock_stiffness, p.soft_lock_stiffness, eps)) return false;
-        if (!is_near(soft_lock_damping, p.soft_lock_damping, eps)) return false;
-
-        if (!is_near(wheelbase_max_nm, p.wheelbase_max_nm, eps)) return false;
-        if (!is_near(target_rim_nm, p.target_rim_nm, eps)) return false;
-        if (!is_near(lockup_freq_scale, p.lockup_freq_scale, eps)) return false;
-        if (bottoming_method != p.bottoming_method) return false;
-        if (!is_near(scrub_drag_gain, p.scrub_drag_gain, eps)) return false;
-        if (!is_near(rear_align_effect, p.rear_align_effect, eps)) return false;
-        if (!is_near(sop_yaw_gain, p.sop_yaw_gain, eps)) return false;
-        if (!is_near(gyro_gain, p.gyro_gain, eps)) return false;
-        if (!is_near(steering_shaft_gain, p.steering_shaft_gain, eps)) return false;
-        if (!is_near(ingame_ffb_gain, p.ingame_ffb_gain, eps)) return false;
-        if (torque_source != p.torque_source) return false;
-        if (torque_passthrough != p.torque_passthrough) return false;
-
-        if (!is_near(optimal_slip_angle, p.optimal_slip_angle, eps)) return false;
-        if (!is_near(optimal_slip_ratio, p.optimal_slip_ratio, eps)) return false;
-        if (!is_near(steering_shaft_smoothing, p.steering_shaft_smoothing, eps)) return false;
-        if (!is_near(gyro_smoothing, p.gyro_smoothing, eps)) return false;
-        if (!is_near(yaw_smoothing, p.yaw_smoothing, eps)) return false;
-        if (!is_near(chassis_smoothing, p.chassis_smoothing, eps)) return false;
-
-        if (flatspot_suppression != p.flatspot_suppression) return false;
-        if (!is_near(notch_q, p.notch_q, eps)) return false;
-        if (!is_near(flatspot_strength, p.flatspot_strength, eps)) return false;
-
-        if (static_notch_enabled != p.static_notch_enabled) return false;
-        if (!is_near(static_notch_freq, p.static_notch_freq, eps)) return false;
-        if (!is_near(static_notch_width, p.static_notch_width, eps)) return false;
-        if (!is_near(yaw_kick_threshold, p.yaw_kick_threshold, eps)) return false;
-
-        if (!is_near(speed_gate_lower, p.speed_gate_lower, eps)) return false;
-        if (!is_near(speed_gate_upper, p.speed_gate_upper, eps)) return false;
-
-        if (!is_near(road_fallback_scale, p.road_fallback_scale, eps)) return false;
-        if (understeer_affects_sop != p.understeer_affects_sop) return false;
-
-        if (slope_detection_enabled != p.slope_detection_enabled) return false;
-        if (slope_sg_window != p.slope_sg_window) return false;
-        if (!is_near(slope_sensitivity, p.slope_sensitivity, eps)) return false;
-
-        if (!is_near(slope_smoothing_tau, p.slope_smoothing_tau, eps)) return false;
-        if (!is_near(slope_alpha_threshold, p.slope_alpha_threshold, eps)) return false;
-        if (!is_near(slope_decay_rate, p.slope_decay_rate, eps)) return false;
-        if (slope_confidence_enabled != p.slope_confidence_enabled) return false;
-        if (!is_near(slope_min_threshold, p.slope_min_threshold, eps)) return false;
-        if (!is_near(slope_max_threshold, p.slope_max_threshold, eps)) return false;
-
-        if (!is_near(slope_g_slew_limit, p.slope_g_slew_limit, eps)) return false;
-        if (slope_use_torque != p.slope_use_torque) return false;
-        if (!is_near(slope_torque_sensitivity, p.slope_torque_sensitivity, eps)) return false;
-        if (!is_near(slope_confidence_max_rate, p.slope_confidence_max_rate, eps)) return false;
-
-        return true;
+        return FieldRegistry::Equal(*this, p);
     }
 };
 
@@ -672,6 +333,14 @@ public:
     static std::string m_config_path; // Default: "config.ini"
     static void Save(const FFBEngine& engine, const std::string& filename = "");
     static void Load(FFBEngine& engine, const std::string& filename = "");
+
+    // Non-blocking save (v0.7.112): snapshots the settings under g_engine_mutex and
+    // hands the disk write (temp file + atomic rename) to a background thread.
+    // Requests within SAVE_DEBOUNCE_MS are coalesced. Save() stays synchronous.
+    static void RequestSave(const FFBEngine& engine, const std::string& filename = "");
+    static void FlushPendingSaves(); // Writes queued saves and stops the writer thread
+    static constexpr int SAVE_DEBOUNCE_MS = 250;
+    static constexpr int SAVE_MAX_DELAY_MS = 1000;
     
     // Preset Management
     static std::vector<Preset> presets;
@@ -689,6 +358,7 @@ public:
 
     // NEW: Import/Export (v0.7.12)
     static void ExportPreset(int index, const std::string& filename);
+    static void ExportPreset(const Preset& p, const std::string& filename);
     static bool ImportPreset(const std::string& filename, const FFBEngine& engine);
 
     // NEW: Persist selected device
@@ -698,29 +368,33 @@ public:
     static bool m_always_on_top;      // NEW: Keep window on top
     static bool m_auto_start_logging; // NEW: Auto-start logging
     static std::string m_log_path;    // NEW: Path to save logs
+    static bool m_log_compress;       // v0.7.112: Write compressed .lmz logs
+    static bool m_flight_recorder;    // v0.7.112: Crash-safe ring of the last seconds (applied at startup)
+    static int m_flight_recorder_seconds;
+    static bool m_anomaly_dumps;      // v0.7.112: Save the recorder window around anomalies
 
     // Window Geometry Persistence (v0.5.5)
     static int win_pos_x, win_pos_y;
     static int win_w_small, win_h_small; // Dimensions for Config Only
     static int win_w_large, win_h_large; // Dimensions for Config + Graphs
     static bool show_graphs;             // Remember if graphs were open
-
-    // Persistent storage for vehicle static loads (v0.7.70)
-    static std::map<std::string, double> m_saved_static_loads;
-    static std::recursive_mutex m_static_loads_mutex;
+    static std::string plot_panels;      // Plot panel layout, PlotPanelSet::Serialize (v0.7.112)
 
     // Flag to request a save from the main thread (avoids File I/O on FFB thread)
     static std::atomic<bool> m_needs_save;
 
-    // Thread-safe access to static loads map (v0.7.70)
+    // Thread-safe access to saved static loads (v0.7.70)
+    // v0.7.112: Backed by VehicleProfileStore; a legacy [StaticLoads] section is imported on Load.
     static void SetSavedStaticLoad(const std::string& vehicleName, double value);
     static bool GetSavedStaticLoad(const std::string& vehicleName, double& value);
 
 private:
     // Helper for parsing preset lines (v0.7.12)
-    static void ParsePresetLine(const std::string& line, Preset& p, std::string& version, bool& needs_save, bool& legacy_torque_hack, float& legacy_torque_val);
+    static void ParsePresetLine(std::string_view line, Preset& p, std::string& version, bool& needs_save, bool& legacy_torque_hack, float& legacy_torque_val);
     // Helper for writing preset fields (v0.7.12)
-    static void WritePresetFields(std::ofstream& file, const Preset& p);
+    static void WritePresetFields(std::ostream& file, const Preset& p);
+    // Full config.ini contents, built under g_engine_mutex
+    static std::string SerializeSnapshot(const FFBEngine& engine);
 };
 
 
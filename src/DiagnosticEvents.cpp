@@ -0,0 +1,251 @@
+#include "DiagnosticEvents.h"
+#include "Logger.h"
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+struct EventInfo {
+    DiagEvent code;
+    const char* name;
+    int min_interval_ms; // Per-type rate limit
+};
+
+// Indexed by DiagEvent. Telemetry warnings are already one-shot per engine, the
+// interval only matters when several engines (fleet, tuner) report the same problem.
+constexpr EventInfo kEvents[] = {
+    { DiagEvent::InvalidDeltaTime,      "Invalid DeltaTime",          5000 },
+    { DiagEvent::MissingTireLoad,       "Missing mTireLoad",          5000 },
+    { DiagEvent::MissingSuspForce,      "Missing mSuspForce",         5000 },
+    { DiagEvent::MissingSuspDeflection, "Missing mSuspDeflection",    5000 },
+    { DiagEvent::MissingLatForceFront,  "Missing mLateralForce (F)",  5000 },
+    { DiagEvent::MissingLatForceRear,   "Missing mLateralForce (R)",  5000 },
+    { DiagEvent::MissingVertDeflection, "Missing mVertTireDeflection",5000 },
+    { DiagEvent::MissingGripFract,      "Missing mGripFract",         5000 },
+    { DiagEvent::StaticLoadLatched,     "Static Load Latched",        1000 },
+    { DiagEvent::StaticLoadRestored,    "Static Load Restored",        250 },
+    { DiagEvent::StaticLoadUnknown,     "Static Load Unknown",         250 },
+    { DiagEvent::VehicleClassSeeded,    "Vehicle Class Seeded",        250 },
+    { DiagEvent::NormalizationReset,    "Normalization Reset",         250 },
+    { DiagEvent::LowSampleRate,         "Low Sample Rate",            5000 },
+};
+static_assert(sizeof(kEvents) / sizeof(kEvents[0]) == (size_t)DiagEvent::Count, "kEvents must cover every DiagEvent");
+
+int64_t NowMs() {
+    return std::chrono::duration_cast<std::chrono::milliseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+void CopyText(char* dst, size_t size, const char* src) {
+    if (!src) { dst[0] = '\0'; return; }
+    size_t n = strnlen(src, size - 1);
+    std::memcpy(dst, src, n);
+    dst[n] = '\0';
+}
+
+const char* MissingDataSuffix() {
+    return ". (Likely Encrypted/DLC Content). A fallback estimation will be used.";
+}
+
+} // namespace
+
+DiagnosticEvents& DiagnosticEvents::Get() {
+    static DiagnosticEvents instance;
+    return instance;
+}
+
+DiagnosticEvents::DiagnosticEvents() : m_ring(new Slot[QUEUE_SIZE]) {
+    for (size_t i = 0; i < QUEUE_SIZE; ++i) m_ring[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+DiagnosticEvents::~DiagnosticEvents() {
+    // No final Drain here: the Logger singleton may already be gone at static destruction.
+    m_running = false;
+    if (m_consumer.joinable()) m_consumer.join();
+}
+
+void DiagnosticEvents::Post(DiagEvent code, const char* vehicle, double a, double b, const char* text, const char* detail,
+                            double c_value, double d_value) {
+    if (code >= DiagEvent::Count) return;
+    Counters& c = m_counters[(size_t)code];
+
+    // Rate limit: only one poster per interval wins the CAS
+    int64_t now = NowMs();
+    int64_t last = c.last_post_ms.load(std::memory_order_relaxed);
+    if (last != INT64_MIN && now - last < kEvents[(size_t)code].min_interval_ms) {
+        c.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    if (!c.last_post_ms.compare_exchange_strong(last, now, std::memory_order_relaxed)) {
+        c.suppressed.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+
+    size_t pos = m_head.load(std::memory_order_relaxed);
+    Slot* slot = nullptr;
+    for (;;) {
+        slot = &m_ring[pos & (QUEUE_SIZE - 1)];
+        size_t seq = slot->sequence.load(std::memory_order_acquire);
+        if (seq == pos) {
+            if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+        } else if (seq < pos) {
+            c.dropped.fetch_add(1, std::memory_order_relaxed);
+            return;
+        } else {
+            pos = m_head.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->rec.code = code;
+    slot->rec.a = a;
+    slot->rec.b = b;
+    slot->rec.c = c_value;
+    slot->rec.d = d_value;
+    CopyText(slot->rec.vehicle, sizeof(slot->rec.vehicle), vehicle);
+    CopyText(slot->rec.text, sizeof(slot->rec.text), text);
+    CopyText(slot->rec.detail, sizeof(slot->rec.detail), detail);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    c.posted.fetch_add(1, std::memory_order_relaxed);
+}
+
+size_t DiagnosticEvents::Drain(std::ostream& out) {
+    return DrainImpl(&out);
+}
+
+size_t DiagnosticEvents::DrainToLog() {
+    return DrainImpl(nullptr);
+}
+
+size_t DiagnosticEvents::DrainImpl(std::ostream* out) {
+    std::lock_guard<std::mutex> lock(m_drain_mutex);
+    size_t count = 0;
+    for (;;) {
+        Slot& slot = m_ring[m_tail & (QUEUE_SIZE - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != m_tail + 1) break;
+        DiagEventRecord rec = slot.rec;
+        slot.sequence.store(m_tail + QUEUE_SIZE, std::memory_order_release);
+        ++m_tail;
+        ++count;
+
+        // One sink only: the Logger already echoes to the console
+        std::string line = Render(rec);
+        if (out) {
+            *out << line << "\n";
+        } else if (Logger::Get().IsInitialized()) {
+            Logger::Get().LogStr(line);
+        } else {
+            std::cout << line << "\n";
+        }
+    }
+    if (count > 0) (out ? *out : std::cout).flush();
+    return count;
+}
+
+void DiagnosticEvents::Start() {
+    if (m_running.exchange(true)) return;
+    m_consumer = std::thread(&DiagnosticEvents::ConsumerLoop, this);
+}
+
+void DiagnosticEvents::Stop() {
+    if (m_running.exchange(false) && m_consumer.joinable()) m_consumer.join();
+    DrainToLog();
+}
+
+void DiagnosticEvents::ConsumerLoop() {
+    while (m_running) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(CONSUMER_PERIOD_MS));
+        DrainToLog();
+    }
+}
+
+DiagEventStats DiagnosticEvents::GetStats(DiagEvent code) const {
+    if (code >= DiagEvent::Count) return { "Unknown", 0, 0, 0 };
+    const Counters& c = m_counters[(size_t)code];
+    return { GetName(code),
+             c.posted.load(std::memory_order_relaxed),
+             c.suppressed.load(std::memory_order_relaxed),
+             c.dropped.load(std::memory_order_relaxed) };
+}
+
+const char* DiagnosticEvents::GetName(DiagEvent code) {
+    if (code >= DiagEvent::Count) return "Unknown";
+    return kEvents[(size_t)code].name;
+}
+
+std::string DiagnosticEvents::Render(const DiagEventRecord& rec) {
+    std::ostringstream ss;
+    switch (rec.code) {
+        case DiagEvent::InvalidDeltaTime:
+            ss << "[WARNING] Invalid DeltaTime (<=0). Using default " << rec.a << "s.";
+            break;
+        case DiagEvent::MissingTireLoad:
+            ss << "Warning: Data for mTireLoad from the game seems to be missing for this car (" << rec.vehicle
+               << "). (Likely Encrypted/DLC Content). Using Kinematic Fallback.";
+            break;
+        case DiagEvent::MissingSuspForce:
+            ss << "Warning: Data for mSuspForce from the game seems to be missing for this car (" << rec.vehicle << ")" << MissingDataSuffix();
+            break;
+        case DiagEvent::MissingSuspDeflection:
+            ss << "Warning: Data for mSuspensionDeflection from the game seems to be missing for this car (" << rec.vehicle << ")" << MissingDataSuffix();
+            break;
+        case DiagEvent::MissingLatForceFront:
+            ss << "Warning: Data for mLateralForce (Front) from the game seems to be missing for this car (" << rec.vehicle << ")" << MissingDataSuffix();
+            break;
+        case DiagEvent::MissingLatForceRear:
+            ss << "Warning: Data for mLateralForce (Rear) from the game seems to be missing for this car (" << rec.vehicle << ")" << MissingDataSuffix();
+            break;
+        case DiagEvent::MissingVertDeflection:
+            ss << "[WARNING] mVerticalTireDeflection is missing for car: " << rec.vehicle
+               << ". (Likely Encrypted/DLC Content). Road Texture fallback active.";
+            break;
+        case DiagEvent::MissingGripFract:
+            ss << "Warning: Data for mGripFract from the game seems to be missing for this car (" << rec.vehicle << ")" << MissingDataSuffix();
+            break;
+        case DiagEvent::StaticLoadLatched:
+            ss << "[FFB] Latched and saved static load for " << rec.vehicle << ": " << rec.a << "N";
+            break;
+        case DiagEvent::StaticLoadRestored:
+            ss << "[FFB] Loaded persistent static load for " << rec.vehicle << ": " << rec.a << "N";
+            break;
+        case DiagEvent::StaticLoadUnknown:
+            ss << "[FFB] No saved load for " << rec.vehicle << ". Learning required.";
+            break;
+        case DiagEvent::VehicleClassSeeded:
+            ss << "[FFB] Vehicle Identification -> Detected Class: " << rec.text
+               << " | Seed Load: " << rec.a << "N (Raw -> Class: " << rec.detail
+               << ", Name: " << rec.vehicle << ")";
+            break;
+        case DiagEvent::NormalizationReset:
+            ss << "[FFB] Normalization state reset. Structural Peak: " << rec.a
+               << " Nm | Load Peak: " << rec.b << " N";
+            break;
+        case DiagEvent::LowSampleRate:
+            ss << "[WARNING] Low Sample Rate detected: ";
+            if (rec.a > 0.0) ss << "Loop=" << (int)rec.a << "Hz ";
+            if (rec.b > 0.0) ss << "Telemetry=" << (int)rec.b << "Hz ";
+            if (rec.c > 0.0) ss << "Torque=" << (int)rec.c << "Hz (Target " << (int)rec.d << "Hz) ";
+            break;
+        default:
+            ss << "[Diag] Unknown event " << (int)rec.code;
+            break;
+    }
+    return ss.str();
+}
+
+void DiagnosticEvents::Reset() {
+    std::lock_guard<std::mutex> lock(m_drain_mutex);
+    for (;;) {
+        Slot& slot = m_ring[m_tail & (QUEUE_SIZE - 1)];
+        if (slot.sequence.load(std::memory_order_acquire) != m_tail + 1) break;
+        slot.sequence.store(m_tail + QUEUE_SIZE, std::memory_order_release);
+        ++m_tail;
+    }
+    for (auto& c : m_counters) {
+        c.posted = 0;
+        c.suppressed = 0;
+        c.dropped = 0;
+        c.last_post_ms = INT64_MIN;
+    }
+}
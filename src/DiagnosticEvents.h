@@ -0,0 +1,115 @@
+#ifndef DIAGNOSTICEVENTS_H
+#define DIAGNOSTICEVENTS_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+
+// Diagnostic Event Channel (v0.7.112)
+// The physics thread reports noteworthy conditions (missing telemetry, invalid dt,
+// static load latching, class seeding, low sample rates) as a typed code plus numeric payload instead
+// of writing to std::cout. Post() only copies the payload into a pre-allocated
+// lock-free ring; a consumer thread renders the text into the debug log, which
+// echoes it to the console.
+// Each code has its own minimum interval and counters shown in the GUI.
+enum class DiagEvent : uint8_t {
+    InvalidDeltaTime = 0,
+    MissingTireLoad,
+    MissingSuspForce,
+    MissingSuspDeflection,
+    MissingLatForceFront,
+    MissingLatForceRear,
+    MissingVertDeflection,
+    MissingGripFract,
+    StaticLoadLatched,      // a = load [N]
+    StaticLoadRestored,     // a = load [N]
+    StaticLoadUnknown,
+    VehicleClassSeeded,     // a = seed load [N], text = detected class, detail = raw class
+    NormalizationReset,     // a = structural peak [Nm], b = load peak [N]
+    LowSampleRate,          // a = loop, b = telemetry, c = torque, d = expected torque [Hz]; 0 = not low
+    Count
+};
+
+struct DiagEventRecord {
+    DiagEvent code = DiagEvent::InvalidDeltaTime;
+    double a = 0.0;
+    double b = 0.0;
+    double c = 0.0;
+    double d = 0.0;
+    char vehicle[64] = {};
+    char text[32] = {};
+    char detail[32] = {};
+};
+
+struct DiagEventStats {
+    const char* name;
+    uint64_t posted;      // Accepted into the queue
+    uint64_t suppressed;  // Rejected by the rate limit
+    uint64_t dropped;     // Rejected because the queue was full
+};
+
+class DiagnosticEvents {
+public:
+    static constexpr size_t QUEUE_SIZE = 128; // Must be a power of two
+    static constexpr int CONSUMER_PERIOD_MS = 50;
+
+    static DiagnosticEvents& Get();
+
+    // Real-time safe: no locks, no allocation, no I/O.
+    void Post(DiagEvent code, const char* vehicle = nullptr, double a = 0.0, double b = 0.0,
+              const char* text = nullptr, const char* detail = nullptr, double c = 0.0, double d = 0.0);
+
+    // Renders every queued event to `out`; returns the number consumed. Single consumer.
+    size_t Drain(std::ostream& out);
+    // Same, into the debug Logger (which echoes to the console), or std::cout while
+    // the Logger has no file
+    size_t DrainToLog();
+
+    // Background consumer draining into the debug Logger
+    void Start();
+    void Stop();
+
+    DiagEventStats GetStats(DiagEvent code) const;
+    uint64_t GetPostedCount(DiagEvent code) const { return GetStats(code).posted; }
+
+    static const char* GetName(DiagEvent code);
+    static std::string Render(const DiagEventRecord& rec);
+
+    // Clears the queue, counters and rate-limit history (tests)
+    void Reset();
+
+private:
+    DiagnosticEvents();
+    ~DiagnosticEvents();
+
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        DiagEventRecord rec;
+    };
+
+    struct Counters {
+        std::atomic<uint64_t> posted{0};
+        std::atomic<uint64_t> suppressed{0};
+        std::atomic<uint64_t> dropped{0};
+        std::atomic<int64_t> last_post_ms{INT64_MIN};
+    };
+
+    void ConsumerLoop();
+    size_t DrainImpl(std::ostream* out);
+
+    std::unique_ptr<Slot[]> m_ring;
+    std::atomic<size_t> m_head{0};
+    size_t m_tail = 0;             // Guarded by m_drain_mutex
+    std::mutex m_drain_mutex;
+    Counters m_counters[(size_t)DiagEvent::Count];
+
+    std::atomic<bool> m_running{false};
+    std::thread m_consumer;
+};
+
+#endif // DIAGNOSTICEVENTS_H
@@ -1,5 +1,8 @@
 #include "FFBEngine.h"
+#include "AnomalyTrigger.h"
 #include "Config.h"
+#include "DiagnosticEvents.h"
+#include "FlightRecorder.h"
 #include <iostream>
 #include <mutex>
 
@@ -42,7 +45,10 @@ bool FFBEngine::IsFFBAllowed(const VehicleScoringInfoV01& scoring, unsigned char
 // Clamps the rate of change of the output force to prevent violent jolts.
 // If restricted is true (e.g. after finish or lost control), limit is tighter.
 double FFBEngine::ApplySafetySlew(double target_force, double dt, bool restricted) {
-    if (!std::isfinite(target_force)) return 0.0;
+    if (!std::isfinite(target_force)) {
+        if (!m_isolated) AnomalyTrigger::Get().Fire(AnomalyType::NonFinite, 1.0);
+        return 0.0;
+    }
     double max_slew = restricted ? (double)SAFETY_SLEW_RESTRICTED : (double)SAFETY_SLEW_NORMAL;
     double max_change = max_slew * dt;
     double delta = target_force - m_last_output_force;
@@ -54,12 +60,8 @@ double FFBEngine::ApplySafetySlew(double target_force, double dt, bool restricte
 // Helper to retrieve data (Consumer)
 std::vector<FFBSnapshot> FFBEngine::GetDebugBatch() {
     std::vector<FFBSnapshot> batch;
-    {
-        std::lock_guard<std::mutex> lock(m_debug_mutex);
-        if (!m_debug_buffer.empty()) {
-            batch.swap(m_debug_buffer);
-        }
-    }
+    batch.reserve(DEBUG_BUFFER_CAP);
+    m_batch_reader.ReadCopy(batch, DEBUG_BUFFER_CAP);
     return batch;
 }
 
@@ -125,11 +127,34 @@ double FFBEngine::apply_signal_conditioning(double raw_torque, const TelemInfoV0
     double circumference = TWO_PI * radius;
     double wheel_freq = (circumference > 0.0) ? (ctx.car_speed / circumference) : 0.0;
     m_theoretical_freq = wheel_freq;
+
+    // Spectrum (v0.7.112): measured oscillation peaks, taken before the notches remove them
+    // Peaks are searched once per spectrum frame; between frames the result is reused
+    if (m_spectrum.Push(game_force_proc, ctx.dt) && m_notch_auto_tune) {
+        double measured = 0.0;
+        m_flatspot_peak_ratio = (m_flatspot_suppression && wheel_freq > 1.0 &&
+            m_spectrum.FindPeak(wheel_freq * (1.0 - NOTCH_TRACK_RANGE), wheel_freq * (1.0 + NOTCH_TRACK_RANGE), measured))
+            ? measured / wheel_freq : 0.0;
+        double center = (double)m_static_notch_freq;
+        m_static_notch_peak_hz = (m_static_notch_enabled &&
+            m_spectrum.FindPeak(center * (1.0 - NOTCH_TRACK_RANGE), center * (1.0 + NOTCH_TRACK_RANGE), measured))
+            ? measured : 0.0;
+    }
+    // A notch switched off (or auto-tune itself) forgets its peak, so re-enabling starts clean
+    if (!m_notch_auto_tune || !m_flatspot_suppression || wheel_freq <= 1.0) m_flatspot_peak_ratio = 0.0;
+    if (!m_notch_auto_tune || !m_static_notch_enabled) m_static_notch_peak_hz = 0.0;
     
     // Dynamic Notch Filter
     if (m_flatspot_suppression) {
         if (wheel_freq > 1.0) {
-            m_notch_filter.Update(wheel_freq, 1.0/ctx.dt, (double)m_notch_q);
+            // v0.7.112: Auto-tune follows the measured peak near the theoretical wheel frequency
+            // The ratio follows speed changes between frames
+            double notch_freq = wheel_freq;
+            if (m_notch_auto_tune && m_flatspot_peak_ratio > 0.0) {
+                notch_freq = wheel_freq * m_flatspot_peak_ratio;
+            }
+            m_flatspot_notch_freq = notch_freq;
+            m_notch_filter.Update(notch_freq, 1.0/ctx.dt, (double)m_notch_q);
             double input_force = game_force_proc;
             double filtered_force = m_notch_filter.Process(input_force);
             game_force_proc = input_force * (1.0f - m_flatspot_strength) + filtered_force * m_flatspot_strength;
@@ -142,8 +167,15 @@ double FFBEngine::apply_signal_conditioning(double raw_torque, const TelemInfoV0
     if (m_static_notch_enabled) {
          double bw = (double)m_static_notch_width;
          if (bw < MIN_NOTCH_WIDTH_HZ) bw = MIN_NOTCH_WIDTH_HZ;
-         double q = (double)m_static_notch_freq / bw;
-         m_static_notch_filter.Update((double)m_static_notch_freq, 1.0/ctx.dt, q);
+         double center = (double)m_static_notch_freq;
+         // A peak found before the center was moved no longer applies
+         if (m_notch_auto_tune && m_static_notch_peak_hz > 0.0 &&
+             std::abs(m_static_notch_peak_hz - center) <= center * NOTCH_TRACK_RANGE) {
+             center = m_static_notch_peak_hz;
+         }
+         m_static_notch_applied_freq = center;
+         double q = center / bw;
+         m_static_notch_filter.Update(center, 1.0/ctx.dt, q);
          game_force_proc = m_static_notch_filter.Process(game_force_proc);
     } else {
          m_static_notch_filter.Reset();
@@ -155,7 +187,8 @@ double FFBEngine::apply_signal_conditioning(double raw_torque, const TelemInfoV0
 // Refactored calculate_force
 double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleClass, const char* vehicleName, float genFFBTorque, bool allowed) {
     if (!data) return 0.0;
-    std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
+    std::unique_lock<std::recursive_mutex> lock(g_engine_mutex, std::defer_lock);
+    if (!m_isolated) lock.lock();
 
     // Select Torque Source
     // v0.7.63 Fix: genFFBTorque (Direct Torque 400Hz) is normalized [-1.0, 1.0].
@@ -163,7 +196,10 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
     double raw_torque_input = (m_torque_source == 1) ? (double)genFFBTorque * (double)m_wheelbase_max_nm : data->mSteeringShaftTorque;
 
     // RELIABILITY FIX: Sanitize input torque
-    if (!std::isfinite(raw_torque_input)) return 0.0;
+    if (!std::isfinite(raw_torque_input)) {
+        if (!m_isolated) AnomalyTrigger::Get().Fire(AnomalyType::NonFinite, 0.0);
+        return 0.0;
+    }
 
     // --- 0. DYNAMIC NORMALIZATION (Issue #152) ---
     // 1. Contextual Spike Rejection (Lightweight MAD alternative)
@@ -177,6 +213,7 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
 
     // Flag as spike if torque jumps > 3x the rolling average (with a 15Nm floor to prevent low-speed false positives)
     bool is_contextual_spike = (current_abs_torque > (m_rolling_average_torque * TORQUE_SPIKE_RATIO)) && (current_abs_torque > TORQUE_SPIKE_MIN_NM);
+    if (is_contextual_spike && !m_isolated) AnomalyTrigger::Get().Fire(AnomalyType::TorqueSpike, current_abs_torque);
 
     // Safety check for clean state
     bool is_clean_state = (lat_g_abs < LAT_G_CLEAN_LIMIT) && (torque_slew < TORQUE_SLEW_CLEAN_LIMIT) && !is_contextual_spike;
@@ -208,9 +245,9 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
     m_smoothed_structural_mult += alpha_gain * (target_structural_mult - m_smoothed_structural_mult);
 
     // Class Seeding
+    // v0.7.112: Cars of the same class have their own profiles, so compare the full name too
     bool seeded = false;
-    if (vehicleClass && m_current_class_name != vehicleClass) {
-        m_current_class_name = vehicleClass;
+    if (vehicleClass && !IsSeededFor(vehicleClass, vehicleName)) {
         InitializeLoadReference(vehicleClass, vehicleName);
         seeded = true;
     }
@@ -223,7 +260,7 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
     if (ctx.dt <= DT_EPSILON) {
         ctx.dt = DEFAULT_DT; // Default to 400Hz
         if (!m_warned_dt) {
-            std::cout << "[WARNING] Invalid DeltaTime (<=0). Using default " << DEFAULT_DT << "s." << std::endl;
+            DiagnosticEvents::Get().Post(DiagEvent::InvalidDeltaTime, data->mVehicleName, DEFAULT_DT);
             m_warned_dt = true;
         }
         ctx.frame_warn_dt = true;
@@ -233,8 +270,8 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
     ctx.car_speed = std::abs(ctx.car_speed_long);
     
     // Update Context strings (for UI/Logging)
-    // Only update if first char differs to avoid redundant copies
-    if (m_vehicle_name[0] != data->mVehicleName[0] || m_vehicle_name[VEHICLE_NAME_CHECK_IDX] != data->mVehicleName[VEHICLE_NAME_CHECK_IDX]) {
+    // Only update if the names differ to avoid redundant copies
+    if (std::strncmp(m_vehicle_name, data->mVehicleName, STR_MAX_64) != 0 || std::strncmp(m_track_name, data->mTrackName, STR_MAX_64) != 0) {
 #ifdef _WIN32
          strncpy_s(m_vehicle_name, sizeof(m_vehicle_name), data->mVehicleName, _TRUNCATE);
          strncpy_s(m_track_name, sizeof(m_track_name), data->mTrackName, _TRUNCATE);
@@ -255,6 +292,13 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
     m_accel_x_smoothed += alpha_chassis * (data->mLocalAccel.x - m_accel_x_smoothed);
     m_accel_z_smoothed += alpha_chassis * (data->mLocalAccel.z - m_accel_z_smoothed);
 
+    // Chassis State Estimator (v0.7.112)
+    if (m_chassis_estimator_enabled) {
+        m_chassis_estimator.Update(data, ctx.dt);
+    } else {
+        m_chassis_estimator.Reset();
+    }
+
     // --- 3. TELEMETRY PROCESSING ---
     // Front Wheels
     const TelemWheelV01& fl = data->mWheel[0];
@@ -283,34 +327,25 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
 
     // --- 4. PRE-CALCULATIONS ---
 
-    // Average Load & Fallback Logic
-    ctx.avg_load = raw_load;
-
     // Hysteresis for missing load
-    if (ctx.avg_load < 1.0 && ctx.car_speed > SPEED_EPSILON) {
+    if (raw_load < 1.0 && ctx.car_speed > SPEED_EPSILON) {
         m_missing_load_frames++;
     } else {
         m_missing_load_frames = (std::max)(0, m_missing_load_frames - 1);
     }
 
     if (m_missing_load_frames > MISSING_LOAD_WARN_THRESHOLD) {
-        // Fallback Logic
-        if (fl.mSuspForce > MIN_VALID_SUSP_FORCE) {
-            double calc_load_fl = approximate_load(fl);
-            double calc_load_fr = approximate_load(fr);
-            ctx.avg_load = (calc_load_fl + calc_load_fr) / DUAL_DIVISOR;
-        } else {
-            double kin_load_fl = calculate_kinematic_load(data, 0);
-            double kin_load_fr = calculate_kinematic_load(data, 1);
-            ctx.avg_load = (kin_load_fl + kin_load_fr) / DUAL_DIVISOR;
-        }
         if (!m_warned_load) {
-            std::cout << "Warning: Data for mTireLoad from the game seems to be missing for this car (" << data->mVehicleName << "). (Likely Encrypted/DLC Content). Using Kinematic Fallback." << std::endl;
+            DiagnosticEvents::Get().Post(DiagEvent::MissingTireLoad, data->mVehicleName);
             m_warned_load = true;
         }
         ctx.frame_warn_load = true;
     }
 
+    // Per-Wheel Load & Fallback Logic (v0.7.112)
+    update_wheel_states(data, ctx);
+    ctx.avg_load = (ctx.wheels[0].load + ctx.wheels[1].load) / DUAL_DIVISOR;
+
     // Sanity Checks (Missing Data)
     
     // 1. Suspension Force (mSuspForce)
@@ -321,7 +356,7 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
          m_missing_susp_force_frames = (std::max)(0, m_missing_susp_force_frames - 1);
     }
     if (m_missing_susp_force_frames > MISSING_TELEMETRY_WARN_THRESHOLD && !m_warned_susp_force) {
-         std::cout << "Warning: Data for mSuspForce from the game seems to be missing for this car (" << data->mVehicleName << "). (Likely Encrypted/DLC Content). A fallback estimation will be used." << std::endl;
+         DiagnosticEvents::Get().Post(DiagEvent::MissingSuspForce, data->mVehicleName);
          m_warned_susp_force = true;
     }
 
@@ -333,7 +368,7 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
         m_missing_susp_deflection_frames = (std::max)(0, m_missing_susp_deflection_frames - 1);
     }
     if (m_missing_susp_deflection_frames > MISSING_TELEMETRY_WARN_THRESHOLD && !m_warned_susp_deflection) {
-        std::cout << "Warning: Data for mSuspensionDeflection from the game seems to be missing for this car (" << data->mVehicleName << "). (Likely Encrypted/DLC Content). A fallback estimation will be used." << std::endl;
+        DiagnosticEvents::Get().Post(DiagEvent::MissingSuspDeflection, data->mVehicleName);
         m_warned_susp_deflection = true;
     }
 
@@ -345,7 +380,7 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
         m_missing_lat_force_front_frames = (std::max)(0, m_missing_lat_force_front_frames - 1);
     }
     if (m_missing_lat_force_front_frames > MISSING_TELEMETRY_WARN_THRESHOLD && !m_warned_lat_force_front) {
-         std::cout << "Warning: Data for mLateralForce (Front) from the game seems to be missing for this car (" << data->mVehicleName << "). (Likely Encrypted/DLC Content). A fallback estimation will be used." << std::endl;
+         DiagnosticEvents::Get().Post(DiagEvent::MissingLatForceFront, data->mVehicleName);
          m_warned_lat_force_front = true;
     }
 
@@ -357,7 +392,7 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
         m_missing_lat_force_rear_frames = (std::max)(0, m_missing_lat_force_rear_frames - 1);
     }
     if (m_missing_lat_force_rear_frames > MISSING_TELEMETRY_WARN_THRESHOLD && !m_warned_lat_force_rear) {
-         std::cout << "Warning: Data for mLateralForce (Rear) from the game seems to be missing for this car (" << data->mVehicleName << "). (Likely Encrypted/DLC Content). A fallback estimation will be used." << std::endl;
+         DiagnosticEvents::Get().Post(DiagEvent::MissingLatForceRear, data->mVehicleName);
          m_warned_lat_force_rear = true;
     }
 
@@ -369,8 +404,7 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
         m_missing_vert_deflection_frames = (std::max)(0, m_missing_vert_deflection_frames - 1);
     }
     if (m_missing_vert_deflection_frames > MISSING_TELEMETRY_WARN_THRESHOLD && !m_warned_vert_deflection) {
-        std::cout << "[WARNING] mVerticalTireDeflection is missing for car: " << data->mVehicleName 
-                  << ". (Likely Encrypted/DLC Content). Road Texture fallback active." << std::endl;
+        DiagnosticEvents::Get().Post(DiagEvent::MissingVertDeflection, data->mVehicleName);
         m_warned_vert_deflection = true;
     }
     
@@ -443,9 +477,26 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
     m_grip_diag.front_approximated = front_grip_res.approximated;
     m_grip_diag.front_slip_angle = front_grip_res.slip_angle;
     if (front_grip_res.approximated) ctx.frame_warn_grip = true;
+    for (int i = 0; i < 2; i++) {
+        ctx.wheels[i].grip = front_grip_res.wheel_grip[i];
+        ctx.wheels[i].slip_angle = front_grip_res.wheel_slip_angle[i];
+        ctx.wheels[i].grip_approximated = front_grip_res.approximated;
+    }
+
+    // v0.7.112: Learn the lateral force peak from the unfiltered per-wheel slip angles
+    if (m_adaptive_slip_angle && !ctx.frame_warn_load) {
+        for (const TelemWheelV01* w : { &fl, &fr }) {
+            double v_long = (std::max)(std::abs(w->mLongitudinalGroundVel), MIN_SLIP_ANGLE_VELOCITY);
+            m_slip_estimator.Update(std::atan2(w->mLateralPatchVel, v_long), w->mLateralForce, w->mTireLoad, ctx.car_speed);
+        }
+    }
+
+    // Latency Compensation (v0.7.112): shaft torque only, the 400Hz in-game signal has none to hide
+    double horizon_s = (m_torque_source == 0) ? (double)m_torque_prediction_ms / 1000.0 : 0.0;
+    double torque_in = m_torque_predictor.Process(raw_torque_input, data->mUnfilteredSteering, data->mLocalRot.y, horizon_s, ctx.dt);
 
     // 2. Signal Conditioning (Smoothing, Notch Filters)
-    double game_force_proc = apply_signal_conditioning(raw_torque_input, data, ctx);
+    double game_force_proc = apply_signal_conditioning(torque_in, data, ctx);
 
     // Base Steering Force (Issue #178)
     double base_input = game_force_proc;
@@ -579,88 +630,106 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
 
     // --- 9. SNAPSHOT ---
     // This block captures the current state of the FFB Engine (inputs, outputs, intermediate calculations)
-    // into a thread-safe buffer. These snapshots are retrieved by the GUI layer (or other consumers)
-    // to visualize real-time telemetry graphs, FFB clipping, and effect contributions.
-    // It uses a mutex to protect the shared circular buffer.
+    // for the GUI layer (or other consumers) to visualize real-time telemetry graphs, FFB clipping,
+    // and effect contributions. It is written in place into the next slot of the snapshot ring and
+    // published by Commit(), no lock and no copy (v0.7.112).
+    // Isolated engines (FleetEvaluator) keep only the latest snapshot, owned by their worker.
     {
-        std::lock_guard<std::mutex> lock(m_debug_mutex);
-        if (m_debug_buffer.size() < DEBUG_BUFFER_CAP) {
-            FFBSnapshot snap;
-            snap.total_output = (float)norm_force;
-            snap.base_force = (float)base_input;
-            snap.sop_force = (float)ctx.sop_unboosted_force; // Use unboosted for snapshot
-            snap.understeer_drop = (float)((base_input * m_steering_shaft_gain) * (1.0 - grip_factor_applied));
-            snap.oversteer_boost = (float)(ctx.sop_base_force - ctx.sop_unboosted_force); // Exact boost amount
-
-            snap.ffb_rear_torque = (float)ctx.rear_torque;
-            snap.ffb_scrub_drag = (float)ctx.scrub_drag_force;
-            snap.ffb_yaw_kick = (float)ctx.yaw_force;
-            snap.ffb_gyro_damping = (float)ctx.gyro_force;
-            snap.texture_road = (float)ctx.road_noise;
-            snap.texture_slide = (float)ctx.slide_noise;
-            snap.texture_lockup = (float)ctx.lockup_rumble;
-            snap.texture_spin = (float)ctx.spin_rumble;
-            snap.texture_bottoming = (float)ctx.bottoming_crunch;
-            snap.ffb_abs_pulse = (float)ctx.abs_pulse_force; 
-            snap.ffb_soft_lock = (float)ctx.soft_lock_force;
-            snap.session_peak_torque = (float)m_session_peak_torque;
-            snap.clipping = (std::abs(norm_force) > (double)CLIPPING_THRESHOLD) ? 1.0f : 0.0f;
-
-            // Physics
-            snap.calc_front_load = (float)ctx.avg_load;
-            snap.calc_rear_load = (float)ctx.avg_rear_load;
-            snap.calc_rear_lat_force = (float)ctx.calc_rear_lat_force;
-            snap.calc_front_grip = (float)ctx.avg_grip;
-            snap.calc_rear_grip = (float)ctx.avg_rear_grip;
-            snap.calc_front_slip_angle_smoothed = (float)m_grip_diag.front_slip_angle;
-            snap.calc_rear_slip_angle_smoothed = (float)m_grip_diag.rear_slip_angle;
-
-            snap.raw_front_slip_angle = (float)calculate_raw_slip_angle_pair(fl, fr);
-            snap.raw_rear_slip_angle = (float)calculate_raw_slip_angle_pair(data->mWheel[2], data->mWheel[3]);
-
-            // Telemetry
-            snap.steer_force = (float)raw_torque;
-            snap.raw_shaft_torque = (float)data->mSteeringShaftTorque;
-            snap.raw_gen_torque = (float)genFFBTorque;
-            snap.raw_input_steering = (float)data->mUnfilteredSteering;
-            snap.raw_front_tire_load = (float)raw_load;
-            snap.raw_front_grip_fract = (float)raw_grip;
-            snap.raw_rear_grip = (float)((data->mWheel[2].mGripFract + data->mWheel[3].mGripFract) / DUAL_DIVISOR);
-            snap.raw_front_susp_force = (float)((fl.mSuspForce + fr.mSuspForce) / DUAL_DIVISOR);
-            snap.raw_front_ride_height = (float)((std::min)(fl.mRideHeight, fr.mRideHeight));
-            snap.raw_rear_lat_force = (float)((data->mWheel[2].mLateralForce + data->mWheel[3].mLateralForce) / DUAL_DIVISOR);
-            snap.raw_car_speed = (float)ctx.car_speed_long;
-            snap.raw_input_throttle = (float)data->mUnfilteredThrottle;
-            snap.raw_input_brake = (float)data->mUnfilteredBrake;
-            snap.accel_x = (float)data->mLocalAccel.x;
-            snap.raw_front_lat_patch_vel = (float)((std::abs(fl.mLateralPatchVel) + std::abs(fr.mLateralPatchVel)) / DUAL_DIVISOR);
-            snap.raw_front_deflection = (float)((fl.mVerticalTireDeflection + fr.mVerticalTireDeflection) / DUAL_DIVISOR);
-            snap.raw_front_long_patch_vel = (float)((fl.mLongitudinalPatchVel + fr.mLongitudinalPatchVel) / DUAL_DIVISOR);
-            snap.raw_rear_lat_patch_vel = (float)((std::abs(data->mWheel[2].mLateralPatchVel) + std::abs(data->mWheel[3].mLateralPatchVel)) / DUAL_DIVISOR);
-            snap.raw_rear_long_patch_vel = (float)((data->mWheel[2].mLongitudinalPatchVel + data->mWheel[3].mLongitudinalPatchVel) / DUAL_DIVISOR);
-
-            snap.warn_load = ctx.frame_warn_load;
-            snap.warn_grip = ctx.frame_warn_grip || ctx.frame_warn_rear_grip;
-            snap.warn_dt = ctx.frame_warn_dt;
-            snap.debug_freq = (float)m_debug_freq;
-            snap.tire_radius = (float)fl.mStaticUndeflectedRadius / 100.0f;
-            snap.slope_current = (float)m_slope_current; // v0.7.1: Slope detection diagnostic
-
-            snap.ffb_rate = (float)m_ffb_rate;
-            snap.telemetry_rate = (float)m_telemetry_rate;
-            snap.hw_rate = (float)m_hw_rate;
-            snap.torque_rate = (float)m_torque_rate;
-            snap.gen_torque_rate = (float)m_gen_torque_rate;
-
-            m_debug_buffer.push_back(snap);
+        FFBSnapshot& snap = m_isolated ? m_last_snapshot : m_snapshot_ring.BeginWrite();
+        snap.total_output = (float)norm_force;
+        snap.base_force = (float)base_input;
+        snap.sop_force = (float)ctx.sop_unboosted_force; // Use unboosted for snapshot
+        snap.understeer_drop = (float)((base_input * m_steering_shaft_gain) * (1.0 - grip_factor_applied));
+        snap.oversteer_boost = (float)(ctx.sop_base_force - ctx.sop_unboosted_force); // Exact boost amount
+
+        snap.ffb_rear_torque = (float)ctx.rear_torque;
+        snap.ffb_scrub_drag = (float)ctx.scrub_drag_force;
+        snap.ffb_yaw_kick = (float)ctx.yaw_force;
+        snap.ffb_gyro_damping = (float)ctx.gyro_force;
+        snap.texture_road = (float)ctx.road_noise;
+        snap.texture_slide = (float)ctx.slide_noise;
+        snap.texture_lockup = (float)ctx.lockup_rumble;
+        snap.texture_spin = (float)ctx.spin_rumble;
+        snap.texture_bottoming = (float)ctx.bottoming_crunch;
+        snap.ffb_abs_pulse = (float)ctx.abs_pulse_force; 
+        snap.ffb_soft_lock = (float)ctx.soft_lock_force;
+        snap.session_peak_torque = (float)m_session_peak_torque;
+        snap.clipping = (std::abs(norm_force) > (double)CLIPPING_THRESHOLD) ? 1.0f : 0.0f;
+
+        // Physics
+        snap.calc_front_load = (float)ctx.avg_load;
+        snap.calc_rear_load = (float)ctx.avg_rear_load;
+        snap.calc_rear_lat_force = (float)ctx.calc_rear_lat_force;
+        snap.calc_front_grip = (float)ctx.avg_grip;
+        snap.calc_rear_grip = (float)ctx.avg_rear_grip;
+        snap.calc_front_slip_angle_smoothed = (float)m_grip_diag.front_slip_angle;
+        snap.calc_rear_slip_angle_smoothed = (float)m_grip_diag.rear_slip_angle;
+
+        for (int i = 0; i < 4; i++) {
+            const WheelState& ws = ctx.wheels[i];
+            snap.wheel_load[i] = (float)ws.load;
+            snap.wheel_grip[i] = (float)ws.grip;
+            snap.wheel_slip_angle[i] = (float)ws.slip_angle;
+            snap.wheel_slip_ratio[i] = (float)ws.slip_ratio;
+            snap.wheel_load_approx[i] = ws.load_approximated;
+            snap.wheel_grip_approx[i] = ws.grip_approximated;
+        }
+
+        snap.raw_front_slip_angle = (float)calculate_raw_slip_angle_pair(fl, fr);
+        snap.raw_rear_slip_angle = (float)calculate_raw_slip_angle_pair(data->mWheel[2], data->mWheel[3]);
+
+        // Telemetry
+        snap.steer_force = (float)raw_torque;
+        snap.raw_shaft_torque = (float)data->mSteeringShaftTorque;
+        snap.raw_gen_torque = (float)genFFBTorque;
+        snap.raw_input_steering = (float)data->mUnfilteredSteering;
+        snap.raw_front_tire_load = (float)raw_load;
+        snap.raw_front_grip_fract = (float)raw_grip;
+        snap.raw_rear_grip = (float)((data->mWheel[2].mGripFract + data->mWheel[3].mGripFract) / DUAL_DIVISOR);
+        snap.raw_front_susp_force = (float)((fl.mSuspForce + fr.mSuspForce) / DUAL_DIVISOR);
+        snap.raw_front_ride_height = (float)((std::min)(fl.mRideHeight, fr.mRideHeight));
+        snap.raw_rear_lat_force = (float)((data->mWheel[2].mLateralForce + data->mWheel[3].mLateralForce) / DUAL_DIVISOR);
+        snap.raw_car_speed = (float)ctx.car_speed_long;
+        snap.raw_input_throttle = (float)data->mUnfilteredThrottle;
+        snap.raw_input_brake = (float)data->mUnfilteredBrake;
+        snap.accel_x = (float)data->mLocalAccel.x;
+        snap.raw_front_lat_patch_vel = (float)((std::abs(fl.mLateralPatchVel) + std::abs(fr.mLateralPatchVel)) / DUAL_DIVISOR);
+        snap.raw_front_deflection = (float)((fl.mVerticalTireDeflection + fr.mVerticalTireDeflection) / DUAL_DIVISOR);
+        snap.raw_front_long_patch_vel = (float)((fl.mLongitudinalPatchVel + fr.mLongitudinalPatchVel) / DUAL_DIVISOR);
+        snap.raw_rear_lat_patch_vel = (float)((std::abs(data->mWheel[2].mLateralPatchVel) + std::abs(data->mWheel[3].mLateralPatchVel)) / DUAL_DIVISOR);
+        snap.raw_rear_long_patch_vel = (float)((data->mWheel[2].mLongitudinalPatchVel + data->mWheel[3].mLongitudinalPatchVel) / DUAL_DIVISOR);
+
+        snap.warn_load = ctx.frame_warn_load;
+        snap.warn_grip = ctx.frame_warn_grip || ctx.frame_warn_rear_grip;
+        snap.warn_dt = ctx.frame_warn_dt;
+        snap.debug_freq = (float)m_debug_freq;
+        snap.tire_radius = (float)fl.mStaticUndeflectedRadius / 100.0f;
+        snap.slope_current = (float)m_slope_current; // v0.7.1: Slope detection diagnostic
+
+        snap.ffb_rate = (float)m_ffb_rate;
+        snap.telemetry_rate = (float)m_telemetry_rate;
+        snap.hw_rate = (float)m_hw_rate;
+        snap.torque_rate = (float)m_torque_rate;
+        snap.gen_torque_rate = (float)m_gen_torque_rate;
+
+        if (!m_isolated) {
+            // Crash-safe ring of the last seconds (v0.7.112): plain stores into mapped pages
+            if (FlightRecorder::Get().IsOpen()) FlightRecorder::Get().Record(snap, data, genFFBTorque);
+            // Sustained clipping fires once per run of clipped ticks
+            m_clip_run_ticks = (snap.clipping > 0.0f) ? m_clip_run_ticks + 1 : 0;
+            if (m_clip_run_ticks == AnomalyTrigger::CLIP_BURST_TICKS) {
+                AnomalyTrigger::Get().Fire(AnomalyType::ClippingBurst, norm_force);
+            }
+            m_snapshot_ring.Commit();
         }
     }
     
     // Telemetry Logging (v0.7.x)
-    if (AsyncLogger::Get().IsLogging()) {
-        LogFrame frame;
+    if (!m_isolated && AsyncLogger::Get().IsLogging()) {
+        LogFrame frame = {};
         frame.timestamp = data->mElapsedTime;
         frame.delta_time = data->mDeltaTime;
+        frame.lap = (int)data->mLapNumber;
         
         // Inputs
         frame.steering = (float)data->mUnfilteredSteering;
@@ -682,6 +751,24 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
         frame.grip_fr = (float)fr.mGripFract;
         frame.load_fl = (float)fl.mTireLoad;
         frame.load_fr = (float)fr.mTireLoad;
+
+        // Rear Axle raw (v0.7.112)
+        const TelemWheelV01& rl = data->mWheel[2];
+        const TelemWheelV01& rr = data->mWheel[3];
+        frame.slip_angle_rl = (float)rl.mLateralPatchVel / (float)(std::max)(1.0, ctx.car_speed);
+        frame.slip_angle_rr = (float)rr.mLateralPatchVel / (float)(std::max)(1.0, ctx.car_speed);
+        frame.slip_ratio_rl = (float)ctx.wheels[2].slip_ratio;
+        frame.slip_ratio_rr = (float)ctx.wheels[3].slip_ratio;
+        frame.grip_rl = (float)rl.mGripFract;
+        frame.grip_rr = (float)rr.mGripFract;
+        frame.load_rl = (float)rl.mTireLoad;
+        frame.load_rr = (float)rr.mTireLoad;
+
+        // Per-wheel estimates (v0.7.112)
+        for (int i = 0; i < 4; i++) {
+            frame.calc_load[i] = (float)ctx.wheels[i].load;
+            frame.calc_grip[i] = (float)ctx.wheels[i].grip;
+        }
         
         // Calculated values
         frame.calc_slip_angle_front = (float)m_grip_diag.front_slip_angle;
@@ -734,16 +821,23 @@ double FFBEngine::calculate_force(const TelemInfoV01* data, const char* vehicleC
 void FFBEngine::calculate_sop_lateral(const TelemInfoV01* data, FFBCalculationContext& ctx) {
     // 1. Raw Lateral G (Chassis-relative X)
     // Clamp to 5G to prevent numeric instability in crashes
-    double raw_g = (std::max)(-G_LIMIT_5G * GRAVITY_MS2, (std::min)(G_LIMIT_5G * GRAVITY_MS2, data->mLocalAccel.x));
+    // v0.7.112: The chassis estimator's fused lateral acceleration replaces the smoother
+    bool use_chassis_state = m_chassis_estimator_enabled && m_chassis_estimator.IsInitialized();
+    double accel_x = use_chassis_state ? m_chassis_estimator.GetLatAccel() : data->mLocalAccel.x;
+    double raw_g = (std::max)(-G_LIMIT_5G * GRAVITY_MS2, (std::min)(G_LIMIT_5G * GRAVITY_MS2, accel_x));
     double lat_g = (raw_g / GRAVITY_MS2);
     
-    // Smoothing: Map 0.0-1.0 slider to 0.1-0.0001s tau
-    double smoothness = 1.0 - (double)m_sop_smoothing_factor;
-    smoothness = (std::max)(0.0, (std::min)(SMOOTHNESS_LIMIT_0999, smoothness));
-    double tau = smoothness * SOP_SMOOTHING_MAX_TAU;
-    double alpha = ctx.dt / (tau + ctx.dt);
-    alpha = (std::max)(MIN_LFM_ALPHA, (std::min)(1.0, alpha));
-    m_sop_lat_g_smoothed += alpha * (lat_g - m_sop_lat_g_smoothed);
+    if (use_chassis_state) {
+        m_sop_lat_g_smoothed = lat_g;
+    } else {
+        // Smoothing: Map 0.0-1.0 slider to 0.1-0.0001s tau
+        double smoothness = 1.0 - (double)m_sop_smoothing_factor;
+        smoothness = (std::max)(0.0, (std::min)(SMOOTHNESS_LIMIT_0999, smoothness));
+        double tau = smoothness * SOP_SMOOTHING_MAX_TAU;
+        double alpha = ctx.dt / (tau + ctx.dt);
+        alpha = (std::max)(MIN_LFM_ALPHA, (std::min)(1.0, alpha));
+        m_sop_lat_g_smoothed += alpha * (lat_g - m_sop_lat_g_smoothed);
+    }
     
     // Base SoP Force
     double sop_base = m_sop_lat_g_smoothed * m_sop_effect * (double)m_sop_scale;
@@ -759,6 +853,11 @@ void FFBEngine::calculate_sop_lateral(const TelemInfoV01* data, FFBCalculationCo
     m_grip_diag.rear_approximated = rear_grip_res.approximated;
     m_grip_diag.rear_slip_angle = rear_grip_res.slip_angle;
     if (rear_grip_res.approximated) ctx.frame_warn_rear_grip = true;
+    for (int i = 0; i < 2; i++) {
+        ctx.wheels[2 + i].grip = rear_grip_res.wheel_grip[i];
+        ctx.wheels[2 + i].slip_angle = rear_grip_res.wheel_slip_angle[i];
+        ctx.wheels[2 + i].grip_approximated = rear_grip_res.approximated;
+    }
     
     if (!m_slope_detection_enabled) {
         double grip_delta = ctx.avg_grip - ctx.avg_rear_grip;
@@ -775,8 +874,10 @@ void FFBEngine::calculate_sop_lateral(const TelemInfoV01* data, FFBCalculationCo
     ctx.avg_rear_load = (calc_load_rl + calc_load_rr) / DUAL_DIVISOR;
     
     // Rear lateral force estimation: F = Alpha * k * TireLoad
-    double rear_slip_angle = m_grip_diag.rear_slip_angle;
-    ctx.calc_rear_lat_force = rear_slip_angle * ctx.avg_rear_load * REAR_TIRE_STIFFNESS_COEFFICIENT;
+    // v0.7.112: Summed per wheel, so the loaded outside tyre dominates as it does on track
+    double rear_lat_rl = rear_grip_res.wheel_slip_angle[0] * calc_load_rl;
+    double rear_lat_rr = rear_grip_res.wheel_slip_angle[1] * calc_load_rr;
+    ctx.calc_rear_lat_force = (rear_lat_rl + rear_lat_rr) / DUAL_DIVISOR * REAR_TIRE_STIFFNESS_COEFFICIENT;
     ctx.calc_rear_lat_force = (std::max)(-MAX_REAR_LATERAL_FORCE, (std::min)(MAX_REAR_LATERAL_FORCE, ctx.calc_rear_lat_force));
     
     // Torque = Force * Aligning_Lever
@@ -784,17 +885,21 @@ void FFBEngine::calculate_sop_lateral(const TelemInfoV01* data, FFBCalculationCo
     ctx.rear_torque = -ctx.calc_rear_lat_force * REAR_ALIGN_TORQUE_COEFFICIENT * m_rear_align_effect;
     
     // 4. Yaw Kick (Inertial Oversteer)
-    double raw_yaw_accel = data->mLocalRotAccel.y;
+    double raw_yaw_accel = use_chassis_state ? m_chassis_estimator.GetYawAccel() : data->mLocalRotAccel.y;
     // v0.4.16: Reject yaw at low speeds and below threshold
     if (ctx.car_speed < MIN_YAW_KICK_SPEED_MS || std::abs(raw_yaw_accel) < (double)m_yaw_kick_threshold) {
         raw_yaw_accel = 0.0;
     }
     
-    // Alpha Smoothing (v0.4.16)
-    double tau_yaw = (double)m_yaw_accel_smoothing;
-    if (tau_yaw < MIN_TAU_S) tau_yaw = MIN_TAU_S;
-    double alpha_yaw = ctx.dt / (tau_yaw + ctx.dt);
-    m_yaw_accel_smoothed += alpha_yaw * (raw_yaw_accel - m_yaw_accel_smoothed);
+    // Alpha Smoothing (v0.4.16), already done by the chassis estimator when enabled
+    if (use_chassis_state) {
+        m_yaw_accel_smoothed = raw_yaw_accel;
+    } else {
+        double tau_yaw = (double)m_yaw_accel_smoothing;
+        if (tau_yaw < MIN_TAU_S) tau_yaw = MIN_TAU_S;
+        double alpha_yaw = ctx.dt / (tau_yaw + ctx.dt);
+        m_yaw_accel_smoothed += alpha_yaw * (raw_yaw_accel - m_yaw_accel_smoothed);
+    }
     
     ctx.yaw_force = -1.0 * m_yaw_accel_smoothed * m_sop_yaw_gain * (double)BASE_NM_YAW_KICK;
     
@@ -877,7 +982,8 @@ void FFBEngine::calculate_lockup_vibration(const TelemInfoV01* data, FFBCalculat
 
         // Pre-conditions
         bool brake_active = (data->mUnfilteredBrake > PREDICTION_BRAKE_THRESHOLD);
-        bool is_grounded = (w.mSuspForce > PREDICTION_LOAD_THRESHOLD);
+        // v0.7.112: Estimated wheel load also counts (cars with blocked suspension force)
+        bool is_grounded = ((std::max)((double)w.mSuspForce, ctx.wheels[i].load) > PREDICTION_LOAD_THRESHOLD);
 
         double start_threshold = (double)m_lockup_start_pct / PERCENT_TO_DECIMAL;
         double full_threshold = (double)m_lockup_full_pct / PERCENT_TO_DECIMAL;
@@ -1045,13 +1151,36 @@ void FFBEngine::calculate_road_texture(const TelemInfoV01* data, FFBCalculationC
         double delta_accel = vert_accel - m_prev_vert_accel;
         road_noise_val = delta_accel * ACCEL_ROAD_TEXTURE_SCALE * DEFLECTION_NM_SCALE; // Blend into similar range
     }
+
+    // Predictive Texture (v0.7.112)
+    // Learn the texture amplitude per track location. The amplitude learned
+    // ROAD_PREDICTION_LOOKAHEAD_S ahead of the car tops up the live signal where it
+    // is still weaker, so kerbs start early. The live signal is never reduced.
+    if (m_road_prediction > 0.0f && !m_isolated && ctx.car_speed > ROAD_PREDICTION_MIN_SPEED &&
+        m_track_map.Activate(data->mTrackName)) {
+        m_track_map.Learn(data->mPos, road_noise_val);
+
+        TelemVect3 ahead = data->mPos;
+        for (int i = 0; i < 3; i++) {
+            double world_vel = data->mOri[i].x * data->mLocalVel.x + data->mOri[i].y * data->mLocalVel.y + data->mOri[i].z * data->mLocalVel.z;
+            ahead[i] += world_vel * ROAD_PREDICTION_LOOKAHEAD_S;
+        }
+        double amplitude = 0.0;
+        double confidence = m_track_map.Predict(ahead, amplitude);
+        double lead = (double)m_road_prediction * confidence * (std::max)(0.0, amplitude - std::abs(road_noise_val));
+        // While the live signal is silent (smooth road, or a tick where deflection did not
+        // refresh) the lead keeps the last live direction instead of buzzing at the loop rate
+        if (road_noise_val != 0.0) m_road_lead_sign = std::copysign(1.0, road_noise_val);
+        road_noise_val += m_road_lead_sign * lead;
+    }
     
     ctx.road_noise = road_noise_val * m_road_texture_gain * ctx.texture_load_factor;
     ctx.road_noise *= ctx.speed_gate;
 }
 
 void FFBEngine::ResetNormalization() {
-    std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
+    std::unique_lock<std::recursive_mutex> lock(g_engine_mutex, std::defer_lock);
+    if (!m_isolated) lock.lock();
 
     // 1. Structural Normalization Reset (Stage 1)
     // If disabled, we return to the user's manual target.
@@ -1078,8 +1207,8 @@ void FFBEngine::ResetNormalization() {
 
     m_smoothed_tactile_mult = 1.0;
 
-    std::cout << "[FFB] Normalization state reset. Structural Peak: " << m_session_peak_torque
-              << " Nm | Load Peak: " << m_auto_peak_load << " N" << std::endl;
+    if (m_isolated) return;
+    DiagnosticEvents::Get().Post(DiagEvent::NormalizationReset, m_vehicle_name, m_session_peak_torque, m_auto_peak_load);
 }
 
 // Helper: Calculate Suspension Bottoming (v0.6.22)
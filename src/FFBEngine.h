@@ -5,6 +5,7 @@
 #include <algorithm>
 #include <vector>
 #include <mutex>
+#include <atomic>
 #include <iostream>
 #include <chrono>
 #include <array>
@@ -14,6 +15,12 @@
 #include "MathUtils.h"
 #include "PerfStats.h"
 #include "VehicleUtils.h"
+#include "TrackTextureMap.h"
+#include "SlipPeakEstimator.h"
+#include "ChassisStateEstimator.h"
+#include "TorquePredictor.h"
+#include "SpectrumAnalyzer.h"
+#include "SnapshotRing.h"
 
 #ifdef _WIN32
 #define NOINLINE __declspec(noinline)
@@ -89,6 +96,14 @@ struct FFBSnapshot {
     float raw_rear_lat_patch_vel;   // New v0.4.9
     float raw_rear_long_patch_vel;  // New v0.4.9
 
+    // --- Header D: Per-Wheel States (v0.7.112, index FL FR RL RR) ---
+    float wheel_load[4];
+    float wheel_grip[4];
+    float wheel_slip_angle[4];
+    float wheel_slip_ratio[4];
+    bool wheel_load_approx[4];
+    bool wheel_grip_approx[4];
+
     // Telemetry Health Flags
     bool warn_load;
     bool warn_grip;
@@ -106,6 +121,9 @@ struct FFBSnapshot {
     float gen_torque_rate;
 };
 
+// GUI hand-off ring (v0.7.112): 1024 slots, 2.56 s at 400 Hz, readers see the oldest 768
+using FFBSnapshotRing = SnapshotRing<FFBSnapshot, 1024>;
+
 // BiquadNotch moved to MathUtils.h
 
 // Helper Result Struct for calculate_grip
@@ -114,6 +132,20 @@ struct GripResult {
     bool approximated;      // Was approximation used?
     double original;        // Original telemetry value
     double slip_angle;      // Calculated slip angle (if approximated)
+    double wheel_grip[2];       // New v0.7.112: Unsmoothed per-wheel grip (w1, w2)
+    double wheel_slip_angle[2]; // New v0.7.112: Smoothed per-wheel slip angle (w1, w2)
+};
+
+// Per-wheel estimation state (v0.7.112). Index matches mWheel: 0=FL 1=FR 2=RL 3=RR.
+// Load and slip ratio come from update_wheel_states(); grip and slip angle are
+// filled by the axle grip estimator, which owns the per-wheel slip angle filters.
+struct WheelState {
+    double load = 0.0;         // N: mTireLoad, or suspension/kinematic estimate
+    double grip = 1.0;         // 0-1: mGripFract, or slip-based estimate
+    double slip_angle = 0.0;   // rad, signed
+    double slip_ratio = 0.0;   // signed, (patch - ground) / ground
+    bool load_approximated = false;
+    bool grip_approximated = false;
 };
 
 struct Preset;
@@ -147,6 +179,7 @@ struct FFBCalculationContext {
     double avg_rear_grip = 0.0;
     double calc_rear_lat_force = 0.0;
     double avg_rear_load = 0.0;
+    WheelState wheels[4];          // v0.7.112: Per-wheel states
 
     // Effect outputs
     double road_noise = 0.0;
@@ -232,6 +265,11 @@ public:
     
     bool m_road_texture_enabled;
     float m_road_texture_gain;
+    float m_road_prediction = 0.0f; // v0.7.112: Predictive road texture lead (0 = off)
+
+    // Learned road texture per track location (v0.7.112)
+    // Serviced (load/save) by the main thread via m_track_map.ServiceIO().
+    TrackTextureMap m_track_map;
     
     // Bottoming Effect (v0.3.2)
     bool m_bottoming_enabled = true;  
@@ -247,9 +285,17 @@ public:
     // NEW: Grip Estimation Settings (v0.5.7)
     float m_optimal_slip_angle;
     float m_optimal_slip_ratio;
+
+    // Learned per-car optimal slip angle (v0.7.112), replaces m_optimal_slip_angle when enabled
+    bool m_adaptive_slip_angle = false;
+    SlipPeakEstimator m_slip_estimator;
     
     // NEW: Steering Shaft Smoothing (v0.5.7)
     float m_steering_shaft_smoothing;
+
+    // Shaft torque latency compensation (v0.7.112), 0 = off
+    float m_torque_prediction_ms = 0.0f;
+    TorquePredictor m_torque_predictor;
     
     // v0.4.41: Signal Filtering Settings
     bool m_flatspot_suppression = false;
@@ -260,6 +306,10 @@ public:
     bool m_static_notch_enabled = false;
     float m_static_notch_freq = DEFAULT_STATIC_NOTCH_FREQ;
     float m_static_notch_width = DEFAULT_STATIC_NOTCH_WIDTH; 
+
+    // Spectrum-tracked notch centers (v0.7.112)
+    bool m_notch_auto_tune = false;
+    SpectrumAnalyzer m_spectrum;
     float m_yaw_kick_threshold = DEFAULT_YAW_KICK_THRESHOLD; 
 
     // v0.6.23: User-Adjustable Speed Gate
@@ -295,6 +345,10 @@ public:
     // Signal Diagnostics
     double m_debug_freq = 0.0; 
     double m_theoretical_freq = 0.0; 
+    double m_flatspot_notch_freq = 0.0; // Applied centers (v0.7.112), tracked or configured
+    double m_static_notch_applied_freq = 0.0;
+    double m_flatspot_peak_ratio = 0.0;  // Measured peak / wheel frequency, 0 if none (last spectrum frame)
+    double m_static_notch_peak_hz = 0.0; // Measured peak near the static center, 0 if none
 
     // Rate Monitoring (Issue #129)
     double m_ffb_rate = 0.0;
@@ -335,6 +389,7 @@ public:
     // Internal state
     double m_prev_vert_deflection[4] = {0.0, 0.0, 0.0, 0.0}; 
     double m_prev_vert_accel = 0.0; 
+    double m_road_lead_sign = 1.0; // Direction of the last non-zero live road texture (v0.7.112)
     double m_prev_slip_angle[4] = {0.0, 0.0, 0.0, 0.0}; 
     double m_prev_rotation[4] = {0.0, 0.0, 0.0, 0.0};    
     double m_prev_brake_pressure[4] = {0.0, 0.0, 0.0, 0.0}; 
@@ -352,6 +407,10 @@ public:
     // Kinematic Smoothing State (v0.4.38)
     double m_accel_x_smoothed = 0.0;
     double m_accel_z_smoothed = 0.0; 
+
+    // Chassis State Estimator (v0.7.112): replaces the SoP, yaw and kinematic smoothers when enabled
+    bool m_chassis_estimator_enabled = false;
+    ChassisStateEstimator m_chassis_estimator;
     
     // Kinematic Physics Parameters (v0.4.39)
     float m_approx_mass_kg = DEFAULT_APPROX_MASS_KG;
@@ -442,6 +501,7 @@ public:
     // Frequency Estimator State (v0.4.41)
     double m_last_crossing_time = 0.0;
     double m_last_output_force = 0.0; 
+    int m_clip_run_ticks = 0; // Consecutive clipped ticks (anomaly trigger, v0.7.112)
     double m_torque_ac_smoothed = 0.0; 
     double m_prev_ac_torque = 0.0;
 
@@ -452,9 +512,20 @@ public:
     ChannelStats s_lat_g;
     std::chrono::steady_clock::time_point last_log_time;
 
-    // Thread-Safe Buffer (Producer-Consumer)
-    std::vector<FFBSnapshot> m_debug_buffer;
-    std::mutex m_debug_mutex;
+    // Snapshot Ring (v0.7.112)
+    // Written in place by the FFB thread, copied out by the GUI through its own
+    // FFBSnapshotRing::Reader, which discards slots overwritten during the copy. Replaces the mutex-guarded vector that was swapped out
+    // (and reallocated) every GUI frame and dropped frames once 100 were pending.
+    FFBSnapshotRing m_snapshot_ring;
+    FFBSnapshotRing::Reader m_batch_reader{m_snapshot_ring}; // Cursor for GetDebugBatch()
+
+    // Isolated Instance Mode (v0.7.112)
+    // Set by FleetEvaluator for engines that evaluate other cars on worker threads.
+    // An isolated engine does not take g_engine_mutex, does not feed the GUI debug
+    // buffer or the AsyncLogger and never writes learned static loads back to Config.
+    // The latest snapshot is kept in m_last_snapshot instead.
+    bool m_isolated = false;
+    FFBSnapshot m_last_snapshot = {};
     
     friend class FFBEngineTests::FFBEngineTestAccess;
     friend struct Preset;
@@ -463,7 +534,13 @@ public:
 
     bool IsFFBAllowed(const VehicleScoringInfoV01& scoring, unsigned char gamePhase) const;
     double ApplySafetySlew(double target_force, double dt, bool restricted);
+    // Copies the newest DEBUG_BUFFER_CAP snapshots since the last call (tests, tools).
+    // The GUI reads m_snapshot_ring in place instead.
     std::vector<FFBSnapshot> GetDebugBatch();
+    const FFBSnapshotRing& GetSnapshotRing() const { return m_snapshot_ring; }
+    // Bumped on every published frame; the GUI compares it against the value at its
+    // last redraw to know whether anything changed (v0.7.112)
+    uint32_t GetFrameSequence() const { return (uint32_t)m_snapshot_ring.GetHead(); }
 
     // UI Reference & Physics Multipliers (v0.4.50)
     static constexpr float BASE_NM_SOP_LATERAL      = 1.0f;
@@ -549,7 +626,7 @@ private:
     static constexpr double DUAL_DIVISOR = 2.0;
     static constexpr double HALF_PERIOD_MULT = 0.5;
     static constexpr double MIN_NOTCH_WIDTH_HZ = 0.1;
-    static constexpr int    VEHICLE_NAME_CHECK_IDX = 10;
+    static constexpr double NOTCH_TRACK_RANGE = 0.25; // Auto-tune searches +/-25% around the expected center
     static constexpr int    DEBUG_BUFFER_CAP = 100;
     static constexpr double OVERSTEER_BOOST_MULT = 2.0;
     static constexpr double MIN_YAW_KICK_SPEED_MS = 5.0;
@@ -629,6 +706,8 @@ private:
     static constexpr double MIN_VALID_LAT_FORCE_N = 1.0;          // Minimum lateral force to consider data present (N)
     static constexpr double ROAD_TEXTURE_SPEED_THRESHOLD = 5.0;
     static constexpr double DEFLECTION_NM_SCALE = 50.0;
+    static constexpr double ROAD_PREDICTION_LOOKAHEAD_S = 0.03; // Typical telemetry-to-rim latency
+    static constexpr double ROAD_PREDICTION_MIN_SPEED = 5.0;    // m/s, no learning in the pits
     static constexpr double ACCEL_ROAD_TEXTURE_SCALE = 0.05;
     static constexpr double DEBUG_FREQ_SMOOTHING = 0.9;
     static constexpr double GAIN_REDUCTION_MAX = 50.0;
@@ -638,11 +717,37 @@ private:
     double m_last_raw_torque = 0.0; // New v0.7.67 (Issue #152)
 
     std::string m_current_class_name = "";
+    // Car whose learned profile is loaded; saved under this name on the next car change (v0.7.112)
+    char m_profile_vehicle[STR_BUF_64] = "";
 
     void update_static_load_reference(double current_load, double speed, double dt);
     void InitializeLoadReference(const char* className, const char* vehicleName);
     
 public:
+    // Writes learned normalization peaks of the current car to VehicleProfileStore (v0.7.112)
+    void SaveVehicleProfile();
+
+    // What a car change looks up in shared tables: class rules, learned profile and saved
+    // static load (v0.7.112). FleetEvaluator resolves it on its own thread, so the worker
+    // threads of its isolated engines never take those locks.
+    struct VehicleSeed {
+        ParsedVehicleClass vclass = ParsedVehicleClass::UNKNOWN;
+        double class_load = 0.0;           // Seed load of the class [N]
+        double learned_peak_load = 0.0;    // 0 = nothing learned
+        double learned_peak_torque = 0.0;  // 0 = nothing learned
+        bool has_slip_angle = false;
+        double learned_slip_angle = 0.0;
+        bool has_static_load = false;
+        double static_front_load = 0.0;
+    };
+    static VehicleSeed ResolveVehicleSeed(const char* className, const char* vehicleName);
+    // True when calculate_force() would not reseed for this class and car
+    bool IsSeededFor(const char* className, const char* vehicleName) const;
+    // Switches the engine to a car from resolved seed data
+    void SeedVehicle(const char* className, const char* vehicleName, const VehicleSeed& seed);
+    // Slip angle threshold used by the grip fallback: learned peak or m_optimal_slip_angle
+    double GetEffectiveOptimalSlipAngle(double tire_load) const;
+
     double calculate_raw_slip_angle_pair(const TelemWheelV01& w1, const TelemWheelV01& w2);
     double calculate_slip_angle(const TelemWheelV01& w, double& prev_state, double dt);
     
@@ -658,6 +763,7 @@ public:
                               const TelemInfoV01* data,
                               bool is_front);
 
+    void update_wheel_states(const TelemInfoV01* data, FFBCalculationContext& ctx);
     double approximate_load(const TelemWheelV01& w);
     double approximate_rear_load(const TelemWheelV01& w);
     double calculate_kinematic_load(const TelemInfoV01* data, int wheel_index);
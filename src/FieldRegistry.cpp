@@ -0,0 +1,331 @@
+#include "FieldRegistry.h"
+#include "Config.h"
+#include <algorithm>
+#include <cfloat>
+#include <cmath>
+#include <cstring>
+#include <utility>
+
+namespace {
+
+enum class FieldType { Float, Int, Bool };
+
+constexpr float NO_MIN = -FLT_MAX;
+constexpr float NO_MAX = FLT_MAX;
+
+struct FieldDesc {
+    const char* key;
+    const char* section;
+    FieldType type;
+    float Preset::* p_f;
+    int Preset::* p_i;
+    bool Preset::* p_b;
+    float FFBEngine::* e_f;
+    int FFBEngine::* e_i;
+    bool FFBEngine::* e_b;
+    float min_val;  // Safe range enforced by Apply/Validate
+    float max_val;
+    float load_max; // Extra upper clamp on file load (v0.4.50 legacy gain compensation)
+};
+
+constexpr FieldDesc F(const char* key, const char* section, float Preset::* p, float FFBEngine::* e,
+                      float lo = NO_MIN, float hi = NO_MAX, float load_max = NO_MAX) {
+    return { key, section, FieldType::Float, p, nullptr, nullptr, e, nullptr, nullptr, lo, hi, load_max };
+}
+constexpr FieldDesc I(const char* key, const char* section, int Preset::* p, int FFBEngine::* e,
+                      float lo = NO_MIN, float hi = NO_MAX) {
+    return { key, section, FieldType::Int, nullptr, p, nullptr, nullptr, e, nullptr, lo, hi, NO_MAX };
+}
+constexpr FieldDesc B(const char* key, const char* section, bool Preset::* p, bool FFBEngine::* e) {
+    return { key, section, FieldType::Bool, nullptr, nullptr, p, nullptr, nullptr, e, NO_MIN, NO_MAX, NO_MAX };
+}
+
+constexpr const char* S_GENERAL = "General FFB";
+constexpr const char* S_FRONT = "Front Axle (Understeer)";
+constexpr const char* S_REAR = "Rear Axle (Oversteer)";
+constexpr const char* S_PHYSICS = "Physics (Grip & Slip Angle)";
+constexpr const char* S_BRAKING = "Braking & Lockup";
+constexpr const char* S_TEXTURES = "Tactile Textures";
+constexpr const char* S_ADVANCED = "Advanced Settings";
+
+// Order defines the order in config.ini and exported presets.
+constexpr FieldDesc kFields[] = {
+    B("invert_force", S_GENERAL, nullptr, &FFBEngine::m_invert_force), // Device setting, not part of presets
+    F("gain", S_GENERAL, &Preset::gain, &FFBEngine::m_gain, 0.0f),
+    B("dynamic_normalization_enabled", S_GENERAL, &Preset::dynamic_normalization_enabled, &FFBEngine::m_dynamic_normalization_enabled),
+    B("auto_load_normalization_enabled", S_GENERAL, &Preset::auto_load_normalization_enabled, &FFBEngine::m_auto_load_normalization_enabled),
+    B("soft_lock_enabled", S_GENERAL, &Preset::soft_lock_enabled, &FFBEngine::m_soft_lock_enabled),
+    F("soft_lock_stiffness", S_GENERAL, &Preset::soft_lock_stiffness, &FFBEngine::m_soft_lock_stiffness, 0.0f),
+    F("soft_lock_damping", S_GENERAL, &Preset::soft_lock_damping, &FFBEngine::m_soft_lock_damping, 0.0f),
+    F("wheelbase_max_nm", S_GENERAL, &Preset::wheelbase_max_nm, &FFBEngine::m_wheelbase_max_nm, 1.0f),
+    F("target_rim_nm", S_GENERAL, &Preset::target_rim_nm, &FFBEngine::m_target_rim_nm, 1.0f),
+    F("min_force", S_GENERAL, &Preset::min_force, &FFBEngine::m_min_force, 0.0f),
+
+    F("steering_shaft_gain", S_FRONT, &Preset::steering_shaft_gain, &FFBEngine::m_steering_shaft_gain, 0.0f),
+    F("ingame_ffb_gain", S_FRONT, &Preset::ingame_ffb_gain, &FFBEngine::m_ingame_ffb_gain, 0.0f),
+    F("steering_shaft_smoothing", S_FRONT, &Preset::steering_shaft_smoothing, &FFBEngine::m_steering_shaft_smoothing, 0.0f),
+    F("torque_prediction_ms", S_FRONT, &Preset::torque_prediction_ms, &FFBEngine::m_torque_prediction_ms, 0.0f, 50.0f),
+    F("understeer", S_FRONT, &Preset::understeer, &FFBEngine::m_understeer_effect, 0.0f, 2.0f),
+    I("torque_source", S_FRONT, &Preset::torque_source, &FFBEngine::m_torque_source), // Clamped by Validate only (Preset)
+    B("torque_passthrough", S_FRONT, &Preset::torque_passthrough, &FFBEngine::m_torque_passthrough),
+    B("flatspot_suppression", S_FRONT, &Preset::flatspot_suppression, &FFBEngine::m_flatspot_suppression),
+    F("notch_q", S_FRONT, &Preset::notch_q, &FFBEngine::m_notch_q, 0.1f), // Critical for biquad division
+    F("flatspot_strength", S_FRONT, &Preset::flatspot_strength, &FFBEngine::m_flatspot_strength, 0.0f, 1.0f),
+    B("static_notch_enabled", S_FRONT, &Preset::static_notch_enabled, &FFBEngine::m_static_notch_enabled),
+    F("static_notch_freq", S_FRONT, &Preset::static_notch_freq, &FFBEngine::m_static_notch_freq, 1.0f),
+    F("static_notch_width", S_FRONT, &Preset::static_notch_width, &FFBEngine::m_static_notch_width, 0.1f),
+    B("notch_auto_tune", S_FRONT, &Preset::notch_auto_tune, &FFBEngine::m_notch_auto_tune),
+
+    F("oversteer_boost", S_REAR, &Preset::oversteer_boost, &FFBEngine::m_oversteer_boost, 0.0f),
+    F("dynamic_weight_gain", S_REAR, &Preset::dynamic_weight_gain, &FFBEngine::m_dynamic_weight_gain, 0.0f, 2.0f),
+    F("dynamic_weight_smoothing", S_REAR, &Preset::dynamic_weight_smoothing, &FFBEngine::m_dynamic_weight_smoothing, 0.0f),
+    F("grip_smoothing_steady", S_REAR, &Preset::grip_smoothing_steady, &FFBEngine::m_grip_smoothing_steady, 0.0f),
+    F("grip_smoothing_fast", S_REAR, &Preset::grip_smoothing_fast, &FFBEngine::m_grip_smoothing_fast, 0.0f),
+    F("grip_smoothing_sensitivity", S_REAR, &Preset::grip_smoothing_sensitivity, &FFBEngine::m_grip_smoothing_sensitivity, 0.001f),
+    F("sop", S_REAR, &Preset::sop, &FFBEngine::m_sop_effect, 0.0f, 2.0f, 2.0f),
+    F("rear_align_effect", S_REAR, &Preset::rear_align_effect, &FFBEngine::m_rear_align_effect, 0.0f, NO_MAX, 2.0f),
+    F("sop_yaw_gain", S_REAR, &Preset::sop_yaw_gain, &FFBEngine::m_sop_yaw_gain, 0.0f, NO_MAX, 2.0f),
+    F("yaw_kick_threshold", S_REAR, &Preset::yaw_kick_threshold, &FFBEngine::m_yaw_kick_threshold), // Clamped by Apply only (Preset)
+    F("yaw_accel_smoothing", S_REAR, &Preset::yaw_smoothing, &FFBEngine::m_yaw_accel_smoothing, 0.0f),
+    F("gyro_gain", S_REAR, &Preset::gyro_gain, &FFBEngine::m_gyro_gain, 0.0f, NO_MAX, 1.0f),
+    F("gyro_smoothing_factor", S_REAR, &Preset::gyro_smoothing, &FFBEngine::m_gyro_smoothing, 0.0f),
+    F("sop_smoothing_factor", S_REAR, &Preset::sop_smoothing, &FFBEngine::m_sop_smoothing_factor, 0.0f, 1.0f),
+    F("sop_scale", S_REAR, &Preset::sop_scale, &FFBEngine::m_sop_scale, 0.01f),
+    B("understeer_affects_sop", S_REAR, &Preset::understeer_affects_sop, &FFBEngine::m_understeer_affects_sop),
+
+    F("slip_angle_smoothing", S_PHYSICS, &Preset::slip_smoothing, &FFBEngine::m_slip_angle_smoothing, 0.0001f),
+    F("chassis_inertia_smoothing", S_PHYSICS, &Preset::chassis_smoothing, &FFBEngine::m_chassis_inertia_smoothing, 0.0f),
+    B("chassis_estimator", S_PHYSICS, &Preset::chassis_estimator, &FFBEngine::m_chassis_estimator_enabled),
+    F("optimal_slip_angle", S_PHYSICS, &Preset::optimal_slip_angle, &FFBEngine::m_optimal_slip_angle, 0.01f), // Critical for grip division
+    F("optimal_slip_ratio", S_PHYSICS, &Preset::optimal_slip_ratio, &FFBEngine::m_optimal_slip_ratio, 0.01f), // Critical for grip division
+    B("adaptive_slip_angle", S_PHYSICS, &Preset::adaptive_slip_angle, &FFBEngine::m_adaptive_slip_angle),
+    B("slope_detection_enabled", S_PHYSICS, &Preset::slope_detection_enabled, &FFBEngine::m_slope_detection_enabled),
+    I("slope_sg_window", S_PHYSICS, &Preset::slope_sg_window, &FFBEngine::m_slope_sg_window, 5.0f, 41.0f),
+    F("slope_sensitivity", S_PHYSICS, &Preset::slope_sensitivity, &FFBEngine::m_slope_sensitivity, 0.1f),
+    F("slope_smoothing_tau", S_PHYSICS, &Preset::slope_smoothing_tau, &FFBEngine::m_slope_smoothing_tau, 0.001f),
+    F("slope_min_threshold", S_PHYSICS, &Preset::slope_min_threshold, &FFBEngine::m_slope_min_threshold),
+    F("slope_max_threshold", S_PHYSICS, &Preset::slope_max_threshold, &FFBEngine::m_slope_max_threshold),
+    F("slope_alpha_threshold", S_PHYSICS, &Preset::slope_alpha_threshold, &FFBEngine::m_slope_alpha_threshold, 0.001f), // Critical for slope division
+    F("slope_decay_rate", S_PHYSICS, &Preset::slope_decay_rate, &FFBEngine::m_slope_decay_rate, 0.1f),
+    B("slope_confidence_enabled", S_PHYSICS, &Preset::slope_confidence_enabled, &FFBEngine::m_slope_confidence_enabled),
+    F("slope_g_slew_limit", S_PHYSICS, &Preset::slope_g_slew_limit, &FFBEngine::m_slope_g_slew_limit, 1.0f),
+    B("slope_use_torque", S_PHYSICS, &Preset::slope_use_torque, &FFBEngine::m_slope_use_torque),
+    F("slope_torque_sensitivity", S_PHYSICS, &Preset::slope_torque_sensitivity, &FFBEngine::m_slope_torque_sensitivity, 0.01f),
+    F("slope_confidence_max_rate", S_PHYSICS, &Preset::slope_confidence_max_rate, &FFBEngine::m_slope_confidence_max_rate), // Lower bound depends on alpha (Preset::Apply)
+
+    B("lockup_enabled", S_BRAKING, &Preset::lockup_enabled, &FFBEngine::m_lockup_enabled),
+    F("lockup_gain", S_BRAKING, &Preset::lockup_gain, &FFBEngine::m_lockup_gain, 0.0f, NO_MAX, 3.0f),
+    F("brake_load_cap", S_BRAKING, &Preset::brake_load_cap, &FFBEngine::m_brake_load_cap, 1.0f, NO_MAX, 10.0f),
+    F("lockup_freq_scale", S_BRAKING, &Preset::lockup_freq_scale, &FFBEngine::m_lockup_freq_scale, 0.1f),
+    F("lockup_gamma", S_BRAKING, &Preset::lockup_gamma, &FFBEngine::m_lockup_gamma, 0.1f), // Critical: prevent pow(0, negative) crash
+    F("lockup_start_pct", S_BRAKING, &Preset::lockup_start_pct, &FFBEngine::m_lockup_start_pct, 0.1f),
+    F("lockup_full_pct", S_BRAKING, &Preset::lockup_full_pct, &FFBEngine::m_lockup_full_pct, 0.2f),
+    F("lockup_prediction_sens", S_BRAKING, &Preset::lockup_prediction_sens, &FFBEngine::m_lockup_prediction_sens, 1.0f),
+    F("lockup_bump_reject", S_BRAKING, &Preset::lockup_bump_reject, &FFBEngine::m_lockup_bump_reject, 0.01f),
+    F("lockup_rear_boost", S_BRAKING, &Preset::lockup_rear_boost, &FFBEngine::m_lockup_rear_boost, 0.0f),
+    B("abs_pulse_enabled", S_BRAKING, &Preset::abs_pulse_enabled, &FFBEngine::m_abs_pulse_enabled),
+    F("abs_gain", S_BRAKING, &Preset::abs_gain, &FFBEngine::m_abs_gain, 0.0f),
+    F("abs_freq", S_BRAKING, &Preset::abs_freq, &FFBEngine::m_abs_freq_hz, 1.0f),
+
+    F("texture_load_cap", S_TEXTURES, &Preset::texture_load_cap, &FFBEngine::m_texture_load_cap, 1.0f),
+    B("slide_enabled", S_TEXTURES, &Preset::slide_enabled, &FFBEngine::m_slide_texture_enabled),
+    F("slide_gain", S_TEXTURES, &Preset::slide_gain, &FFBEngine::m_slide_texture_gain, 0.0f, NO_MAX, 2.0f),
+    F("slide_freq", S_TEXTURES, &Preset::slide_freq, &FFBEngine::m_slide_freq_scale, 0.1f),
+    B("road_enabled", S_TEXTURES, &Preset::road_enabled, &FFBEngine::m_road_texture_enabled),
+    F("road_gain", S_TEXTURES, &Preset::road_gain, &FFBEngine::m_road_texture_gain, 0.0f, NO_MAX, 2.0f),
+    F("road_prediction", S_TEXTURES, &Preset::road_prediction, &FFBEngine::m_road_prediction, 0.0f, 1.0f),
+    F("tactile_gain", S_TEXTURES, &Preset::tactile_gain, &FFBEngine::m_tactile_gain, 0.0f, 2.0f, 2.0f),
+    F("road_fallback_scale", S_TEXTURES, &Preset::road_fallback_scale, &FFBEngine::m_road_fallback_scale, 0.0f),
+    B("spin_enabled", S_TEXTURES, &Preset::spin_enabled, &FFBEngine::m_spin_enabled),
+    F("spin_gain", S_TEXTURES, &Preset::spin_gain, &FFBEngine::m_spin_gain, 0.0f, NO_MAX, 2.0f),
+    F("spin_freq_scale", S_TEXTURES, &Preset::spin_freq_scale, &FFBEngine::m_spin_freq_scale, 0.1f),
+    F("scrub_drag_gain", S_TEXTURES, &Preset::scrub_drag_gain, &FFBEngine::m_scrub_drag_gain, 0.0f, NO_MAX, 1.0f),
+    I("bottoming_method", S_TEXTURES, &Preset::bottoming_method, &FFBEngine::m_bottoming_method),
+
+    F("speed_gate_lower", S_ADVANCED, &Preset::speed_gate_lower, &FFBEngine::m_speed_gate_lower), // Clamped by Apply only (Preset)
+    F("speed_gate_upper", S_ADVANCED, &Preset::speed_gate_upper, &FFBEngine::m_speed_gate_upper, 0.1f),
+};
+
+// Keys written by older versions
+constexpr std::pair<const char*, const char*> kAliases[] = {
+    { "smoothing", "sop_smoothing_factor" },
+    { "max_load_factor", "texture_load_cap" },
+    { "slope_negative_threshold", "slope_min_threshold" },
+};
+
+constexpr float EQUAL_EPSILON = 0.0001f;
+
+bool InPreset(const FieldDesc& f) {
+    return f.p_f || f.p_i || f.p_b;
+}
+
+// Same NaN behaviour as the (std::max)(lo, (std::min)(hi, v)) chains this replaces
+float ClampFloat(const FieldDesc& f, float v) {
+    if (f.max_val < NO_MAX) v = (std::min)(f.max_val, v);
+    if (f.min_val > NO_MIN) v = (std::max)(f.min_val, v);
+    return v;
+}
+
+int ClampInt(const FieldDesc& f, int v) {
+    if (f.max_val < NO_MAX) v = (std::min)((int)f.max_val, v);
+    if (f.min_val > NO_MIN) v = (std::max)((int)f.min_val, v);
+    return v;
+}
+
+bool IsNear(float a, float b) {
+    return std::abs(a - b) < EQUAL_EPSILON;
+}
+
+// Sorted key index (aliases included), built once
+const FieldDesc* Find(std::string_view key) {
+    using Entry = std::pair<std::string_view, const FieldDesc*>;
+    static const std::vector<Entry> index = [] {
+        std::vector<Entry> v;
+        for (const FieldDesc& f : kFields) v.emplace_back(f.key, &f);
+        for (const auto& alias : kAliases) {
+            for (const FieldDesc& f : kFields) {
+                if (std::strcmp(f.key, alias.second) == 0) v.emplace_back(alias.first, &f);
+            }
+        }
+        std::sort(v.begin(), v.end(), [](const Entry& a, const Entry& b) { return a.first < b.first; });
+        return v;
+    }();
+
+    auto it = std::lower_bound(index.begin(), index.end(), key,
+        [](const Entry& e, std::string_view k) { return e.first < k; });
+    return (it != index.end() && it->first == key) ? it->second : nullptr;
+}
+
+template <typename T>
+FieldRegistry::ParseResult ParseInto(const FieldDesc& f, std::string_view value, T& obj,
+                                     float T::* m_f, int T::* m_i, bool T::* m_b) {
+    using FieldRegistry::ParseResult;
+    switch (f.type) {
+        case FieldType::Float: {
+            float v = 0.0f;
+            if (!FieldRegistry::ParseNumber(value, v)) return ParseResult::Invalid;
+            obj.*m_f = (f.load_max < NO_MAX) ? (std::min)(f.load_max, v) : v;
+            return ParseResult::Ok;
+        }
+        case FieldType::Int:
+            return FieldRegistry::ParseNumber(value, obj.*m_i) ? ParseResult::Ok : ParseResult::Invalid;
+        case FieldType::Bool:
+            return FieldRegistry::ParseBool(value, obj.*m_b) ? ParseResult::Ok : ParseResult::Invalid;
+    }
+    return ParseResult::Invalid;
+}
+
+template <typename T>
+void WriteValue(std::ostream& out, const FieldDesc& f, const T& obj, float T::* m_f, int T::* m_i, bool T::* m_b) {
+    out << f.key << "=";
+    switch (f.type) {
+        case FieldType::Float: out << obj.*m_f; break;
+        case FieldType::Int: out << obj.*m_i; break;
+        case FieldType::Bool: out << ((obj.*m_b) ? "1" : "0"); break;
+    }
+    out << "\n";
+}
+
+} // namespace
+
+namespace FieldRegistry {
+
+ParseResult Parse(std::string_view key, std::string_view value, Preset& p) {
+    const FieldDesc* f = Find(key);
+    if (!f || !InPreset(*f)) return ParseResult::Unknown;
+    return ParseInto(*f, value, p, f->p_f, f->p_i, f->p_b);
+}
+
+ParseResult Parse(std::string_view key, std::string_view value, FFBEngine& engine) {
+    const FieldDesc* f = Find(key);
+    if (!f) return ParseResult::Unknown;
+    return ParseInto(*f, value, engine, f->e_f, f->e_i, f->e_b);
+}
+
+void Write(std::ostream& out, const Preset& p) {
+    for (const FieldDesc& f : kFields) {
+        if (InPreset(f)) WriteValue(out, f, p, f.p_f, f.p_i, f.p_b);
+    }
+}
+
+void Write(std::ostream& out, const FFBEngine& engine) {
+    const char* section = nullptr;
+    for (const FieldDesc& f : kFields) {
+        if (section != f.section) {
+            section = f.section;
+            out << "\n; --- " << section << " ---\n";
+        }
+        WriteValue(out, f, engine, f.e_f, f.e_i, f.e_b);
+    }
+}
+
+void Apply(const Preset& p, FFBEngine& engine) {
+    for (const FieldDesc& f : kFields) {
+        if (!InPreset(f)) continue;
+        switch (f.type) {
+            case FieldType::Float: engine.*(f.e_f) = ClampFloat(f, p.*(f.p_f)); break;
+            case FieldType::Int: engine.*(f.e_i) = ClampInt(f, p.*(f.p_i)); break;
+            case FieldType::Bool: engine.*(f.e_b) = p.*(f.p_b); break;
+        }
+    }
+}
+
+void Capture(Preset& p, const FFBEngine& engine) {
+    for (const FieldDesc& f : kFields) {
+        if (!InPreset(f)) continue;
+        switch (f.type) {
+            case FieldType::Float: p.*(f.p_f) = engine.*(f.e_f); break;
+            case FieldType::Int: p.*(f.p_i) = engine.*(f.e_i); break;
+            case FieldType::Bool: p.*(f.p_b) = engine.*(f.e_b); break;
+        }
+    }
+}
+
+void Clamp(Preset& p) {
+    for (const FieldDesc& f : kFields) {
+        if (!InPreset(f)) continue;
+        if (f.type == FieldType::Float) p.*(f.p_f) = ClampFloat(f, p.*(f.p_f));
+        else if (f.type == FieldType::Int) p.*(f.p_i) = ClampInt(f, p.*(f.p_i));
+    }
+}
+
+bool Equal(const Preset& a, const Preset& b) {
+    for (const FieldDesc& f : kFields) {
+        if (!InPreset(f)) continue;
+        switch (f.type) {
+            case FieldType::Float: if (!IsNear(a.*(f.p_f), b.*(f.p_f))) return false; break;
+            case FieldType::Int: if (a.*(f.p_i) != b.*(f.p_i)) return false; break;
+            case FieldType::Bool: if (a.*(f.p_b) != b.*(f.p_b)) return false; break;
+        }
+    }
+    return true;
+}
+
+bool Matches(const Preset& p, const FFBEngine& engine) {
+    for (const FieldDesc& f : kFields) {
+        if (!InPreset(f)) continue;
+        switch (f.type) {
+            case FieldType::Float: if (!IsNear(p.*(f.p_f), engine.*(f.e_f))) return false; break;
+            case FieldType::Int: if (p.*(f.p_i) != engine.*(f.e_i)) return false; break;
+            case FieldType::Bool: if (p.*(f.p_b) != engine.*(f.e_b)) return false; break;
+        }
+    }
+    return true;
+}
+
+bool SetPresetFloat(Preset& p, std::string_view key, float value) {
+    const FieldDesc* f = Find(key);
+    if (!f || f->type != FieldType::Float || !f->p_f) return false;
+    p.*(f->p_f) = value;
+    return true;
+}
+
+std::vector<std::string> PresetFloatKeys() {
+    std::vector<std::string> keys;
+    for (const FieldDesc& f : kFields) {
+        if (f.type == FieldType::Float && f.p_f) keys.emplace_back(f.key);
+    }
+    return keys;
+}
+
+} // namespace FieldRegistry
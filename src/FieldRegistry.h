@@ -0,0 +1,68 @@
+#ifndef FIELDREGISTRY_H
+#define FIELDREGISTRY_H
+
+#include <charconv>
+#include <ostream>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+class FFBEngine;
+struct Preset;
+
+// Field Registry (v0.7.112)
+// Every persisted FFB parameter is described once in FieldRegistry.cpp: INI key,
+// type, Preset member, FFBEngine member, safe range and config.ini section.
+// Preset::Apply/UpdateFromEngine/Validate/Equals, Config load/save and the preset
+// dirty check are all driven by that table. Defaults remain the Preset member
+// initializers in Config.h.
+namespace FieldRegistry {
+
+    enum class ParseResult { Unknown, Ok, Invalid };
+
+    // Allocation-free value parsing (no exceptions, no locale)
+    template <typename T>
+    bool ParseNumber(std::string_view s, T& out) {
+        if (!s.empty() && s[0] == '+') s.remove_prefix(1);
+        T v{};
+        auto res = std::from_chars(s.data(), s.data() + s.size(), v);
+        if (res.ec != std::errc()) return false;
+        out = v;
+        return true;
+    }
+
+    inline bool ParseBool(std::string_view s, bool& out) {
+        if (s == "true") { out = true; return true; }
+        if (s == "false") { out = false; return true; }
+        int v = 0;
+        if (!ParseNumber(s, v)) return false;
+        out = (v != 0);
+        return true;
+    }
+
+    // Assigns a value read from an INI file (legacy aliases accepted).
+    // Engine-only keys (e.g. invert_force) are Unknown for presets.
+    ParseResult Parse(std::string_view key, std::string_view value, Preset& p);
+    ParseResult Parse(std::string_view key, std::string_view value, FFBEngine& engine);
+
+    // Writes "key=value" lines. The engine variant also emits the "; --- Section ---" headers.
+    void Write(std::ostream& out, const Preset& p);
+    void Write(std::ostream& out, const FFBEngine& engine);
+
+    // Per-field copies with range clamping. Cross-field rules stay in Preset.
+    void Apply(const Preset& p, FFBEngine& engine);
+    void Capture(Preset& p, const FFBEngine& engine);
+    void Clamp(Preset& p);
+
+    // Floats compare with a 1e-4 tolerance, ints/bools exactly.
+    bool Equal(const Preset& a, const Preset& b);
+    bool Matches(const Preset& p, const FFBEngine& engine); // Dirty check without a temporary Preset
+
+    // Continuous preset parameters (used by the offline preset tuner)
+    bool SetPresetFloat(Preset& p, std::string_view key, float value);
+    std::vector<std::string> PresetFloatKeys();
+
+} // namespace FieldRegistry
+
+#endif // FIELDREGISTRY_H
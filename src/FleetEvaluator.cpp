@@ -0,0 +1,207 @@
+#include "FleetEvaluator.h"
+#include "Config.h"
+#include <algorithm>
+
+FleetEvaluator::FleetEvaluator(unsigned int thread_count) {
+    if (thread_count == 0) thread_count = std::thread::hardware_concurrency();
+    if (thread_count == 0) thread_count = 1;
+    thread_count = (std::min)(thread_count, (unsigned int)MAX_VEHICLES);
+
+    m_slots.resize(MAX_VEHICLES);
+    m_jobs.reserve(MAX_VEHICLES);
+    m_preset = std::make_unique<Preset>();
+
+    // The caller participates in every batch, so spawn one thread less.
+    for (unsigned int i = 1; i < thread_count; ++i) {
+        m_workers.emplace_back(&FleetEvaluator::WorkerLoop, this);
+    }
+}
+
+FleetEvaluator::~FleetEvaluator() {
+    {
+        std::lock_guard<std::mutex> lock(m_pool_mutex);
+        m_stop = true;
+    }
+    m_work_cv.notify_all();
+    for (auto& t : m_workers) {
+        if (t.joinable()) t.join();
+    }
+}
+
+void FleetEvaluator::Configure(const Preset& preset) {
+    *m_preset = preset;
+    for (auto& slot : m_slots) {
+        if (!slot) continue;
+        m_preset->Apply(slot->engine);
+        slot->engine.m_torque_source = 0;
+    }
+}
+
+void FleetEvaluator::Reset() {
+    for (auto& slot : m_slots) slot.reset();
+}
+
+FleetEvaluator::Slot& FleetEvaluator::AcquireSlot(int index, long id) {
+    std::unique_ptr<Slot>& slot = m_slots[index];
+
+    // Slot IDs can be re-used in multiplayer after someone leaves: start from a clean engine.
+    if (slot && slot->result.id != id) slot.reset();
+
+    if (!slot) {
+        slot = std::make_unique<Slot>();
+        slot->engine.m_isolated = true;
+        m_preset->Apply(slot->engine);
+        slot->engine.m_torque_source = 0;
+        slot->trace.resize(TRACE_CAPACITY);
+        slot->result.id = id;
+    }
+    return *slot;
+}
+
+int FleetEvaluator::Evaluate(const SharedMemoryObjectOut& data, bool include_player) {
+    const SharedMemoryTelemtryData& telem = data.telemetry;
+    const SharedMemoryScoringData& scoring = data.scoring;
+    int active = (std::min)((int)telem.activeVehicles, MAX_VEHICLES);
+    int num_scoring = (std::min)((int)scoring.scoringInfo.mNumVehicles, MAX_VEHICLES);
+
+    m_jobs.clear();
+    for (int i = 0; i < MAX_VEHICLES; ++i) {
+        if (m_slots[i]) m_slots[i]->result.active = false;
+    }
+
+    for (int i = 0; i < active; ++i) {
+        const TelemInfoV01& info = telem.telemInfo[i];
+        bool is_player = telem.playerHasVehicle && (i == telem.playerVehicleIdx);
+        if (is_player && !include_player) continue;
+
+        // Scoring and telemetry arrays normally share the index (as in FFBThread),
+        // but fall back to an ID search when they disagree.
+        const VehicleScoringInfoV01* veh = nullptr;
+        if (i < num_scoring && scoring.vehScoringInfo[i].mID == info.mID) {
+            veh = &scoring.vehScoringInfo[i];
+        } else {
+            for (int j = 0; j < num_scoring; ++j) {
+                if (scoring.vehScoringInfo[j].mID == info.mID) { veh = &scoring.vehScoringInfo[j]; break; }
+            }
+        }
+
+        Slot& slot = AcquireSlot(i, info.mID);
+
+        // Car changes look up shared tables behind global locks: resolve them here, so the
+        // workers' calculate_force() finds the engine already seeded.
+        const char* vclass = veh ? veh->mVehicleClass : nullptr;
+        const char* vname = veh ? veh->mVehicleName : info.mVehicleName;
+        if (vclass && !slot.engine.IsSeededFor(vclass, vname)) {
+            slot.engine.SeedVehicle(vclass, vname, FFBEngine::ResolveVehicleSeed(vclass, vname));
+        }
+
+        slot.telem = &info;
+        slot.scoring = veh;
+        slot.result.active = true;
+        slot.result.is_player = is_player;
+        m_jobs.push_back(&slot);
+    }
+
+    if (m_jobs.empty()) return 0;
+
+    m_next_job.store(0, std::memory_order_relaxed);
+    if (!m_workers.empty() && m_jobs.size() > 1) {
+        {
+            std::lock_guard<std::mutex> lock(m_pool_mutex);
+            m_busy_workers = (int)m_workers.size();
+            ++m_generation;
+        }
+        m_work_cv.notify_all();
+        RunJobs();
+        std::unique_lock<std::mutex> lock(m_pool_mutex);
+        m_done_cv.wait(lock, [this] { return m_busy_workers == 0; });
+    } else {
+        RunJobs();
+    }
+
+    return (int)m_jobs.size();
+}
+
+void FleetEvaluator::RunJobs() {
+    const size_t count = m_jobs.size();
+    for (;;) {
+        size_t idx = m_next_job.fetch_add(1, std::memory_order_relaxed);
+        if (idx >= count) break;
+        ProcessSlot(*m_jobs[idx]);
+    }
+}
+
+void FleetEvaluator::WorkerLoop() {
+    uint64_t seen = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> lock(m_pool_mutex);
+            m_work_cv.wait(lock, [&] { return m_stop || m_generation != seen; });
+            if (m_stop) return;
+            seen = m_generation;
+        }
+
+        RunJobs();
+
+        {
+            std::lock_guard<std::mutex> lock(m_pool_mutex);
+            if (--m_busy_workers == 0) m_done_cv.notify_one();
+        }
+    }
+}
+
+void FleetEvaluator::ProcessSlot(Slot& slot) {
+    const TelemInfoV01* info = slot.telem;
+    const char* vclass = slot.scoring ? slot.scoring->mVehicleClass : nullptr;
+    const char* vname = slot.scoring ? slot.scoring->mVehicleName : info->mVehicleName;
+
+    double force = slot.engine.calculate_force(info, vclass, vname, 0.0f, true);
+    const FFBSnapshot& snap = slot.engine.m_last_snapshot;
+
+    slot.result.snapshot = snap;
+#ifdef _WIN32
+    strncpy_s(slot.result.vehicle_name, sizeof(slot.result.vehicle_name), info->mVehicleName, _TRUNCATE);
+#else
+    strncpy(slot.result.vehicle_name, info->mVehicleName, sizeof(slot.result.vehicle_name) - 1);
+    slot.result.vehicle_name[sizeof(slot.result.vehicle_name) - 1] = '\0';
+#endif
+
+    FleetSample& s = slot.trace[slot.trace_head];
+    s.elapsed_time = info->mElapsedTime;
+    s.force = (float)force;
+    s.front_grip = snap.calc_front_grip;
+    s.rear_grip = snap.calc_rear_grip;
+    s.front_slip_angle = snap.calc_front_slip_angle_smoothed;
+    s.rear_slip_angle = snap.calc_rear_slip_angle_smoothed;
+    s.front_load = snap.calc_front_load;
+    s.rear_load = snap.calc_rear_load;
+    s.clipping = snap.clipping > 0.5f;
+
+    slot.trace_head = (slot.trace_head + 1) % TRACE_CAPACITY;
+    if (slot.trace_count < TRACE_CAPACITY) slot.trace_count++;
+}
+
+int FleetEvaluator::GetActiveCount() const {
+    int count = 0;
+    for (const auto& slot : m_slots) {
+        if (slot && slot->result.active) count++;
+    }
+    return count;
+}
+
+FleetVehicleResult FleetEvaluator::GetResult(int slot) const {
+    if (slot < 0 || slot >= MAX_VEHICLES || !m_slots[slot]) return FleetVehicleResult();
+    return m_slots[slot]->result;
+}
+
+std::vector<FleetSample> FleetEvaluator::GetTrace(int slot) const {
+    std::vector<FleetSample> out;
+    if (slot < 0 || slot >= MAX_VEHICLES || !m_slots[slot]) return out;
+    const Slot& s = *m_slots[slot];
+    out.reserve(s.trace_count);
+    size_t start = (s.trace_head + TRACE_CAPACITY - s.trace_count) % TRACE_CAPACITY;
+    for (size_t i = 0; i < s.trace_count; ++i) {
+        out.push_back(s.trace[(start + i) % TRACE_CAPACITY]);
+    }
+    return out;
+}
@@ -0,0 +1,125 @@
+#ifndef FLEETEVALUATOR_H
+#define FLEETEVALUATOR_H
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <atomic>
+#include <cstdint>
+#include "FFBEngine.h"
+#include "lmu_sm_interface/LmuSharedMemoryWrapper.h"
+
+struct Preset;
+
+/**
+ * @brief One evaluated sample for a single car (Fleet / spectator mode).
+ * Compact subset of FFBSnapshot kept in the per-car trace.
+ */
+struct FleetSample {
+    double elapsed_time = 0.0;
+    float force = 0.0f;            // Normalized output [-1, 1]
+    float front_grip = 0.0f;
+    float rear_grip = 0.0f;
+    float front_slip_angle = 0.0f; // Smoothed (rad)
+    float rear_slip_angle = 0.0f;  // Smoothed (rad)
+    float front_load = 0.0f;       // N
+    float rear_load = 0.0f;        // N
+    bool clipping = false;
+};
+
+/**
+ * @brief Latest result for one telemetry slot.
+ */
+struct FleetVehicleResult {
+    bool active = false;
+    bool is_player = false;
+    long id = -1;                  // mID from telemetry/scoring
+    char vehicle_name[FFBEngine::STR_BUF_64] = "";
+    FFBSnapshot snapshot = {};     // Full diagnostics of the last evaluation
+};
+
+/**
+ * @brief Evaluates independent FFBEngine instances for every active car in parallel.
+ *
+ * The FFB thread only ever computes the player car. FleetEvaluator runs one isolated
+ * FFBEngine per telemInfo slot on a small persistent thread pool so other cars
+ * (teammate, AI) can be compared against the player or feed a coaching overlay.
+ *
+ * - Each slot (engine + trace) is a separate cache-line aligned allocation so worker
+ *   threads never share lines and throughput scales with cores.
+ * - Engines are flagged m_isolated: they do not take g_engine_mutex, do not touch the
+ *   GUI debug buffer or AsyncLogger and never persist learned static loads. Car changes
+ *   (class rules, profiles, saved loads) are resolved on the calling thread before
+ *   dispatch, so workers take no global locks.
+ * - Evaluate() is synchronous: it returns once every active slot has been processed.
+ *   Results and traces may be read by the calling thread until the next Evaluate().
+ *   Evaluate(), Configure() and the getters must not be called concurrently.
+ */
+class FleetEvaluator {
+public:
+    static constexpr int MAX_VEHICLES = 104;     // SharedMemoryTelemtryData::telemInfo size
+    static constexpr size_t TRACE_CAPACITY = 2000; // 5 s at 400 Hz per car
+
+    // thread_count = 0 selects std::thread::hardware_concurrency().
+    // The calling thread also processes work, so N threads means N-1 workers.
+    explicit FleetEvaluator(unsigned int thread_count = 0);
+    ~FleetEvaluator();
+
+    FleetEvaluator(const FleetEvaluator&) = delete;
+    FleetEvaluator& operator=(const FleetEvaluator&) = delete;
+
+    // Applies the given tuning to all current and future engines.
+    // Torque source is forced to Shaft Torque: the 400 Hz in-game FFB signal only exists for the player.
+    void Configure(const Preset& preset);
+
+    // Evaluates all active vehicles of a shared memory copy. Returns the number of cars evaluated.
+    int Evaluate(const SharedMemoryObjectOut& data, bool include_player = true);
+
+    // Drops all engines, traces and results (e.g. on session change).
+    void Reset();
+
+    unsigned int GetThreadCount() const { return (unsigned int)m_workers.size() + 1; }
+    int GetActiveCount() const;
+
+    // Latest result for a telemetry slot. Inactive slots return a default result.
+    FleetVehicleResult GetResult(int slot) const;
+
+    // Chronological copy of the slot's trace (oldest first).
+    std::vector<FleetSample> GetTrace(int slot) const;
+
+private:
+    struct alignas(64) Slot {
+        FFBEngine engine;
+        FleetVehicleResult result;
+        std::vector<FleetSample> trace;
+        size_t trace_head = 0;
+        size_t trace_count = 0;
+
+        // Per-frame job inputs (written by the caller before dispatch)
+        const TelemInfoV01* telem = nullptr;
+        const VehicleScoringInfoV01* scoring = nullptr;
+    };
+
+    Slot& AcquireSlot(int index, long id);
+    void ProcessSlot(Slot& slot);
+    void RunJobs();
+    void WorkerLoop();
+
+    std::vector<std::unique_ptr<Slot>> m_slots;
+    std::vector<Slot*> m_jobs;
+    std::unique_ptr<Preset> m_preset;
+
+    std::vector<std::thread> m_workers;
+    std::mutex m_pool_mutex;
+    std::condition_variable m_work_cv;
+    std::condition_variable m_done_cv;
+    uint64_t m_generation = 0;
+    int m_busy_workers = 0;
+    bool m_stop = false;
+
+    alignas(64) std::atomic<size_t> m_next_job{0};
+};
+
+#endif // FLEETEVALUATOR_H
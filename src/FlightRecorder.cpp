@@ -0,0 +1,384 @@
+#include "FlightRecorder.h"
+#include "Version.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <iterator>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr char RECORDER_MAGIC[8] = { 'L', 'M', 'U', 'F', 'L', 'T', 'R', '1' };
+
+// --- CSV export: every field of the record, named after the struct members ---
+
+enum class FieldType { Double, Float, Bool };
+
+struct Field {
+    const char* name;
+    size_t offset;
+    FieldType type;
+};
+
+#define FR_INPUT(member, type) { #member, offsetof(FlightRecord, inputs) + offsetof(FlightInputs, member), FieldType::type }
+#define FR_INPUT_AT(name, member, i) { name, offsetof(FlightRecord, inputs) + offsetof(FlightInputs, member) + (i) * sizeof(float), FieldType::Float }
+#define FR_INPUT_WHEELS(member) FR_INPUT_AT(#member "_fl", member, 0), FR_INPUT_AT(#member "_fr", member, 1), \
+                                FR_INPUT_AT(#member "_rl", member, 2), FR_INPUT_AT(#member "_rr", member, 3)
+#define FR_INPUT_XYZ(member) FR_INPUT_AT(#member "_x", member, 0), FR_INPUT_AT(#member "_y", member, 1), FR_INPUT_AT(#member "_z", member, 2)
+#define FR_SNAP(member, type) { #member, offsetof(FlightRecord, snapshot) + offsetof(FFBSnapshot, member), FieldType::type }
+#define FR_SNAP_AT(name, member, i, type, elem) { name, offsetof(FlightRecord, snapshot) + offsetof(FFBSnapshot, member) + (i) * sizeof(elem), FieldType::type }
+#define FR_SNAP_WHEELS(member, type, elem) FR_SNAP_AT(#member "_fl", member, 0, type, elem), FR_SNAP_AT(#member "_fr", member, 1, type, elem), \
+                                           FR_SNAP_AT(#member "_rl", member, 2, type, elem), FR_SNAP_AT(#member "_rr", member, 3, type, elem)
+
+const Field kFields[] = {
+    // Raw inputs
+    FR_INPUT(delta_time, Double), FR_INPUT(shaft_torque, Float), FR_INPUT(gen_torque, Float),
+    FR_INPUT(steering, Float), FR_INPUT(throttle, Float), FR_INPUT(brake, Float), FR_INPUT(engine_rpm, Float),
+    FR_INPUT_XYZ(local_accel), FR_INPUT_XYZ(local_vel), FR_INPUT_XYZ(local_rot),
+    FR_INPUT_WHEELS(tire_load), FR_INPUT_WHEELS(grip_fract), FR_INPUT_WHEELS(lat_force), FR_INPUT_WHEELS(long_force),
+    FR_INPUT_WHEELS(susp_force), FR_INPUT_WHEELS(susp_deflection), FR_INPUT_WHEELS(ride_height),
+    FR_INPUT_WHEELS(lat_patch_vel), FR_INPUT_WHEELS(long_patch_vel), FR_INPUT_WHEELS(rotation),
+    FR_INPUT_WHEELS(vert_deflection),
+    // FFB components
+    FR_SNAP(total_output, Float), FR_SNAP(base_force, Float), FR_SNAP(sop_force, Float),
+    FR_SNAP(understeer_drop, Float), FR_SNAP(oversteer_boost, Float), FR_SNAP(ffb_rear_torque, Float),
+    FR_SNAP(ffb_scrub_drag, Float), FR_SNAP(ffb_yaw_kick, Float), FR_SNAP(ffb_gyro_damping, Float),
+    FR_SNAP(texture_road, Float), FR_SNAP(texture_slide, Float), FR_SNAP(texture_lockup, Float),
+    FR_SNAP(texture_spin, Float), FR_SNAP(texture_bottoming, Float), FR_SNAP(ffb_abs_pulse, Float),
+    FR_SNAP(ffb_soft_lock, Float), FR_SNAP(session_peak_torque, Float), FR_SNAP(clipping, Float),
+    // Internal physics
+    FR_SNAP(calc_front_load, Float), FR_SNAP(calc_rear_load, Float), FR_SNAP(calc_rear_lat_force, Float),
+    FR_SNAP(calc_front_grip, Float), FR_SNAP(calc_rear_grip, Float), FR_SNAP(calc_front_slip_ratio, Float),
+    FR_SNAP(calc_front_slip_angle_smoothed, Float), FR_SNAP(raw_front_slip_angle, Float),
+    FR_SNAP(calc_rear_slip_angle_smoothed, Float), FR_SNAP(raw_rear_slip_angle, Float),
+    // Snapshot telemetry
+    FR_SNAP(steer_force, Float), FR_SNAP(raw_shaft_torque, Float), FR_SNAP(raw_gen_torque, Float),
+    FR_SNAP(raw_input_steering, Float), FR_SNAP(raw_front_tire_load, Float), FR_SNAP(raw_front_grip_fract, Float),
+    FR_SNAP(raw_rear_grip, Float), FR_SNAP(raw_front_susp_force, Float), FR_SNAP(raw_front_ride_height, Float),
+    FR_SNAP(raw_rear_lat_force, Float), FR_SNAP(raw_car_speed, Float), FR_SNAP(raw_front_slip_ratio, Float),
+    FR_SNAP(raw_input_throttle, Float), FR_SNAP(raw_input_brake, Float), FR_SNAP(accel_x, Float),
+    FR_SNAP(raw_front_lat_patch_vel, Float), FR_SNAP(raw_front_deflection, Float),
+    FR_SNAP(raw_front_long_patch_vel, Float), FR_SNAP(raw_rear_lat_patch_vel, Float),
+    FR_SNAP(raw_rear_long_patch_vel, Float),
+    // Per wheel
+    FR_SNAP_WHEELS(wheel_load, Float, float), FR_SNAP_WHEELS(wheel_grip, Float, float),
+    FR_SNAP_WHEELS(wheel_slip_angle, Float, float), FR_SNAP_WHEELS(wheel_slip_ratio, Float, float),
+    FR_SNAP_WHEELS(wheel_load_approx, Bool, bool), FR_SNAP_WHEELS(wheel_grip_approx, Bool, bool),
+    // Health and rates
+    FR_SNAP(warn_load, Bool), FR_SNAP(warn_grip, Bool), FR_SNAP(warn_dt, Bool),
+    FR_SNAP(debug_freq, Float), FR_SNAP(tire_radius, Float), FR_SNAP(slope_current, Float),
+    FR_SNAP(ffb_rate, Float), FR_SNAP(telemetry_rate, Float), FR_SNAP(hw_rate, Float),
+    FR_SNAP(torque_rate, Float), FR_SNAP(gen_torque_rate, Float),
+};
+
+#undef FR_INPUT
+#undef FR_INPUT_AT
+#undef FR_INPUT_WHEELS
+#undef FR_INPUT_XYZ
+#undef FR_SNAP
+#undef FR_SNAP_AT
+#undef FR_SNAP_WHEELS
+
+float OutputOf(const FlightRecord& r) {
+    return std::isfinite(r.output_force) ? r.output_force : r.snapshot.total_output;
+}
+
+} // namespace
+
+FlightRecorder& FlightRecorder::Get() {
+    static FlightRecorder instance;
+    return instance;
+}
+
+FlightRecorder::~FlightRecorder() {
+    Close();
+}
+
+std::string FlightRecorder::PreviousPath(const std::string& path) {
+    size_t dot = path.find_last_of('.');
+    size_t sep = path.find_last_of("/\\");
+    if (dot == std::string::npos || (sep != std::string::npos && dot < sep)) return path + ".prev";
+    return path.substr(0, dot) + ".prev" + path.substr(dot);
+}
+
+bool FlightRecorder::Open(const std::string& path, int seconds) {
+    Close();
+    seconds = (std::max)(MIN_SECONDS, (std::min)(MAX_SECONDS, seconds));
+    size_t capacity = (size_t)seconds * RATE_HZ;
+    size_t file_size = HEADER_SIZE + capacity * sizeof(FlightRecord);
+
+    // Keep the last session (it may hold the crash being investigated)
+    try {
+        std::filesystem::path p(path);
+        if (p.has_parent_path()) std::filesystem::create_directories(p.parent_path());
+        if (std::filesystem::exists(p) && std::filesystem::file_size(p) > 0) {
+            std::string prev = PreviousPath(path);
+            std::filesystem::remove(prev);
+            std::filesystem::rename(p, prev);
+        }
+    } catch (...) {
+        // Not fatal: the old file is simply overwritten
+    }
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cerr << "[FlightRecorder] Failed to open " << path << std::endl;
+        return false;
+    }
+    HANDLE map = CreateFileMappingA(file, NULL, PAGE_READWRITE, (DWORD)((uint64_t)file_size >> 32), (DWORD)(file_size & 0xFFFFFFFFu), NULL);
+    void* view = map ? MapViewOfFile(map, FILE_MAP_ALL_ACCESS, 0, 0, file_size) : nullptr;
+    if (!view) {
+        if (map) CloseHandle(map);
+        CloseHandle(file);
+        std::cerr << "[FlightRecorder] Failed to map " << path << std::endl;
+        return false;
+    }
+    m_file_handle = file;
+    m_map_handle = map;
+#else
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (fd < 0) {
+        std::cerr << "[FlightRecorder] Failed to open " << path << std::endl;
+        return false;
+    }
+    void* view = MAP_FAILED;
+    if (ftruncate(fd, (off_t)file_size) == 0) {
+        view = mmap(nullptr, file_size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (view == MAP_FAILED) {
+        close(fd);
+        std::cerr << "[FlightRecorder] Failed to map " << path << std::endl;
+        return false;
+    }
+    m_fd = fd;
+#endif
+
+    // Touch every page now so the FFB thread never takes a first-write fault
+    std::memset(view, 0, file_size);
+
+    m_mapping = view;
+    m_file_size = file_size;
+    m_capacity = capacity;
+    m_path = path;
+    m_header = static_cast<Header*>(view);
+    std::memcpy(m_header->magic, RECORDER_MAGIC, sizeof(RECORDER_MAGIC));
+    m_header->version = FILE_VERSION;
+    m_header->header_size = (uint32_t)HEADER_SIZE;
+    m_header->record_size = (uint32_t)sizeof(FlightRecord);
+    m_header->snapshot_size = (uint32_t)sizeof(FFBSnapshot);
+    m_header->capacity = (uint32_t)capacity;
+    m_header->rate_hz = RATE_HZ;
+    m_header->opened_unix = (int64_t)std::chrono::duration_cast<std::chrono::seconds>(
+        std::chrono::system_clock::now().time_since_epoch()).count();
+    std::strncpy(m_header->app_version, LMUFFB_VERSION, sizeof(m_header->app_version) - 1);
+    m_records = reinterpret_cast<FlightRecord*>(static_cast<char*>(view) + HEADER_SIZE);
+    m_next_seq = 1;
+    m_head.store(0, std::memory_order_release);
+
+    std::cout << "[FlightRecorder] Recording the last " << seconds << " s to " << path
+              << " (" << (file_size >> 20) << " MB)" << std::endl;
+    return true;
+}
+
+void FlightRecorder::Close() {
+    if (!m_mapping) return;
+    m_records = nullptr;
+    m_header = nullptr;
+#ifdef _WIN32
+    FlushViewOfFile(m_mapping, m_file_size);
+    UnmapViewOfFile(m_mapping);
+    CloseHandle((HANDLE)m_map_handle);
+    CloseHandle((HANDLE)m_file_handle);
+    m_map_handle = nullptr;
+    m_file_handle = nullptr;
+#else
+    msync(m_mapping, m_file_size, MS_SYNC);
+    munmap(m_mapping, m_file_size);
+    close(m_fd);
+    m_fd = -1;
+#endif
+    m_mapping = nullptr;
+    m_capacity = 0;
+}
+
+void FlightRecorder::Record(const FFBSnapshot& snapshot, const TelemInfoV01* data, float gen_torque) {
+    if (!m_records || !data) return;
+    uint64_t seq = m_next_seq++;
+    FlightRecord& r = m_records[(seq - 1) % m_capacity];
+
+    // Seqlock order: invalidate, payload, then publish. Fences keep the plain stores
+    // in this order for in-process readers; a crash mid-record leaves seq != seq_end.
+    r.seq_end = 0;
+    r.seq = seq;
+    std::atomic_thread_fence(std::memory_order_release);
+
+    FlightInputs& in = r.inputs;
+    in.elapsed_time = data->mElapsedTime;
+    in.delta_time = data->mDeltaTime;
+    in.shaft_torque = (float)data->mSteeringShaftTorque;
+    in.gen_torque = gen_torque;
+    in.steering = (float)data->mUnfilteredSteering;
+    in.throttle = (float)data->mUnfilteredThrottle;
+    in.brake = (float)data->mUnfilteredBrake;
+    in.engine_rpm = (float)data->mEngineRPM;
+    in.local_accel[0] = (float)data->mLocalAccel.x;
+    in.local_accel[1] = (float)data->mLocalAccel.y;
+    in.local_accel[2] = (float)data->mLocalAccel.z;
+    in.local_vel[0] = (float)data->mLocalVel.x;
+    in.local_vel[1] = (float)data->mLocalVel.y;
+    in.local_vel[2] = (float)data->mLocalVel.z;
+    in.local_rot[0] = (float)data->mLocalRot.x;
+    in.local_rot[1] = (float)data->mLocalRot.y;
+    in.local_rot[2] = (float)data->mLocalRot.z;
+    for (int i = 0; i < 4; ++i) {
+        const TelemWheelV01& w = data->mWheel[i];
+        in.tire_load[i] = (float)w.mTireLoad;
+        in.grip_fract[i] = (float)w.mGripFract;
+        in.lat_force[i] = (float)w.mLateralForce;
+        in.long_force[i] = (float)w.mLongitudinalForce;
+        in.susp_force[i] = (float)w.mSuspForce;
+        in.susp_deflection[i] = (float)w.mSuspensionDeflection;
+        in.ride_height[i] = (float)w.mRideHeight;
+        in.lat_patch_vel[i] = (float)w.mLateralPatchVel;
+        in.long_patch_vel[i] = (float)w.mLongitudinalPatchVel;
+        in.rotation[i] = (float)w.mRotation;
+        in.vert_deflection[i] = (float)w.mVerticalTireDeflection;
+    }
+    r.snapshot = snapshot;
+    r.output_force = NAN;
+
+    std::atomic_thread_fence(std::memory_order_release);
+    r.seq_end = seq;
+    m_header->head = seq;
+    m_head.store(seq, std::memory_order_release);
+}
+
+void FlightRecorder::SetOutput(float force) {
+    uint64_t seq = m_next_seq - 1;
+    if (!m_records || seq == 0) return;
+    FlightRecord& r = m_records[(seq - 1) % m_capacity];
+    if (!std::isnan(r.output_force)) return;
+
+    // Same seqlock order as Record(): the record is invalid while the force is stored
+    r.seq_end = 0;
+    std::atomic_thread_fence(std::memory_order_release);
+    r.output_force = force;
+    std::atomic_thread_fence(std::memory_order_release);
+    r.seq_end = seq;
+}
+
+size_t FlightRecorder::Copy(uint64_t first_seq, size_t count, std::vector<FlightRecord>& out) const {
+    uint64_t head = GetHead();
+    if (!m_records || head == 0 || count == 0) return 0;
+    uint64_t oldest = (head > m_capacity) ? head - m_capacity + 1 : 1;
+    uint64_t first = (std::max)((std::max)(first_seq, oldest), (uint64_t)1);
+    uint64_t last = (std::min)(first_seq + count - 1, head);
+
+    size_t copied = 0;
+    for (uint64_t s = first; s <= last; ++s) {
+        const FlightRecord& r = m_records[(s - 1) % m_capacity];
+        uint64_t end = r.seq_end;
+        std::atomic_thread_fence(std::memory_order_acquire);
+        out.push_back(r);
+        std::atomic_thread_fence(std::memory_order_acquire);
+        if (end != s || r.seq != s || r.seq_end != s) {
+            out.pop_back(); // Overwritten or completed while copying
+            continue;
+        }
+        copied++;
+    }
+    return copied;
+}
+
+bool FlightRecorder::Load(const std::string& path, std::vector<FlightRecord>& out, FlightRecorderInfo* info, std::string* error) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        if (error) *error = "Cannot open " + path;
+        return false;
+    }
+    std::string data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return LoadBuffer(data.data(), data.size(), out, info, error);
+}
+
+bool FlightRecorder::LoadBuffer(const char* data, size_t size, std::vector<FlightRecord>& out, FlightRecorderInfo* info, std::string* error) {
+    Header h;
+    if (size >= HEADER_SIZE) std::memcpy(&h, data, sizeof(h));
+    if (size < HEADER_SIZE || std::memcmp(h.magic, RECORDER_MAGIC, sizeof(RECORDER_MAGIC)) != 0) {
+        if (error) *error = "Not a flight recorder file";
+        return false;
+    }
+    if (h.version != FILE_VERSION || h.header_size != HEADER_SIZE || h.record_size != sizeof(FlightRecord) ||
+        h.snapshot_size != sizeof(FFBSnapshot)) {
+        if (error) *error = "Flight recorder file from an incompatible version (" + std::string(h.app_version, strnlen(h.app_version, sizeof(h.app_version))) + ")";
+        return false;
+    }
+    if (info) {
+        info->capacity = h.capacity;
+        info->rate_hz = h.rate_hz;
+        info->head = h.head;
+        info->opened_unix = h.opened_unix;
+        info->app_version.assign(h.app_version, strnlen(h.app_version, sizeof(h.app_version)));
+    }
+
+    // Every complete record, oldest first (the slot being written at a crash is skipped)
+    size_t available = (size - h.header_size) / sizeof(FlightRecord);
+    size_t slots = (std::min)((size_t)h.capacity, available);
+    size_t first = out.size();
+    for (size_t i = 0; i < slots; ++i) {
+        FlightRecord r;
+        std::memcpy(&r, data + h.header_size + i * sizeof(FlightRecord), sizeof(FlightRecord));
+        if (r.seq != 0 && r.seq == r.seq_end) out.push_back(r);
+    }
+    std::sort(out.begin() + (std::ptrdiff_t)first, out.end(),
+              [](const FlightRecord& a, const FlightRecord& b) { return a.seq < b.seq; });
+    return true;
+}
+
+size_t FlightRecorder::FindLargestStep(const std::vector<FlightRecord>& records) {
+    size_t best = 0;
+    float best_step = -1.0f;
+    for (size_t i = 1; i < records.size(); ++i) {
+        if (records[i].seq != records[i - 1].seq + 1) continue; // Not adjacent ticks
+        float step = std::fabs(OutputOf(records[i]) - OutputOf(records[i - 1]));
+        if (step > best_step) {
+            best_step = step;
+            best = i;
+        }
+    }
+    return best;
+}
+
+void FlightRecorder::WriteCsv(std::ostream& out, const FlightRecord* records, size_t count) {
+    out << "Seq,Time,Output";
+    for (const auto& f : kFields) out << "," << f.name;
+    out << "\n";
+    out << std::fixed << std::setprecision(6);
+    for (size_t i = 0; i < count; ++i) {
+        const FlightRecord& r = records[i];
+        out << r.seq << "," << r.inputs.elapsed_time << "," << r.output_force;
+        const char* base = reinterpret_cast<const char*>(&r);
+        for (const auto& f : kFields) {
+            out << ",";
+            switch (f.type) {
+                case FieldType::Double: out << *reinterpret_cast<const double*>(base + f.offset); break;
+                case FieldType::Float: out << *reinterpret_cast<const float*>(base + f.offset); break;
+                default: out << (*reinterpret_cast<const bool*>(base + f.offset) ? 1 : 0); break;
+            }
+        }
+        out << "\n";
+    }
+}
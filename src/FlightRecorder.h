@@ -0,0 +1,138 @@
+#ifndef FLIGHTRECORDER_H
+#define FLIGHTRECORDER_H
+
+#include "FFBEngine.h"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+// Raw game inputs of one FFB tick, next to the engine's snapshot (v0.7.112)
+struct FlightInputs {
+    double elapsed_time;     // mElapsedTime
+    double delta_time;       // mDeltaTime
+    float shaft_torque;      // mSteeringShaftTorque
+    float gen_torque;        // Generic FFBTorque
+    float steering;          // mUnfilteredSteering
+    float throttle;
+    float brake;
+    float engine_rpm;
+    float local_accel[3];
+    float local_vel[3];
+    float local_rot[3];
+    // Per wheel, FL FR RL RR
+    float tire_load[4];
+    float grip_fract[4];
+    float lat_force[4];
+    float long_force[4];
+    float susp_force[4];
+    float susp_deflection[4];
+    float ride_height[4];
+    float lat_patch_vel[4];
+    float long_patch_vel[4];
+    float rotation[4];
+    float vert_deflection[4];
+};
+
+struct FlightRecord {
+    uint64_t seq;            // 1-based tick number, written before the payload
+    FlightInputs inputs;
+    FFBSnapshot snapshot;
+    float output_force;      // Force sent to the wheel after the safety slew, NaN until known
+    uint32_t reserved;
+    uint64_t seq_end;        // Equals seq once the payload is complete
+};
+
+struct FlightRecorderInfo {
+    uint32_t capacity = 0;   // Records
+    uint32_t rate_hz = 0;
+    uint64_t head = 0;       // Last sequence number written
+    int64_t opened_unix = 0; // Wall clock when the recorder was opened
+    std::string app_version;
+};
+
+// Flight Recorder (v0.7.112)
+// Always-on ring of the last 10-60 s of FFB state (the full FFBSnapshot plus the raw
+// inputs and the final output) in a memory-mapped file. The FFB thread writes each
+// record with plain stores into pages touched at Open(): no lock, no allocation, no
+// syscall. Because the pages belong to a file, the OS still writes them back when the
+// process crashes or is killed while hung, so the seconds before a jolt can be
+// extracted afterwards (LMUFFB_LogAnalyzer flight). A record is valid when its two
+// sequence numbers match, which rejects the one being written at the time.
+// Opening moves the previous session's file aside (.prev) instead of overwriting it.
+// Open()/Close() must not run concurrently with Record() (startup/shutdown only).
+class FlightRecorder {
+public:
+    static constexpr int RATE_HZ = 400;
+    static constexpr int DEFAULT_SECONDS = 30;
+    static constexpr int MIN_SECONDS = 10;
+    static constexpr int MAX_SECONDS = 60;
+    static constexpr uint32_t FILE_VERSION = 1;
+
+    static FlightRecorder& Get();
+
+    bool Open(const std::string& path, int seconds = DEFAULT_SECONDS);
+    void Close();
+    bool IsOpen() const { return m_records != nullptr; }
+    const std::string& GetPath() const { return m_path; }
+    static std::string PreviousPath(const std::string& path); // foo.lmfr -> foo.prev.lmfr
+
+    // --- FFB thread ---
+    void Record(const FFBSnapshot& snapshot, const TelemInfoV01* data, float gen_torque);
+    // Completes the latest record with the force actually sent (after ApplySafetySlew).
+    // Republishes the record, so readers never see it half updated.
+    void SetOutput(float force);
+
+    // --- Any thread ---
+    uint64_t GetHead() const { return m_head.load(std::memory_order_acquire); }
+    size_t GetCapacity() const { return m_capacity; }
+    // Appends the records [first_seq, first_seq + count) that are still intact; returns how many
+    size_t Copy(uint64_t first_seq, size_t count, std::vector<FlightRecord>& out) const;
+
+    // --- Readers (tools, tests): a file from a live, stopped or crashed session ---
+    static bool Load(const std::string& path, std::vector<FlightRecord>& out, FlightRecorderInfo* info = nullptr,
+                     std::string* error = nullptr);
+    static bool LoadBuffer(const char* data, size_t size, std::vector<FlightRecord>& out,
+                           FlightRecorderInfo* info = nullptr, std::string* error = nullptr);
+    // Index of the largest tick-to-tick output change (the jolt), 0 if fewer than 2 records
+    static size_t FindLargestStep(const std::vector<FlightRecord>& records);
+    static void WriteCsv(std::ostream& out, const FlightRecord* records, size_t count);
+
+private:
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t header_size;
+        uint32_t record_size;
+        uint32_t snapshot_size;
+        uint32_t capacity;
+        uint32_t rate_hz;
+        int64_t opened_unix;
+        uint64_t head;           // Mirrors m_head for readers of the file
+        char app_version[32];
+    };
+    static constexpr size_t HEADER_SIZE = 128;
+    static_assert(sizeof(Header) <= HEADER_SIZE, "Header must fit in HEADER_SIZE");
+
+    FlightRecorder() = default;
+    ~FlightRecorder();
+
+    std::string m_path;
+    FlightRecord* m_records = nullptr;
+    Header* m_header = nullptr;
+    size_t m_capacity = 0;
+    size_t m_file_size = 0;
+    uint64_t m_next_seq = 1;                 // FFB thread only
+    std::atomic<uint64_t> m_head{0};
+    void* m_mapping = nullptr;
+#ifdef _WIN32
+    void* m_file_handle = nullptr;
+    void* m_map_handle = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+#endif // FLIGHTRECORDER_H
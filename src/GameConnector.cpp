@@ -145,6 +145,7 @@ bool GameConnector::CopyTelemetry(SharedMemoryObjectOut& dest) {
         m_smLock->Unlock();
         return isRealtime;
     } else {
+        m_lockTimeouts.fetch_add(1, std::memory_order_relaxed);
         return false;
     }
 }
@@ -35,6 +35,9 @@ public:
     // Returns true if telemetry data hasn't changed for more than timeout (v0.7.15)
     bool IsStale(long timeoutMs = 100) const;
 
+    // Times CopyTelemetry gave up waiting for the shared memory lock (v0.7.112)
+    uint64_t GetLockTimeoutCount() const { return m_lockTimeouts.load(std::memory_order_relaxed); }
+
 private:
     GameConnector();
     ~GameConnector();
@@ -46,6 +49,7 @@ private:
     DWORD m_processId = 0;
 
     std::atomic<bool> m_connected{false};
+    std::atomic<uint64_t> m_lockTimeouts{0};
     mutable std::mutex m_mutex;
 
     // Heartbeat for staleness detection (v0.7.15)
@@ -15,6 +15,8 @@
 
 #include "FFBEngine.h"
 #include "Config.h"
+#include "DiagnosticEvents.h"
+#include "VehicleProfileStore.h"
 #include <iostream>
 #include <mutex>
 
@@ -25,7 +27,8 @@ using namespace ffb_math;
 
 // Helper: Learn static front load reference (v0.7.46)
 void FFBEngine::update_static_load_reference(double current_load, double speed, double dt) {
-    std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
+    std::unique_lock<std::recursive_mutex> lock(g_engine_mutex, std::defer_lock);
+    if (!m_isolated) lock.lock();
     if (m_static_load_latched) return; // Do not update if latched
 
     if (speed > 2.0 && speed < 15.0) {
@@ -38,12 +41,12 @@ void FFBEngine::update_static_load_reference(double current_load, double speed,
         // Latch the value once we exceed 15 m/s (aero begins to take over)
         m_static_load_latched = true;
 
-        // Save to config map (v0.7.70)
+        // Save to the vehicle profile (v0.7.70, in-place since v0.7.112: no config rewrite)
+        // Isolated engines (other cars) must not overwrite the player's persisted loads.
         std::string vName = m_vehicle_name;
-        if (vName != "Unknown" && vName != "") {
+        if (!m_isolated && vName != "Unknown" && vName != "") {
             Config::SetSavedStaticLoad(vName, m_static_front_load);
-            Config::m_needs_save = true; // Flag main thread to write to disk
-            std::cout << "[FFB] Latched and saved static load for " << vName << ": " << m_static_front_load << "N" << std::endl;
+            DiagnosticEvents::Get().Post(DiagEvent::StaticLoadLatched, vName.c_str(), m_static_front_load);
         }
     }
 
@@ -53,40 +56,111 @@ void FFBEngine::update_static_load_reference(double current_load, double speed,
     }
 }
 
+// Stores the current car's learned normalization peaks in its profile (v0.7.112)
+void FFBEngine::SaveVehicleProfile() {
+    if (m_isolated || m_profile_vehicle[0] == '\0' || std::strcmp(m_profile_vehicle, "Unknown") == 0) return;
+    VehicleProfileStore& profiles = VehicleProfileStore::Get();
+    if (m_dynamic_normalization_enabled) profiles.SetField(m_profile_vehicle, ProfileField::SessionPeakTorque, m_session_peak_torque);
+    if (m_auto_load_normalization_enabled) profiles.SetField(m_profile_vehicle, ProfileField::AutoPeakLoad, m_auto_peak_load);
+    double slip_peak = 0.0;
+    if (m_adaptive_slip_angle && m_slip_estimator.GetLearnedPeak(slip_peak)) {
+        profiles.SetField(m_profile_vehicle, ProfileField::OptimalSlipAngle, slip_peak);
+    }
+}
+
+double FFBEngine::GetEffectiveOptimalSlipAngle(double tire_load) const {
+    double learned = 0.0;
+    if (m_adaptive_slip_angle && m_slip_estimator.GetPeak(tire_load, learned)) return learned;
+    return (double)m_optimal_slip_angle;
+}
+
 // Initialize the load reference based on vehicle class and name seeding
 void FFBEngine::InitializeLoadReference(const char* className, const char* vehicleName) {
-    std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
+    std::unique_lock<std::recursive_mutex> lock(g_engine_mutex, std::defer_lock);
+    if (!m_isolated) lock.lock();
+    SeedVehicle(className, vehicleName, ResolveVehicleSeed(className, vehicleName));
+}
+
+FFBEngine::VehicleSeed FFBEngine::ResolveVehicleSeed(const char* className, const char* vehicleName) {
+    VehicleSeed seed;
+    std::string vName = vehicleName ? vehicleName : "Unknown";
+    seed.vclass = ParseVehicleClass(className, vehicleName);
+    seed.class_load = GetDefaultLoadForClass(seed.vclass);
+
+    VehicleProfileStore& profiles = VehicleProfileStore::Get();
+    double learned = 0.0;
+    if (profiles.GetField(vName.c_str(), ProfileField::AutoPeakLoad, learned) && learned > 0.0) seed.learned_peak_load = learned;
+    if (profiles.GetField(vName.c_str(), ProfileField::SessionPeakTorque, learned) && learned > 0.0) seed.learned_peak_torque = learned;
+    seed.has_slip_angle = profiles.GetField(vName.c_str(), ProfileField::OptimalSlipAngle, seed.learned_slip_angle);
+    seed.has_static_load = Config::GetSavedStaticLoad(vName, seed.static_front_load);
+    return seed;
+}
+
+bool FFBEngine::IsSeededFor(const char* className, const char* vehicleName) const {
+    if (!className || m_current_class_name != className) return false;
+    // v0.7.112: Cars of the same class have their own profiles, so compare the full name too
+    return !vehicleName || std::strncmp(m_profile_vehicle, vehicleName, STR_MAX_64) == 0;
+}
+
+void FFBEngine::SeedVehicle(const char* className, const char* vehicleName, const VehicleSeed& seed) {
+    std::unique_lock<std::recursive_mutex> lock(g_engine_mutex, std::defer_lock);
+    if (!m_isolated) lock.lock();
+
+    // v0.7.112: Keep what was learned for the outgoing car. A class change under the same
+    // name is not a new car, and peaks learned under the other class are not worth keeping.
+    std::string vName = vehicleName ? vehicleName : "Unknown";
+    if (!m_isolated && std::strncmp(m_profile_vehicle, vName.c_str(), STR_MAX_64) != 0) SaveVehicleProfile();
+    if (className) m_current_class_name = className;
+#ifdef _WIN32
+    strncpy_s(m_profile_vehicle, sizeof(m_profile_vehicle), vName.c_str(), _TRUNCATE);
+#else
+    strncpy(m_profile_vehicle, vName.c_str(), STR_MAX_64);
+    m_profile_vehicle[STR_MAX_64] = '\0';
+#endif
 
     // v0.7.109: Perform a full normalization reset on car change
     // This ensures that session-learned peaks from a previous car don't pollute the new session.
-    ResetNormalization();
-
-    ParsedVehicleClass vclass = ParseVehicleClass(className, vehicleName);
+    // Isolated engines only need the structural part, which takes no shared lookups.
+    if (!m_isolated) {
+        ResetNormalization();
+    } else {
+        m_session_peak_torque = (std::max)(1.0, (double)m_target_rim_nm);
+        m_smoothed_structural_mult = 1.0 / (m_session_peak_torque + EPSILON_DIV);
+        m_rolling_average_torque = m_session_peak_torque;
+    }
 
     // Stage 3 Reset: Ensure peak load starts at class baseline
-    m_auto_peak_load = GetDefaultLoadForClass(vclass);
+    m_auto_peak_load = seed.class_load;
 
-    std::string vName = vehicleName ? vehicleName : "Unknown";
+    // v0.7.112: Resume normalization from this car's learned peaks instead of the seeds
+    if (m_auto_load_normalization_enabled && seed.learned_peak_load > 0.0) {
+        m_auto_peak_load = seed.learned_peak_load;
+    }
+    if (m_dynamic_normalization_enabled && seed.learned_peak_torque > 0.0) {
+        m_session_peak_torque = (std::max)(1.0, seed.learned_peak_torque);
+        m_smoothed_structural_mult = 1.0 / (m_session_peak_torque + EPSILON_DIV);
+        m_rolling_average_torque = m_session_peak_torque;
+    }
+    m_slip_estimator.Reset();
+    if (seed.has_slip_angle) m_slip_estimator.Seed(seed.learned_slip_angle);
 
     // Check if we already have a saved static load for this specific car (v0.7.70)
-    double saved_load = 0.0;
-    if (Config::GetSavedStaticLoad(vName, saved_load)) {
-        m_static_front_load = saved_load;
+    if (seed.has_static_load) {
+        m_static_front_load = seed.static_front_load;
         m_static_load_latched = true; // Skip the 2-15 m/s learning phase
-        std::cout << "[FFB] Loaded persistent static load for " << vName << ": " << m_static_front_load << "N" << std::endl;
+        if (!m_isolated) DiagnosticEvents::Get().Post(DiagEvent::StaticLoadRestored, vName.c_str(), m_static_front_load);
     } else {
         // Reset static load reference for new car class
         m_static_front_load = m_auto_peak_load * 0.5;
         m_static_load_latched = false;
-        std::cout << "[FFB] No saved load for " << vName << ". Learning required." << std::endl;
+        if (!m_isolated) DiagnosticEvents::Get().Post(DiagEvent::StaticLoadUnknown, vName.c_str());
     }
 
     m_smoothed_tactile_mult = 1.0;
 
-    std::cout << "[FFB] Vehicle Identification -> Detected Class: " << VehicleClassToString(vclass)
-              << " | Seed Load: " << m_auto_peak_load << "N" 
-              << " (Raw -> Class: " << (className ? className : "Unknown") 
-              << ", Name: " << vName << ")" << std::endl;
+    if (m_isolated) return;
+    DiagnosticEvents::Get().Post(DiagEvent::VehicleClassSeeded, vName.c_str(), m_auto_peak_load, 0.0,
+                                 VehicleClassToString(seed.vclass), className ? className : "Unknown");
 }
 
 // Helper: Calculate Raw Slip Angle for a pair of wheels (v0.4.9 Refactor)
@@ -151,6 +225,8 @@ GripResult FFBEngine::calculate_grip(const TelemWheelV01& w1,
     result.value = result.original;
     result.approximated = false;
     result.slip_angle = 0.0;
+    result.wheel_grip[0] = w1.mGripFract;
+    result.wheel_grip[1] = w2.mGripFract;
     
     // ==================================================================================
     // CRITICAL LOGIC FIX (v0.4.14) - DO NOT MOVE INSIDE CONDITIONAL BLOCK
@@ -171,6 +247,8 @@ GripResult FFBEngine::calculate_grip(const TelemWheelV01& w1,
     double slip1 = calculate_slip_angle(w1, prev_slip1, dt);
     double slip2 = calculate_slip_angle(w2, prev_slip2, dt);
     result.slip_angle = (slip1 + slip2) / 2.0;
+    result.wheel_slip_angle[0] = slip1;
+    result.wheel_slip_angle[1] = slip2;
 
     // Fallback condition: Grip is essentially zero BUT car has significant load
     if (result.value < 0.0001 && avg_load > 100.0) {
@@ -180,6 +258,7 @@ GripResult FFBEngine::calculate_grip(const TelemWheelV01& w1,
             // Note: We still keep the calculated slip_angle in result.slip_angle
             // for visualization/rear torque, even if we force grip to 1.0 here.
             result.value = 1.0; 
+            result.wheel_grip[0] = result.wheel_grip[1] = 1.0;
         } else {
             if (m_slope_detection_enabled && is_front && data) {
                 // Dynamic grip estimation via derivative monitoring
@@ -189,42 +268,47 @@ GripResult FFBEngine::calculate_grip(const TelemWheelV01& w1,
                     dt,
                     data
                 );
+                result.wheel_grip[0] = result.wheel_grip[1] = result.value;
             } else {
                 // v0.4.38: Combined Friction Circle (Advanced Reconstruction)
-                
-                // 1. Lateral Component (Alpha)
-                // USE CONFIGURABLE THRESHOLD (v0.5.7)
-                double lat_metric = std::abs(result.slip_angle) / (double)m_optimal_slip_angle;
-
-                // 2. Longitudinal Component (Kappa)
-                // Calculate manual slip for both wheels and average the magnitude
-                double ratio1 = calculate_manual_slip_ratio(w1, car_speed);
-                double ratio2 = calculate_manual_slip_ratio(w2, car_speed);
-                double avg_ratio = (std::abs(ratio1) + std::abs(ratio2)) / 2.0;
-
-                // USE CONFIGURABLE THRESHOLD (v0.5.7)
-                double long_metric = avg_ratio / (double)m_optimal_slip_ratio;
-
-                // 3. Combined Vector (Friction Circle)
-                double combined_slip = std::sqrt((lat_metric * lat_metric) + (long_metric * long_metric));
-
-                // 4. Map to Grip Fraction
-
-                if (combined_slip > 1.0) {
-                    double excess = combined_slip - 1.0;
-                    result.value = 1.0 / (1.0 + excess * 2.0);
-                } else {
-                    result.value = 1.0;
+                // v0.7.112: Evaluated per wheel, then averaged, so one locked or sliding
+                // wheel is not diluted by its partner before the circle is applied.
+                // Learned per-car peak when Adaptive Slip Angle is enabled.
+                double optimal_slip_angle = GetEffectiveOptimalSlipAngle(avg_load);
+                const TelemWheelV01* axle[2] = { &w1, &w2 };
+                const double slips[2] = { slip1, slip2 };
+                for (int k = 0; k < 2; k++) {
+                    // 1. Lateral Component (Alpha)
+                    // USE CONFIGURABLE THRESHOLD (v0.5.7)
+                    double lat_metric = std::abs(slips[k]) / optimal_slip_angle;
+
+                    // 2. Longitudinal Component (Kappa)
+                    double ratio = calculate_manual_slip_ratio(*axle[k], car_speed);
+                    double long_metric = std::abs(ratio) / (double)m_optimal_slip_ratio;
+
+                    // 3. Combined Vector (Friction Circle)
+                    double combined_slip = std::sqrt((lat_metric * lat_metric) + (long_metric * long_metric));
+
+                    // 4. Map to Grip Fraction
+                    if (combined_slip > 1.0) {
+                        double excess = combined_slip - 1.0;
+                        result.wheel_grip[k] = 1.0 / (1.0 + excess * 2.0);
+                    } else {
+                        result.wheel_grip[k] = 1.0;
+                    }
                 }
+                result.value = (result.wheel_grip[0] + result.wheel_grip[1]) / 2.0;
             }
         }
         
         
         // Safety Clamp (v0.4.6): Never drop below 0.2 in approximation
         result.value = (std::max)(0.2, result.value);
+        result.wheel_grip[0] = (std::max)(0.2, result.wheel_grip[0]);
+        result.wheel_grip[1] = (std::max)(0.2, result.wheel_grip[1]);
         
         if (!warned_flag) {
-            std::cout << "Warning: Data for mGripFract from the game seems to be missing for this car (" << vehicleName << "). (Likely Encrypted/DLC Content). A fallback estimation will be used." << std::endl;
+            DiagnosticEvents::Get().Post(DiagEvent::MissingGripFract, vehicleName);
             warned_flag = true;
         }
     }
@@ -240,6 +324,25 @@ GripResult FFBEngine::calculate_grip(const TelemWheelV01& w1,
     return result;
 }
 
+// Per-wheel load and slip ratio (v0.7.112)
+// One pass over the four wheels. When mTireLoad is missing (ctx.frame_warn_load),
+// each wheel falls back on its own: suspension force if present, else the kinematic model.
+void FFBEngine::update_wheel_states(const TelemInfoV01* data, FFBCalculationContext& ctx) {
+    for (int i = 0; i < 4; i++) {
+        const TelemWheelV01& w = data->mWheel[i];
+        WheelState& s = ctx.wheels[i];
+        s.slip_ratio = calculate_wheel_slip_ratio(w);
+        s.load_approximated = ctx.frame_warn_load;
+        if (!ctx.frame_warn_load) {
+            s.load = w.mTireLoad;
+        } else if (w.mSuspForce > MIN_VALID_SUSP_FORCE) {
+            s.load = (i < 2) ? approximate_load(w) : approximate_rear_load(w);
+        } else {
+            s.load = calculate_kinematic_load(data, i);
+        }
+    }
+}
+
 // Helper: Approximate Load (v0.4.5)
 double FFBEngine::approximate_load(const TelemWheelV01& w) {
     // Base: Suspension Force + Est. Unsprung Mass (300N)
@@ -277,7 +380,10 @@ double FFBEngine::calculate_kinematic_load(const TelemInfoV01* data, int wheel_i
     // 
     // Formula: (Accel / g) * WEIGHT_TRANSFER_SCALE
     // We use SMOOTHED acceleration to simulate chassis pitch inertia (~35ms lag)
-    double long_transfer = (m_accel_z_smoothed / 9.81) * WEIGHT_TRANSFER_SCALE; 
+    // v0.7.112: or the chassis estimator's fused value when enabled
+    bool use_chassis_state = m_chassis_estimator_enabled && m_chassis_estimator.IsInitialized();
+    double long_g = use_chassis_state ? m_chassis_estimator.GetLongTransferG() : (m_accel_z_smoothed / 9.81);
+    double long_transfer = long_g * WEIGHT_TRANSFER_SCALE; 
     if (is_rear) long_transfer *= -1.0; // Subtract from Rear during Braking
 
     // 4. Lateral Weight Transfer (Cornering)
@@ -289,7 +395,8 @@ double FFBEngine::calculate_kinematic_load(const TelemInfoV01* data, int wheel_i
     // 
     // Formula: (Accel / g) * WEIGHT_TRANSFER_SCALE * Roll_Stiffness
     // We use SMOOTHED acceleration to simulate chassis roll inertia (~35ms lag)
-    double lat_transfer = (m_accel_x_smoothed / 9.81) * WEIGHT_TRANSFER_SCALE * m_approx_roll_stiffness;
+    double lat_g = use_chassis_state ? m_chassis_estimator.GetLatTransferG() : (m_accel_x_smoothed / 9.81);
+    double lat_transfer = lat_g * WEIGHT_TRANSFER_SCALE * m_approx_roll_stiffness;
     bool is_left = (wheel_index == 0 || wheel_index == 2);
     if (!is_left) lat_transfer *= -1.0; // Subtract from Right wheels
 
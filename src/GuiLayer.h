@@ -2,6 +2,7 @@
 #define GUILAYER_H
 
 #include "FFBEngine.h"
+#include <chrono>
 #include <string>
 
 class GuiLayer {
@@ -13,12 +14,18 @@ public:
     static void* GetWindowHandle(); // Returns HWND on Windows, GLFWwindow* on Linux
     static void SetupGUIStyle();   // Setup professional theme
 
-    // Returns true if the GUI is active/focused (affects lazy rendering)
+    // Pumps window messages and redraws when the RenderScheduler says a frame is due.
+    // Returns false once the window was closed.
     static bool Render(FFBEngine& engine);
+    // Blocks until the next pump or draw is due, returning early on window input (v0.7.112)
+    static void WaitForEvents();
+    // Refresh interval the open graphs ask for, 0 when none are open (v0.7.112)
+    static std::chrono::milliseconds GetPlotRefreshInterval();
 
 private:
     static void DrawTuningWindow(FFBEngine& engine);
     static void DrawDebugWindow(FFBEngine& engine);
+    static void DrawPlotPanels(FFBEngine& engine);
 };
 
 // Platform helper functions (implemented in GuiLayer_Win32.cpp and GuiLayer_Linux.cpp)
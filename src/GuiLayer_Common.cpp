@@ -5,9 +5,16 @@
 #include "DirectInputFFB.h"
 #include "GameConnector.h"
 #include "GuiWidgets.h"
+#include "AnomalyTrigger.h"
 #include "AsyncLogger.h"
+#include "DiagnosticEvents.h"
+#include "FlightRecorder.h"
+#include "PlotBuffer.h"
+#include "PlotPanels.h"
+#include "RenderScheduler.h"
 #include <iostream>
 #include <vector>
+#include <array>
 #include <cmath>
 #include <algorithm>
 #include <cstring>
@@ -42,6 +49,8 @@ extern std::atomic<bool> g_running;
 extern std::recursive_mutex g_engine_mutex;
 
 static const float CONFIG_PANEL_WIDTH = 500.0f;
+static PlotPanelSet g_plot_panels; // User plot panels (v0.7.112), layout in Config::plot_panels
+static bool g_plot_panels_loaded = false;
 static const int LATENCY_WARNING_THRESHOLD_MS = 15;
 
 // Professional "Flat Dark" Theme
@@ -142,7 +151,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
                 selected_device_idx = i;
                 DirectInputFFB::Get().SelectDevice(devices[i].guid);
                 Config::m_last_device_guid = DirectInputFFB::GuidToString(devices[i].guid);
-                Config::Save(engine);
+                Config::RequestSave(engine);
             }
             if (is_selected) ImGui::SetItemDefaultFocus();
             ImGui::PopID();
@@ -179,7 +188,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
 
     if (ImGui::Checkbox("Always on Top", &Config::m_always_on_top)) {
         SetWindowAlwaysOnTopPlatform(Config::m_always_on_top);
-        Config::Save(engine);
+        Config::RequestSave(engine);
     }
     if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::ALWAYS_ON_TOP);
     ImGui::SameLine();
@@ -191,9 +200,16 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
         int target_w = Config::show_graphs ? Config::win_w_large : Config::win_w_small;
         int target_h = Config::show_graphs ? Config::win_h_large : Config::win_h_small;
         ResizeWindowPlatform(Config::win_pos_x, Config::win_pos_y, target_w, target_h);
-        Config::Save(engine);
+        Config::RequestSave(engine);
     }
     if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::SHOW_GRAPHS);
+    ImGui::SameLine();
+    if (ImGui::Button("+ Plot Panel")) {
+        g_plot_panels.Add();
+        Config::plot_panels = g_plot_panels.Serialize();
+        Config::RequestSave(engine);
+    }
+    if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::ADD_PLOT_PANEL);
 
     ImGui::Separator();
     bool is_logging = AsyncLogger::Get().IsLogging();
@@ -242,7 +258,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
              info.slope_decay_rate = engine.m_slope_decay_rate;
              info.torque_passthrough = engine.m_torque_passthrough;
 
-             AsyncLogger::Get().Start(info, Config::m_log_path);
+             AsyncLogger::Get().Start(info, Config::m_log_path, Config::m_log_compress);
          }
          if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::LOG_START);
          ImGui::SameLine();
@@ -270,14 +286,14 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
     auto FloatSetting = [&](const char* label, float* v, float min, float max, const char* fmt = "%.2f", const char* tooltip = nullptr, std::function<void()> decorator = nullptr) {
         GuiWidgets::Result res = GuiWidgets::Float(label, v, min, max, fmt, tooltip, decorator);
         if (res.deactivated) {
-            Config::Save(engine);
+            Config::RequestSave(engine);
         }
     };
 
     auto BoolSetting = [&](const char* label, bool* v, const char* tooltip = nullptr) {
         GuiWidgets::Result res = GuiWidgets::Checkbox(label, v, tooltip);
         if (res.deactivated) {
-            Config::Save(engine);
+            Config::RequestSave(engine);
         }
     };
 
@@ -286,7 +302,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
         if (res.changed) {
             std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
             // v is already updated by ImGui, but we lock to ensure visibility and consistency
-            Config::Save(engine);
+            Config::RequestSave(engine);
         }
     };
 
@@ -352,7 +368,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
             if (selected_preset >= 0 && selected_preset < (int)Config::presets.size() && !Config::presets[selected_preset].is_builtin) {
                 Config::AddUserPreset(Config::presets[selected_preset].name, engine);
             } else {
-                Config::Save(engine);
+                Config::RequestSave(engine);
             }
         }
         if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::PRESET_SAVE_CURRENT);
@@ -424,7 +440,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
         if (GuiWidgets::Checkbox("Use In-Game FFB (400Hz Native)", &use_in_game_ffb, Tooltips::USE_INGAME_FFB).changed) {
             std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
             engine.m_torque_source = use_in_game_ffb ? 1 : 0;
-            Config::Save(engine);
+            Config::RequestSave(engine);
         }
 
         BoolSetting("Invert FFB Signal", &engine.m_invert_force, Tooltips::INVERT_FFB);
@@ -434,7 +450,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
             if (prev_structural && !engine.m_dynamic_normalization_enabled) {
                 engine.ResetNormalization();
             }
-            Config::Save(engine);
+            Config::RequestSave(engine);
         }
         FloatSetting("Master Gain", &engine.m_gain, 0.0f, 2.0f, FormatPct(engine.m_gain), Tooltips::MASTER_GAIN);
         FloatSetting("Wheelbase Max Torque", &engine.m_wheelbase_max_nm, 1.0f, 50.0f, "%.1f Nm", Tooltips::WHEELBASE_MAX_TORQUE);
@@ -474,6 +490,17 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
                 ImGui::TextColored(color, "Latency: %d ms - %s", ms, (ms < LATENCY_WARNING_THRESHOLD_MS) ? "OK" : "High");
             });
 
+        if (engine.m_torque_source == 0) {
+            FloatSetting("  Latency Compensation", &engine.m_torque_prediction_ms, 0.0f, 50.0f, "%.0f ms",
+                Tooltips::TORQUE_PREDICTION,
+                [&]() {
+                    if (engine.m_torque_prediction_ms > 0.0f) {
+                        int pct = (int)std::lround(engine.m_torque_predictor.GetConfidence() * 100.0);
+                        ImGui::TextColored(ImVec4(0.5f, 0.5f, 1.0f, 1.0f), "Confidence: %d%%", pct);
+                    }
+                });
+        }
+
         FloatSetting("Understeer Effect", &engine.m_understeer_effect, 0.0f, 2.0f, FormatPct(engine.m_understeer_effect),
             Tooltips::UNDERSTEER_EFFECT);
 
@@ -508,6 +535,16 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
                 FloatSetting("    Filter Width", &engine.m_static_notch_width, 0.1f, 10.0f, "%.1f Hz", Tooltips::STATIC_NOTCH_WIDTH);
             }
 
+            if (engine.m_flatspot_suppression || engine.m_static_notch_enabled) {
+                BoolSetting("  Auto-Tune Notches", &engine.m_notch_auto_tune, Tooltips::NOTCH_AUTO_TUNE);
+                if (engine.m_notch_auto_tune) {
+                    ImGui::Text("    Applied Centers");
+                    ImGui::NextColumn();
+                    ImGui::TextDisabled("Flatspot %.1f Hz / Static %.1f Hz", engine.m_flatspot_notch_freq, engine.m_static_notch_applied_freq);
+                    ImGui::NextColumn();
+                }
+            }
+
             ImGui::TreePop();
         } else {
             ImGui::NextColumn(); ImGui::NextColumn();
@@ -586,9 +623,20 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
                 int ms = (int)std::lround(engine.m_chassis_inertia_smoothing * 1000.0f);
                 ImGui::TextColored(ImVec4(0.5f, 0.5f, 1.0f, 1.0f), "Simulation: %d ms", ms);
             });
+        BoolSetting("  Chassis State Filter", &engine.m_chassis_estimator_enabled, Tooltips::CHASSIS_ESTIMATOR);
 
         FloatSetting("Optimal Slip Angle", &engine.m_optimal_slip_angle, 0.05f, 0.20f, "%.2f rad",
             Tooltips::OPTIMAL_SLIP_ANGLE);
+        BoolSetting("  Adaptive Slip Angle", &engine.m_adaptive_slip_angle, Tooltips::ADAPTIVE_SLIP_ANGLE);
+        if (engine.m_adaptive_slip_angle) {
+            double learned = 0.0;
+            if (engine.m_slip_estimator.GetLearnedPeak(learned)) {
+                ImGui::TextColored(ImVec4(0.5f, 0.5f, 1.0f, 1.0f), "  Learned peak: %.3f rad", learned);
+            } else {
+                ImGui::TextColored(ImVec4(0.7f, 0.7f, 0.7f, 1.0f), "  Learning... (%u samples)", engine.m_slip_estimator.GetSampleCount());
+            }
+            ImGui::NextColumn(); ImGui::NextColumn();
+        }
         FloatSetting("Optimal Slip Ratio", &engine.m_optimal_slip_ratio, 0.05f, 0.20f, "%.2f",
             Tooltips::OPTIMAL_SLIP_RATIO);
 
@@ -608,7 +656,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
             }
         }
         if (slope_res.deactivated) {
-            Config::Save(engine);
+            Config::RequestSave(engine);
         }
 
         if (engine.m_slope_detection_enabled && engine.m_oversteer_boost > 0.01f) {
@@ -626,7 +674,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
             if (ImGui::IsItemHovered()) {
                 ImGui::SetTooltip("%s", Tooltips::SLOPE_FILTER_WINDOW);
             }
-            if (ImGui::IsItemDeactivatedAfterEdit()) Config::Save(engine);
+            if (ImGui::IsItemDeactivatedAfterEdit()) Config::RequestSave(engine);
 
             ImGui::SameLine();
             float latency_ms = (static_cast<float>(engine.m_slope_sg_window) / 2.0f) * 2.5f;
@@ -714,7 +762,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
             if (prev_tactile && !engine.m_auto_load_normalization_enabled) {
                 engine.ResetNormalization();
             }
-            Config::Save(engine);
+            Config::RequestSave(engine);
         }
 
         FloatSetting("Texture Load Cap", &engine.m_texture_load_cap, 1.0f, 3.0f, "%.2fx", Tooltips::TEXTURE_LOAD_CAP);
@@ -729,6 +777,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
         BoolSetting("Road Details", &engine.m_road_texture_enabled, Tooltips::ROAD_DETAILS);
         if (engine.m_road_texture_enabled) {
             FloatSetting("  Road Gain", &engine.m_road_texture_gain, 0.0f, 2.0f, FormatDecoupled(engine.m_road_texture_gain, FFBEngine::BASE_NM_ROAD_TEXTURE), Tooltips::ROAD_GAIN);
+            FloatSetting("  Road Prediction", &engine.m_road_prediction, 0.0f, 1.0f, "%.2f", Tooltips::ROAD_PREDICTION);
         }
 
         BoolSetting("Spin Vibration", &engine.m_spin_enabled, Tooltips::SPIN_VIBRATION);
@@ -758,7 +807,7 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
                     engine.m_speed_gate_upper = engine.m_speed_gate_lower + 0.5f;
             }
             if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::MUTE_BELOW);
-            if (ImGui::IsItemDeactivatedAfterEdit()) Config::Save(engine);
+            if (ImGui::IsItemDeactivatedAfterEdit()) Config::RequestSave(engine);
 
             float upper_kmh = engine.m_speed_gate_upper * 3.6f;
             if (ImGui::SliderFloat("Full Above", &upper_kmh, 1.0f, 50.0f, "%.1f km/h")) {
@@ -767,14 +816,14 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
                     engine.m_speed_gate_upper = engine.m_speed_gate_lower + 0.5f;
             }
             if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::FULL_ABOVE);
-            if (ImGui::IsItemDeactivatedAfterEdit()) Config::Save(engine);
+            if (ImGui::IsItemDeactivatedAfterEdit()) Config::RequestSave(engine);
 
             ImGui::TreePop();
         }
 
         if (ImGui::TreeNode("Telemetry Logger")) {
             if (ImGui::Checkbox("Auto-Start on Session", &Config::m_auto_start_logging)) {
-                Config::Save(engine);
+                Config::RequestSave(engine);
             }
             if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::AUTO_START_LOGGING);
 
@@ -789,12 +838,39 @@ void GuiLayer::DrawTuningWindow(FFBEngine& engine) {
                 Config::m_log_path = log_path_buf;
             }
             if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::LOG_PATH);
-            if (ImGui::IsItemDeactivatedAfterEdit()) Config::Save(engine);
+            if (ImGui::IsItemDeactivatedAfterEdit()) Config::RequestSave(engine);
+
+            if (ImGui::Checkbox("Compress Logs", &Config::m_log_compress)) {
+                Config::RequestSave(engine);
+            }
+            if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::LOG_COMPRESS);
 
             if (AsyncLogger::Get().IsLogging()) {
                 ImGui::BulletText("Filename: %s", AsyncLogger::Get().GetFilename().c_str());
             }
 
+            // Flight recorder (v0.7.112): applied at the next start
+            if (ImGui::Checkbox("Flight Recorder", &Config::m_flight_recorder)) {
+                Config::RequestSave(engine);
+            }
+            if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::FLIGHT_RECORDER);
+            if (ImGui::SliderInt("Recorder Seconds", &Config::m_flight_recorder_seconds,
+                                 FlightRecorder::MIN_SECONDS, FlightRecorder::MAX_SECONDS)) {
+                Config::RequestSave(engine);
+            }
+            if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::FLIGHT_RECORDER_SECONDS);
+            if (FlightRecorder::Get().IsOpen()) {
+                ImGui::BulletText("Recording: %s", FlightRecorder::Get().GetPath().c_str());
+            }
+            if (ImGui::Checkbox("Anomaly Snapshots", &Config::m_anomaly_dumps)) {
+                Config::RequestSave(engine);
+            }
+            if (ImGui::IsItemHovered()) ImGui::SetTooltip("%s", Tooltips::ANOMALY_DUMPS);
+            if (AnomalyTrigger::Get().GetDumpCount() > 0) {
+                ImGui::BulletText("Anomalies saved: %llu (last: %s)", (unsigned long long)AnomalyTrigger::Get().GetDumpCount(),
+                                  AnomalyTrigger::Get().GetLastDumpPath().c_str());
+            }
+
             ImGui::TreePop();
         }
         ImGui::Unindent();
@@ -808,50 +884,76 @@ const float PLOT_HISTORY_SEC = 10.0f;
 const int PHYSICS_RATE_HZ = 400;
 const int PLOT_BUFFER_SIZE = (int)(PLOT_HISTORY_SEC * PHYSICS_RATE_HZ);
 
-struct RollingBuffer {
-    std::vector<float> data;
-    int offset = 0;
+// Every analysis buffer, so a gap in the snapshot stream can be marked in all of them
+static std::vector<PlotBuffer*>& AnalysisBuffers() {
+    static std::vector<PlotBuffer*> buffers;
+    return buffers;
+}
 
-    RollingBuffer() {
-        data.resize(PLOT_BUFFER_SIZE, 0.0f);
-    }
+struct RollingBuffer : PlotBuffer {
+    RollingBuffer() : PlotBuffer(PLOT_BUFFER_SIZE) { AnalysisBuffers().push_back(this); }
+};
 
-    void Add(float val) {
-        data[offset] = val;
-        offset = (offset + 1) % (int)data.size();
-    }
+static ImVec2 PlotItemSize(ImVec2 size) {
+    if (size.x == 0.0f) size.x = ImGui::CalcItemWidth();
+    else if (size.x < 0.0f) size.x = (std::max)(4.0f, ImGui::GetContentRegionAvail().x + size.x);
+    if (size.y == 0.0f) size.y = ImGui::GetFontSize() + ImGui::GetStyle().FramePadding.y * 2.0f;
+    return size;
+}
 
-    float GetCurrent() const {
-        if (data.empty()) return 0.0f;
-        size_t idx = (offset - 1 + (int)data.size()) % (int)data.size();
-        return data[idx];
-    }
+// Pixel columns available inside a plot frame of the given width
+static int PlotColumns(float width) {
+    return (std::max)(0, (int)(width - ImGui::GetStyle().FramePadding.x * 2.0f));
+}
 
-    float GetMin() const {
-        if (data.empty()) return 0.0f;
-        return *std::min_element(data.begin(), data.end());
-    }
+// Draws a precomputed envelope (one entry per column, NaN = no data) as a plot item
+static void DrawEnvelope(const char* id, const float* env_min, const float* env_max, int count,
+                         float scale_min, float scale_max, ImVec2 size) {
+    const ImGuiStyle& style = ImGui::GetStyle();
+    ImVec2 p0 = ImGui::GetCursorScreenPos();
+    ImGui::InvisibleButton(id, size);
+    if (!ImGui::IsItemVisible()) return;
+    ImVec2 p1(p0.x + size.x, p0.y + size.y);
 
-    float GetMax() const {
-        if (data.empty()) return 0.0f;
-        return *std::max_element(data.begin(), data.end());
+    ImDrawList* draw_list = ImGui::GetWindowDrawList();
+    draw_list->AddRectFilled(p0, p1, ImGui::GetColorU32(ImGuiCol_FrameBg), style.FrameRounding);
+
+    float x0 = p0.x + style.FramePadding.x;
+    float y0 = p0.y + style.FramePadding.y, y1 = p1.y - style.FramePadding.y;
+    int columns = (std::min)(count, PlotColumns(size.x));
+    if (columns <= 0 || scale_max <= scale_min) return;
+
+    ImU32 color = ImGui::GetColorU32(ImGuiCol_PlotLines);
+    float y_scale = (y1 - y0) / (scale_max - scale_min);
+    auto to_y = [&](float v) { return y1 - ((std::clamp)(v, scale_min, scale_max) - scale_min) * y_scale; };
+    for (int c = 0; c < columns; ++c) {
+        if (std::isnan(env_min[c])) continue;
+        float lo = env_min[c], hi = env_max[c];
+        // Reach the previous column so the trace stays connected across fast edges
+        if (c > 0 && !std::isnan(env_min[c - 1])) {
+            lo = (std::min)(lo, env_max[c - 1]);
+            hi = (std::max)(hi, env_min[c - 1]);
+        }
+        float x = x0 + (float)c;
+        draw_list->AddRectFilled(ImVec2(x, to_y(hi)), ImVec2(x + 1.0f, to_y(lo) + 1.0f), color);
     }
-};
+}
 
-inline void PlotWithStats(const char* label, const RollingBuffer& buffer,
-                          float scale_min, float scale_max,
-                          const ImVec2& size = ImVec2(0, 40),
-                          const char* tooltip = nullptr) {
-    ImGui::Text("%s", label);
-    char hidden_label[256];
-    snprintf(hidden_label, sizeof(hidden_label), "##%s", label);
-    ImGui::PlotLines(hidden_label, buffer.data.data(), (int)buffer.data.size(),
-                     buffer.offset, NULL, scale_min, scale_max, size);
-    if (tooltip && ImGui::IsItemHovered()) ImGui::SetTooltip("%s", tooltip);
+// Draws a plot as one min/max bar per pixel column (v0.7.112). Replaces ImGui::PlotLines,
+// which walks every sample; this costs one PlotBuffer range query per column. Same
+// sizing rules as PlotLines and honours pushed ImGuiCol_PlotLines / ImGuiCol_FrameBg
+// colours, so two plots can still be overlaid with a transparent frame.
+static void PlotEnvelope(const char* id, const PlotBuffer& buffer, float scale_min, float scale_max, ImVec2 size) {
+    size = PlotItemSize(size);
+    int columns = PlotColumns(size.x);
+    static std::vector<float> env_min, env_max;
+    if ((int)env_min.size() < columns) { env_min.resize(columns); env_max.resize(columns); }
+    buffer.BuildEnvelope(columns, env_min.data(), env_max.data());
+    DrawEnvelope(id, env_min.data(), env_max.data(), columns, scale_min, scale_max, size);
+}
 
-    float current = buffer.GetCurrent();
-    float min_val = buffer.GetMin();
-    float max_val = buffer.GetMax();
+// Cur/Min/Max readout in the top-left corner of the last plot item
+static void DrawPlotStats(float current, float min_val, float max_val) {
     char stats_overlay[128];
     snprintf(stats_overlay, sizeof(stats_overlay), "Cur:%.4f Min:%.3f Max:%.3f", current, min_val, max_val);
 
@@ -877,44 +979,33 @@ inline void PlotWithStats(const char* label, const RollingBuffer& buffer,
     draw_list->AddText(font, font_size, p_min, IM_COL32(255, 255, 255, 255), stats_overlay);
 }
 
+inline void PlotWithStats(const char* label, const RollingBuffer& buffer,
+                          float scale_min, float scale_max,
+                          const ImVec2& size = ImVec2(0, 40),
+                          const char* tooltip = nullptr) {
+    ImGui::Text("%s", label);
+    char hidden_label[256];
+    snprintf(hidden_label, sizeof(hidden_label), "##%s", label);
+    PlotEnvelope(hidden_label, buffer, scale_min, scale_max, size);
+    if (tooltip && ImGui::IsItemHovered()) ImGui::SetTooltip("%s", tooltip);
+
+    DrawPlotStats(buffer.GetCurrent(), buffer.GetMin(), buffer.GetMax());
+}
+
 // Global Buffers
 static RollingBuffer plot_total, plot_base, plot_sop, plot_yaw_kick, plot_rear_torque, plot_gyro_damping, plot_scrub_drag, plot_soft_lock, plot_oversteer, plot_understeer, plot_clipping, plot_road, plot_slide, plot_lockup, plot_spin, plot_bottoming;
 static RollingBuffer plot_calc_front_load, plot_calc_rear_load, plot_calc_front_grip, plot_calc_rear_grip, plot_calc_slip_ratio, plot_calc_slip_angle_smoothed, plot_calc_rear_slip_angle_smoothed, plot_slope_current, plot_calc_rear_lat_force;
+static RollingBuffer plot_wheel_load[4], plot_wheel_grip[4], plot_wheel_slip_angle[4], plot_wheel_slip_ratio[4];
 static RollingBuffer plot_raw_steer, plot_raw_shaft_torque, plot_raw_gen_torque, plot_raw_input_steering, plot_raw_throttle, plot_raw_brake, plot_input_accel, plot_raw_car_speed, plot_raw_load, plot_raw_grip, plot_raw_rear_grip, plot_raw_front_slip_ratio, plot_raw_susp_force, plot_raw_ride_height, plot_raw_front_lat_patch_vel, plot_raw_front_long_patch_vel, plot_raw_rear_lat_patch_vel, plot_raw_rear_long_patch_vel, plot_raw_slip_angle, plot_raw_rear_slip_angle, plot_raw_front_deflection;
 
 static bool g_warn_dt = false;
 
-void GuiLayer::DrawDebugWindow(FFBEngine& engine) {
-    if (!Config::show_graphs) return;
-
-    ImGuiViewport* viewport = ImGui::GetMainViewport();
-    ImGui::SetNextWindowPos(ImVec2(viewport->Pos.x + CONFIG_PANEL_WIDTH, viewport->Pos.y));
-    ImGui::SetNextWindowSize(ImVec2(viewport->Size.x - CONFIG_PANEL_WIDTH, viewport->Size.y));
-
-    ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize;
-    ImGui::Begin("FFB Analysis", nullptr, flags);
-
-    // System Health Diagnostics (Moved from Tuning window - Issue #149)
-    if (ImGui::CollapsingHeader("System Health (Hz)", ImGuiTreeNodeFlags_DefaultOpen)) {
-        ImGui::Columns(5, "RateCols", false);
-        DisplayRate("FFB Loop", engine.m_ffb_rate, 400.0);
-        ImGui::NextColumn();
-        DisplayRate("Telemetry", engine.m_telemetry_rate, 400.0);
-        ImGui::NextColumn();
-        DisplayRate("Hardware", engine.m_hw_rate, 400.0);
-        ImGui::NextColumn();
-        DisplayRate("S.Torque", engine.m_torque_rate, 400.0);
-        ImGui::NextColumn();
-        DisplayRate("G.Torque", engine.m_gen_torque_rate, 400.0);
-        ImGui::Columns(1);
-        if ((engine.m_telemetry_rate < 380.0 || engine.m_torque_rate < 380.0) && engine.m_telemetry_rate > 1.0 && GameConnector::Get().IsConnected()) {
-            ImGui::TextColored(ImVec4(1, 1, 0, 1), "Warning: Low telemetry/torque rate. Check game FFB settings.");
-        }
-        ImGui::Separator();
+// Fixed FFB Analysis buffers, fed only while that window is open
+static void FeedAnalysisBuffers(const FFBSnapshotRing::View& snapshots) {
+    if (snapshots.GetDropped() > 0) {
+        for (PlotBuffer* buf : AnalysisBuffers()) buf->AddGap((int64_t)snapshots.GetDropped());
     }
-
-    auto snapshots = engine.GetDebugBatch();
-    for (const auto& snap : snapshots) {
+    snapshots.ForEach([](const FFBSnapshot& snap) {
         plot_total.Add(snap.total_output);
         plot_base.Add(snap.base_force);
         plot_sop.Add(snap.sop_force);
@@ -961,9 +1052,90 @@ void GuiLayer::DrawDebugWindow(FFBEngine& engine) {
         plot_raw_slip_angle.Add(snap.raw_front_slip_angle);
         plot_raw_rear_slip_angle.Add(snap.raw_rear_slip_angle);
         plot_raw_front_deflection.Add(snap.raw_front_deflection);
+        for (int i = 0; i < 4; i++) {
+            plot_wheel_load[i].Add(snap.wheel_load[i]);
+            plot_wheel_grip[i].Add(snap.wheel_grip[i]);
+            plot_wheel_slip_angle[i].Add(snap.wheel_slip_angle[i]);
+            plot_wheel_slip_ratio[i].Add(snap.wheel_slip_ratio[i]);
+        }
         g_warn_dt = snap.warn_dt;
+    });
+}
+
+// Hands the new snapshots to every open plot view once per ImGui frame, read in place
+// from the ring. Snapshots the GUI was too slow for (stall, minimized window) are
+// plotted as a break. So are any the writer reached while they were being plotted,
+// right after the possibly torn values (v0.7.112)
+static void PollSnapshots(FFBEngine& engine) {
+    static int polled_frame = -1;
+    if (polled_frame == ImGui::GetFrameCount()) return;
+    polled_frame = ImGui::GetFrameCount();
+
+    static FFBSnapshotRing::Reader reader(engine.GetSnapshotRing());
+    FFBSnapshotRing::View snapshots = reader.Read();
+    if (Config::show_graphs) FeedAnalysisBuffers(snapshots);
+    g_plot_panels.Feed(snapshots);
+
+    size_t torn = reader.Validate(snapshots);
+    if (torn > 0) {
+        if (Config::show_graphs) {
+            for (PlotBuffer* buf : AnalysisBuffers()) buf->AddGap((int64_t)torn);
+        }
+        g_plot_panels.AddGap((int64_t)torn);
+    }
+}
+
+void GuiLayer::DrawDebugWindow(FFBEngine& engine) {
+    if (!Config::show_graphs) return;
+
+    ImGuiViewport* viewport = ImGui::GetMainViewport();
+    ImGui::SetNextWindowPos(ImVec2(viewport->Pos.x + CONFIG_PANEL_WIDTH, viewport->Pos.y));
+    ImGui::SetNextWindowSize(ImVec2(viewport->Size.x - CONFIG_PANEL_WIDTH, viewport->Size.y));
+
+    ImGuiWindowFlags flags = ImGuiWindowFlags_NoDecoration | ImGuiWindowFlags_NoMove | ImGuiWindowFlags_NoResize;
+    ImGui::Begin("FFB Analysis", nullptr, flags);
+
+    // System Health Diagnostics (Moved from Tuning window - Issue #149)
+    if (ImGui::CollapsingHeader("System Health (Hz)", ImGuiTreeNodeFlags_DefaultOpen)) {
+        ImGui::Columns(5, "RateCols", false);
+        DisplayRate("FFB Loop", engine.m_ffb_rate, 400.0);
+        ImGui::NextColumn();
+        DisplayRate("Telemetry", engine.m_telemetry_rate, 400.0);
+        ImGui::NextColumn();
+        DisplayRate("Hardware", engine.m_hw_rate, 400.0);
+        ImGui::NextColumn();
+        DisplayRate("S.Torque", engine.m_torque_rate, 400.0);
+        ImGui::NextColumn();
+        DisplayRate("G.Torque", engine.m_gen_torque_rate, 400.0);
+        ImGui::Columns(1);
+        if ((engine.m_telemetry_rate < 380.0 || engine.m_torque_rate < 380.0) && engine.m_telemetry_rate > 1.0 && GameConnector::Get().IsConnected()) {
+            ImGui::TextColored(ImVec4(1, 1, 0, 1), "Warning: Low telemetry/torque rate. Check game FFB settings.");
+        }
+        ImGui::Separator();
+    }
+
+    // Diagnostic event counters (v0.7.112)
+    if (ImGui::CollapsingHeader("Diagnostic Events", ImGuiTreeNodeFlags_None)) {
+        ImGui::Columns(4, "DiagCols", false);
+        ImGui::TextDisabled("Event"); ImGui::NextColumn();
+        ImGui::TextDisabled("Posted"); ImGui::NextColumn();
+        ImGui::TextDisabled("Rate Limited"); ImGui::NextColumn();
+        ImGui::TextDisabled("Dropped"); ImGui::NextColumn();
+        for (int i = 0; i < (int)DiagEvent::Count; ++i) {
+            DiagEventStats st = DiagnosticEvents::Get().GetStats((DiagEvent)i);
+            if (st.posted > 0) ImGui::TextColored(ImVec4(1, 1, 0, 1), "%s", st.name);
+            else ImGui::Text("%s", st.name);
+            ImGui::NextColumn();
+            ImGui::Text("%llu", (unsigned long long)st.posted); ImGui::NextColumn();
+            ImGui::Text("%llu", (unsigned long long)st.suppressed); ImGui::NextColumn();
+            ImGui::Text("%llu", (unsigned long long)st.dropped); ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+        ImGui::Separator();
     }
 
+    PollSnapshots(engine);
+
     if (g_warn_dt) {
         ImGui::PushStyleColor(ImGuiCol_Text, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
         ImGui::Text("TELEMETRY WARNINGS: - Invalid DeltaTime");
@@ -1003,13 +1175,13 @@ void GuiLayer::DrawDebugWindow(FFBEngine& engine) {
         ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "[Loads]");
         ImGui::Text("Front: %.0f N | Rear: %.0f N", plot_calc_front_load.GetCurrent(), plot_calc_rear_load.GetCurrent());
         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 1.0f, 1.0f, 1.0f));
-        ImGui::PlotLines("##CLoadF", plot_calc_front_load.data.data(), (int)plot_calc_front_load.data.size(), plot_calc_front_load.offset, NULL, 0.0f, 10000.0f, ImVec2(0, 40));
+        PlotEnvelope("##CLoadF", plot_calc_front_load, 0.0f, 10000.0f, ImVec2(0, 40));
         ImGui::PopStyleColor();
         ImVec2 pos_load = ImGui::GetItemRectMin();
         ImGui::SetCursorScreenPos(pos_load);
         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0,0,0,0));
         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(1.0f, 0.0f, 1.0f, 1.0f));
-        ImGui::PlotLines("##CLoadR", plot_calc_rear_load.data.data(), (int)plot_calc_rear_load.data.size(), plot_calc_rear_load.offset, NULL, 0.0f, 10000.0f, ImVec2(0, 40));
+        PlotEnvelope("##CLoadR", plot_calc_rear_load, 0.0f, 10000.0f, ImVec2(0, 40));
         ImGui::PopStyleColor(2);
         ImGui::NextColumn();
         ImGui::TextColored(ImVec4(1.0f, 1.0f, 0.0f, 1.0f), "[Grip/Slip]");
@@ -1035,12 +1207,12 @@ void GuiLayer::DrawDebugWindow(FFBEngine& engine) {
         ImGui::Text("Combined Input");
         ImVec2 pos = ImGui::GetCursorScreenPos();
         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(1.0f, 0.0f, 0.0f, 1.0f));
-        ImGui::PlotLines("##BrkComb", plot_raw_brake.data.data(), (int)plot_raw_brake.data.size(), plot_raw_brake.offset, NULL, 0.0f, 1.0f, ImVec2(0, 40));
+        PlotEnvelope("##BrkComb", plot_raw_brake, 0.0f, 1.0f, ImVec2(0, 40));
         ImGui::PopStyleColor();
         ImGui::SetCursorScreenPos(pos);
         ImGui::PushStyleColor(ImGuiCol_PlotLines, ImVec4(0.0f, 1.0f, 0.0f, 1.0f));
         ImGui::PushStyleColor(ImGuiCol_FrameBg, ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
-        ImGui::PlotLines("##ThrComb", plot_raw_throttle.data.data(), (int)plot_raw_throttle.data.size(), plot_raw_throttle.offset, NULL, 0.0f, 1.0f, ImVec2(0, 40));
+        PlotEnvelope("##ThrComb", plot_raw_throttle, 0.0f, 1.0f, ImVec2(0, 40));
         ImGui::PopStyleColor(2);
         ImGui::NextColumn();
         ImGui::TextColored(ImVec4(0.0f, 1.0f, 1.0f, 1.0f), "[Vehicle State]");
@@ -1060,6 +1232,154 @@ void GuiLayer::DrawDebugWindow(FFBEngine& engine) {
         ImGui::Columns(1);
     }
 
+    if (ImGui::CollapsingHeader("D. Per-Wheel States", ImGuiTreeNodeFlags_None)) {
+        static const char* wheel_names[4] = { "FL", "FR", "RL", "RR" };
+        ImGui::Columns(4, "WheelCols", false);
+        for (int i = 0; i < 4; i++) {
+            char label[32];
+            ImGui::TextColored(ImVec4(0.0f, 1.0f, 1.0f, 1.0f), "[%s]", wheel_names[i]);
+            snprintf(label, sizeof(label), "Load %s", wheel_names[i]);
+            PlotWithStats(label, plot_wheel_load[i], 0.0f, 10000.0f);
+            snprintf(label, sizeof(label), "Grip %s", wheel_names[i]);
+            PlotWithStats(label, plot_wheel_grip[i], 0.0f, 1.2f);
+            snprintf(label, sizeof(label), "Slip Angle %s", wheel_names[i]);
+            PlotWithStats(label, plot_wheel_slip_angle[i], -0.5f, 0.5f);
+            snprintf(label, sizeof(label), "Slip Ratio %s", wheel_names[i]);
+            PlotWithStats(label, plot_wheel_slip_ratio[i], -1.0f, 1.0f);
+            ImGui::NextColumn();
+        }
+        ImGui::Columns(1);
+    }
+
+    if (ImGui::CollapsingHeader("E. Torque Spectrum", ImGuiTreeNodeFlags_None)) {
+        static std::array<float, SpectrumAnalyzer::BINS> spectrum = {};
+        double bin_hz = 0.0, dominant = 0.0;
+        {
+            std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
+            spectrum = engine.m_spectrum.GetAmplitudes();
+            bin_hz = engine.m_spectrum.GetBinHz();
+            dominant = engine.m_spectrum.GetDominantFrequency();
+        }
+        float max_amp = *std::max_element(spectrum.begin(), spectrum.end());
+        char overlay[64];
+        if (dominant > 0.0) snprintf(overlay, sizeof(overlay), "Peak: %.1f Hz", dominant);
+        else snprintf(overlay, sizeof(overlay), "No dominant peak");
+        ImGui::Text("Amplitude (Nm) 0 - %.0f Hz, %.2f Hz/bin", bin_hz * SpectrumAnalyzer::BINS, bin_hz);
+        ImGui::PlotHistogram("##Spectrum", spectrum.data(), (int)spectrum.size(), 0, overlay,
+                             0.0f, (std::max)(0.1f, max_amp * 1.1f), ImVec2(-1, 120));
+    }
+
     ImGui::End();
 }
+
+std::chrono::milliseconds GuiLayer::GetPlotRefreshInterval() {
+    if (Config::show_graphs) return RenderScheduler::ACTIVE_INTERVAL;
+    return g_plot_panels.GetRefreshInterval();
+}
+
+// Channel picker and per-panel options (v0.7.112). Returns true if the layout changed.
+static bool DrawPlotPanelMenus(PlotPanel& panel) {
+    bool changed = false;
+    if (!ImGui::BeginMenuBar()) return false;
+    if (ImGui::BeginMenu("Channels")) {
+        const char* group = nullptr;
+        bool group_open = false;
+        for (int ch = 0; ch < GetPlotChannelCount(); ++ch) {
+            const PlotChannel& info = GetPlotChannel(ch);
+            if (group == nullptr || strcmp(group, info.group) != 0) {
+                if (group_open) ImGui::EndMenu();
+                group = info.group;
+                group_open = ImGui::BeginMenu(group);
+            }
+            if (!group_open) continue;
+            bool selected = panel.HasChannel(ch);
+            if (ImGui::MenuItem(info.label, nullptr, &selected)) {
+                panel.SetChannel(ch, selected);
+                changed = true;
+            }
+        }
+        if (group_open) ImGui::EndMenu();
+        ImGui::EndMenu();
+    }
+    if (ImGui::BeginMenu("Options")) {
+        float history = panel.GetHistorySeconds();
+        ImGui::SetNextItemWidth(160.0f);
+        ImGui::SliderFloat("History", &history, PlotPanel::MIN_HISTORY_S, PlotPanel::MAX_HISTORY_S, "%.0f s");
+        if (ImGui::IsItemDeactivatedAfterEdit()) {
+            panel.SetHistorySeconds(history);
+            changed = true;
+        }
+        float refresh = panel.GetRefreshHz();
+        ImGui::SetNextItemWidth(160.0f);
+        if (ImGui::SliderFloat("Refresh", &refresh, PlotPanel::MIN_REFRESH_HZ, PlotPanel::MAX_REFRESH_HZ, "%.0f Hz")) {
+            panel.SetRefreshHz(refresh);
+            changed = true;
+        }
+        if (ImGui::Checkbox("Auto Scale", &panel.auto_scale)) changed = true;
+        ImGui::EndMenu();
+    }
+    ImGui::EndMenuBar();
+    return changed;
+}
+
+void GuiLayer::DrawPlotPanels(FFBEngine& engine) {
+    if (!g_plot_panels_loaded) {
+        g_plot_panels.Deserialize(Config::plot_panels);
+        g_plot_panels_loaded = true;
+    }
+    if (g_plot_panels.GetPanels().empty()) return;
+    PollSnapshots(engine);
+
+    bool changed = false;
+    auto now = std::chrono::steady_clock::now();
+    ImGuiViewport* viewport = ImGui::GetMainViewport();
+    for (PlotPanel& panel : g_plot_panels.GetPanels()) {
+        char title[128];
+        snprintf(title, sizeof(title), "%s###PlotPanel%d", panel.GetTitle().c_str(), panel.GetId());
+        float offset = 30.0f * (float)(panel.GetId() % 8);
+        ImGui::SetNextWindowPos(ImVec2(viewport->Pos.x + 80.0f + offset, viewport->Pos.y + 80.0f + offset), ImGuiCond_FirstUseEver);
+        ImGui::SetNextWindowSize(ImVec2(420.0f, 320.0f), ImGuiCond_FirstUseEver);
+        if (!ImGui::Begin(title, &panel.open, ImGuiWindowFlags_MenuBar)) {
+            ImGui::End();
+            continue;
+        }
+        changed |= DrawPlotPanelMenus(panel);
+
+        const auto& channels = panel.GetChannels();
+        if (channels.empty()) {
+            ImGui::TextDisabled("Pick signals from the Channels menu.");
+            ImGui::End();
+            continue;
+        }
+
+        // Split the window height between the traces, each with its label line
+        ImVec2 avail = ImGui::GetContentRegionAvail();
+        float label_h = ImGui::GetTextLineHeightWithSpacing() + ImGui::GetStyle().ItemSpacing.y;
+        float plot_h = (std::max)(30.0f, avail.y / (float)channels.size() - label_h);
+        ImVec2 size(avail.x, plot_h);
+        panel.Refresh(PlotColumns(size.x), now);
+
+        for (size_t slot = 0; slot < channels.size(); ++slot) {
+            const PlotChannel& info = GetPlotChannel(channels[slot]);
+            const PlotPanel::Trace& tr = panel.GetTrace((int)slot);
+            float lo = info.scale_min, hi = info.scale_max;
+            if (panel.auto_scale && tr.max_val >= tr.min_val) {
+                float pad = (std::max)(1e-3f, (tr.max_val - tr.min_val) * 0.05f);
+                lo = tr.min_val - pad;
+                hi = tr.max_val + pad;
+            }
+            ImGui::Text("%s", info.label);
+            ImGui::PushID((int)slot);
+            DrawEnvelope("##trace", tr.env_min.data(), tr.env_max.data(), (int)tr.env_min.size(), lo, hi, size);
+            ImGui::PopID();
+            DrawPlotStats(tr.current, tr.min_val, tr.max_val);
+        }
+        ImGui::End();
+    }
+    changed |= g_plot_panels.RemoveClosed();
+    if (changed) {
+        Config::plot_panels = g_plot_panels.Serialize();
+        Config::RequestSave(engine);
+    }
+}
 #endif
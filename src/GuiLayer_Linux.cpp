@@ -2,11 +2,13 @@
 #include "GuiPlatform.h"
 #include "Version.h"
 #include "Config.h"
+#include "RenderScheduler.h"
 #include <iostream>
 #include <vector>
 #include <algorithm>
 #include <mutex>
 #include <chrono>
+#include <thread>
 
 #if defined(ENABLE_IMGUI) && !defined(HEADLESS_GUI)
 #include "imgui.h"
@@ -20,6 +22,8 @@
 #endif
 
 static GLFWwindow* g_window = nullptr;
+static RenderScheduler g_render_scheduler;
+static uint32_t g_drawn_frame_seq = 0;
 #endif
 
 extern std::atomic<bool> g_running;
@@ -103,6 +107,18 @@ static void glfw_error_callback(int error, const char* description) {
     fprintf(stderr, "Glfw Error %d: %s\n", error, description);
 }
 
+// Input hooks for the RenderScheduler. Installed before the ImGui backend, which
+// chains to them from its own callbacks.
+static void glfw_input_cursor_pos(GLFWwindow*, double, double) { g_render_scheduler.NotifyInput(); }
+static void glfw_input_mouse_button(GLFWwindow*, int, int, int) { g_render_scheduler.NotifyInput(); }
+static void glfw_input_scroll(GLFWwindow*, double, double) { g_render_scheduler.NotifyInput(); }
+static void glfw_input_key(GLFWwindow*, int, int, int, int) { g_render_scheduler.NotifyInput(); }
+static void glfw_input_char(GLFWwindow*, unsigned int) { g_render_scheduler.NotifyInput(); }
+static void glfw_input_focus(GLFWwindow*, int) { g_render_scheduler.NotifyInput(); }
+static void glfw_input_enter(GLFWwindow*, int) { g_render_scheduler.NotifyInput(); }
+static void glfw_window_size(GLFWwindow*, int, int) { g_render_scheduler.NotifyInput(); }
+static void glfw_window_refresh(GLFWwindow*) { g_render_scheduler.NotifyInput(); }
+
 bool GuiLayer::Init() {
     glfwSetErrorCallback(glfw_error_callback);
     if (!glfwInit()) return false;
@@ -124,6 +140,16 @@ bool GuiLayer::Init() {
 
     if (Config::m_always_on_top) SetWindowAlwaysOnTopPlatform(true);
 
+    glfwSetCursorPosCallback(g_window, glfw_input_cursor_pos);
+    glfwSetMouseButtonCallback(g_window, glfw_input_mouse_button);
+    glfwSetScrollCallback(g_window, glfw_input_scroll);
+    glfwSetKeyCallback(g_window, glfw_input_key);
+    glfwSetCharCallback(g_window, glfw_input_char);
+    glfwSetWindowFocusCallback(g_window, glfw_input_focus);
+    glfwSetCursorEnterCallback(g_window, glfw_input_enter);
+    glfwSetFramebufferSizeCallback(g_window, glfw_window_size);
+    glfwSetWindowRefreshCallback(g_window, glfw_window_refresh);
+
     IMGUI_CHECKVERSION();
     ImGui::CreateContext();
     ImGuiIO& io = ImGui::GetIO(); (void)io;
@@ -161,12 +187,23 @@ bool GuiLayer::Render(FFBEngine& engine) {
 
     glfwPollEvents();
 
+    // Adaptive redraw (v0.7.112). GLFW cannot see occlusion, only iconified/hidden windows.
+    RenderScheduler::WindowState state = RenderScheduler::WindowState::Visible;
+    if (glfwGetWindowAttrib(g_window, GLFW_ICONIFIED) || !glfwGetWindowAttrib(g_window, GLFW_VISIBLE)) {
+        state = RenderScheduler::WindowState::Minimized;
+    }
+    uint32_t frame_seq = engine.GetFrameSequence();
+    auto plot_interval = GetPlotRefreshInterval();
+    if (!g_render_scheduler.ShouldDraw(state, frame_seq != g_drawn_frame_seq, plot_interval.count() > 0, plot_interval)) return true;
+    g_drawn_frame_seq = frame_seq;
+
     ImGui_ImplOpenGL3_NewFrame();
     ImGui_ImplGlfw_NewFrame();
     ImGui::NewFrame();
 
     DrawTuningWindow(engine);
     if (Config::show_graphs) DrawDebugWindow(engine);
+    DrawPlotPanels(engine);
 
     ImGui::Render();
     int display_w, display_h;
@@ -178,9 +215,22 @@ bool GuiLayer::Render(FFBEngine& engine) {
 
     glfwSwapBuffers(g_window);
 
+    // A held slider or a text cursor generates no events but still needs frames
+    const ImGuiIO& io = ImGui::GetIO();
+    if (ImGui::IsAnyItemActive() || io.WantTextInput) g_render_scheduler.NotifyInput();
     return true; // Always return true to keep the main loop running at full speed
 }
 
+void GuiLayer::WaitForEvents() {
+    auto wait = g_render_scheduler.GetWaitTime();
+    if (!g_window) {
+        std::this_thread::sleep_for(wait);
+        return;
+    }
+    // Returns on the first event; the callbacks have already flagged it as input
+    if (wait.count() > 0) glfwWaitEventsTimeout(wait.count() / 1000.0);
+}
+
 #else
 // Stub Implementation for Headless Builds (or if IMGUI disabled)
 bool GuiLayer::Init() {
@@ -191,6 +241,7 @@ void GuiLayer::Shutdown(FFBEngine& engine) {
     Config::Save(engine);
 }
 bool GuiLayer::Render(FFBEngine& engine) { return true; }
+void GuiLayer::WaitForEvents() { std::this_thread::sleep_for(RenderScheduler::PUMP_INTERVAL); }
 void* GuiLayer::GetWindowHandle() { return nullptr; }
 
 #endif
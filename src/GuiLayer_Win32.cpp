@@ -4,6 +4,7 @@
 #include "Version.h"
 #include "Logger.h"
 #include "Config.h"
+#include "RenderScheduler.h"
 #include <windows.h>
 #include <commdlg.h>
 #include <iostream>
@@ -11,6 +12,7 @@
 #include <algorithm>
 #include <mutex>
 #include <chrono>
+#include <thread>
 
 #if defined(ENABLE_IMGUI) && !defined(HEADLESS_GUI)
 #include "imgui.h"
@@ -29,6 +31,10 @@ static ID3D11DeviceContext*     g_pd3dDeviceContext = NULL;
 static IDXGISwapChain*          g_pSwapChain = NULL;
 static ID3D11RenderTargetView*  g_mainRenderTargetView = NULL;
 static HWND                     g_hwnd = NULL;
+static bool                     g_swap_chain_occluded = false;
+
+static RenderScheduler          g_render_scheduler;
+static uint32_t                 g_drawn_frame_seq = 0;
 
 static const int MIN_WINDOW_WIDTH = 400;
 static const int MIN_WINDOW_HEIGHT = 600;
@@ -211,22 +217,58 @@ bool GuiLayer::Render(FFBEngine& engine) {
         if (msg.message == WM_QUIT) { g_running = false; return false; }
     }
     if (g_running == false) return false;
+
+    // Adaptive redraw (v0.7.112): messages are always pumped above, frames only when due.
+    // A flip-model swap chain reports occlusion from Present; probe it cheaply until it clears.
+    RenderScheduler::WindowState state = RenderScheduler::WindowState::Visible;
+    if (::IsIconic(g_hwnd) || !::IsWindowVisible(g_hwnd)) {
+        state = RenderScheduler::WindowState::Minimized;
+    } else if (g_swap_chain_occluded) {
+        g_swap_chain_occluded = (g_pSwapChain->Present(0, DXGI_PRESENT_TEST) == DXGI_STATUS_OCCLUDED);
+        if (g_swap_chain_occluded) state = RenderScheduler::WindowState::Occluded;
+    }
+    uint32_t frame_seq = engine.GetFrameSequence();
+    auto plot_interval = GetPlotRefreshInterval();
+    if (!g_render_scheduler.ShouldDraw(state, frame_seq != g_drawn_frame_seq, plot_interval.count() > 0, plot_interval)) return true;
+    g_drawn_frame_seq = frame_seq;
+
     ImGui_ImplDX11_NewFrame();
     ImGui_ImplWin32_NewFrame();
     ImGui::NewFrame();
     DrawTuningWindow(engine);
     if (Config::show_graphs) DrawDebugWindow(engine);
+    DrawPlotPanels(engine);
     ImGui::Render();
     const float clear_color_with_alpha[4] = { 0.45f, 0.55f, 0.60f, 1.00f };
     g_pd3dDeviceContext->OMSetRenderTargets(1, &g_mainRenderTargetView, NULL);
     g_pd3dDeviceContext->ClearRenderTargetView(g_mainRenderTargetView, clear_color_with_alpha);
     ImGui_ImplDX11_RenderDrawData(ImGui::GetDrawData());
-    g_pSwapChain->Present(1, 0);
+    // No vsync wait: the scheduler paces frames and the flip model never tears
+    g_swap_chain_occluded = (g_pSwapChain->Present(0, 0) == DXGI_STATUS_OCCLUDED);
+
+    // A held slider or a text cursor generates no messages but still needs frames
+    const ImGuiIO& io = ImGui::GetIO();
+    if (ImGui::IsAnyItemActive() || io.WantTextInput) g_render_scheduler.NotifyInput();
     return true; // Always return true to keep the main loop running at full speed
 }
 
+void GuiLayer::WaitForEvents() {
+    // Wakes on any queued input, otherwise returns by the next pump or draw deadline
+    DWORD wait_ms = (DWORD)g_render_scheduler.GetWaitTime().count();
+    if (wait_ms > 0) ::MsgWaitForMultipleObjectsEx(0, NULL, wait_ms, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+}
+
 extern IMGUI_IMPL_API LRESULT ImGui_ImplWin32_WndProcHandler(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
 LRESULT WINAPI WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam) {
+    if ((msg >= WM_MOUSEFIRST && msg <= WM_MOUSELAST) || (msg >= WM_KEYFIRST && msg <= WM_KEYLAST)) {
+        g_render_scheduler.NotifyInput();
+    }
+    switch (msg) {
+    case WM_SIZE: case WM_ACTIVATE: case WM_SETFOCUS: case WM_KILLFOCUS:
+    case WM_PAINT: case WM_MOUSELEAVE: case WM_NCMOUSEMOVE:
+        g_render_scheduler.NotifyInput();
+        break;
+    }
     if (ImGui_ImplWin32_WndProcHandler(hWnd, msg, wParam, lParam)) return true;
     switch (msg) {
     case WM_SIZE:
@@ -356,6 +398,7 @@ void GuiLayer::Shutdown(FFBEngine& engine) {
     Config::Save(engine);
 }
 bool GuiLayer::Render(FFBEngine& engine) { return true; }
+void GuiLayer::WaitForEvents() { std::this_thread::sleep_for(RenderScheduler::PUMP_INTERVAL); }
 void* GuiLayer::GetWindowHandle() { return nullptr; }
 
 void ResizeWindowPlatform(int x, int y, int w, int h) { GetGuiPlatform().ResizeWindow(x, y, w, h); }
@@ -0,0 +1,672 @@
+#include "LogAnalyzer.h"
+#include "LogCodec.h"
+#include "LogFrame.h"
+#include <algorithm>
+#include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <thread>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr size_t OSCILLATION_WINDOW = 50;        // 0.5 s at the logged 100 Hz
+constexpr double DEFAULT_FRAME_DT = 0.01;        // When the log has no Time column
+constexpr size_t AUTO_CHUNK_BYTES = 256 * 1024;  // Smallest chunk when the thread count is automatic
+// Thresholds on logged channels are floats like the LogFrame fields, so values written
+// as exactly "0.95" compare the way pandas compares them
+constexpr float STRAIGHT_SPEED = 27.8f;          // > 100 km/h
+constexpr float STRAIGHT_SLIP = 0.02f;
+constexpr float GRIP_FLOOR = 0.21f;
+constexpr float BINARY_LOW = 0.25f;
+constexpr float BINARY_HIGH = 0.95f;
+
+// --- Column table: CSV header name -> LogFrame field ---
+
+enum class ColumnType { Double, Float, Bool };
+
+struct Column {
+    const char* name;
+    size_t offset;
+    ColumnType type;
+};
+
+#define LOG_COL(name, member, type) { name, offsetof(LogFrame, member), ColumnType::type }
+#define LOG_WHEEL(name, member, i) { name, offsetof(LogFrame, member) + (i) * sizeof(float), ColumnType::Float }
+
+const Column kColumns[] = {
+    LOG_COL("Time", timestamp, Double), LOG_COL("DeltaTime", delta_time, Double),
+    LOG_COL("Speed", speed, Float), LOG_COL("LatAccel", lat_accel, Float), LOG_COL("LongAccel", long_accel, Float),
+    LOG_COL("YawRate", yaw_rate, Float), LOG_COL("Steering", steering, Float), LOG_COL("Throttle", throttle, Float),
+    LOG_COL("Brake", brake, Float),
+    LOG_COL("SlipAngleFL", slip_angle_fl, Float), LOG_COL("SlipAngleFR", slip_angle_fr, Float),
+    LOG_COL("SlipRatioFL", slip_ratio_fl, Float), LOG_COL("SlipRatioFR", slip_ratio_fr, Float),
+    LOG_COL("GripFL", grip_fl, Float), LOG_COL("GripFR", grip_fr, Float),
+    LOG_COL("LoadFL", load_fl, Float), LOG_COL("LoadFR", load_fr, Float),
+    LOG_COL("SlipAngleRL", slip_angle_rl, Float), LOG_COL("SlipAngleRR", slip_angle_rr, Float),
+    LOG_COL("SlipRatioRL", slip_ratio_rl, Float), LOG_COL("SlipRatioRR", slip_ratio_rr, Float),
+    LOG_COL("GripRL", grip_rl, Float), LOG_COL("GripRR", grip_rr, Float),
+    LOG_COL("LoadRL", load_rl, Float), LOG_COL("LoadRR", load_rr, Float),
+    LOG_WHEEL("CalcLoadFL", calc_load, 0), LOG_WHEEL("CalcLoadFR", calc_load, 1),
+    LOG_WHEEL("CalcLoadRL", calc_load, 2), LOG_WHEEL("CalcLoadRR", calc_load, 3),
+    LOG_WHEEL("CalcGripFL", calc_grip, 0), LOG_WHEEL("CalcGripFR", calc_grip, 1),
+    LOG_WHEEL("CalcGripRL", calc_grip, 2), LOG_WHEEL("CalcGripRR", calc_grip, 3),
+    LOG_COL("CalcSlipAngle", calc_slip_angle_front, Float),
+    LOG_COL("calc_slip_angle_front", calc_slip_angle_front, Float), // Early logs
+    LOG_COL("CalcGripFront", calc_grip_front, Float), LOG_COL("CalcGripRear", calc_grip_rear, Float),
+    LOG_COL("GripDelta", grip_delta, Float),
+    LOG_COL("dG_dt", dG_dt, Float), LOG_COL("dAlpha_dt", dAlpha_dt, Float),
+    LOG_COL("SlopeCurrent", slope_current, Float), LOG_COL("SlopeRaw", slope_raw_unclamped, Float),
+    LOG_COL("SlopeNum", slope_numerator, Float), LOG_COL("SlopeDenom", slope_denominator, Float),
+    LOG_COL("HoldTimer", hold_timer, Float), LOG_COL("InputSlipSmooth", input_slip_smoothed, Float),
+    LOG_COL("SlopeSmoothed", slope_smoothed, Float), LOG_COL("Confidence", confidence, Float),
+    LOG_COL("SurfaceFL", surface_type_fl, Float), LOG_COL("SurfaceFR", surface_type_fr, Float),
+    LOG_COL("SlopeTorque", slope_torque, Float), LOG_COL("SlewLimitedG", slew_limited_g, Float),
+    LOG_COL("FFBTotal", ffb_total, Float), LOG_COL("FFBBase", ffb_base, Float),
+    LOG_COL("FFBShaftTorque", ffb_shaft_torque, Float), LOG_COL("FFBGenTorque", ffb_gen_torque, Float),
+    LOG_COL("FFBSoP", ffb_sop, Float), LOG_COL("GripFactor", ffb_grip_factor, Float),
+    LOG_COL("SpeedGate", speed_gate, Float), LOG_COL("LoadPeakRef", load_peak_ref, Float),
+    LOG_COL("Clipping", clipping, Bool), LOG_COL("Marker", marker, Bool),
+};
+
+#undef LOG_COL
+#undef LOG_WHEEL
+
+const Column* FindColumn(const std::string& name) {
+    for (const auto& c : kColumns) {
+        if (name == c.name) return &c;
+    }
+    return nullptr;
+}
+
+// --- Mergeable statistics (Welford / Chan et al.), sample variance like pandas ---
+
+struct Moments {
+    uint64_t n = 0;
+    double mean = 0.0, m2 = 0.0;
+    double min = INFINITY, max = -INFINITY;
+
+    void Add(double x) {
+        n++;
+        double d = x - mean;
+        mean += d / (double)n;
+        m2 += d * (x - mean);
+        min = (std::min)(min, x);
+        max = (std::max)(max, x);
+    }
+    void Merge(const Moments& o) {
+        if (o.n == 0) return;
+        if (n == 0) { *this = o; return; }
+        double total = (double)(n + o.n);
+        double d = o.mean - mean;
+        mean += d * (double)o.n / total;
+        m2 += o.m2 + d * d * (double)n * (double)o.n / total;
+        n += o.n;
+        min = (std::min)(min, o.min);
+        max = (std::max)(max, o.max);
+    }
+    double Variance() const { return (n > 1) ? m2 / (double)(n - 1) : NAN; }
+    double Std() const { return std::sqrt(Variance()); }
+};
+
+struct CoMoments {
+    uint64_t n = 0;
+    double mx = 0.0, my = 0.0, m2x = 0.0, m2y = 0.0, cxy = 0.0;
+
+    void Add(double x, double y) {
+        n++;
+        double dx = x - mx;
+        mx += dx / (double)n;
+        double dy = y - my;
+        my += dy / (double)n;
+        m2x += dx * (x - mx);
+        m2y += dy * (y - my);
+        cxy += dx * (y - my);
+    }
+    void Merge(const CoMoments& o) {
+        if (o.n == 0) return;
+        if (n == 0) { *this = o; return; }
+        double total = (double)(n + o.n);
+        double f = (double)n * (double)o.n / total;
+        double dx = o.mx - mx, dy = o.my - my;
+        mx += dx * (double)o.n / total;
+        my += dy * (double)o.n / total;
+        m2x += o.m2x + dx * dx * f;
+        m2y += o.m2y + dy * dy * f;
+        cxy += o.cxy + dx * dy * f;
+        n += o.n;
+    }
+    double Correlation() const {
+        double denom = std::sqrt(m2x * m2y);
+        return (n > 1 && denom > 0.0) ? cxy / denom : NAN;
+    }
+};
+
+int Sign(double x) { return (x > 0.0) - (x < 0.0); }
+
+// --- Per-chunk pass ---
+
+struct ColumnLayout {
+    std::vector<const Column*> fields;   // Per CSV field, nullptr if unknown
+    float LogFrame::* grip = nullptr;    // GripFactor, else SlopeSmoothed
+    bool has_time = false, has_slope = false, has_dalpha = false, has_dg = false;
+    bool has_slip = false, has_latg = false;
+};
+
+struct ChunkResult {
+    size_t frames = 0;
+    size_t skipped = 0;
+    Moments slope, straight_grip, dg_dt, dalpha_dt;
+    size_t active = 0, floor_hits = 0, binary = 0;
+    int singularities = 0;
+    double worst_singularity = 0.0;
+    size_t zero_crossings = 0;
+    int first_sign = 0, last_sign = 0;
+    double first_time = 0.0, last_time = 0.0, max_time = -INFINITY;
+    CoMoments grip_slip, grip_latg;
+    // Compact columns for the windowed oscillation search
+    std::vector<float> slope_col;
+    std::vector<double> time_col;
+};
+
+const char* ParseLine(const char* p, const char* end, const ColumnLayout& layout, LogFrame& frame, size_t& fields) {
+    fields = 0;
+    const char* line_end = static_cast<const char*>(memchr(p, '\n', (size_t)(end - p)));
+    if (!line_end) line_end = end;
+    const char* q = p;
+    while (q <= line_end && fields < layout.fields.size()) {
+        const char* field_end = q;
+        while (field_end < line_end && *field_end != ',') field_end++;
+        const char* value_end = field_end;
+        if (value_end > q && value_end[-1] == '\r') value_end--;
+        const Column* col = layout.fields[fields];
+        if (col && value_end > q) {
+            double v = 0.0;
+            std::from_chars(q, value_end, v);
+            char* dst = reinterpret_cast<char*>(&frame) + col->offset;
+            if (col->type == ColumnType::Double) *reinterpret_cast<double*>(dst) = v;
+            else if (col->type == ColumnType::Float) *reinterpret_cast<float*>(dst) = (float)v;
+            else *reinterpret_cast<bool*>(dst) = (v != 0.0);
+        }
+        fields++;
+        q = field_end + 1;
+    }
+    return (line_end < end) ? line_end + 1 : end;
+}
+
+void AnalyzeChunk(const char* p, const char* end, const ColumnLayout& layout, const LogAnalyzerOptions& opt,
+                  ChunkResult& r) {
+    r.slope_col.reserve((size_t)(end - p) / 300 + 1);   // ~300 bytes per row
+    if (layout.has_time) r.time_col.reserve(r.slope_col.capacity());
+
+    while (p < end) {
+        if (*p == '\n' || *p == '\r') { p++; continue; }
+        LogFrame f = {};
+        size_t fields = 0;
+        p = ParseLine(p, end, layout, f, fields);
+        if (fields < layout.fields.size()) { r.skipped++; continue; }
+
+        double slope = f.slope_current;
+        if (r.frames == 0) {
+            r.first_sign = Sign(slope);
+            r.first_time = f.timestamp;
+        } else if (Sign(slope) != r.last_sign) {
+            r.zero_crossings++;
+        }
+        r.last_sign = Sign(slope);
+        r.last_time = f.timestamp;
+        r.max_time = (std::max)(r.max_time, f.timestamp);
+        r.frames++;
+
+        r.slope.Add(slope);
+        r.slope_col.push_back(f.slope_current);
+        if (layout.has_time) r.time_col.push_back(f.timestamp);
+
+        if (layout.has_dalpha) {
+            double da = std::fabs(f.dAlpha_dt);
+            if (da > opt.active_threshold) r.active++;
+            r.dalpha_dt.Add(f.dAlpha_dt);
+            if (std::fabs(slope) > opt.singularity_slope && da < opt.singularity_alpha_rate) {
+                r.singularities++;
+                r.worst_singularity = (std::max)(r.worst_singularity, std::fabs(slope));
+            }
+        }
+        if (layout.has_dg) r.dg_dt.Add(f.dG_dt);
+
+        if (layout.grip) {
+            float grip = f.*layout.grip;
+            if (grip <= GRIP_FLOOR) r.floor_hits++;
+            if (grip <= BINARY_LOW || grip >= BINARY_HIGH) r.binary++;
+            // Without a slip column the Python gate is speed only (slip defaults to 0)
+            if (f.speed > STRAIGHT_SPEED && std::fabs(f.calc_slip_angle_front) < STRAIGHT_SLIP) r.straight_grip.Add(grip);
+            if (layout.has_slip) r.grip_slip.Add(grip, std::fabs(f.calc_slip_angle_front));
+            if (layout.has_latg) r.grip_latg.Add(grip, std::fabs(f.lat_accel));
+        }
+    }
+}
+
+void Merge(ChunkResult& a, ChunkResult& b) {
+    if (b.frames == 0) { a.skipped += b.skipped; return; }
+    if (a.frames == 0) {
+        size_t skipped = a.skipped;
+        a = std::move(b);
+        a.skipped += skipped;
+        return;
+    }
+    a.zero_crossings += b.zero_crossings + (a.last_sign != b.first_sign ? 1 : 0);
+    a.last_sign = b.last_sign;
+    a.last_time = b.last_time;
+    a.max_time = (std::max)(a.max_time, b.max_time);
+    a.frames += b.frames;
+    a.skipped += b.skipped;
+    a.slope.Merge(b.slope);
+    a.straight_grip.Merge(b.straight_grip);
+    a.dg_dt.Merge(b.dg_dt);
+    a.dalpha_dt.Merge(b.dalpha_dt);
+    a.active += b.active;
+    a.floor_hits += b.floor_hits;
+    a.binary += b.binary;
+    a.singularities += b.singularities;
+    a.worst_singularity = (std::max)(a.worst_singularity, b.worst_singularity);
+    a.grip_slip.Merge(b.grip_slip);
+    a.grip_latg.Merge(b.grip_latg);
+    a.slope_col.insert(a.slope_col.end(), b.slope_col.begin(), b.slope_col.end());
+    a.time_col.insert(a.time_col.end(), b.time_col.begin(), b.time_col.end());
+}
+
+// pandas rolling(50, center=True).std(): frame i covers [i - 25, i + 24], NaN near the edges
+std::vector<OscillationEvent> FindOscillations(const std::vector<float>& signal, const std::vector<double>& time,
+                                               const LogAnalyzerOptions& opt) {
+    std::vector<OscillationEvent> events;
+    const size_t n = signal.size();
+    const size_t w = OSCILLATION_WINDOW;
+    if (n < w) return events;
+    auto time_at = [&](size_t i) { return time.empty() ? (double)i * DEFAULT_FRAME_DT : time[i]; };
+
+    double sum = 0.0, sumsq = 0.0;
+    for (size_t i = 0; i < w; ++i) {
+        sum += signal[i];
+        sumsq += (double)signal[i] * signal[i];
+    }
+    bool in_event = false;
+    size_t start = 0;
+    auto close_event = [&](size_t end_exclusive) {
+        size_t last = end_exclusive - 1;
+        double duration = time_at(last) - time_at(start);
+        if (duration < opt.oscillation_min_duration) return;
+        OscillationEvent ev;
+        ev.start_time = time_at(start);
+        ev.end_time = time_at(last);
+        ev.duration = duration;
+        for (size_t k = start; k < end_exclusive; ++k) ev.amplitude = (std::max)(ev.amplitude, (double)std::fabs(signal[k]));
+        ev.frame_start = start;
+        ev.frame_end = last;
+        events.push_back(ev);
+    };
+
+    // Window starting at s is centered on frame s + w/2
+    for (size_t s = 0; s + w <= n; ++s) {
+        if (s > 0) {
+            double out = signal[s - 1], in = signal[s + w - 1];
+            sum += in - out;
+            sumsq += in * in - out * out;
+        }
+        double var = (sumsq - sum * sum / (double)w) / (double)(w - 1);
+        bool above = std::sqrt((std::max)(0.0, var)) > opt.oscillation_threshold;
+        size_t i = s + w / 2;
+        if (above && !in_event) { in_event = true; start = i; }
+        else if (!above && in_event) { in_event = false; close_event(i); }
+    }
+    if (in_event) close_event(n - w + w / 2 + 1);
+    return events;
+}
+
+// --- Header ---
+
+std::string Trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return "";
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+float ToFloat(const std::string& s, float def) {
+    try { return std::stof(s); } catch (...) { return def; }
+}
+
+void ParseHeaderLine(std::string line, LogSessionMeta& meta) {
+    line = Trim(line.substr(1));
+    size_t colon = line.find(':');
+    if (colon == std::string::npos) return;
+    std::string key = Trim(line.substr(0, colon));
+    std::string value = Trim(line.substr(colon + 1));
+    std::transform(key.begin(), key.end(), key.begin(), [](unsigned char c) { return (char)(c == ' ' ? '_' : std::tolower(c)); });
+
+    if (key == "lmuffb_telemetry_log") meta.log_version = value;
+    else if (key == "date") meta.date = value;
+    else if (key == "app_version") meta.app_version = value;
+    else if (key == "driver") meta.driver_name = value;
+    else if (key == "vehicle") meta.vehicle_name = value;
+    else if (key == "track") meta.track_name = value;
+    else if (key == "gain") meta.gain = ToFloat(value, meta.gain);
+    else if (key == "understeer_effect") meta.understeer_effect = ToFloat(value, meta.understeer_effect);
+    else if (key == "sop_effect") meta.sop_effect = ToFloat(value, meta.sop_effect);
+    else if (key == "slope_detection") meta.slope_enabled = (value == "Enabled" || value == "enabled");
+    else if (key == "slope_sensitivity") meta.slope_sensitivity = ToFloat(value, meta.slope_sensitivity);
+    else if (key == "slope_threshold") meta.slope_threshold = ToFloat(value, meta.slope_threshold);
+}
+
+// --- Memory mapping ---
+
+class MappedFile {
+public:
+    ~MappedFile() { Close(); }
+
+    bool Open(const std::string& path, std::string* error) {
+#ifdef _WIN32
+        m_file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_WRITE, nullptr, OPEN_EXISTING,
+                             FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+        if (m_file == INVALID_HANDLE_VALUE) return Fail(error, "Cannot open " + path);
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(m_file, &size)) return Fail(error, "Cannot stat " + path);
+        m_size = (size_t)size.QuadPart;
+        if (m_size == 0) return true;
+        m_mapping = CreateFileMappingA(m_file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!m_mapping) return Fail(error, "Cannot map " + path);
+        m_data = static_cast<const char*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!m_data) return Fail(error, "Cannot map " + path);
+#else
+        m_fd = open(path.c_str(), O_RDONLY);
+        if (m_fd < 0) return Fail(error, "Cannot open " + path);
+        struct stat st;
+        if (fstat(m_fd, &st) != 0) return Fail(error, "Cannot stat " + path);
+        m_size = (size_t)st.st_size;
+        if (m_size == 0) return true;
+        void* p = mmap(nullptr, m_size, PROT_READ, MAP_PRIVATE, m_fd, 0);
+        if (p == MAP_FAILED) return Fail(error, "Cannot map " + path);
+        madvise(p, m_size, MADV_SEQUENTIAL);
+        m_data = static_cast<const char*>(p);
+#endif
+        return true;
+    }
+
+    const char* Data() const { return m_data; }
+    size_t Size() const { return m_data ? m_size : 0; }
+
+private:
+    bool Fail(std::string* error, const std::string& msg) {
+        if (error) *error = msg;
+        Close();
+        return false;
+    }
+
+    void Close() {
+#ifdef _WIN32
+        if (m_data) UnmapViewOfFile(m_data);
+        if (m_mapping) CloseHandle(m_mapping);
+        if (m_file != INVALID_HANDLE_VALUE) CloseHandle(m_file);
+        m_mapping = nullptr;
+        m_file = INVALID_HANDLE_VALUE;
+#else
+        if (m_data) munmap(const_cast<char*>(m_data), m_size);
+        if (m_fd >= 0) close(m_fd);
+        m_fd = -1;
+#endif
+        m_data = nullptr;
+    }
+
+#ifdef _WIN32
+    HANDLE m_file = INVALID_HANDLE_VALUE;
+    HANDLE m_mapping = nullptr;
+#else
+    int m_fd = -1;
+#endif
+    const char* m_data = nullptr;
+    size_t m_size = 0;
+};
+
+void AddIssue(SlopeStabilityResult& r, const char* fmt, double value) {
+    char buf[160];
+    snprintf(buf, sizeof(buf), fmt, value);
+    r.issues.push_back(buf);
+}
+
+} // namespace
+
+namespace LogAnalyzer {
+
+bool AnalyzeBuffer(const char* data, size_t size, LogAnalysis& out, const LogAnalyzerOptions& opt, std::string* error) {
+    out = LogAnalysis();
+    const char* p = data;
+    const char* end = data + size;
+
+    // Header comments, then the column names
+    std::string header;
+    while (p < end) {
+        const char* eol = static_cast<const char*>(memchr(p, '\n', (size_t)(end - p)));
+        if (!eol) eol = end;
+        std::string line(p, eol);
+        p = (eol < end) ? eol + 1 : end;
+        if (Trim(line).empty()) continue;
+        if (line[0] == '#') { ParseHeaderLine(line, out.meta); continue; }
+        header = Trim(line);
+        break;
+    }
+
+    ColumnLayout layout;
+    size_t pos = 0;
+    while (pos <= header.size() && !header.empty()) {
+        size_t comma = header.find(',', pos);
+        std::string name = Trim(header.substr(pos, comma == std::string::npos ? std::string::npos : comma - pos));
+        const Column* col = FindColumn(name);
+        layout.fields.push_back(col);
+        if (name == "Time") layout.has_time = true;
+        else if (name == "SlopeCurrent") layout.has_slope = true;
+        else if (name == "dAlpha_dt") layout.has_dalpha = true;
+        else if (name == "dG_dt") layout.has_dg = true;
+        else if (name == "LatAccel") layout.has_latg = true;
+        else if (name == "CalcSlipAngle" || name == "calc_slip_angle_front") layout.has_slip = true;
+        else if (name == "GripFactor") layout.grip = &LogFrame::ffb_grip_factor;
+        else if (name == "SlopeSmoothed" && !layout.grip) layout.grip = &LogFrame::slope_smoothed;
+        if (comma == std::string::npos) break;
+        pos = comma + 1;
+    }
+    if (!layout.has_slope) {
+        if (error) *error = "Missing column: SlopeCurrent";
+        return false;
+    }
+
+    // One chunk per thread, split at line boundaries
+    unsigned int threads = opt.threads;
+    size_t body = (size_t)(end - p);
+    if (threads == 0) {
+        threads = (std::max)(1u, std::thread::hardware_concurrency());
+        threads = (unsigned int)(std::min)((size_t)threads, body / AUTO_CHUNK_BYTES + 1);
+    }
+    std::vector<const char*> bounds = { p };
+    for (unsigned int t = 1; t < threads; ++t) {
+        const char* cut = p + body * t / threads;
+        cut = (std::max)(cut, bounds.back());
+        const char* eol = static_cast<const char*>(memchr(cut, '\n', (size_t)(end - cut)));
+        bounds.push_back(eol ? eol + 1 : end);
+    }
+    bounds.push_back(end);
+
+    std::vector<ChunkResult> chunks(threads);
+    std::vector<std::thread> workers;
+    for (unsigned int t = 1; t < threads; ++t) {
+        workers.emplace_back(AnalyzeChunk, bounds[t], bounds[t + 1], std::cref(layout), std::cref(opt), std::ref(chunks[t]));
+    }
+    AnalyzeChunk(bounds[0], bounds[1], layout, opt, chunks[0]);
+    for (auto& w : workers) w.join();
+    for (unsigned int t = 1; t < threads; ++t) Merge(chunks[0], chunks[t]);
+    ChunkResult& r = chunks[0];
+
+    out.threads_used = threads;
+    out.frames = r.frames;
+    out.skipped_lines = r.skipped;
+    out.duration_s = (r.frames > 0 && layout.has_time) ? r.max_time : 0.0;
+
+    // --- Slope stability (analyze_slope_stability) ---
+    SlopeStabilityResult& s = out.slope;
+    double n = (double)r.frames;
+    s.slope_mean = r.frames ? r.slope.mean : NAN;
+    s.slope_std = r.slope.Std();
+    s.slope_variance = r.slope.Variance();
+    s.slope_min = r.frames ? r.slope.min : NAN;
+    s.slope_max = r.frames ? r.slope.max : NAN;
+    if (r.frames > 0) {
+        if (layout.has_dalpha) s.active_percentage = (double)r.active / n * 100.0;
+        if (layout.grip) {
+            s.floor_percentage = (double)r.floor_hits / n * 100.0;
+            s.binary_residence = (double)r.binary / n * 100.0;
+            if (r.straight_grip.n > 0) {
+                s.grip_on_straights_mean = r.straight_grip.mean;
+                s.grip_on_straights_std = r.straight_grip.Std();
+            }
+        }
+        double duration = layout.has_time ? (r.last_time - r.first_time) : n * DEFAULT_FRAME_DT;
+        s.zero_crossing_rate = (duration > 0.0) ? (double)r.zero_crossings / duration : 0.0;
+        if (layout.has_dg && layout.has_dalpha) {
+            double std_alpha = r.dalpha_dt.Std();
+            s.derivative_energy_ratio = (std_alpha > 0.0) ? r.dg_dt.Std() / std_alpha : 0.0;
+        }
+    }
+
+    if (s.slope_std > 5.0) AddIssue(s, "HIGH SLOPE VARIANCE (%.2f) - Algorithm may be unstable", s.slope_std);
+    if (s.floor_percentage && *s.floor_percentage > 5.0)
+        AddIssue(s, "FREQUENT FLOOR HITS (%.1f%%) - Algorithm too aggressive", *s.floor_percentage);
+    if (s.active_percentage && *s.active_percentage < 30.0)
+        AddIssue(s, "LOW ACTIVE PERCENTAGE (%.1f%%) - Slope rarely calculated", *s.active_percentage);
+    if (s.grip_on_straights_mean && *s.grip_on_straights_mean < 0.9)
+        AddIssue(s, "LOW GRIP ON STRAIGHTS (%.2f) - Slope stuck at negative", *s.grip_on_straights_mean);
+    if (s.zero_crossing_rate && *s.zero_crossing_rate > 5.0)
+        AddIssue(s, "HIGH SIGNAL NOISE (%.1f Hz) - Slope signal is jittery", *s.zero_crossing_rate);
+
+    // --- Oscillations, singularities, grip correlation ---
+    out.oscillations = FindOscillations(r.slope_col, r.time_col, opt);
+    if (layout.has_dalpha) {
+        out.singularity_count = r.singularities;
+        out.worst_singularity = r.worst_singularity;
+    }
+    if (layout.grip) {
+        if (layout.has_slip) out.grip.grip_vs_slip = -r.grip_slip.Correlation();
+        if (layout.has_latg) out.grip.grip_vs_latg = r.grip_latg.Correlation();
+    }
+    return true;
+}
+
+bool AnalyzeFile(const std::string& path, LogAnalysis& out, const LogAnalyzerOptions& options, std::string* error) {
+    MappedFile file;
+    if (!file.Open(path, error)) return false;
+    if (file.Size() == 0) {
+        if (error) *error = "Empty log " + path;
+        return false;
+    }
+    if (LogCodec::IsCompressed(file.Data(), file.Size())) {
+        std::string csv;
+        if (!LogCodec::DecodeToCsv(file.Data(), file.Size(), csv, error)) return false;
+        return AnalyzeBuffer(csv.data(), csv.size(), out, options, error);
+    }
+    return AnalyzeBuffer(file.Data(), file.Size(), out, options, error);
+}
+
+std::string FormatTextReport(const LogAnalysis& a) {
+    std::string out;
+    char buf[256];
+    auto line = [&](const char* fmt, auto... args) {
+        snprintf(buf, sizeof(buf), fmt, args...);
+        out += buf;
+        out += '\n';
+    };
+    auto text = [&](const std::string& s) { out += s; out += '\n'; };
+    const std::string rule(60, '=');
+    const std::string sub(20, '-');
+
+    std::string date = a.meta.date;
+    if (date.empty()) {
+        std::time_t now = std::time(nullptr);
+        std::tm tm_now;
+#ifdef _WIN32
+        localtime_s(&tm_now, &now);
+#else
+        localtime_r(&now, &tm_now);
+#endif
+        char date_buf[32];
+        std::strftime(date_buf, sizeof(date_buf), "%Y-%m-%d %H:%M:%S", &tm_now);
+        date = date_buf;
+    }
+
+    text(rule);
+    text(std::string(15, ' ') + "LMUFFB DIAGNOSTIC REPORT");
+    text(rule);
+    text("");
+
+    text("SESSION INFORMATION");
+    text(sub);
+    text("Driver:       " + a.meta.driver_name);
+    text("Vehicle:      " + a.meta.vehicle_name);
+    text("Track:        " + a.meta.track_name);
+    text("Date:         " + date);
+    text("App Version:  " + a.meta.app_version);
+    text("");
+
+    text("SETTINGS");
+    text(sub);
+    line("Gain:               %.2f", a.meta.gain);
+    line("Understeer Effect:  %.2f", a.meta.understeer_effect);
+    line("SOP Effect:          %.2f", a.meta.sop_effect);
+    text(std::string("Slope Detection:    ") + (a.meta.slope_enabled ? "Enabled" : "Disabled"));
+    line("Slope Sensitivity:  %.2f", a.meta.slope_sensitivity);
+    line("Slope Threshold:    %.2f", a.meta.slope_threshold);
+    text("");
+
+    const SlopeStabilityResult& s = a.slope;
+    text("SLOPE ANALYSIS");
+    text(sub);
+    line("Slope Mean:       %.2f", s.slope_mean);
+    line("Slope Std Dev:    %.2f", s.slope_std);
+    line("Slope Range:      %.1f to %.1f", s.slope_min, s.slope_max);
+    if (s.active_percentage) line("Active Time:      %.1f%%", *s.active_percentage);
+    if (s.floor_percentage) line("Floor Hits:       %.1f%%", *s.floor_percentage);
+    line("Oscillations:      %d events detected", (int)a.oscillations.size());
+    line("Singularities:     %d events detected (Worst: %.1f)", a.singularity_count, a.worst_singularity);
+    text("");
+
+    text("SIGNAL QUALITY & STABILITY");
+    text(sub);
+    if (s.zero_crossing_rate) line("Zero-Crossing Rate: %.2f Hz", *s.zero_crossing_rate);
+    if (s.binary_residence) line("Binary Residence:   %.1f%%", *s.binary_residence);
+    if (s.derivative_energy_ratio) line("D-Energy Ratio:     %.2f", *s.derivative_energy_ratio);
+    text("");
+
+    if (!s.issues.empty()) {
+        text("ISSUES DETECTED");
+        text(sub);
+        for (const auto& issue : s.issues) text("  [!] " + issue);
+        text("");
+    } else {
+        text("No significant issues detected in slope analysis.");
+        text("");
+    }
+
+    out += rule; // No trailing newline, like "\n".join()
+    return out;
+}
+
+} // namespace LogAnalyzer
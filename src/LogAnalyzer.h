@@ -0,0 +1,106 @@
+#ifndef LOGANALYZER_H
+#define LOGANALYZER_H
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Native counterpart of tools/lmuffb_log_analyzer (v0.7.112).
+ *
+ * Reads an AsyncLogger CSV in one pass straight from a memory mapping: the data
+ * region is split into one chunk per thread at line boundaries, each worker parses
+ * its rows into LogFrame (columns matched by header name) and keeps only mergeable
+ * statistics plus the two compact columns the windowed oscillation search needs.
+ * Chunks are merged in file order, so the results do not depend on the thread count.
+ *
+ * The metrics follow analyzers/slope_analyzer.py (pandas semantics: sample std,
+ * centered 50-frame rolling window) and FormatTextReport reproduces reports.py.
+ */
+
+struct LogAnalyzerOptions {
+    unsigned int threads = 0;              // 0 = all cores (small files use fewer)
+    float active_threshold = 0.02f;        // |dAlpha_dt| above which the slope is "active"
+    float oscillation_threshold = 5.0f;    // Rolling std of SlopeCurrent
+    float oscillation_min_duration = 0.1f; // s
+    float singularity_slope = 10.0f;
+    float singularity_alpha_rate = 0.05f;
+};
+
+struct LogSessionMeta {
+    std::string log_version = "unknown";
+    std::string date;                      // Empty if the header has none
+    std::string app_version = "unknown";
+    std::string driver_name = "Unknown";
+    std::string vehicle_name = "Unknown";
+    std::string track_name = "Unknown";
+    float gain = 1.0f;
+    float understeer_effect = 1.0f;
+    float sop_effect = 1.0f;
+    bool slope_enabled = false;
+    float slope_sensitivity = 0.5f;
+    float slope_threshold = -0.3f;
+};
+
+struct OscillationEvent {
+    double start_time = 0.0;
+    double end_time = 0.0;
+    double duration = 0.0;
+    double amplitude = 0.0;
+    size_t frame_start = 0;
+    size_t frame_end = 0;                  // Inclusive
+};
+
+struct SlopeStabilityResult {
+    double slope_mean = 0.0;
+    double slope_std = 0.0;
+    double slope_min = 0.0;
+    double slope_max = 0.0;
+    double slope_variance = 0.0;
+    // Unset when the log lacks the columns the metric needs
+    std::optional<double> active_percentage;
+    std::optional<double> floor_percentage;
+    std::optional<double> grip_on_straights_mean;
+    std::optional<double> grip_on_straights_std;
+    std::optional<double> zero_crossing_rate;
+    std::optional<double> binary_residence;
+    std::optional<double> derivative_energy_ratio;
+    std::vector<std::string> issues;
+};
+
+struct GripCorrelationResult {
+    std::optional<double> grip_vs_slip;
+    std::optional<double> grip_vs_latg;
+};
+
+struct LogAnalysis {
+    LogSessionMeta meta;
+    size_t frames = 0;
+    size_t skipped_lines = 0;              // Rows with fewer fields than the header
+    double duration_s = 0.0;               // Largest Time value
+    SlopeStabilityResult slope;
+    std::vector<OscillationEvent> oscillations;
+    int singularity_count = 0;
+    double worst_singularity = 0.0;
+    GripCorrelationResult grip;
+    unsigned int threads_used = 0;
+};
+
+namespace LogAnalyzer {
+
+    // Maps the file and analyzes it (compressed .lmz logs are decoded first). Returns
+    // false (and fills error) if it cannot be read or has no SlopeCurrent column.
+    bool AnalyzeFile(const std::string& path, LogAnalysis& out, const LogAnalyzerOptions& options = {},
+                     std::string* error = nullptr);
+
+    // Same on a log already in memory (tests, compressed inputs).
+    bool AnalyzeBuffer(const char* data, size_t size, LogAnalysis& out, const LogAnalyzerOptions& options = {},
+                       std::string* error = nullptr);
+
+    // Text report in the layout of the Python analyzer's `report` command.
+    std::string FormatTextReport(const LogAnalysis& analysis);
+
+} // namespace LogAnalyzer
+
+#endif // LOGANALYZER_H
@@ -0,0 +1,323 @@
+#include "LogCodec.h"
+#include "AsyncLogger.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstring>
+#include <sstream>
+
+namespace {
+
+const char FILE_MAGIC[4] = { 'L', 'M', 'Z', '1' };
+const char BLOCK_MAGIC[4] = { 'L', 'M', 'B', '1' };
+constexpr size_t BLOCK_HEADER_BYTES = 12;        // Magic, frame count, payload size
+constexpr uint32_t MAX_BLOCK_FRAMES = 1u << 20;  // Sanity bound when decoding
+
+// --- Columns in CSV order: every one is stored as an integer on the CSV's grid ---
+
+enum class ColumnType { Double, Float, Bool };
+
+struct Column {
+    size_t offset;
+    ColumnType type;
+};
+
+#define CODEC_COL(member, type) { offsetof(LogFrame, member), ColumnType::type }
+#define CODEC_WHEEL(member, i) { offsetof(LogFrame, member) + (i) * sizeof(float), ColumnType::Float }
+
+const Column kColumns[] = {
+    CODEC_COL(timestamp, Double), CODEC_COL(delta_time, Double),
+    CODEC_COL(speed, Float), CODEC_COL(lat_accel, Float), CODEC_COL(long_accel, Float), CODEC_COL(yaw_rate, Float),
+    CODEC_COL(steering, Float), CODEC_COL(throttle, Float), CODEC_COL(brake, Float),
+    CODEC_COL(slip_angle_fl, Float), CODEC_COL(slip_angle_fr, Float),
+    CODEC_COL(slip_ratio_fl, Float), CODEC_COL(slip_ratio_fr, Float),
+    CODEC_COL(grip_fl, Float), CODEC_COL(grip_fr, Float),
+    CODEC_COL(load_fl, Float), CODEC_COL(load_fr, Float),
+    CODEC_COL(slip_angle_rl, Float), CODEC_COL(slip_angle_rr, Float),
+    CODEC_COL(slip_ratio_rl, Float), CODEC_COL(slip_ratio_rr, Float),
+    CODEC_COL(grip_rl, Float), CODEC_COL(grip_rr, Float),
+    CODEC_COL(load_rl, Float), CODEC_COL(load_rr, Float),
+    CODEC_WHEEL(calc_load, 0), CODEC_WHEEL(calc_load, 1), CODEC_WHEEL(calc_load, 2), CODEC_WHEEL(calc_load, 3),
+    CODEC_WHEEL(calc_grip, 0), CODEC_WHEEL(calc_grip, 1), CODEC_WHEEL(calc_grip, 2), CODEC_WHEEL(calc_grip, 3),
+    CODEC_COL(calc_slip_angle_front, Float), CODEC_COL(calc_grip_front, Float),
+    CODEC_COL(calc_grip_rear, Float), CODEC_COL(grip_delta, Float),
+    CODEC_COL(dG_dt, Float), CODEC_COL(dAlpha_dt, Float), CODEC_COL(slope_current, Float),
+    CODEC_COL(slope_raw_unclamped, Float), CODEC_COL(slope_numerator, Float), CODEC_COL(slope_denominator, Float),
+    CODEC_COL(hold_timer, Float), CODEC_COL(input_slip_smoothed, Float),
+    CODEC_COL(slope_smoothed, Float), CODEC_COL(confidence, Float),
+    CODEC_COL(surface_type_fl, Float), CODEC_COL(surface_type_fr, Float),
+    CODEC_COL(slope_torque, Float), CODEC_COL(slew_limited_g, Float),
+    CODEC_COL(ffb_total, Float), CODEC_COL(ffb_base, Float), CODEC_COL(ffb_shaft_torque, Float),
+    CODEC_COL(ffb_gen_torque, Float), CODEC_COL(ffb_sop, Float),
+    CODEC_COL(ffb_grip_factor, Float), CODEC_COL(speed_gate, Float), CODEC_COL(load_peak_ref, Float),
+    CODEC_COL(clipping, Bool), CODEC_COL(marker, Bool),
+};
+constexpr size_t COLUMN_COUNT = sizeof(kColumns) / sizeof(kColumns[0]);
+
+#undef CODEC_COL
+#undef CODEC_WHEEL
+
+constexpr double SCALE = 10000.0;                 // The CSV's 4 decimals
+constexpr int64_t NON_FINITE = INT64_MIN;         // NaN/inf (written back as nan)
+
+int64_t Quantize(const LogFrame& f, const Column& c) {
+    const char* p = reinterpret_cast<const char*>(&f) + c.offset;
+    double v;
+    switch (c.type) {
+        case ColumnType::Double: v = *reinterpret_cast<const double*>(p); break;
+        case ColumnType::Float: v = *reinterpret_cast<const float*>(p); break;
+        default: return *reinterpret_cast<const bool*>(p) ? 1 : 0;
+    }
+    double s = v * SCALE;
+    if (!(std::fabs(s) < 4.0e18)) return NON_FINITE;
+    return std::llround(s);
+}
+
+void Dequantize(LogFrame& f, const Column& c, int64_t q) {
+    char* p = reinterpret_cast<char*>(&f) + c.offset;
+    double v = (q == NON_FINITE) ? NAN : (double)q / SCALE;
+    switch (c.type) {
+        case ColumnType::Double: *reinterpret_cast<double*>(p) = v; break;
+        case ColumnType::Float: *reinterpret_cast<float*>(p) = (float)v; break;
+        default: *reinterpret_cast<bool*>(p) = (q != 0); break;
+    }
+}
+
+// --- Adaptive binary range coder (LZMA style: 11-bit probabilities, carry via cache) ---
+
+constexpr int PROB_BITS = 11;
+constexpr uint16_t PROB_INIT = 1 << (PROB_BITS - 1);
+constexpr int MOVE_BITS = 5;
+constexpr uint32_t RANGE_TOP = 1u << 24;
+
+class RangeEncoder {
+public:
+    explicit RangeEncoder(std::string& out) : m_out(out) {}
+
+    void Bit(uint16_t& p, int bit) {
+        uint32_t bound = (m_range >> PROB_BITS) * p;
+        if (bit == 0) {
+            m_range = bound;
+            p += ((1 << PROB_BITS) - p) >> MOVE_BITS;
+        } else {
+            m_low += bound;
+            m_range -= bound;
+            p -= p >> MOVE_BITS;
+        }
+        while (m_range < RANGE_TOP) {
+            m_range <<= 8;
+            ShiftLow();
+        }
+    }
+
+    void Flush() {
+        for (int i = 0; i < 5; ++i) ShiftLow();
+    }
+
+private:
+    void ShiftLow() {
+        if ((uint32_t)m_low < 0xFF000000u || (m_low >> 32) != 0) {
+            uint8_t carry = (uint8_t)(m_low >> 32);
+            uint8_t byte = m_cache;
+            do {
+                m_out.push_back((char)(uint8_t)(byte + carry));
+                byte = 0xFF;
+            } while (--m_cache_size != 0);
+            m_cache = (uint8_t)((uint32_t)m_low >> 24);
+        }
+        m_cache_size++;
+        m_low = (m_low & 0x00FFFFFFu) << 8;
+    }
+
+    std::string& m_out;
+    uint64_t m_low = 0;
+    uint32_t m_range = 0xFFFFFFFFu;
+    uint8_t m_cache = 0;
+    uint64_t m_cache_size = 1;
+};
+
+class RangeDecoder {
+public:
+    RangeDecoder(const uint8_t* data, size_t size) : m_data(data), m_end(data + size) {
+        for (int i = 0; i < 5; ++i) m_code = (m_code << 8) | Next();
+    }
+
+    int Bit(uint16_t& p) {
+        uint32_t bound = (m_range >> PROB_BITS) * p;
+        int bit;
+        if (m_code < bound) {
+            m_range = bound;
+            p += ((1 << PROB_BITS) - p) >> MOVE_BITS;
+            bit = 0;
+        } else {
+            m_code -= bound;
+            m_range -= bound;
+            p -= p >> MOVE_BITS;
+            bit = 1;
+        }
+        while (m_range < RANGE_TOP) {
+            m_range <<= 8;
+            m_code = (m_code << 8) | Next();
+        }
+        return bit;
+    }
+
+private:
+    uint32_t Next() { return (m_data < m_end) ? *m_data++ : 0; }
+
+    const uint8_t* m_data;
+    const uint8_t* m_end;
+    uint32_t m_code = 0;
+    uint32_t m_range = 0xFFFFFFFFu;
+};
+
+// --- Per-column value model: bit length (given the previous one), then mantissa bits ---
+
+constexpr int LENGTH_CONTEXTS = 65;               // Previous bit length 0..64
+constexpr int LENGTH_TREE = 128;                  // 7-bit tree for lengths 0..64
+constexpr int MANTISSA_OFFSET = LENGTH_CONTEXTS * LENGTH_TREE;
+constexpr int MODEL_SIZE = MANTISSA_OFFSET + 65 * 64;
+
+int BitLength(uint64_t z) {
+    int n = 0;
+    while (z) { ++n; z >>= 1; }
+    return n;
+}
+
+void EncodeValue(RangeEncoder& rc, uint16_t* model, int& prev_length, uint64_t z) {
+    int n = BitLength(z);
+    uint16_t* tree = model + prev_length * LENGTH_TREE;
+    int m = 1;
+    for (int i = 6; i >= 0; --i) {
+        int bit = (n >> i) & 1;
+        rc.Bit(tree[m], bit);
+        m = (m << 1) | bit;
+    }
+    uint16_t* mantissa = model + MANTISSA_OFFSET + n * 64;
+    for (int i = n - 2; i >= 0; --i) rc.Bit(mantissa[i], (int)((z >> i) & 1));
+    prev_length = n;
+}
+
+uint64_t DecodeValue(RangeDecoder& rc, uint16_t* model, int& prev_length) {
+    uint16_t* tree = model + prev_length * LENGTH_TREE;
+    int m = 1;
+    for (int i = 0; i < 7; ++i) m = (m << 1) | rc.Bit(tree[m]);
+    int n = (std::min)(m - LENGTH_TREE, 64);
+    uint64_t z = (n > 0) ? 1 : 0;
+    uint16_t* mantissa = model + MANTISSA_OFFSET + n * 64;
+    for (int i = n - 2; i >= 0; --i) z = (z << 1) | (uint64_t)rc.Bit(mantissa[i]);
+    prev_length = n;
+    return z;
+}
+
+void PutU32(std::string& out, uint32_t v) {
+    for (int i = 0; i < 4; ++i) out.push_back((char)(uint8_t)(v >> (8 * i)));
+}
+
+uint32_t GetU32(const char* p) {
+    uint32_t v = 0;
+    for (int i = 0; i < 4; ++i) v |= (uint32_t)(uint8_t)p[i] << (8 * i);
+    return v;
+}
+
+} // namespace
+
+namespace LogCodec {
+
+void AppendFileHeader(std::string& out, const std::string& header_text) {
+    out.append(FILE_MAGIC, sizeof(FILE_MAGIC));
+    PutU32(out, (uint32_t)header_text.size());
+    out += header_text;
+}
+
+bool IsCompressed(const char* data, size_t size) {
+    return size >= sizeof(FILE_MAGIC) && std::memcmp(data, FILE_MAGIC, sizeof(FILE_MAGIC)) == 0;
+}
+
+size_t ReadFileHeader(const char* data, size_t size, std::string& header_text) {
+    if (!IsCompressed(data, size) || size < 8) return 0;
+    uint32_t length = GetU32(data + 4);
+    if (size - 8 < length) return 0;
+    header_text.assign(data + 8, length);
+    return 8 + (size_t)length;
+}
+
+BlockEncoder::BlockEncoder() : m_model(MODEL_SIZE) {}
+
+void BlockEncoder::Encode(std::string& out) {
+    if (m_frames.empty()) return;
+
+    // Blocks are independent and so are columns: fresh model, deltas restart from zero
+    m_payload.clear();
+    RangeEncoder rc(m_payload);
+    for (size_t c = 0; c < COLUMN_COUNT; ++c) {
+        std::fill(m_model.begin(), m_model.end(), PROB_INIT);
+        uint16_t* model = m_model.data();
+        int prev_length = 0;
+        uint64_t prev = 0;
+        for (const LogFrame& frame : m_frames) {
+            uint64_t q = (uint64_t)Quantize(frame, kColumns[c]);
+            uint64_t delta = q - prev;    // Wrapping arithmetic, exact on decode
+            prev = q;
+            EncodeValue(rc, model, prev_length, (delta << 1) ^ (uint64_t)((int64_t)delta >> 63));
+        }
+    }
+    rc.Flush();
+
+    out.append(BLOCK_MAGIC, sizeof(BLOCK_MAGIC));
+    PutU32(out, (uint32_t)m_frames.size());
+    PutU32(out, (uint32_t)m_payload.size());
+    out += m_payload;
+    m_frames.clear();
+}
+
+size_t DecodeBlock(const char* data, size_t size, std::vector<LogFrame>& frames) {
+    if (size < BLOCK_HEADER_BYTES || std::memcmp(data, BLOCK_MAGIC, sizeof(BLOCK_MAGIC)) != 0) return 0;
+    uint32_t count = GetU32(data + 4);
+    uint32_t payload = GetU32(data + 8);
+    if (count == 0 || count > MAX_BLOCK_FRAMES || size - BLOCK_HEADER_BYTES < payload) return 0;
+
+    size_t first = frames.size();
+    frames.resize(first + count, LogFrame{});
+    std::vector<uint16_t> model(MODEL_SIZE);
+    RangeDecoder rc(reinterpret_cast<const uint8_t*>(data + BLOCK_HEADER_BYTES), payload);
+    for (size_t c = 0; c < COLUMN_COUNT; ++c) {
+        std::fill(model.begin(), model.end(), PROB_INIT);
+        int prev_length = 0;
+        uint64_t prev = 0;
+        for (uint32_t i = 0; i < count; ++i) {
+            uint64_t z = DecodeValue(rc, model.data(), prev_length);
+            prev += (z >> 1) ^ (0 - (z & 1));
+            Dequantize(frames[first + i], kColumns[c], (int64_t)prev);
+        }
+    }
+    return BLOCK_HEADER_BYTES + payload;
+}
+
+bool DecodeToCsv(const char* data, size_t size, std::string& csv, std::string* error, size_t* frames) {
+    size_t pos = ReadFileHeader(data, size, csv);
+    if (pos == 0) {
+        if (error) *error = "Not a compressed lmuFFB log";
+        return false;
+    }
+
+    std::vector<LogFrame> block;
+    std::ostringstream row;
+    size_t total = 0;
+    while (pos < size) {
+        block.clear();
+        size_t used = DecodeBlock(data + pos, size - pos, block);
+        if (used == 0) break;  // Torn tail of an interrupted session
+        pos += used;
+        total += block.size();
+        for (const LogFrame& frame : block) {
+            row.str("");
+            AsyncLogger::FormatRow(row, frame);
+            csv += row.str();
+        }
+    }
+    if (frames) *frames = total;
+    return true;
+}
+
+} // namespace LogCodec
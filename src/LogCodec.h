@@ -0,0 +1,63 @@
+#ifndef LOGCODEC_H
+#define LOGCODEC_H
+
+#include "LogFrame.h"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/**
+ * @brief Compressed AsyncLogger output (v0.7.112).
+ *
+ * A compressed log (.lmz) holds the same text header as the CSV followed by blocks of
+ * up to BLOCK_FRAMES rows. Inside a block every CSV column is quantized to the CSV's
+ * 4-decimal resolution and delta coded against the previous row, then the zigzagged
+ * deltas go through an adaptive binary range coder with one model per column (bit
+ * length conditioned on the previous bit length, then the mantissa bits). Slow or
+ * constant channels cost almost nothing and noisy ones cost their actual noise, so
+ * a session takes about a tenth of the CSV's disk space and write bandwidth.
+ *
+ * Blocks are independent (models and deltas restart), so each one is a sync point:
+ * the log index stores block offsets for compressed logs, and an interrupted session
+ * decodes up to its last complete block. Decoding reproduces the CSV rows.
+ *
+ * Self-contained on purpose: no third-party compressor to vendor or download.
+ */
+namespace LogCodec {
+
+    constexpr int BLOCK_FRAMES = 1000;   // One LogIndex chunk
+
+    // File magic plus the CSV header text, verbatim
+    void AppendFileHeader(std::string& out, const std::string& header_text);
+    bool IsCompressed(const char* data, size_t size);
+    // Returns the bytes used by the file header, 0 if `data` is not a compressed log
+    size_t ReadFileHeader(const char* data, size_t size, std::string& header_text);
+
+    class BlockEncoder {
+    public:
+        BlockEncoder();
+
+        void Add(const LogFrame& frame) { m_frames.push_back(frame); }
+        size_t GetCount() const { return m_frames.size(); }
+        // Appends the buffered rows as one block and clears the buffer
+        void Encode(std::string& out);
+
+    private:
+        std::vector<LogFrame> m_frames;
+        std::vector<uint16_t> m_model;
+        std::string m_payload;
+    };
+
+    // Decodes the block at `data` and appends its rows. Returns the bytes consumed,
+    // 0 if the block is incomplete (torn tail) or corrupt.
+    size_t DecodeBlock(const char* data, size_t size, std::vector<LogFrame>& frames);
+
+    // Whole file back to the CSV text AsyncLogger would have written.
+    // Stops at a torn last block; `frames` (optional) receives the row count.
+    bool DecodeToCsv(const char* data, size_t size, std::string& csv, std::string* error = nullptr,
+                     size_t* frames = nullptr);
+
+} // namespace LogCodec
+
+#endif // LOGCODEC_H
@@ -0,0 +1,86 @@
+#ifndef LOGFRAME_H
+#define LOGFRAME_H
+
+// Log frame structure - captures one physics tick
+struct LogFrame {
+    double timestamp;
+    double delta_time;
+    
+    // Driver Inputs
+    float steering;
+    float throttle;
+    float brake;
+    
+    // Vehicle State
+    float speed;             // m/s
+    float lat_accel;         // m/sÂ²
+    float long_accel;        // m/sÂ²
+    float yaw_rate;          // rad/s
+    
+    // Front Axle - Raw Telemetry
+    float slip_angle_fl;
+    float slip_angle_fr;
+    float slip_ratio_fl;
+    float slip_ratio_fr;
+    float grip_fl;
+    float grip_fr;
+    float load_fl;
+    float load_fr;
+    
+    // Rear Axle - Raw Telemetry (v0.7.112)
+    float slip_angle_rl;
+    float slip_angle_rr;
+    float slip_ratio_rl;
+    float slip_ratio_rr;
+    float grip_rl;
+    float grip_rr;
+    float load_rl;
+    float load_rr;
+    
+    // Per-Wheel Estimates (v0.7.112) - FL, FR, RL, RR
+    float calc_load[4];
+    float calc_grip[4];
+    
+    // Front Axle - Calculated
+    float calc_slip_angle_front;
+    float calc_grip_front;
+    
+    // Slope Detection Specific
+    float dG_dt;             // Derivative of lateral G
+    float dAlpha_dt;         // Derivative of slip angle
+    float slope_current;     // dG/dAlpha ratio
+    float slope_raw_unclamped; // NEW v0.7.38
+    float slope_numerator;     // NEW v0.7.38
+    float slope_denominator;   // NEW v0.7.38
+    float hold_timer;          // NEW v0.7.38
+    float input_slip_smoothed; // NEW v0.7.38
+    float slope_smoothed;    // Smoothed grip output
+    float confidence;        // Confidence factor (v0.7.3)
+    float surface_type_fl;   // NEW v0.7.39
+    float surface_type_fr;   // NEW v0.7.39
+    float slope_torque;      // NEW v0.7.40
+    float slew_limited_g;    // NEW v0.7.40
+    
+    // Rear Axle
+    float calc_grip_rear;
+    float grip_delta;        // Front - Rear
+    
+    // FFB Output
+    float ffb_total;         // Normalized output
+    float ffb_base;          // Base steering shaft force
+    float ffb_shaft_torque;  // NEW v0.7.62 (Issue #138)
+    float ffb_gen_torque;    // NEW v0.7.62 (Issue #138)
+    float ffb_sop;           // Seat of Pants force
+    float ffb_grip_factor;   // Applied grip modulation
+    float speed_gate;        // Speed gate factor
+    float load_peak_ref;     // NEW: Dynamic normalization reference
+    bool clipping;           // Output clipping flag
+    
+    // User Markers
+    bool marker;             // User-triggered marker
+
+    // Session position (v0.7.112) - feeds the log index, not a CSV column
+    int lap;
+};
+
+#endif // LOGFRAME_H
@@ -0,0 +1,224 @@
+#include "LogIndex.h"
+#include <algorithm>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+namespace {
+
+const char* const kChannelNames[LogIndex::CHANNEL_COUNT] = {
+    "Speed", "LatAccel", "SlopeCurrent", "FFBTotal", "FFBShaftTorque", "GripFactor"
+};
+
+void ReadChannels(const LogFrame& f, std::array<float, LogIndex::CHANNEL_COUNT>& v) {
+    v[LogIndex::SPEED] = f.speed;
+    v[LogIndex::LAT_ACCEL] = f.lat_accel;
+    v[LogIndex::SLOPE] = f.slope_current;
+    v[LogIndex::FFB_TOTAL] = f.ffb_total;
+    v[LogIndex::SHAFT_TORQUE] = f.ffb_shaft_torque;
+    v[LogIndex::GRIP_FACTOR] = f.ffb_grip_factor;
+}
+
+const char* MarkName(LogIndexMark::Type type) {
+    return (type == LogIndexMark::Type::Lap) ? "lap" : "marker";
+}
+
+} // namespace
+
+LogIndex::LogIndex(int chunk_frames) : m_chunk_frames((std::max)(1, chunk_frames)) {}
+
+const char* LogIndex::ChannelName(int channel) {
+    return (channel >= 0 && channel < CHANNEL_COUNT) ? kChannelNames[channel] : "";
+}
+
+int LogIndex::FindChannel(std::string_view name) {
+    for (int i = 0; i < CHANNEL_COUNT; ++i) {
+        if (name == kChannelNames[i]) return i;
+    }
+    return -1;
+}
+
+std::string LogIndex::PathFor(const std::string& log_path) {
+    size_t dot = log_path.find_last_of('.');
+    size_t sep = log_path.find_last_of("/\\");
+    if (dot == std::string::npos || (sep != std::string::npos && dot < sep)) return log_path + ".idx";
+    return log_path.substr(0, dot) + ".idx";
+}
+
+void LogIndex::Clear() {
+    m_chunks.clear();
+    m_marks.clear();
+    m_open = Chunk();
+    m_frames = 0;
+    m_last_lap = 0;
+    m_complete = false;
+}
+
+void LogIndex::AddFrame(const LogFrame& frame, uint64_t offset) {
+    // A full chunk ends where this row starts
+    if ((int)m_open.frame_count >= m_chunk_frames) CloseChunk(offset);
+
+    std::array<float, CHANNEL_COUNT> v;
+    ReadChannels(frame, v);
+
+    if (m_open.frame_count == 0) {
+        m_open.first_frame = m_frames;
+        m_open.offset = offset;
+        m_open.time_start = frame.timestamp;
+        m_open.lap = frame.lap;
+        m_open.min = v;
+        m_open.max = v;
+    } else {
+        for (int i = 0; i < CHANNEL_COUNT; ++i) {
+            m_open.min[i] = (std::min)(m_open.min[i], v[i]);
+            m_open.max[i] = (std::max)(m_open.max[i], v[i]);
+        }
+    }
+    m_open.time_end = frame.timestamp;
+    m_open.frame_count++;
+
+    if (m_frames == 0 || frame.lap != m_last_lap) {
+        m_marks.push_back({ LogIndexMark::Type::Lap, frame.lap, m_frames, offset, frame.timestamp });
+        m_last_lap = frame.lap;
+    }
+    if (frame.marker) {
+        m_marks.push_back({ LogIndexMark::Type::Marker, frame.lap, m_frames, offset, frame.timestamp });
+    }
+    m_frames++;
+}
+
+void LogIndex::CloseChunk(uint64_t end_offset) {
+    if (m_open.frame_count == 0) return;
+    m_open.end_offset = end_offset;
+    m_chunks.push_back(m_open);
+    m_open = Chunk();
+}
+
+void LogIndex::Finish(uint64_t end_offset) {
+    CloseChunk(end_offset);
+    m_complete = true;
+}
+
+void LogIndex::WriteHeader(std::ostream& out, const std::string& log_name, int chunk_frames) {
+    out << "# LMUFFB Log Index v1\n";
+    out << "# Log: " << log_name << "\n";
+    out << "# Chunk Frames: " << chunk_frames << "\n";
+    out << "# chunk,first_frame,frame_count,offset,end_offset,time_start,time_end,lap";
+    for (int i = 0; i < CHANNEL_COUNT; ++i) out << "," << kChannelNames[i] << "Min," << kChannelNames[i] << "Max";
+    out << "\n# lap|marker,lap,frame,offset,time\n";
+}
+
+void LogIndex::WriteRecords(std::ostream& out, size_t& chunks_written, size_t& marks_written) const {
+    // Same precision as the CSV rows: rounding is monotonic, so the written min/max are
+    // exactly the min/max of the values a reader parses back from the chunk
+    out << std::fixed << std::setprecision(4);
+    for (; chunks_written < m_chunks.size(); ++chunks_written) {
+        const Chunk& c = m_chunks[chunks_written];
+        out << "chunk," << c.first_frame << "," << c.frame_count << "," << c.offset << "," << c.end_offset << ","
+            << c.time_start << "," << c.time_end << "," << c.lap;
+        for (int i = 0; i < CHANNEL_COUNT; ++i) out << "," << c.min[i] << "," << c.max[i];
+        out << "\n";
+    }
+    for (; marks_written < m_marks.size(); ++marks_written) {
+        const LogIndexMark& m = m_marks[marks_written];
+        out << MarkName(m.type) << "," << m.lap << "," << m.frame << "," << m.offset << "," << m.time << "\n";
+    }
+}
+
+void LogIndex::WriteEnd(std::ostream& out) const {
+    out << "end," << m_frames << "\n";
+}
+
+bool LogIndex::Load(const std::string& path, std::string* error) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        if (error) *error = "Cannot open " + path;
+        return false;
+    }
+    Clear();
+
+    std::string line;
+    std::vector<std::string> f;
+    while (std::getline(file, line)) {
+        if (!line.empty() && line.back() == '\r') line.pop_back();
+        if (line.empty()) continue;
+        if (line[0] == '#') {
+            if (line.rfind("# Chunk Frames:", 0) == 0) {
+                try { m_chunk_frames = (std::max)(1, std::stoi(line.substr(15))); } catch (...) {}
+            }
+            continue;
+        }
+
+        f.clear();
+        std::stringstream ss(line);
+        std::string field;
+        while (std::getline(ss, field, ',')) f.push_back(field);
+
+        try {
+            if (f[0] == "chunk" && f.size() >= 8 + 2 * CHANNEL_COUNT) {
+                Chunk c;
+                c.first_frame = std::stoull(f[1]);
+                c.frame_count = (uint32_t)std::stoul(f[2]);
+                c.offset = std::stoull(f[3]);
+                c.end_offset = std::stoull(f[4]);
+                c.time_start = std::stod(f[5]);
+                c.time_end = std::stod(f[6]);
+                c.lap = std::stoi(f[7]);
+                for (int i = 0; i < CHANNEL_COUNT; ++i) {
+                    c.min[i] = std::stof(f[8 + 2 * i]);
+                    c.max[i] = std::stof(f[9 + 2 * i]);
+                }
+                m_chunks.push_back(c);
+                m_frames = (std::max)(m_frames, c.first_frame + c.frame_count);
+            } else if ((f[0] == "lap" || f[0] == "marker") && f.size() >= 5) {
+                LogIndexMark m;
+                m.type = (f[0] == "lap") ? LogIndexMark::Type::Lap : LogIndexMark::Type::Marker;
+                m.lap = std::stoi(f[1]);
+                m.frame = std::stoull(f[2]);
+                m.offset = std::stoull(f[3]);
+                m.time = std::stod(f[4]);
+                m_marks.push_back(m);
+            } else if (f[0] == "end" && f.size() >= 2) {
+                m_frames = std::stoull(f[1]);
+                m_complete = true;
+            }
+        } catch (...) {
+            // A torn last line from an interrupted session; keep what was read
+        }
+    }
+
+    // Records are appended as they complete, so marks can precede their chunk
+    std::stable_sort(m_marks.begin(), m_marks.end(),
+                     [](const LogIndexMark& a, const LogIndexMark& b) { return a.frame < b.frame; });
+    return true;
+}
+
+int LogIndex::FindChunk(double time) const {
+    auto it = std::upper_bound(m_chunks.begin(), m_chunks.end(), time,
+                               [](double t, const Chunk& c) { return t < c.time_start; });
+    if (it == m_chunks.begin()) return -1;
+    return (int)(it - m_chunks.begin()) - 1;
+}
+
+std::vector<int> LogIndex::FindChunks(int channel, float lo, float hi) const {
+    std::vector<int> out;
+    if (channel < 0 || channel >= CHANNEL_COUNT) return out;
+    for (size_t i = 0; i < m_chunks.size(); ++i) {
+        if (m_chunks[i].max[channel] >= lo && m_chunks[i].min[channel] <= hi) out.push_back((int)i);
+    }
+    return out;
+}
+
+const LogIndexMark* LogIndex::FindMarker(int n) const {
+    for (const auto& m : m_marks) {
+        if (m.type == LogIndexMark::Type::Marker && n-- == 0) return &m;
+    }
+    return nullptr;
+}
+
+const LogIndexMark* LogIndex::FindLap(int lap) const {
+    for (const auto& m : m_marks) {
+        if (m.type == LogIndexMark::Type::Lap && m.lap == lap) return &m;
+    }
+    return nullptr;
+}
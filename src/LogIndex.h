@@ -0,0 +1,105 @@
+#ifndef LOGINDEX_H
+#define LOGINDEX_H
+
+#include "LogFrame.h"
+#include <array>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Seek index for AsyncLogger CSV logs (v0.7.112).
+ *
+ * The logged rows are grouped into chunks of CHUNK_FRAMES rows. Each chunk records the
+ * byte offset of its first row (a sync point: seek there and parse forward), its time
+ * span, the lap at its start and the min/max of a few key channels, so a query such
+ * as "lateral G above 2.5" can skip every chunk that cannot contain a match. Lap
+ * boundaries and user markers are recorded with their exact row offset. For a compressed
+ * log (LogCodec) chunks coincide with blocks and every offset is that of the block
+ * holding the row.
+ *
+ * The index lives in a sidecar file next to the log (PathFor), so the CSV stays
+ * plain for pandas and TelemetryReplay. AsyncLogger appends records as chunks close
+ * and markers arrive, and closes the file with an "end" record on Stop. An index
+ * without one comes from an interrupted session: everything in it is still valid,
+ * it just stops at the last completed chunk.
+ */
+
+struct LogIndexMark {
+    enum class Type { Lap, Marker };
+    Type type = Type::Marker;
+    int lap = 0;
+    uint64_t frame = 0;      // Row number (0 = first data row)
+    uint64_t offset = 0;     // Byte offset of the row in the CSV
+    double time = 0.0;
+};
+
+class LogIndex {
+public:
+    static constexpr int CHUNK_FRAMES = 1000;   // 10 s at the logged 100 Hz
+
+    // Channels with per-chunk min/max, named like their CSV columns
+    enum Channel { SPEED, LAT_ACCEL, SLOPE, FFB_TOTAL, SHAFT_TORQUE, GRIP_FACTOR, CHANNEL_COUNT };
+    static const char* ChannelName(int channel);
+    static int FindChannel(std::string_view name); // -1 if not indexed
+
+    struct Chunk {
+        uint64_t first_frame = 0;
+        uint32_t frame_count = 0;
+        uint64_t offset = 0;
+        uint64_t end_offset = 0;                  // Offset just past the chunk's last row
+        double time_start = 0.0;
+        double time_end = 0.0;
+        int lap = 0;
+        std::array<float, CHANNEL_COUNT> min{};
+        std::array<float, CHANNEL_COUNT> max{};
+    };
+
+    explicit LogIndex(int chunk_frames = CHUNK_FRAMES);
+
+    static std::string PathFor(const std::string& log_path); // foo.csv -> foo.idx
+
+    // --- Writer side (AsyncLogger worker) ---
+    // Rows in file order, each with the byte offset at which it starts.
+    void AddFrame(const LogFrame& frame, uint64_t offset);
+    // Closes the partial last chunk at the end of the data.
+    void Finish(uint64_t end_offset);
+    void Clear();
+
+    static void WriteHeader(std::ostream& out, const std::string& log_name, int chunk_frames);
+    // Appends the chunks and marks not written yet (counters are advanced).
+    void WriteRecords(std::ostream& out, size_t& chunks_written, size_t& marks_written) const;
+    void WriteEnd(std::ostream& out) const;
+
+    // --- Reader side ---
+    bool Load(const std::string& path, std::string* error = nullptr);
+    bool IsComplete() const { return m_complete; }  // Has the "end" record
+
+    const std::vector<Chunk>& GetChunks() const { return m_chunks; }
+    const std::vector<LogIndexMark>& GetMarks() const { return m_marks; }
+    uint64_t GetFrameCount() const { return m_frames; }
+    int GetChunkFrames() const { return m_chunk_frames; }
+
+    // Chunk whose time span contains t (the nearest one before it in gaps), -1 if none
+    int FindChunk(double time) const;
+    // Chunks whose [min, max] of `channel` overlaps [lo, hi]
+    std::vector<int> FindChunks(int channel, float lo, float hi) const;
+    // n-th user marker (0-based) or the start of a lap, nullptr if absent
+    const LogIndexMark* FindMarker(int n) const;
+    const LogIndexMark* FindLap(int lap) const;
+
+private:
+    void CloseChunk(uint64_t end_offset);
+
+    int m_chunk_frames;
+    std::vector<Chunk> m_chunks;
+    std::vector<LogIndexMark> m_marks;
+    Chunk m_open;                 // Chunk being filled (writer)
+    uint64_t m_frames = 0;
+    int m_last_lap = 0;
+    bool m_complete = false;
+};
+
+#endif // LOGINDEX_H
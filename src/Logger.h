@@ -10,38 +10,90 @@
 #include <iomanip>
 #include <chrono>
 #include <cstdarg>
+#include <cstdio>
+#include <ctime>
+#include <atomic>
+#include <thread>
+#include <csignal>
 
-// Simple synchronous logger that flushes every line for crash debugging
+#ifdef _WIN32
+#include <io.h>
+#include <fcntl.h>
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+// Asynchronous debug logger (v0.7.112)
+// Callers format straight into a slot of a pre-allocated lock-free ring and never
+// touch the file or console, so a slow disk cannot stall the FFB loop. A background
+// writer drains the ring every WRITER_PERIOD_MS and flushes the file after each batch.
+// Fatal signals (SIGSEGV/SIGABRT/SIGFPE/SIGILL) append the queued ring slots to the log
+// with raw write() calls on a descriptor opened at Init(), before the process dies.
+// If the ring is full the message is dropped and counted rather than blocking.
 class Logger {
 public:
+    static constexpr size_t RING_SIZE = 256;        // Must be a power of two
+    static constexpr size_t MESSAGE_SIZE = 1024;
+    static constexpr int WRITER_PERIOD_MS = 20;
+
     static Logger& Get() {
         static Logger instance;
         return instance;
     }
 
     void Init(const std::string& filename) {
-        std::lock_guard<std::mutex> lock(m_mutex);
-        m_filename = filename;
-        m_file.open(m_filename, std::ios::out | std::ios::trunc);
-        if (m_file.is_open()) {
-            m_initialized = true;
-            _LogNoLock("Logger Initialized. Version: " + std::string(LMUFFB_VERSION));
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            _DrainNoLock();
+            if (m_file.is_open()) m_file.close();
+            m_filename = filename;
+            m_file.open(m_filename, std::ios::out | std::ios::trunc);
+            m_initialized = m_file.is_open();
+            CloseCrashFile();
+            if (m_initialized) {
+#ifdef _WIN32
+                m_crash_fd = _open(m_filename.c_str(), _O_WRONLY | _O_APPEND | _O_BINARY);
+#else
+                m_crash_fd = ::open(m_filename.c_str(), O_WRONLY | O_APPEND);
+#endif
+            }
+        }
+        if (!m_initialized) return;
+
+        InstallSignalHandlers();
+        if (!m_writer.joinable()) {
+            m_running = true;
+            m_writer = std::thread(&Logger::WriterLoop, this);
         }
+        Log("Logger Initialized. Version: %s", LMUFFB_VERSION);
     }
 
+    // Wait-free for the caller apart from the CAS on the ring head.
     void Log(const char* fmt, ...) {
         if (!m_initialized) return;
 
-        char buffer[1024];
+        size_t pos = m_head.load(std::memory_order_relaxed);
+        Slot* slot = nullptr;
+        for (;;) {
+            slot = &m_ring[pos & (RING_SIZE - 1)];
+            size_t seq = slot->sequence.load(std::memory_order_acquire);
+            if (seq == pos) {
+                if (m_head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) break;
+            } else if (seq < pos) {
+                m_dropped.fetch_add(1, std::memory_order_relaxed); // Ring full
+                return;
+            } else {
+                pos = m_head.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->time = std::chrono::system_clock::to_time_t(std::chrono::system_clock::now());
         va_list args;
         va_start(args, fmt);
-        vsnprintf(buffer, sizeof(buffer), fmt, args);
+        vsnprintf(slot->text, sizeof(slot->text), fmt, args);
         va_end(args);
-
-        std::string message(buffer);
-
-        std::lock_guard<std::mutex> lock(m_mutex);
-        _LogNoLock(message);
+        slot->sequence.store(pos + 1, std::memory_order_release);
     }
 
     // Helper for std::string
@@ -54,43 +106,174 @@ public:
         Log("Error in %s: Code %lu", context, errorCode);
     }
 
+    // Synchronously writes everything queued so far (shutdown, tests)
+    void Flush() {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        _DrainNoLock();
+    }
+
+    bool IsInitialized() const { return m_initialized.load(std::memory_order_relaxed); }
+    size_t GetDroppedCount() const { return m_total_dropped.load(std::memory_order_relaxed) + m_dropped.load(std::memory_order_relaxed); }
+
 private:
-    Logger() {}
+    struct Slot {
+        std::atomic<size_t> sequence{0};
+        std::time_t time = 0;
+        char text[MESSAGE_SIZE];
+    };
+
+    Logger() : m_ring(new Slot[RING_SIZE]) {
+        for (size_t i = 0; i < RING_SIZE; ++i) m_ring[i].sequence.store(i, std::memory_order_relaxed);
+    }
+
     ~Logger() noexcept {
         try {
+            m_running = false;
+            if (m_writer.joinable()) m_writer.join();
+            std::lock_guard<std::mutex> lock(m_mutex);
+            _DrainNoLock();
             if (m_file.is_open()) {
                 m_file << "Logger Shutdown.\n";
                 m_file.close();
             }
+            CloseCrashFile();
         } catch (...) {
             // Destructor must not throw
         }
     }
 
-    void _LogNoLock(const std::string& message) {
+    void WriterLoop() {
+        while (m_running) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(WRITER_PERIOD_MS));
+            std::lock_guard<std::mutex> lock(m_mutex);
+            _DrainNoLock();
+        }
+    }
+
+    // Single consumer: only ever called with m_mutex held.
+    void _DrainNoLock() {
+        bool wrote = false;
+        for (;;) {
+            size_t tail = m_tail.load(std::memory_order_relaxed);
+            Slot& slot = m_ring[tail & (RING_SIZE - 1)];
+            if (slot.sequence.load(std::memory_order_acquire) != tail + 1) break;
+            _WriteLine(slot.time, slot.text);
+            slot.sequence.store(tail + RING_SIZE, std::memory_order_release);
+            m_tail.store(tail + 1, std::memory_order_relaxed);
+            wrote = true;
+        }
+
+        size_t dropped = m_dropped.exchange(0, std::memory_order_relaxed);
+        if (dropped > 0) {
+            m_total_dropped.fetch_add(dropped, std::memory_order_relaxed);
+            char note[64];
+            snprintf(note, sizeof(note), "[Logger] %zu messages dropped (ring full)", dropped);
+            _WriteLine(std::time(nullptr), note);
+            wrote = true;
+        }
+
+        if (wrote) {
+            if (m_file.is_open()) m_file.flush(); // Critical for crash debugging
+            std::cout.flush();
+        }
+    }
+
+    void _WriteLine(std::time_t t, const char* message) {
         if (!m_file.is_open()) return;
 
-        // Timestamp
-        auto now = std::chrono::system_clock::now();
-        auto in_time_t = std::chrono::system_clock::to_time_t(now);
         std::tm time_info;
         #ifdef _WIN32
-            localtime_s(&time_info, &in_time_t);
+            localtime_s(&time_info, &t);
         #else
-            localtime_r(&in_time_t, &time_info);
+            localtime_r(&t, &time_info);
         #endif
 
         m_file << "[" << std::put_time(&time_info, "%H:%M:%S") << "] " << message << "\n";
-        m_file.flush(); // Critical for crash debugging
 
         // Also print to console for consistency
-        std::cout << "[Log] " << message << std::endl;
+        std::cout << "[Log] " << message << "\n";
+    }
+
+    void InstallSignalHandlers() {
+        if (m_handlers_installed) return;
+        m_handlers_installed = true;
+        std::signal(SIGSEGV, &Logger::OnFatalSignal);
+        std::signal(SIGABRT, &Logger::OnFatalSignal);
+        std::signal(SIGFPE, &Logger::OnFatalSignal);
+        std::signal(SIGILL, &Logger::OnFatalSignal);
+    }
+
+    void CloseCrashFile() {
+        int fd = m_crash_fd.exchange(-1);
+        if (fd < 0) return;
+#ifdef _WIN32
+        _close(fd);
+#else
+        ::close(fd);
+#endif
+    }
+
+    // Async-signal-safe helpers: no locks, no allocation, no stdio
+    static void RawWrite(int fd, const char* text, size_t len) {
+#ifdef _WIN32
+        (void)_write(fd, text, (unsigned int)len);
+#else
+        ssize_t written = ::write(fd, text, len);
+        (void)written;
+#endif
+    }
+
+    static size_t TextLength(const char* text, size_t max_len) {
+        size_t n = 0;
+        while (n < max_len && text[n] != '\0') ++n;
+        return n;
+    }
+
+    static const char* FatalNote(int sig) {
+        switch (sig) {
+            case SIGSEGV: return "[Logger] Fatal signal: SIGSEGV\n";
+            case SIGABRT: return "[Logger] Fatal signal: SIGABRT\n";
+            case SIGFPE:  return "[Logger] Fatal signal: SIGFPE\n";
+            case SIGILL:  return "[Logger] Fatal signal: SIGILL\n";
+            default:      return "[Logger] Fatal signal\n";
+        }
+    }
+
+    // Only async-signal-safe calls: the file, the mutex and stdio may be mid-use by the
+    // thread that crashed. Appends the messages still queued (untimed, and possibly one
+    // the writer was printing at that moment) and the signal, then re-raises it.
+    static void OnFatalSignal(int sig) {
+        Logger& self = Get();
+        int fd = self.m_crash_fd.load(std::memory_order_relaxed);
+        if (fd >= 0) {
+            size_t head = self.m_head.load(std::memory_order_acquire);
+            for (size_t pos = self.m_tail.load(std::memory_order_relaxed); pos != head; ++pos) {
+                const Slot& slot = self.m_ring[pos & (RING_SIZE - 1)];
+                if (slot.sequence.load(std::memory_order_acquire) != pos + 1) continue; // Still being formatted
+                RawWrite(fd, slot.text, TextLength(slot.text, sizeof(slot.text)));
+                RawWrite(fd, "\n", 1);
+            }
+            const char* note = FatalNote(sig);
+            RawWrite(fd, note, TextLength(note, MESSAGE_SIZE));
+        }
+        std::signal(sig, SIG_DFL);
+        std::raise(sig);
     }
 
     std::string m_filename;
     std::ofstream m_file;
-    std::mutex m_mutex;
-    bool m_initialized = false;
+    std::mutex m_mutex;                       // Guards the file and the ring tail
+    std::atomic<bool> m_initialized{false};
+    std::atomic<bool> m_running{false};
+    bool m_handlers_installed = false;
+    std::thread m_writer;
+
+    std::unique_ptr<Slot[]> m_ring;
+    std::atomic<size_t> m_head{0};
+    std::atomic<size_t> m_tail{0};            // Written by the drain, read by the signal handler
+    std::atomic<int> m_crash_fd{-1};          // Raw descriptor for the signal handler
+    std::atomic<size_t> m_dropped{0};
+    std::atomic<size_t> m_total_dropped{0};
 };
 
 #endif // LOGGER_H
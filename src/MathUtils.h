@@ -153,6 +153,136 @@ inline double calculate_sg_derivative(const std::array<double, BufferSize>& buff
     // Divide by dt to get derivative in units/second
     return sum / (S2 * dt);
 }
+/**
+ * @brief Fixed-size dense matrix (row-major, inline storage)
+ *
+ * Dimensions are template parameters, so filters built on it keep all state
+ * inside their owner and no operation allocates. Meant for the small systems
+ * (N <= ~8) used on the FFB thread.
+ */
+template <int R, int C>
+struct Matrix {
+    double m[R][C] = {};
+
+    double& operator()(int r, int c) { return m[r][c]; }
+    double operator()(int r, int c) const { return m[r][c]; }
+
+    static Matrix Identity() {
+        static_assert(R == C, "Identity requires a square matrix");
+        Matrix out;
+        for (int i = 0; i < R; ++i) out.m[i][i] = 1.0;
+        return out;
+    }
+
+    Matrix operator+(const Matrix& o) const {
+        Matrix out;
+        for (int i = 0; i < R; ++i)
+            for (int j = 0; j < C; ++j) out.m[i][j] = m[i][j] + o.m[i][j];
+        return out;
+    }
+
+    Matrix operator-(const Matrix& o) const {
+        Matrix out;
+        for (int i = 0; i < R; ++i)
+            for (int j = 0; j < C; ++j) out.m[i][j] = m[i][j] - o.m[i][j];
+        return out;
+    }
+
+    template <int K>
+    Matrix<R, K> operator*(const Matrix<C, K>& o) const {
+        Matrix<R, K> out;
+        for (int i = 0; i < R; ++i)
+            for (int k = 0; k < C; ++k) {
+                double a = m[i][k];
+                if (a == 0.0) continue; // Block-diagonal systems are mostly zeros
+                for (int j = 0; j < K; ++j) out.m[i][j] += a * o.m[k][j];
+            }
+        return out;
+    }
+
+    Matrix<C, R> Transposed() const {
+        Matrix<C, R> out;
+        for (int i = 0; i < R; ++i)
+            for (int j = 0; j < C; ++j) out.m[j][i] = m[i][j];
+        return out;
+    }
+};
+
+// Helper: Gauss-Jordan inverse with partial pivoting
+// Returns false (out untouched) if the matrix is singular.
+template <int N>
+inline bool invert(const Matrix<N, N>& a, Matrix<N, N>& out) {
+    Matrix<N, N> work = a;
+    Matrix<N, N> inv = Matrix<N, N>::Identity();
+    for (int col = 0; col < N; ++col) {
+        int pivot = col;
+        for (int r = col + 1; r < N; ++r) {
+            if (std::abs(work.m[r][col]) > std::abs(work.m[pivot][col])) pivot = r;
+        }
+        if (std::abs(work.m[pivot][col]) < 1e-12) return false;
+        if (pivot != col) {
+            for (int j = 0; j < N; ++j) {
+                std::swap(work.m[col][j], work.m[pivot][j]);
+                std::swap(inv.m[col][j], inv.m[pivot][j]);
+            }
+        }
+        double d = 1.0 / work.m[col][col];
+        for (int j = 0; j < N; ++j) {
+            work.m[col][j] *= d;
+            inv.m[col][j] *= d;
+        }
+        for (int r = 0; r < N; ++r) {
+            if (r == col) continue;
+            double f = work.m[r][col];
+            if (f == 0.0) continue;
+            for (int j = 0; j < N; ++j) {
+                work.m[r][j] -= f * work.m[col][j];
+                inv.m[r][j] -= f * inv.m[col][j];
+            }
+        }
+    }
+    out = inv;
+    return true;
+}
+
+/**
+ * @brief Linear Kalman filter with compile-time dimensions
+ *
+ * N states, M measurements. The caller supplies the model (F, Q) and the
+ * measurement (H, R) every step, so time-varying dt is handled by the owner.
+ * Constant time and allocation-free.
+ */
+template <int N, int M>
+struct KalmanFilter {
+    Matrix<N, 1> x;
+    Matrix<N, N> P;
+
+    void Reset(const Matrix<N, 1>& x0, const Matrix<N, N>& P0) {
+        x = x0;
+        P = P0;
+    }
+
+    void Predict(const Matrix<N, N>& F, const Matrix<N, N>& Q) {
+        x = F * x;
+        P = F * P * F.Transposed() + Q;
+    }
+
+    // Returns false if the innovation covariance was singular (state unchanged)
+    bool Update(const Matrix<M, 1>& z, const Matrix<M, N>& H, const Matrix<M, M>& R) {
+        Matrix<N, M> PHt = P * H.Transposed();
+        Matrix<M, M> S = H * PHt + R;
+        Matrix<M, M> S_inv;
+        if (!invert(S, S_inv)) return false;
+        Matrix<N, M> K = PHt * S_inv;
+        x = x + K * (z - H * x);
+        P = (Matrix<N, N>::Identity() - K * H) * P;
+        // Keep P symmetric against round-off
+        for (int i = 0; i < N; ++i)
+            for (int j = i + 1; j < N; ++j) P.m[i][j] = P.m[j][i] = 0.5 * (P.m[i][j] + P.m[j][i]);
+        return true;
+    }
+};
+
 } // namespace ffb_math
 
 #endif // MATH_UTILS_H
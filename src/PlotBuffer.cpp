@@ -0,0 +1,125 @@
+#include "PlotBuffer.h"
+#include <algorithm>
+#include <cmath>
+
+PlotBuffer::PlotBuffer(int capacity) {
+    Resize(capacity);
+}
+
+void PlotBuffer::Resize(int capacity) {
+    m_capacity = (std::max)(1, capacity);
+    m_data.assign(m_capacity, 0.0f);
+    m_levels.clear();
+    for (int l = 1; (1 << l) <= m_capacity; ++l) {
+        Level level;
+        int ring = (m_capacity >> l) + 2;
+        level.min_vals.assign(ring, 0.0f);
+        level.max_vals.assign(ring, 0.0f);
+        m_levels.push_back(std::move(level));
+    }
+    m_total = 0;
+    m_current = 0.0f;
+}
+
+void PlotBuffer::Clear() {
+    std::fill(m_data.begin(), m_data.end(), 0.0f);
+    m_total = 0;
+    m_current = 0.0f;
+}
+
+void PlotBuffer::Add(float val) {
+    int64_t idx = m_total++;
+    m_data[idx % m_capacity] = val;
+    bool gap = std::isnan(val);
+    if (!gap) m_current = val;
+    for (size_t i = 0; i < m_levels.size(); ++i) {
+        int l = (int)i + 1;
+        Level& level = m_levels[i];
+        size_t slot = (size_t)((idx >> l) % (int64_t)level.min_vals.size());
+        if ((idx & ((int64_t(1) << l) - 1)) == 0) {
+            // First sample of a new block overwrites the stale one in this slot
+            level.min_vals[slot] = gap ? INFINITY : val;
+            level.max_vals[slot] = gap ? -INFINITY : val;
+        } else if (!gap) {
+            if (val < level.min_vals[slot]) level.min_vals[slot] = val;
+            if (val > level.max_vals[slot]) level.max_vals[slot] = val;
+        }
+    }
+}
+
+void PlotBuffer::AddGap(int64_t count) {
+    count = (std::min)(count, (int64_t)m_capacity);
+    for (int64_t i = 0; i < count; ++i) Add(NAN);
+}
+
+float PlotBuffer::GetCurrent() const {
+    return m_current;
+}
+
+float PlotBuffer::GetMin() const {
+    float min_val = 0.0f, max_val = 0.0f;
+    GetRange(0, GetCount(), min_val, max_val);
+    return min_val;
+}
+
+float PlotBuffer::GetMax() const {
+    float min_val = 0.0f, max_val = 0.0f;
+    GetRange(0, GetCount(), min_val, max_val);
+    return max_val;
+}
+
+bool PlotBuffer::GetRange(int first, int count, float& min_val, float& max_val) const {
+    int held = GetCount();
+    if (first < 0 || count <= 0 || first + count > held) {
+        min_val = max_val = 0.0f;
+        return false;
+    }
+    int64_t begin = m_total - held + first;
+    Query(begin, begin + count, min_val, max_val);
+    if (min_val > max_val) {
+        min_val = max_val = 0.0f;
+        return false;
+    }
+    return true;
+}
+
+void PlotBuffer::Query(int64_t begin, int64_t end, float& min_val, float& max_val) const {
+    min_val = INFINITY;   // NaN gaps fail every comparison and drop out
+    max_val = -INFINITY;
+    int64_t a = begin;
+    while (a < end) {
+        // Largest aligned block starting at a that still fits in the range
+        int l = 0;
+        while (l < (int)m_levels.size() && (a & ((int64_t(2) << l) - 1)) == 0 && a + (int64_t(2) << l) <= end) l++;
+        if (l == 0) {
+            float v = m_data[a % m_capacity];
+            if (v < min_val) min_val = v;
+            if (v > max_val) max_val = v;
+        } else {
+            const Level& level = m_levels[l - 1];
+            size_t slot = (size_t)((a >> l) % (int64_t)level.min_vals.size());
+            if (level.min_vals[slot] < min_val) min_val = level.min_vals[slot];
+            if (level.max_vals[slot] > max_val) max_val = level.max_vals[slot];
+        }
+        a += int64_t(1) << l;
+    }
+}
+
+int PlotBuffer::BuildEnvelope(int columns, float* out_min, float* out_max) const {
+    if (columns <= 0) return 0;
+    int64_t window_start = m_total - m_capacity;      // May be negative while filling
+    int64_t held_start = m_total - GetCount();
+    for (int c = 0; c < columns; ++c) {
+        int64_t begin = window_start + (int64_t)c * m_capacity / columns;
+        int64_t end = window_start + (int64_t)(c + 1) * m_capacity / columns;
+        if (end <= begin) end = begin + 1;            // More columns than samples
+        begin = (std::max)(begin, held_start);
+        if (end <= begin) {
+            out_min[c] = out_max[c] = NAN;
+            continue;
+        }
+        Query(begin, end, out_min[c], out_max[c]);
+        if (out_min[c] > out_max[c]) out_min[c] = out_max[c] = NAN;
+    }
+    return columns;
+}
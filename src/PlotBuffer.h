@@ -0,0 +1,64 @@
+#ifndef PLOTBUFFER_H
+#define PLOTBUFFER_H
+
+#include <cstdint>
+#include <vector>
+
+// Plot Buffer (v0.7.112)
+// Rolling history for the live graphs with a min/max pyramid on top of it. Level l
+// holds the min and max of every aligned block of 2^l samples (level 0 is the data
+// itself) and is updated incrementally on Add, O(log N) per sample.
+//
+// Any range query decomposes into at most two blocks per level, so the window
+// min/max is O(log N) instead of a full scan, and a plot of W pixels needs W range
+// queries (BuildEnvelope) no matter how long the history is. The GUI draws that
+// per-column min/max envelope instead of handing every sample to ImGui.
+//
+// NaN samples (AddGap) mark lost data: they are skipped by every query and columns
+// holding only gaps come out as NaN, so the plot shows a break.
+class PlotBuffer {
+public:
+    explicit PlotBuffer(int capacity);
+
+    // Changes the history length. Clears the buffer.
+    void Resize(int capacity);
+    void Clear();
+    void Add(float val);
+    // Appends `count` NaN samples for snapshots that never arrived (capped at the capacity)
+    void AddGap(int64_t count);
+
+    int GetCapacity() const { return m_capacity; }
+    int GetCount() const { return (m_total < (int64_t)m_capacity) ? (int)m_total : m_capacity; }
+
+    float GetCurrent() const; // Latest non-gap sample
+    // Over the samples held (0 when empty)
+    float GetMin() const;
+    float GetMax() const;
+    // Min/max of `count` samples starting at `first` (0 = oldest held). False (and 0)
+    // if out of range or the range holds only gaps.
+    bool GetRange(int first, int count, float& min_val, float& max_val) const;
+
+    // Splits the whole history window (GetCapacity() samples, newest on the right) into
+    // `columns` equal slices and writes each slice's min/max. Slices older than the first
+    // sample (buffer still filling) or holding only gaps are NaN. Returns the number of
+    // columns written.
+    int BuildEnvelope(int columns, float* out_min, float* out_max) const;
+
+private:
+    struct Level {
+        std::vector<float> min_vals;
+        std::vector<float> max_vals;
+    };
+
+    // Absolute sample indices [begin, end), both within the held window. min > max if
+    // the range holds only gaps.
+    void Query(int64_t begin, int64_t end, float& min_val, float& max_val) const;
+
+    int m_capacity = 0;
+    int64_t m_total = 0;          // Samples ever added
+    float m_current = 0.0f;       // Latest non-gap sample
+    std::vector<float> m_data;    // Level 0, ring indexed by absolute index % capacity
+    std::vector<Level> m_levels;  // m_levels[l - 1] = level l, ring of (capacity >> l) + 2 blocks
+};
+
+#endif // PLOTBUFFER_H
@@ -0,0 +1,281 @@
+#include "PlotPanels.h"
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <sstream>
+
+namespace {
+
+constexpr PlotChannel C(const char* key, const char* label, const char* group, float lo, float hi,
+                        float FFBSnapshot::* field) {
+    return { key, label, group, lo, hi, field, nullptr, 0 };
+}
+constexpr PlotChannel W(const char* key, const char* label, const char* group, float lo, float hi,
+                        float (FFBSnapshot::* field)[4], int wheel) {
+    return { key, label, group, lo, hi, nullptr, field, wheel };
+}
+
+constexpr const char* G_OUTPUT = "FFB Components";
+constexpr const char* G_PHYSICS = "Internal Physics";
+constexpr const char* G_TELEMETRY = "Raw Telemetry";
+constexpr const char* G_WHEELS = "Per-Wheel States";
+constexpr const char* G_SYSTEM = "System";
+
+// Ranges match the fixed FFB Analysis plots
+constexpr PlotChannel kChannels[] = {
+    C("total_output", "Total Output", G_OUTPUT, -1.0f, 1.0f, &FFBSnapshot::total_output),
+    C("base_force", "Base Torque (Nm)", G_OUTPUT, -30.0f, 30.0f, &FFBSnapshot::base_force),
+    C("sop_force", "SoP (Chassis G)", G_OUTPUT, -20.0f, 20.0f, &FFBSnapshot::sop_force),
+    C("yaw_kick", "Yaw Kick", G_OUTPUT, -20.0f, 20.0f, &FFBSnapshot::ffb_yaw_kick),
+    C("rear_torque", "Rear Align", G_OUTPUT, -20.0f, 20.0f, &FFBSnapshot::ffb_rear_torque),
+    C("gyro_damping", "Gyro Damping", G_OUTPUT, -20.0f, 20.0f, &FFBSnapshot::ffb_gyro_damping),
+    C("scrub_drag", "Scrub Drag", G_OUTPUT, -20.0f, 20.0f, &FFBSnapshot::ffb_scrub_drag),
+    C("soft_lock", "Soft Lock", G_OUTPUT, -50.0f, 50.0f, &FFBSnapshot::ffb_soft_lock),
+    C("abs_pulse", "ABS Pulse", G_OUTPUT, -10.0f, 10.0f, &FFBSnapshot::ffb_abs_pulse),
+    C("oversteer_boost", "Lateral G Boost", G_OUTPUT, -20.0f, 20.0f, &FFBSnapshot::oversteer_boost),
+    C("understeer_drop", "Understeer Cut", G_OUTPUT, -20.0f, 20.0f, &FFBSnapshot::understeer_drop),
+    C("clipping", "Clipping", G_OUTPUT, 0.0f, 1.1f, &FFBSnapshot::clipping),
+    C("texture_road", "Road Texture", G_OUTPUT, -10.0f, 10.0f, &FFBSnapshot::texture_road),
+    C("texture_slide", "Slide Texture", G_OUTPUT, -10.0f, 10.0f, &FFBSnapshot::texture_slide),
+    C("texture_lockup", "Lockup Vib", G_OUTPUT, -10.0f, 10.0f, &FFBSnapshot::texture_lockup),
+    C("texture_spin", "Spin Vib", G_OUTPUT, -10.0f, 10.0f, &FFBSnapshot::texture_spin),
+    C("texture_bottoming", "Bottoming", G_OUTPUT, -10.0f, 10.0f, &FFBSnapshot::texture_bottoming),
+    C("session_peak_torque", "Session Peak Torque", G_OUTPUT, 0.0f, 50.0f, &FFBSnapshot::session_peak_torque),
+
+    C("calc_front_load", "Calc Front Load", G_PHYSICS, 0.0f, 10000.0f, &FFBSnapshot::calc_front_load),
+    C("calc_rear_load", "Calc Rear Load", G_PHYSICS, 0.0f, 10000.0f, &FFBSnapshot::calc_rear_load),
+    C("calc_front_grip", "Calc Front Grip", G_PHYSICS, 0.0f, 1.2f, &FFBSnapshot::calc_front_grip),
+    C("calc_rear_grip", "Calc Rear Grip", G_PHYSICS, 0.0f, 1.2f, &FFBSnapshot::calc_rear_grip),
+    C("calc_front_slip_ratio", "Front Slip Ratio", G_PHYSICS, -1.0f, 1.0f, &FFBSnapshot::calc_front_slip_ratio),
+    C("calc_front_slip_angle", "Front Slip Angle", G_PHYSICS, 0.0f, 1.0f, &FFBSnapshot::calc_front_slip_angle_smoothed),
+    C("calc_rear_slip_angle", "Rear Slip Angle", G_PHYSICS, 0.0f, 1.0f, &FFBSnapshot::calc_rear_slip_angle_smoothed),
+    C("calc_rear_lat_force", "Calc Rear Lat Force", G_PHYSICS, -5000.0f, 5000.0f, &FFBSnapshot::calc_rear_lat_force),
+    C("slope_current", "Slope", G_PHYSICS, -5.0f, 5.0f, &FFBSnapshot::slope_current),
+    C("debug_freq", "Oscillation Freq (Hz)", G_PHYSICS, 0.0f, 50.0f, &FFBSnapshot::debug_freq),
+
+    C("steer_force", "Selected Torque", G_TELEMETRY, -30.0f, 30.0f, &FFBSnapshot::steer_force),
+    C("raw_shaft_torque", "Shaft Torque (100Hz)", G_TELEMETRY, -30.0f, 30.0f, &FFBSnapshot::raw_shaft_torque),
+    C("raw_gen_torque", "In-Game FFB (400Hz)", G_TELEMETRY, -30.0f, 30.0f, &FFBSnapshot::raw_gen_torque),
+    C("raw_input_steering", "Steering Input", G_TELEMETRY, -1.0f, 1.0f, &FFBSnapshot::raw_input_steering),
+    C("raw_input_throttle", "Throttle", G_TELEMETRY, 0.0f, 1.0f, &FFBSnapshot::raw_input_throttle),
+    C("raw_input_brake", "Brake", G_TELEMETRY, 0.0f, 1.0f, &FFBSnapshot::raw_input_brake),
+    C("accel_x", "Lat Accel", G_TELEMETRY, -20.0f, 20.0f, &FFBSnapshot::accel_x),
+    C("raw_car_speed", "Speed (m/s)", G_TELEMETRY, 0.0f, 100.0f, &FFBSnapshot::raw_car_speed),
+    C("raw_front_tire_load", "Raw Front Load", G_TELEMETRY, 0.0f, 10000.0f, &FFBSnapshot::raw_front_tire_load),
+    C("raw_front_grip", "Raw Front Grip", G_TELEMETRY, 0.0f, 1.2f, &FFBSnapshot::raw_front_grip_fract),
+    C("raw_rear_grip", "Raw Rear Grip", G_TELEMETRY, 0.0f, 1.2f, &FFBSnapshot::raw_rear_grip),
+    C("raw_front_slip_ratio", "Raw Front Slip Ratio", G_TELEMETRY, -1.0f, 1.0f, &FFBSnapshot::raw_front_slip_ratio),
+    C("raw_front_slip_angle", "Raw Front Slip Angle", G_TELEMETRY, 0.0f, 1.0f, &FFBSnapshot::raw_front_slip_angle),
+    C("raw_rear_slip_angle", "Raw Rear Slip Angle", G_TELEMETRY, 0.0f, 1.0f, &FFBSnapshot::raw_rear_slip_angle),
+    C("raw_front_susp_force", "Front Susp Force", G_TELEMETRY, 0.0f, 20000.0f, &FFBSnapshot::raw_front_susp_force),
+    C("raw_front_ride_height", "Front Ride Height", G_TELEMETRY, 0.0f, 0.2f, &FFBSnapshot::raw_front_ride_height),
+    C("raw_front_deflection", "Front Deflection", G_TELEMETRY, 0.0f, 0.1f, &FFBSnapshot::raw_front_deflection),
+    C("raw_rear_lat_force", "Raw Rear Lat Force", G_TELEMETRY, -5000.0f, 5000.0f, &FFBSnapshot::raw_rear_lat_force),
+    C("raw_front_lat_patch_vel", "F-Lat PatchVel", G_TELEMETRY, 0.0f, 20.0f, &FFBSnapshot::raw_front_lat_patch_vel),
+    C("raw_rear_lat_patch_vel", "R-Lat PatchVel", G_TELEMETRY, 0.0f, 20.0f, &FFBSnapshot::raw_rear_lat_patch_vel),
+    C("raw_front_long_patch_vel", "F-Long PatchVel", G_TELEMETRY, -20.0f, 20.0f, &FFBSnapshot::raw_front_long_patch_vel),
+    C("raw_rear_long_patch_vel", "R-Long PatchVel", G_TELEMETRY, -20.0f, 20.0f, &FFBSnapshot::raw_rear_long_patch_vel),
+
+    W("wheel_load_fl", "Load FL", G_WHEELS, 0.0f, 10000.0f, &FFBSnapshot::wheel_load, 0),
+    W("wheel_load_fr", "Load FR", G_WHEELS, 0.0f, 10000.0f, &FFBSnapshot::wheel_load, 1),
+    W("wheel_load_rl", "Load RL", G_WHEELS, 0.0f, 10000.0f, &FFBSnapshot::wheel_load, 2),
+    W("wheel_load_rr", "Load RR", G_WHEELS, 0.0f, 10000.0f, &FFBSnapshot::wheel_load, 3),
+    W("wheel_grip_fl", "Grip FL", G_WHEELS, 0.0f, 1.2f, &FFBSnapshot::wheel_grip, 0),
+    W("wheel_grip_fr", "Grip FR", G_WHEELS, 0.0f, 1.2f, &FFBSnapshot::wheel_grip, 1),
+    W("wheel_grip_rl", "Grip RL", G_WHEELS, 0.0f, 1.2f, &FFBSnapshot::wheel_grip, 2),
+    W("wheel_grip_rr", "Grip RR", G_WHEELS, 0.0f, 1.2f, &FFBSnapshot::wheel_grip, 3),
+    W("wheel_slip_angle_fl", "Slip Angle FL", G_WHEELS, -0.5f, 0.5f, &FFBSnapshot::wheel_slip_angle, 0),
+    W("wheel_slip_angle_fr", "Slip Angle FR", G_WHEELS, -0.5f, 0.5f, &FFBSnapshot::wheel_slip_angle, 1),
+    W("wheel_slip_angle_rl", "Slip Angle RL", G_WHEELS, -0.5f, 0.5f, &FFBSnapshot::wheel_slip_angle, 2),
+    W("wheel_slip_angle_rr", "Slip Angle RR", G_WHEELS, -0.5f, 0.5f, &FFBSnapshot::wheel_slip_angle, 3),
+    W("wheel_slip_ratio_fl", "Slip Ratio FL", G_WHEELS, -1.0f, 1.0f, &FFBSnapshot::wheel_slip_ratio, 0),
+    W("wheel_slip_ratio_fr", "Slip Ratio FR", G_WHEELS, -1.0f, 1.0f, &FFBSnapshot::wheel_slip_ratio, 1),
+    W("wheel_slip_ratio_rl", "Slip Ratio RL", G_WHEELS, -1.0f, 1.0f, &FFBSnapshot::wheel_slip_ratio, 2),
+    W("wheel_slip_ratio_rr", "Slip Ratio RR", G_WHEELS, -1.0f, 1.0f, &FFBSnapshot::wheel_slip_ratio, 3),
+
+    C("ffb_rate", "FFB Loop (Hz)", G_SYSTEM, 0.0f, 500.0f, &FFBSnapshot::ffb_rate),
+    C("telemetry_rate", "Telemetry (Hz)", G_SYSTEM, 0.0f, 500.0f, &FFBSnapshot::telemetry_rate),
+    C("hw_rate", "Hardware (Hz)", G_SYSTEM, 0.0f, 500.0f, &FFBSnapshot::hw_rate),
+    C("torque_rate", "S.Torque (Hz)", G_SYSTEM, 0.0f, 500.0f, &FFBSnapshot::torque_rate),
+    C("gen_torque_rate", "G.Torque (Hz)", G_SYSTEM, 0.0f, 500.0f, &FFBSnapshot::gen_torque_rate),
+};
+
+constexpr int kChannelCount = (int)(sizeof(kChannels) / sizeof(kChannels[0]));
+
+// Titles end up inside the config.ini line; keep its separators out
+std::string SanitizeTitle(const std::string& title) {
+    std::string out;
+    for (char c : title) {
+        if (c != '|' && c != ';' && c != ',' && c != '\n' && c != '\r') out += c;
+    }
+    return out;
+}
+
+} // namespace
+
+int GetPlotChannelCount() { return kChannelCount; }
+
+const PlotChannel& GetPlotChannel(int index) { return kChannels[index]; }
+
+int FindPlotChannel(std::string_view key) {
+    for (int i = 0; i < kChannelCount; ++i) {
+        if (key == kChannels[i].key) return i;
+    }
+    return -1;
+}
+
+PlotPanel::PlotPanel(int id) : m_id(id), m_title("Plot Panel " + std::to_string(id)) {}
+
+void PlotPanel::SetTitle(const std::string& title) {
+    std::string clean = SanitizeTitle(title);
+    if (!clean.empty()) m_title = clean;
+}
+
+int PlotPanel::HistorySamples() const {
+    return (int)std::lround(m_history_s * SAMPLE_RATE_HZ);
+}
+
+bool PlotPanel::HasChannel(int channel) const {
+    return std::find(m_channels.begin(), m_channels.end(), channel) != m_channels.end();
+}
+
+void PlotPanel::SetChannel(int channel, bool enabled) {
+    if (channel < 0 || channel >= kChannelCount) return;
+    auto it = std::find(m_channels.begin(), m_channels.end(), channel);
+    if (enabled && it == m_channels.end()) {
+        m_channels.push_back(channel);
+        m_buffers.emplace_back(HistorySamples());
+        m_traces.emplace_back();
+    } else if (!enabled && it != m_channels.end()) {
+        size_t slot = (size_t)(it - m_channels.begin());
+        m_channels.erase(it);
+        m_buffers.erase(m_buffers.begin() + slot);
+        m_traces.erase(m_traces.begin() + slot);
+    }
+    m_dirty = true;
+}
+
+void PlotPanel::SetHistorySeconds(float seconds) {
+    float clamped = (std::max)(MIN_HISTORY_S, (std::min)(MAX_HISTORY_S, seconds));
+    if (clamped == m_history_s) return;
+    m_history_s = clamped;
+    for (auto& buf : m_buffers) buf.Resize(HistorySamples());
+    m_dirty = true;
+}
+
+void PlotPanel::SetRefreshHz(float hz) {
+    m_refresh_hz = (std::max)(MIN_REFRESH_HZ, (std::min)(MAX_REFRESH_HZ, hz));
+}
+
+std::chrono::milliseconds PlotPanel::GetRefreshInterval() const {
+    return std::chrono::milliseconds((long long)std::lround(1000.0 / m_refresh_hz));
+}
+
+void PlotPanel::Feed(const FFBSnapshot& snap) {
+    for (size_t i = 0; i < m_channels.size(); ++i) {
+        m_buffers[i].Add(kChannels[m_channels[i]].Read(snap));
+    }
+}
+
+void PlotPanel::AddGap(int64_t count) {
+    for (auto& buf : m_buffers) buf.AddGap(count);
+}
+
+bool PlotPanel::Refresh(int columns, std::chrono::steady_clock::time_point now) {
+    if (columns <= 0) return false;
+    if (!m_dirty && columns == m_columns && now - m_last_refresh < GetRefreshInterval()) return false;
+    for (size_t i = 0; i < m_channels.size(); ++i) {
+        Trace& tr = m_traces[i];
+        const PlotBuffer& buf = m_buffers[i];
+        tr.env_min.resize(columns);
+        tr.env_max.resize(columns);
+        buf.BuildEnvelope(columns, tr.env_min.data(), tr.env_max.data());
+        tr.current = buf.GetCurrent();
+        buf.GetRange(0, buf.GetCount(), tr.min_val, tr.max_val);
+    }
+    m_columns = columns;
+    m_last_refresh = now;
+    m_dirty = false;
+    return true;
+}
+
+PlotPanel& PlotPanelSet::Add() {
+    m_panels.emplace_back(m_next_id++);
+    return m_panels.back();
+}
+
+bool PlotPanelSet::RemoveClosed() {
+    size_t before = m_panels.size();
+    m_panels.erase(std::remove_if(m_panels.begin(), m_panels.end(), [](const PlotPanel& p) { return !p.open; }),
+                   m_panels.end());
+    return m_panels.size() != before;
+}
+
+void PlotPanelSet::Feed(const FFBSnapshotRing::View& batch) {
+    for (auto& panel : m_panels) {
+        if (panel.GetChannels().empty()) continue;
+        if (batch.GetDropped() > 0) panel.AddGap((int64_t)batch.GetDropped());
+        batch.ForEach([&panel](const FFBSnapshot& snap) { panel.Feed(snap); });
+    }
+}
+
+void PlotPanelSet::AddGap(int64_t count) {
+    for (auto& panel : m_panels) {
+        if (!panel.GetChannels().empty()) panel.AddGap(count);
+    }
+}
+
+std::chrono::milliseconds PlotPanelSet::GetRefreshInterval() const {
+    std::chrono::milliseconds fastest(0);
+    for (const auto& panel : m_panels) {
+        if (panel.GetChannels().empty()) continue;
+        auto interval = panel.GetRefreshInterval();
+        if (fastest.count() == 0 || interval < fastest) fastest = interval;
+    }
+    return fastest;
+}
+
+std::string PlotPanelSet::Serialize() const {
+    std::ostringstream out;
+    for (size_t p = 0; p < m_panels.size(); ++p) {
+        const PlotPanel& panel = m_panels[p];
+        if (p > 0) out << ';';
+        out << panel.GetTitle() << '|' << panel.GetHistorySeconds() << '|' << panel.GetRefreshHz() << '|'
+            << (panel.auto_scale ? 1 : 0) << '|';
+        const auto& channels = panel.GetChannels();
+        for (size_t i = 0; i < channels.size(); ++i) {
+            if (i > 0) out << ',';
+            out << kChannels[channels[i]].key;
+        }
+    }
+    return out.str();
+}
+
+void PlotPanelSet::Deserialize(const std::string& text) {
+    m_panels.clear();
+    std::istringstream panels(text);
+    std::string entry;
+    while (std::getline(panels, entry, ';')) {
+        std::vector<std::string> fields;
+        std::istringstream parts(entry);
+        std::string field;
+        while (std::getline(parts, field, '|')) fields.push_back(field);
+        if (fields.size() < 4) continue; // Channel list may be empty
+
+        PlotPanel& panel = Add();
+        panel.SetTitle(fields[0]);
+        try {
+            panel.SetHistorySeconds(std::stof(fields[1]));
+            panel.SetRefreshHz(std::stof(fields[2]));
+        } catch (...) {
+            std::cerr << "[PlotPanels] Invalid settings for panel '" << fields[0] << "', using defaults" << std::endl;
+        }
+        panel.auto_scale = (fields[3] == "1");
+        std::istringstream keys(fields.size() > 4 ? fields[4] : std::string());
+        std::string key;
+        while (std::getline(keys, key, ',')) {
+            int ch = FindPlotChannel(key);
+            if (ch >= 0) panel.SetChannel(ch, true); // Unknown keys: channel removed in a later version
+        }
+    }
+}
@@ -0,0 +1,120 @@
+#ifndef PLOTPANELS_H
+#define PLOTPANELS_H
+
+#include "FFBEngine.h"
+#include "PlotBuffer.h"
+#include <chrono>
+#include <string>
+#include <string_view>
+#include <vector>
+
+// Plot Panels (v0.7.112)
+// User-built graph windows next to the fixed "FFB Analysis" view. Each panel picks
+// its channels from the FFBSnapshot channel table below and only those are buffered,
+// with the panel's own history length. Traces (min/max envelope per pixel column
+// plus current/min/max) are rebuilt at the panel's refresh rate and drawn from that
+// cache in between, so a slow focused panel costs almost nothing per frame.
+
+struct PlotChannel {
+    const char* key;    // Stable id, stored in config.ini
+    const char* label;
+    const char* group;
+    float scale_min;
+    float scale_max;
+    float FFBSnapshot::* field;             // Scalar channel, or
+    float (FFBSnapshot::* wheel_field)[4];  // per-wheel channel at index `wheel`
+    int wheel;
+
+    float Read(const FFBSnapshot& snap) const { return field ? snap.*field : (snap.*wheel_field)[wheel]; }
+};
+
+int GetPlotChannelCount();
+const PlotChannel& GetPlotChannel(int index);
+int FindPlotChannel(std::string_view key); // -1 if unknown
+
+class PlotPanel {
+public:
+    static constexpr int SAMPLE_RATE_HZ = 400;    // One snapshot per FFB tick
+    static constexpr float MIN_HISTORY_S = 1.0f;
+    static constexpr float MAX_HISTORY_S = 60.0f;
+    static constexpr float DEFAULT_HISTORY_S = 10.0f;
+    static constexpr float MIN_REFRESH_HZ = 1.0f;
+    static constexpr float MAX_REFRESH_HZ = 60.0f;
+    static constexpr float DEFAULT_REFRESH_HZ = 30.0f;
+
+    struct Trace {
+        std::vector<float> env_min;
+        std::vector<float> env_max;
+        float current = 0.0f;
+        float min_val = 0.0f;
+        float max_val = 0.0f;
+    };
+
+    explicit PlotPanel(int id);
+
+    int GetId() const { return m_id; }
+    const std::string& GetTitle() const { return m_title; }
+    void SetTitle(const std::string& title);
+
+    const std::vector<int>& GetChannels() const { return m_channels; }
+    bool HasChannel(int channel) const;
+    void SetChannel(int channel, bool enabled);
+
+    float GetHistorySeconds() const { return m_history_s; }
+    void SetHistorySeconds(float seconds); // Clears the history
+    float GetRefreshHz() const { return m_refresh_hz; }
+    void SetRefreshHz(float hz);
+    std::chrono::milliseconds GetRefreshInterval() const;
+
+    bool auto_scale = false;
+    bool open = true;
+
+    void Feed(const FFBSnapshot& snap);
+    // Marks `count` lost snapshots, drawn as a break
+    void AddGap(int64_t count);
+
+    // Rebuilds the traces for `columns` pixel columns if the refresh interval has passed
+    // or the width changed. Returns true if they were rebuilt.
+    bool Refresh(int columns, std::chrono::steady_clock::time_point now);
+    const Trace& GetTrace(int slot) const { return m_traces[slot]; } // Slot = index in GetChannels()
+    int GetColumns() const { return m_columns; }
+
+private:
+    int HistorySamples() const;
+
+    int m_id;
+    std::string m_title;
+    std::vector<int> m_channels;
+    std::vector<PlotBuffer> m_buffers;   // Parallel to m_channels
+    std::vector<Trace> m_traces;         // Parallel to m_channels
+    float m_history_s = DEFAULT_HISTORY_S;
+    float m_refresh_hz = DEFAULT_REFRESH_HZ;
+    int m_columns = 0;
+    bool m_dirty = true;
+    std::chrono::steady_clock::time_point m_last_refresh;
+};
+
+class PlotPanelSet {
+public:
+    PlotPanel& Add();
+    // Drops panels the user closed. Returns true if any were removed.
+    bool RemoveClosed();
+    std::vector<PlotPanel>& GetPanels() { return m_panels; }
+    const std::vector<PlotPanel>& GetPanels() const { return m_panels; }
+
+    void Feed(const FFBSnapshotRing::View& batch);
+    // Marks `count` snapshots that were plotted but turned out torn, drawn as a break
+    void AddGap(int64_t count);
+    // Fastest refresh interval among the panels, 0 when there are none
+    std::chrono::milliseconds GetRefreshInterval() const;
+
+    // One line for config.ini: title|history_s|refresh_hz|auto_scale|key,key;...
+    std::string Serialize() const;
+    void Deserialize(const std::string& text);
+
+private:
+    std::vector<PlotPanel> m_panels;
+    int m_next_id = 1;
+};
+
+#endif // PLOTPANELS_H
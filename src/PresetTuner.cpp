@@ -0,0 +1,203 @@
+#include "PresetTuner.h"
+#include "FFBEngine.h"
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdlib>
+#include <random>
+#include <thread>
+
+namespace {
+
+// Score weights: clipping is penalized hardest, then headroom, then smoothness and lag.
+constexpr double W_CLIPPING = 10.0;
+constexpr double W_SATURATION = 2.0;
+constexpr double W_HF_ENERGY = 50.0;
+constexpr double W_LATENCY_PER_MS = 0.02;
+constexpr double W_RMS_ERROR = 2.0;
+
+constexpr double CLIP_LEVEL = 0.99;
+constexpr double SATURATION_LEVEL = 0.90;
+
+// Lag (in frames) maximizing |correlation| between output and reference.
+// Absolute correlation makes the measure independent of the invert setting.
+int FindLagFrames(const std::vector<double>& out, const std::vector<double>& ref, int max_lag) {
+    const int n = (int)out.size();
+    if (n < 2) return 0;
+    double best = -1.0;
+    int best_lag = 0;
+    for (int lag = 0; lag <= max_lag && lag < n - 1; ++lag) {
+        double sum = 0.0, so = 0.0, sr = 0.0;
+        for (int i = lag; i < n; ++i) {
+            sum += out[i] * ref[i - lag];
+            so += out[i] * out[i];
+            sr += ref[i - lag] * ref[i - lag];
+        }
+        if (so <= 0.0 || sr <= 0.0) continue;
+        double corr = std::abs(sum) / std::sqrt(so * sr);
+        if (corr > best + 1e-9) {
+            best = corr;
+            best_lag = lag;
+        }
+    }
+    return best_lag;
+}
+
+} // namespace
+
+namespace PresetTuner {
+
+bool SetField(Preset& p, const std::string& key, float value) {
+    return FieldRegistry::SetPresetFloat(p, key, value);
+}
+
+const std::vector<std::string>& TunableKeys() {
+    static const std::vector<std::string> keys = FieldRegistry::PresetFloatKeys();
+    return keys;
+}
+
+bool ParseParam(const std::string& text, TunerParam& out) {
+    size_t eq = text.find('=');
+    if (eq == std::string::npos || eq == 0) return false;
+    out.key = text.substr(0, eq);
+    Preset probe;
+    if (!SetField(probe, out.key, 0.0f)) return false;
+
+    std::string range = text.substr(eq + 1);
+    const char* p = range.c_str();
+    char* end = nullptr;
+    out.min_val = std::strtof(p, &end);
+    if (end == p || *end != ':') return false;
+    p = end + 1;
+    out.max_val = std::strtof(p, &end);
+    if (end == p) return false;
+    out.steps = 5;
+    if (*end == ':') {
+        p = end + 1;
+        long steps = std::strtol(p, &end, 10);
+        if (end == p || steps < 1) return false;
+        out.steps = (int)steps;
+    }
+    if (*end != '\0') return false;
+    if (out.max_val < out.min_val) std::swap(out.min_val, out.max_val);
+    return true;
+}
+
+std::vector<TunerCandidate> BuildGrid(const Preset& base, const std::vector<TunerParam>& params) {
+    std::vector<TunerCandidate> result;
+    TunerCandidate seed;
+    seed.preset = base;
+    result.push_back(seed);
+
+    for (const auto& param : params) {
+        std::vector<TunerCandidate> next;
+        next.reserve(result.size() * (size_t)param.steps);
+        for (const auto& c : result) {
+            for (int s = 0; s < param.steps; ++s) {
+                float t = (param.steps > 1) ? (float)s / (float)(param.steps - 1) : 0.0f;
+                float v = param.min_val + t * (param.max_val - param.min_val);
+                TunerCandidate n = c;
+                SetField(n.preset, param.key, v);
+                n.values.emplace_back(param.key, v);
+                next.push_back(std::move(n));
+            }
+        }
+        result.swap(next);
+    }
+    return result;
+}
+
+std::vector<TunerCandidate> BuildRandom(const Preset& base, const std::vector<TunerParam>& params, int count, unsigned int seed) {
+    std::vector<TunerCandidate> result;
+    std::mt19937 rng(seed);
+    for (int i = 0; i < count; ++i) {
+        TunerCandidate c;
+        c.preset = base;
+        for (const auto& param : params) {
+            std::uniform_real_distribution<float> dist(param.min_val, param.max_val);
+            float v = (param.max_val > param.min_val) ? dist(rng) : param.min_val;
+            SetField(c.preset, param.key, v);
+            c.values.emplace_back(param.key, v);
+        }
+        result.push_back(std::move(c));
+    }
+    return result;
+}
+
+TunerMetrics Evaluate(const Preset& preset, const ReplayCapture& capture, const char* vehicle_class) {
+    TunerMetrics m;
+    const size_t n = capture.frames.size();
+    if (n == 0) return m;
+
+    FFBEngine engine;
+    engine.m_isolated = true;
+    preset.Apply(engine);
+
+    std::vector<double> out(n), ref(n);
+    double dt_sum = 0.0;
+    size_t clipped = 0, saturated = 0;
+    double hf_sum = 0.0, sq_sum = 0.0;
+    // No class given: seed from the vehicle name alone, never pass the name as the class
+    const char* vclass = vehicle_class ? vehicle_class : "";
+
+    for (size_t i = 0; i < n; ++i) {
+        const TelemInfoV01& f = capture.frames[i];
+        float gen = (i < capture.gen_torque.size()) ? capture.gen_torque[i] : 0.0f;
+        double y = engine.calculate_force(&f, vclass, capture.vehicle_name.c_str(), gen, true);
+        out[i] = y;
+        ref[i] = (engine.m_torque_source == 1) ? (double)gen : f.mSteeringShaftTorque;
+        dt_sum += f.mDeltaTime;
+
+        double a = std::abs(y);
+        if (a > CLIP_LEVEL) clipped++;
+        if (a > SATURATION_LEVEL) saturated++;
+        sq_sum += y * y;
+        if (i > 0) {
+            double d = y - out[i - 1];
+            hf_sum += d * d;
+        }
+    }
+
+    double mean_dt = dt_sum / (double)n;
+    int max_lag = (mean_dt > 0.0) ? (int)(MAX_LATENCY_S / mean_dt) : 0;
+
+    m.clipping_ratio = (double)clipped / (double)n;
+    m.saturation_ratio = (double)saturated / (double)n;
+    m.hf_energy = (n > 1) ? hf_sum / (double)(n - 1) : 0.0;
+    m.latency_ms = FindLagFrames(out, ref, max_lag) * mean_dt * 1000.0;
+    m.output_rms = std::sqrt(sq_sum / (double)n);
+    m.score = W_CLIPPING * m.clipping_ratio
+            + W_SATURATION * m.saturation_ratio
+            + W_HF_ENERGY * m.hf_energy
+            + W_LATENCY_PER_MS * m.latency_ms
+            + W_RMS_ERROR * std::abs(m.output_rms - TARGET_OUTPUT_RMS);
+    return m;
+}
+
+void Run(std::vector<TunerCandidate>& candidates, const ReplayCapture& capture,
+         unsigned int thread_count, const char* vehicle_class) {
+    if (thread_count == 0) thread_count = std::thread::hardware_concurrency();
+    if (thread_count == 0) thread_count = 1;
+    thread_count = (std::min)(thread_count, (unsigned int)(std::max)((size_t)1, candidates.size()));
+
+    // Each candidate owns its engine, so workers share nothing but the read-only capture.
+    std::atomic<size_t> next{0};
+    auto worker = [&]() {
+        for (;;) {
+            size_t i = next.fetch_add(1, std::memory_order_relaxed);
+            if (i >= candidates.size()) break;
+            candidates[i].metrics = Evaluate(candidates[i].preset, capture, vehicle_class);
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned int t = 1; t < thread_count; ++t) threads.emplace_back(worker);
+    worker();
+    for (auto& t : threads) t.join();
+
+    std::stable_sort(candidates.begin(), candidates.end(), [](const TunerCandidate& a, const TunerCandidate& b) {
+        return a.metrics.score < b.metrics.score;
+    });
+}
+
+} // namespace PresetTuner
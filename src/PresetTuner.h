@@ -0,0 +1,67 @@
+#ifndef PRESETTUNER_H
+#define PRESETTUNER_H
+
+#include <string>
+#include <vector>
+#include <utility>
+#include "Config.h"
+#include "TelemetryReplay.h"
+
+/**
+ * @brief Parameter range for a preset sweep ("key=min:max:steps" on the command line).
+ * Keys are the INI names used by Config (e.g. "gain", "understeer", "sop").
+ */
+struct TunerParam {
+    std::string key;
+    float min_val = 0.0f;
+    float max_val = 0.0f;
+    int steps = 1;
+};
+
+/**
+ * @brief Quality metrics of one preset over a replayed capture. Lower score is better.
+ */
+struct TunerMetrics {
+    double clipping_ratio = 0.0;   // Frames with |output| > 0.99
+    double saturation_ratio = 0.0; // Frames with |output| > 0.90 (no headroom for detail)
+    double hf_energy = 0.0;        // Mean squared frame-to-frame output change
+    double latency_ms = 0.0;       // Lag of output behind raw shaft torque (cross-correlation peak)
+    double output_rms = 0.0;
+    double score = 0.0;
+};
+
+struct TunerCandidate {
+    Preset preset;
+    std::vector<std::pair<std::string, float>> values; // Swept parameters only
+    TunerMetrics metrics;
+};
+
+namespace PresetTuner {
+
+    // Target RMS of the normalized output. Presets far below feel weak, far above clip.
+    static constexpr double TARGET_OUTPUT_RMS = 0.45;
+    static constexpr double MAX_LATENCY_S = 0.2;
+
+    // Sets a tunable float field by INI key. Returns false for unknown keys.
+    bool SetField(Preset& p, const std::string& key, float value);
+    const std::vector<std::string>& TunableKeys();
+
+    // Parses "key=min:max:steps" (steps defaults to 5). Returns false on malformed input.
+    bool ParseParam(const std::string& text, TunerParam& out);
+
+    // Full cartesian grid over all params, starting from base.
+    std::vector<TunerCandidate> BuildGrid(const Preset& base, const std::vector<TunerParam>& params);
+    // Uniform random samples inside the param ranges (deterministic for a given seed).
+    std::vector<TunerCandidate> BuildRandom(const Preset& base, const std::vector<TunerParam>& params, int count, unsigned int seed);
+
+    // Replays the capture through a fresh isolated engine and scores the output.
+    // Without vehicle_class the car is classified from the capture's vehicle name only.
+    TunerMetrics Evaluate(const Preset& preset, const ReplayCapture& capture, const char* vehicle_class = nullptr);
+
+    // Evaluates all candidates on thread_count threads (0 = all cores) and sorts them by score.
+    void Run(std::vector<TunerCandidate>& candidates, const ReplayCapture& capture,
+             unsigned int thread_count = 0, const char* vehicle_class = nullptr);
+
+} // namespace PresetTuner
+
+#endif // PRESETTUNER_H
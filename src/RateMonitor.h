@@ -3,9 +3,14 @@
 
 #include <chrono>
 #include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
 
 /**
  * @brief Simple utility to monitor event frequency (Hz) over a 1-second sliding window.
+ * The rate is recomputed once per second; m_startTime is only touched by the writer.
  */
 class RateMonitor {
 public:
@@ -49,4 +54,141 @@ private:
     std::atomic<long> m_lastRateScaled; // Rate multiplied by 100 for atomic storage
 };
 
+/**
+ * @brief Interval statistics of an IntervalRateMonitor window (v0.7.112).
+ */
+struct RateStats {
+    double rate_hz = 0.0;      // Intervals in the window / their span
+    double instant_hz = 0.0;   // From the latest interval
+    double mean_ms = 0.0;
+    double stddev_ms = 0.0;
+    double min_ms = 0.0;
+    double max_ms = 0.0;
+    size_t intervals = 0;      // Intervals ending inside the window
+    size_t missed = 0;         // Of those, longer than the deadline
+    uint64_t missed_total = 0; // Since construction
+    uint64_t events = 0;
+};
+
+/**
+ * @brief Exact sliding-window rate and jitter monitor (v0.7.112).
+ *
+ * Keeps the timestamps of the last RING_SIZE events instead of a counter, so the rate
+ * is exact over the last window_ms at any moment (no 1 s batching, no 0.01 Hz
+ * quantization) and comes with the interval spread and missed deadlines.
+ * When events stop, the open gap counts once it is longer than any interval in the
+ * window, so the rate decays to 0 instead of holding its last value.
+ *
+ * One writer (RecordEvent), any number of readers: slots are atomics published by the
+ * event counter, and a reader retries if the writer lapped the slots it was reading.
+ * Windows longer than RING_SIZE - READ_MARGIN events are truncated to that many.
+ */
+class IntervalRateMonitor {
+public:
+    static constexpr size_t RING_SIZE = 512;   // Power of two
+    static constexpr size_t READ_MARGIN = 64;  // Slots a reader leaves to the writer
+
+    explicit IntervalRateMonitor(double deadline_ms = 0.0, double window_ms = 1000.0)
+        : m_window_ns((int64_t)(window_ms * 1e6)) {
+        SetDeadline(deadline_ms);
+        for (auto& t : m_times) t.store(0, std::memory_order_relaxed);
+    }
+
+    // Intervals longer than this count as missed (0 = no deadline)
+    void SetDeadline(double deadline_ms) {
+        m_deadline_ns.store((int64_t)(deadline_ms * 1e6), std::memory_order_relaxed);
+    }
+
+    void RecordEvent() {
+        RecordEventAt(std::chrono::steady_clock::now());
+    }
+
+    void RecordEventAt(std::chrono::steady_clock::time_point now) {
+        int64_t t = ToNs(now);
+        uint64_t n = m_events.load(std::memory_order_relaxed);
+        if (n > 0) {
+            int64_t deadline = m_deadline_ns.load(std::memory_order_relaxed);
+            int64_t prev = m_times[(n - 1) & (RING_SIZE - 1)].load(std::memory_order_relaxed);
+            if (deadline > 0 && t - prev > deadline) {
+                m_missed.store(m_missed.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+            }
+        }
+        m_times[n & (RING_SIZE - 1)].store(t, std::memory_order_relaxed);
+        m_events.store(n + 1, std::memory_order_release);
+    }
+
+    RateStats GetStats() const {
+        return GetStatsAt(std::chrono::steady_clock::now());
+    }
+
+    RateStats GetStatsAt(std::chrono::steady_clock::time_point now) const {
+        RateStats s;
+        int64_t t_now = ToNs(now);
+        int64_t times[RING_SIZE];
+        size_t k = 0;
+        uint64_t n = 0;
+        for (int attempt = 0; attempt < 4; ++attempt) {
+            n = m_events.load(std::memory_order_acquire);
+            size_t avail = (size_t)std::min<uint64_t>(n, RING_SIZE - READ_MARGIN);
+            // Newest first, down to the first event at or before the window start
+            k = 0;
+            while (k < avail) {
+                int64_t t = m_times[(n - 1 - k) & (RING_SIZE - 1)].load(std::memory_order_relaxed);
+                times[k++] = t;
+                if (t_now - t >= m_window_ns) break;
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if (m_events.load(std::memory_order_relaxed) - n <= READ_MARGIN) break;
+        }
+        s.events = n;
+        s.missed_total = m_missed.load(std::memory_order_relaxed);
+        if (k < 2 || t_now - times[0] >= m_window_ns) return s;
+
+        int64_t deadline = m_deadline_ns.load(std::memory_order_relaxed);
+        size_t m = k - 1;
+        double sum = 0.0, min_ns = 1e300, max_ns = 0.0;
+        for (size_t i = 0; i < m; ++i) {
+            int64_t d = times[i] - times[i + 1];
+            sum += (double)d;
+            min_ns = std::min(min_ns, (double)d);
+            max_ns = std::max(max_ns, (double)d);
+            if (deadline > 0 && d > deadline) s.missed++;
+        }
+        double mean = sum / (double)m;
+        double var = 0.0;
+        for (size_t i = 0; i < m; ++i) {
+            double d = (double)(times[i] - times[i + 1]) - mean;
+            var += d * d;
+        }
+
+        double open = (double)(t_now - times[0]);
+        double span = sum + ((open > max_ns) ? open : 0.0);
+        s.intervals = m;
+        s.rate_hz = (span > 0.0) ? (double)m * 1e9 / span : 0.0;
+        double latest = (double)(times[0] - times[1]);
+        s.instant_hz = (latest > 0.0) ? 1e9 / latest : 0.0;
+        s.mean_ms = mean * 1e-6;
+        s.stddev_ms = std::sqrt(var / (double)m) * 1e-6;
+        s.min_ms = min_ns * 1e-6;
+        s.max_ms = max_ns * 1e-6;
+        return s;
+    }
+
+    // Drop-in for RateMonitor::GetRate()
+    double GetRate() const {
+        return GetStats().rate_hz;
+    }
+
+private:
+    static int64_t ToNs(std::chrono::steady_clock::time_point t) {
+        return std::chrono::duration_cast<std::chrono::nanoseconds>(t.time_since_epoch()).count();
+    }
+
+    std::atomic<int64_t> m_times[RING_SIZE];
+    std::atomic<uint64_t> m_events{0};
+    std::atomic<uint64_t> m_missed{0};
+    std::atomic<int64_t> m_deadline_ns{0};
+    const int64_t m_window_ns;
+};
+
 #endif // RATEMONITOR_H
@@ -0,0 +1,110 @@
+#ifndef RENDERSCHEDULER_H
+#define RENDERSCHEDULER_H
+
+#include <chrono>
+#include <cstdint>
+
+/**
+ * @brief Decides when the GUI actually redraws (v0.7.112).
+ *
+ * The main loop keeps pumping window messages every PUMP_INTERVAL (DirectInput needs
+ * the message loop serviced), but a frame is only built and presented when something
+ * visible can have changed:
+ *  - recent user input (mouse, keyboard, resize, focus) or an active ImGui widget: full rate
+ *  - live telemetry with the graphs open: full rate, the plots scroll (or the plot
+ *    panels' own refresh rate when only those are open)
+ *  - live telemetry with only the tuning window: LIVE_INTERVAL for the readouts
+ *  - nothing changing: IDLE_INTERVAL (connection status, clocks)
+ *  - minimized or occluded: no frames at all; the first visible pump redraws at once
+ *
+ * The GUI runs next to the sim on the same CPU and GPU, so every skipped frame is
+ * headroom handed back to the game.
+ */
+class RenderScheduler {
+public:
+    using Clock = std::chrono::steady_clock;
+
+    enum class WindowState { Visible, Occluded, Minimized };
+
+    static constexpr std::chrono::milliseconds PUMP_INTERVAL{16};    // Message loop, ~60 Hz
+    static constexpr std::chrono::milliseconds ACTIVE_INTERVAL{16};  // Input or live graphs
+    static constexpr std::chrono::milliseconds LIVE_INTERVAL{50};    // Live readouts, 20 Hz
+    static constexpr std::chrono::milliseconds IDLE_INTERVAL{500};   // Nothing changing
+    static constexpr std::chrono::milliseconds INPUT_HOLD{500};      // Full rate after input (hover, animations)
+    static constexpr std::chrono::milliseconds DUE_SLACK{2};         // Pump jitter allowance
+
+    /**
+     * @brief Record user input or any window event that needs an immediate redraw.
+     */
+    void NotifyInput() { NotifyInputAt(Clock::now()); }
+    void NotifyInputAt(Clock::time_point now) {
+        m_last_input = now;
+        m_has_input = true;
+    }
+
+    /**
+     * @brief Called once per pump. Returns true if a frame should be drawn now.
+     * @param data_changed The engine produced new frames since the last check.
+     * @param graphs_visible The debug window or a plot panel is open.
+     * @param graphs_interval Refresh interval the open plots ask for.
+     */
+    bool ShouldDraw(WindowState state, bool data_changed, bool graphs_visible,
+                    std::chrono::milliseconds graphs_interval = ACTIVE_INTERVAL) {
+        return ShouldDrawAt(Clock::now(), state, data_changed, graphs_visible, graphs_interval);
+    }
+    bool ShouldDrawAt(Clock::time_point now, WindowState state, bool data_changed, bool graphs_visible,
+                      std::chrono::milliseconds graphs_interval = ACTIVE_INTERVAL) {
+        if (state != WindowState::Visible) {
+            m_hidden = true;
+            m_frames_skipped++;
+            return false;
+        }
+
+        m_interval = TargetInterval(now, data_changed, graphs_visible, graphs_interval);
+        bool due = m_hidden || !m_has_drawn || (now - m_last_draw) >= (m_interval - DUE_SLACK);
+        if (!due) {
+            m_frames_skipped++;
+            return false;
+        }
+        m_hidden = false;
+        m_has_drawn = true;
+        m_last_draw = now;
+        m_frames_drawn++;
+        return true;
+    }
+
+    /**
+     * @brief How long the main loop may block waiting for events (never above PUMP_INTERVAL).
+     */
+    std::chrono::milliseconds GetWaitTime() const { return GetWaitTimeAt(Clock::now()); }
+    std::chrono::milliseconds GetWaitTimeAt(Clock::time_point now) const {
+        if (m_hidden || !m_has_drawn) return PUMP_INTERVAL;
+        auto next = std::chrono::duration_cast<std::chrono::milliseconds>(m_last_draw + m_interval - now);
+        if (next < std::chrono::milliseconds(0)) return std::chrono::milliseconds(0);
+        return (next < PUMP_INTERVAL) ? next : PUMP_INTERVAL;
+    }
+
+    std::chrono::milliseconds GetInterval() const { return m_interval; }
+    uint64_t GetFramesDrawn() const { return m_frames_drawn; }
+    uint64_t GetFramesSkipped() const { return m_frames_skipped; }
+
+private:
+    std::chrono::milliseconds TargetInterval(Clock::time_point now, bool data_changed, bool graphs_visible,
+                                             std::chrono::milliseconds graphs_interval) const {
+        if (m_has_input && (now - m_last_input) < INPUT_HOLD) return ACTIVE_INTERVAL;
+        if (!data_changed) return IDLE_INTERVAL;
+        if (!graphs_visible || graphs_interval >= LIVE_INTERVAL) return LIVE_INTERVAL;
+        return (graphs_interval > ACTIVE_INTERVAL) ? graphs_interval : ACTIVE_INTERVAL;
+    }
+
+    Clock::time_point m_last_input;
+    Clock::time_point m_last_draw;
+    bool m_has_input = false;
+    bool m_has_drawn = false;
+    bool m_hidden = false;
+    std::chrono::milliseconds m_interval{IDLE_INTERVAL};
+    uint64_t m_frames_drawn = 0;
+    uint64_t m_frames_skipped = 0;
+};
+
+#endif // RENDERSCHEDULER_H
@@ -0,0 +1,143 @@
+#include "SlipPeakEstimator.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+constexpr double BIN_WIDTH = SlipPeakEstimator::MAX_SLIP_RAD / SlipPeakEstimator::SLIP_BINS;
+constexpr double SLIP_SCALE = 0.1;       // Fit in s = slip / 0.1 so the regressors stay O(1)
+constexpr double P_INIT = 100.0;
+constexpr double P_TRACE_MAX = 1.0e4;    // Covariance windup guard without excitation
+constexpr double FIT_WINDOW_LO = 0.7;    // Fit samples within [0.7, 1.4] x rough peak:
+constexpr double FIT_WINDOW_HI = 1.4;    // wider windows bias the vertex high (flat post-peak)
+constexpr double PAST_PEAK_MARGIN = 1.1; // Must have seen slip 10% beyond the vertex
+constexpr uint32_t MAX_BIN_AVERAGE = 256;
+constexpr double MAX_MU = 5.0;
+
+} // namespace
+
+void SlipPeakEstimator::Reset() {
+    for (auto& b : m_buckets) ResetBucket(b);
+    m_seed = 0.0;
+}
+
+void SlipPeakEstimator::ResetBucket(Bucket& b) {
+    for (auto& bin : b.bins) bin = { 0.0f, 0 };
+    for (int i = 0; i < 3; ++i) {
+        b.theta[i] = 0.0;
+        for (int j = 0; j < 3; ++j) b.P[i][j] = (i == j) ? P_INIT : 0.0;
+    }
+    b.samples = 0;
+    b.peak = 0.0;
+    b.fitted = false;
+}
+
+void SlipPeakEstimator::Seed(double slip_angle) {
+    if (std::isfinite(slip_angle) && slip_angle >= MIN_PEAK_RAD && slip_angle <= MAX_PEAK_RAD) m_seed = slip_angle;
+}
+
+int SlipPeakEstimator::LoadBucket(double tire_load) {
+    int i = (int)(tire_load / LOAD_BUCKET_N);
+    return (std::max)(0, (std::min)(LOAD_BUCKETS - 1, i));
+}
+
+void SlipPeakEstimator::Update(double slip_angle, double lateral_force, double tire_load, double speed) {
+    if (!std::isfinite(slip_angle) || !std::isfinite(lateral_force) || !std::isfinite(tire_load)) return;
+    if (speed < MIN_SPEED_MS || tire_load < MIN_LOAD_N) return;
+    double a = std::abs(slip_angle);
+    if (a < MIN_SLIP_RAD || a >= MAX_SLIP_RAD) return;
+    double fy = std::abs(lateral_force);
+    if (fy < 1.0) return; // Encrypted cars report 0
+    double mu = fy / tire_load;
+    if (mu > MAX_MU) return;
+
+    Bucket& b = m_buckets[LoadBucket(tire_load)];
+
+    // 1. Histogram (running mean, EMA once the bin is full)
+    Bin& h = b.bins[(std::min)(SLIP_BINS - 1, (int)(a / BIN_WIDTH))];
+    if (h.count < MAX_BIN_AVERAGE) h.count++;
+    h.mu += (float)((mu - h.mu) / (double)h.count);
+
+    // 2. Rough peak and the furthest slip seen
+    int best = -1;
+    int last_observed = -1;
+    for (int i = 0; i < SLIP_BINS; ++i) {
+        if (b.bins[i].count < MIN_BIN_SAMPLES) continue;
+        last_observed = i;
+        if (best < 0 || b.bins[i].mu > b.bins[best].mu) best = i;
+    }
+    if (best < 0) return;
+    double rough = (best + 0.5) * BIN_WIDTH;
+
+    // 3. Local parabola fit around the rough peak
+    if (a < FIT_WINDOW_LO * rough || a > FIT_WINDOW_HI * rough) return;
+    Fit(b, a / SLIP_SCALE, mu);
+
+    // 4. Vertex, only once the curve has been explored past it
+    if (b.samples < MIN_FIT_SAMPLES || b.theta[2] >= 0.0) return;
+    double peak = -b.theta[1] / (2.0 * b.theta[2]) * SLIP_SCALE;
+    double max_seen = (last_observed + 1) * BIN_WIDTH;
+    if (peak >= MIN_PEAK_RAD && peak <= MAX_PEAK_RAD && max_seen > peak * PAST_PEAK_MARGIN) {
+        b.peak = peak;
+        b.fitted = true;
+    }
+}
+
+void SlipPeakEstimator::Fit(Bucket& b, double s, double mu) {
+    // Recursive least squares with forgetting factor
+    const double x[3] = { 1.0, s, s * s };
+    double Px[3];
+    for (int i = 0; i < 3; ++i) Px[i] = b.P[i][0] * x[0] + b.P[i][1] * x[1] + b.P[i][2] * x[2];
+    double denom = FORGETTING + x[0] * Px[0] + x[1] * Px[1] + x[2] * Px[2];
+    double err = mu - (b.theta[0] * x[0] + b.theta[1] * x[1] + b.theta[2] * x[2]);
+
+    double K[3];
+    for (int i = 0; i < 3; ++i) {
+        K[i] = Px[i] / denom;
+        b.theta[i] += K[i] * err;
+    }
+    double trace = 0.0;
+    for (int i = 0; i < 3; ++i) {
+        for (int j = 0; j < 3; ++j) b.P[i][j] -= K[i] * Px[j];
+        trace += b.P[i][i];
+    }
+    if (trace < P_TRACE_MAX) {
+        for (auto& row : b.P) for (double& p : row) p /= FORGETTING;
+    }
+    b.samples++;
+}
+
+bool SlipPeakEstimator::GetPeak(double tire_load, double& slip_angle) const {
+    // Own bucket first, then the nearest fitted neighbour
+    int home = LoadBucket(tire_load);
+    for (int d = 0; d < LOAD_BUCKETS; ++d) {
+        for (int i : { home - d, home + d }) {
+            if (i < 0 || i >= LOAD_BUCKETS || !m_buckets[i].fitted) continue;
+            slip_angle = m_buckets[i].peak;
+            return true;
+        }
+    }
+    if (m_seed > 0.0) {
+        slip_angle = m_seed;
+        return true;
+    }
+    return false;
+}
+
+bool SlipPeakEstimator::GetLearnedPeak(double& slip_angle) const {
+    double sum = 0.0, weight = 0.0;
+    for (const auto& b : m_buckets) {
+        if (!b.fitted) continue;
+        sum += b.peak * b.samples;
+        weight += b.samples;
+    }
+    if (weight <= 0.0) return false;
+    slip_angle = sum / weight;
+    return true;
+}
+
+uint32_t SlipPeakEstimator::GetSampleCount() const {
+    uint32_t n = 0;
+    for (const auto& b : m_buckets) n += b.samples;
+    return n;
+}
@@ -0,0 +1,70 @@
+#ifndef SLIPPEAKESTIMATOR_H
+#define SLIPPEAKESTIMATOR_H
+
+#include <cstdint>
+
+// Slip Peak Estimator (v0.7.112)
+// Learns where the lateral force of the front tyres peaks over slip angle, per car,
+// from streaming telemetry (mLateralForce / mTireLoad vs atan2(mLateralPatchVel, v)).
+//
+// Per load bucket it keeps a bounded histogram of normalized lateral force (mu) over
+// slip angle and a 3-parameter recursive least squares fit mu = c0 + c1*s + c2*s^2
+// with exponential forgetting. The histogram locates the rough peak and gates which
+// samples feed the fit (a window around the peak, where a parabola is a good local
+// model); the fitted vertex -c1 / (2*c2) is the estimate. A bucket only reports a peak
+// once the driver has actually been past it (no extrapolation).
+//
+// Every Update is O(SLIP_BINS) with no allocation, so it can run on each FFB tick.
+class SlipPeakEstimator {
+public:
+    static constexpr int LOAD_BUCKETS = 4;
+    static constexpr double LOAD_BUCKET_N = 2500.0;   // 0-2.5k, 2.5-5k, 5-7.5k, 7.5k+ N
+    static constexpr int SLIP_BINS = 24;
+    static constexpr double MAX_SLIP_RAD = 0.24;      // Histogram range
+    static constexpr double MIN_SLIP_RAD = 0.005;     // Ignore straight-line noise
+    static constexpr double MIN_LOAD_N = 500.0;
+    static constexpr double MIN_SPEED_MS = 10.0;
+    static constexpr double FORGETTING = 0.9995;      // ~2000 samples (5 s at 400 Hz) of memory
+    static constexpr uint32_t MIN_FIT_SAMPLES = 400;  // Per bucket before a peak is reported
+    static constexpr uint32_t MIN_BIN_SAMPLES = 8;    // Bin counts as observed
+    static constexpr double MIN_PEAK_RAD = 0.02;
+    static constexpr double MAX_PEAK_RAD = 0.20;
+
+    SlipPeakEstimator() { Reset(); }
+
+    void Reset();
+    // Prior (e.g. from the vehicle profile), reported until a bucket has its own fit
+    void Seed(double slip_angle);
+
+    // One tyre sample. slip_angle in rad (sign ignored), forces in N, speed in m/s.
+    void Update(double slip_angle, double lateral_force, double tire_load, double speed);
+
+    // Peak for the given load; falls back to the other buckets, then to the seed.
+    bool GetPeak(double tire_load, double& slip_angle) const;
+    // Sample-weighted peak over all fitted buckets (what gets persisted). Seed excluded.
+    bool GetLearnedPeak(double& slip_angle) const;
+    uint32_t GetSampleCount() const;
+
+private:
+    struct Bin {
+        float mu;
+        uint32_t count;
+    };
+    struct Bucket {
+        Bin bins[SLIP_BINS];
+        double theta[3];
+        double P[3][3];
+        uint32_t samples;    // Fed to the fit
+        double peak;         // rad, valid when fitted
+        bool fitted;
+    };
+
+    static int LoadBucket(double tire_load);
+    void ResetBucket(Bucket& b);
+    void Fit(Bucket& b, double s, double mu);
+
+    Bucket m_buckets[LOAD_BUCKETS];
+    double m_seed = 0.0;
+};
+
+#endif // SLIPPEAKESTIMATOR_H
@@ -0,0 +1,185 @@
+#ifndef SNAPSHOTRING_H
+#define SNAPSHOTRING_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Persistent single-writer ring that readers consume in place (v0.7.112).
+ *
+ * The FFB thread writes each snapshot straight into the next slot and publishes it by
+ * advancing a 64-bit sequence number. Every reader keeps its own cursor and gets a
+ * View (at most two contiguous segments, split at the wrap) over the slots written
+ * since its last read: no copy, no allocation, no lock on either side.
+ *
+ * Readers never see the GUARD slots right behind the writer, so the writer has
+ * GUARD ticks of headroom before it can reach a slot a reader is still walking
+ * (1024/256 at 400 Hz: 640 ms). A reader that falls further behind than READABLE
+ * slots loses the oldest ones; the View reports how many, so plots can show a break
+ * instead of silently joining the two sides.
+ *
+ * The guard only makes a collision unlikely: a reader stalled for longer than that
+ * while walking a View reads slots that are being rewritten. Reader::Validate() checks
+ * the head again after the View was consumed and discards what the writer reached in
+ * the meantime; the GUI plots a break for those. ReadCopy() reads, copies and validates
+ * in one step for readers that need a vector anyway (the legacy debug batch).
+ *
+ * Storage is allocated on the first write, so engines that never publish (isolated
+ * FleetEvaluator instances, most tests) do not pay for it.
+ */
+template <typename T, size_t Capacity, size_t Guard = Capacity / 4>
+class SnapshotRing {
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(Guard < Capacity, "Guard must leave readable slots");
+
+public:
+    static constexpr size_t CAPACITY = Capacity;
+    static constexpr size_t READABLE = Capacity - Guard;
+
+    class View {
+    public:
+        size_t size() const { return m_count[0] + m_count[1]; }
+        bool empty() const { return size() == 0; }
+        const T& operator[](size_t i) const {
+            return (i < m_count[0]) ? m_data[0][i] : m_data[1][i - m_count[0]];
+        }
+        // Sequence number of element 0; elements are consecutive
+        uint64_t GetFirstSeq() const { return m_first_seq; }
+        // Snapshots between the reader's previous read and this view that were lost
+        uint64_t GetDropped() const { return m_dropped; }
+
+        const T* GetSegment(int k) const { return m_data[k]; }
+        size_t GetSegmentSize(int k) const { return m_count[k]; }
+
+        template <typename F>
+        void ForEach(F&& fn) const {
+            for (int k = 0; k < 2; ++k)
+                for (size_t i = 0; i < m_count[k]; ++i) fn(m_data[k][i]);
+        }
+
+    private:
+        friend class SnapshotRing;
+        const T* m_data[2] = { nullptr, nullptr };
+        size_t m_count[2] = { 0, 0 };
+        uint64_t m_first_seq = 0;
+        uint64_t m_dropped = 0;
+    };
+
+    class Reader {
+    public:
+        // Starts at the current head: only snapshots written from now on are returned
+        explicit Reader(const SnapshotRing& ring) : m_ring(&ring), m_next(ring.GetHead()) {}
+
+        /**
+         * @brief Everything written since the last Read, newest `max_count` at most
+         * (older ones count as dropped). Valid until the writer gets GUARD slots further.
+         */
+        View Read(size_t max_count = READABLE) {
+            View view;
+            uint64_t head = m_ring->GetHead();
+            uint64_t begin = m_next;
+            uint64_t limit = (max_count < READABLE) ? max_count : READABLE;
+            if (head - begin > limit) begin = head - limit;
+            view.m_first_seq = begin;
+            view.m_dropped = begin - m_next;
+            m_dropped += view.m_dropped;
+            m_next = head;
+
+            size_t count = (size_t)(head - begin);
+            if (count == 0) return view;
+            size_t start = (size_t)(begin & MASK);
+            size_t first = (count < Capacity - start) ? count : Capacity - start;
+            view.m_data[0] = m_ring->m_slots.get() + start;
+            view.m_count[0] = first;
+            view.m_data[1] = m_ring->m_slots.get();
+            view.m_count[1] = count - first;
+            return view;
+        }
+
+        /**
+         * @brief Call after consuming `view`: drops the oldest elements whose slots the
+         * writer has reached since Read() (their contents may be torn), counts them as
+         * dropped and returns how many. The remaining elements were intact when read.
+         */
+        size_t Validate(View& view) {
+            std::atomic_thread_fence(std::memory_order_acquire); // Slot reads before the head reload
+            uint64_t head = m_ring->GetHead();
+            // The writer fills slot `head` before publishing it
+            uint64_t intact = (head + 1 > Capacity) ? head + 1 - Capacity : 0;
+            if (intact <= view.m_first_seq || view.empty()) return 0;
+            uint64_t overwritten = intact - view.m_first_seq;
+            size_t lost = (overwritten < view.size()) ? (size_t)overwritten : view.size();
+            if (lost <= view.m_count[0]) {
+                view.m_data[0] += lost;
+                view.m_count[0] -= lost;
+            } else {
+                size_t rest = lost - view.m_count[0];
+                view.m_data[0] = view.m_data[1] + rest;
+                view.m_count[0] = view.m_count[1] - rest;
+                view.m_count[1] = 0;
+            }
+            view.m_first_seq += lost;
+            view.m_dropped += lost;
+            m_dropped += lost;
+            return lost;
+        }
+
+        /**
+         * @brief Read() into `out` (its capacity is reused) followed by Validate(). The
+         * returned View points into `out` and is already validated.
+         */
+        View ReadCopy(std::vector<T>& out, size_t max_count = READABLE) {
+            View view = Read(max_count);
+            out.clear();
+            view.ForEach([&out](const T& value) { out.push_back(value); });
+            size_t lost = Validate(view);
+            out.erase(out.begin(), out.begin() + lost);
+
+            View copy;
+            copy.m_data[0] = out.data();
+            copy.m_count[0] = out.size();
+            copy.m_first_seq = view.m_first_seq;
+            copy.m_dropped = view.m_dropped;
+            return copy;
+        }
+
+        uint64_t GetNextSeq() const { return m_next; }
+        uint64_t GetTotalDropped() const { return m_dropped; }
+
+    private:
+        const SnapshotRing* m_ring;
+        uint64_t m_next;
+        uint64_t m_dropped = 0;
+    };
+
+    SnapshotRing() = default;
+    SnapshotRing(const SnapshotRing&) = delete;
+    SnapshotRing& operator=(const SnapshotRing&) = delete;
+
+    /**
+     * @brief Writer only: slot for the next snapshot, filled in place and published by Commit().
+     */
+    T& BeginWrite() {
+        if (!m_slots) m_slots.reset(new T[Capacity]());
+        return m_slots[m_head.load(std::memory_order_relaxed) & MASK];
+    }
+    void Commit() { m_head.store(m_head.load(std::memory_order_relaxed) + 1, std::memory_order_release); }
+    void Push(const T& value) {
+        BeginWrite() = value;
+        Commit();
+    }
+
+    // Sequence number of the next write, i.e. the number of snapshots ever published
+    uint64_t GetHead() const { return m_head.load(std::memory_order_acquire); }
+
+private:
+    static constexpr uint64_t MASK = Capacity - 1;
+
+    std::unique_ptr<T[]> m_slots;
+    std::atomic<uint64_t> m_head{0};
+};
+
+#endif // SNAPSHOTRING_H
@@ -0,0 +1,130 @@
+#include "SpectrumAnalyzer.h"
+#include "MathUtils.h"
+#include <algorithm>
+#include <cmath>
+
+static_assert((SpectrumAnalyzer::FFT_SIZE & (SpectrumAnalyzer::FFT_SIZE - 1)) == 0, "FFT_SIZE must be a power of two");
+
+SpectrumAnalyzer::SpectrumAnalyzer() {
+    int bits = 0;
+    while ((1 << bits) < FFT_SIZE) bits++;
+    m_window_gain = 0.0;
+    for (int i = 0; i < FFT_SIZE; ++i) {
+        m_window[i] = 0.5 * (1.0 - std::cos(ffb_math::TWO_PI * i / (FFT_SIZE - 1)));
+        m_window_gain += m_window[i];
+        int r = 0;
+        for (int b = 0; b < bits; ++b) r |= ((i >> b) & 1) << (bits - 1 - b);
+        m_bitrev[i] = (uint16_t)r;
+    }
+    for (int k = 0; k < BINS; ++k) {
+        m_cos[k] = std::cos(ffb_math::TWO_PI * k / FFT_SIZE);
+        m_sin[k] = -std::sin(ffb_math::TWO_PI * k / FFT_SIZE);
+    }
+    Reset();
+}
+
+void SpectrumAnalyzer::Reset() {
+    m_ring.fill(0.0f);
+    m_amplitude.fill(0.0f);
+    m_write = 0;
+    m_filled = 0;
+    m_since_frame = 0;
+    m_frames = 0;
+    m_dominant_hz = 0.0;
+    m_band_mean = 0.0;
+}
+
+bool SpectrumAnalyzer::Push(double sample, double dt) {
+    if (!std::isfinite(sample) || dt <= 0.0) return false;
+    // Track the actual tick rate (the FFB loop is not exactly 400 Hz)
+    double rate = 1.0 / dt;
+    m_sample_rate += 0.01 * (rate - m_sample_rate);
+
+    m_ring[m_write] = (float)sample;
+    m_write = (m_write + 1) & (FFT_SIZE - 1);
+    if (m_filled < FFT_SIZE) m_filled++;
+    if (++m_since_frame < HOP || m_filled < FFT_SIZE) return false;
+    m_since_frame = 0;
+    ComputeFrame();
+    return true;
+}
+
+void SpectrumAnalyzer::ComputeFrame() {
+    // Oldest sample first; remove DC so steering load does not leak into the low bins
+    double mean = 0.0;
+    for (float s : m_ring) mean += s;
+    mean /= FFT_SIZE;
+    for (int i = 0; i < FFT_SIZE; ++i) {
+        double s = m_ring[(m_write + i) & (FFT_SIZE - 1)] - mean;
+        int j = m_bitrev[i];
+        m_re[j] = s * m_window[i];
+        m_im[j] = 0.0;
+    }
+    Transform();
+
+    // Single-sided amplitude, averaged across frames
+    double w = (m_frames == 0) ? 1.0 : FRAME_SMOOTHING;
+    double scale = 2.0 / m_window_gain;
+    for (int k = 0; k < BINS; ++k) {
+        double amp = std::sqrt(m_re[k] * m_re[k] + m_im[k] * m_im[k]) * scale;
+        m_amplitude[k] = (float)(m_amplitude[k] + w * (amp - m_amplitude[k]));
+    }
+    m_frames++;
+
+    // Prominence reference for every peak search on this frame
+    int first_band = (std::max)(1, (int)std::ceil(MIN_PEAK_HZ / GetBinHz()));
+    double sum = 0.0;
+    for (int k = first_band; k < BINS; ++k) sum += m_amplitude[k];
+    m_band_mean = sum / (BINS - first_band);
+
+    double peak = 0.0;
+    m_dominant_hz = FindPeak(MIN_PEAK_HZ, m_sample_rate * 0.5, peak) ? peak : 0.0;
+}
+
+void SpectrumAnalyzer::Transform() {
+    // Iterative radix-2 decimation in time; input already in bit-reversed order
+    for (int len = 2; len <= FFT_SIZE; len <<= 1) {
+        int half = len >> 1;
+        int step = FFT_SIZE / len;
+        for (int start = 0; start < FFT_SIZE; start += len) {
+            for (int k = 0; k < half; ++k) {
+                double wr = m_cos[k * step];
+                double wi = m_sin[k * step];
+                int a = start + k;
+                int b = a + half;
+                double tr = m_re[b] * wr - m_im[b] * wi;
+                double ti = m_re[b] * wi + m_im[b] * wr;
+                m_re[b] = m_re[a] - tr;
+                m_im[b] = m_im[a] - ti;
+                m_re[a] += tr;
+                m_im[a] += ti;
+            }
+        }
+    }
+}
+
+bool SpectrumAnalyzer::FindPeak(double lo_hz, double hi_hz, double& freq_hz, double* amplitude) const {
+    if (m_frames == 0) return false;
+    double bin_hz = GetBinHz();
+    int first_band = (std::max)(1, (int)std::ceil(MIN_PEAK_HZ / bin_hz));
+    int lo = (std::max)(first_band, (int)std::ceil(lo_hz / bin_hz));
+    int hi = (std::min)(BINS - 2, (int)std::floor(hi_hz / bin_hz));
+    if (lo > hi) return false;
+
+    int best = -1;
+    for (int k = lo; k <= hi; ++k) {
+        if (m_amplitude[k] < m_amplitude[k - 1] || m_amplitude[k] < m_amplitude[k + 1]) continue; // Local max only
+        if (best < 0 || m_amplitude[k] > m_amplitude[best]) best = k;
+    }
+    if (best < 0) return false;
+
+    // Prominence against the whole oscillation band, not just the search window
+    double a = m_amplitude[best - 1], b = m_amplitude[best], c = m_amplitude[best + 1];
+    if (b < MIN_AMPLITUDE_NM || b < m_band_mean * MIN_PROMINENCE) return false;
+
+    double denom = a - 2.0 * b + c;
+    double offset = (std::abs(denom) > 1e-12) ? 0.5 * (a - c) / denom : 0.0;
+    freq_hz = (best + (std::max)(-0.5, (std::min)(0.5, offset))) * bin_hz;
+    if (amplitude) *amplitude = b;
+    return true;
+}
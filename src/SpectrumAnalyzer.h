@@ -0,0 +1,69 @@
+#ifndef SPECTRUMANALYZER_H
+#define SPECTRUMANALYZER_H
+
+#include <array>
+#include <cstdint>
+
+// Spectrum Analyzer (v0.7.112)
+// Streaming windowed FFT of the steering torque. Samples go into a ring; every HOP
+// samples the last FFT_SIZE are Hann-windowed and transformed with an in-place
+// radix-2 FFT (precomputed twiddles and bit-reversal, no allocation). Successive
+// frames are averaged into an amplitude spectrum (Nm per bin) that the notch filters
+// use to find the real oscillation peaks and the GUI shows live.
+//
+// At 400 Hz: 0.64 s window, 1.56 Hz bins, a new frame every 160 ms. The whole frame
+// (1024 butterflies, 128 sqrt and one band scan) runs inside the one tick that
+// completes it, every HOP ticks; the other ticks only store the sample.
+class SpectrumAnalyzer {
+public:
+    static constexpr int FFT_SIZE = 256;           // Power of two
+    static constexpr int BINS = FFT_SIZE / 2;
+    static constexpr int HOP = 64;
+    static constexpr double FRAME_SMOOTHING = 0.5; // Weight of the newest frame
+    static constexpr double MIN_PEAK_HZ = 2.0;     // Below this is steering, not oscillation
+    static constexpr double MIN_PROMINENCE = 4.0;  // Peak vs mean amplitude in the band
+    static constexpr double MIN_AMPLITUDE_NM = 0.05;
+
+    SpectrumAnalyzer();
+
+    void Reset();
+    // One sample. Returns true when a new spectrum frame was produced.
+    bool Push(double sample, double dt);
+
+    double GetSampleRate() const { return m_sample_rate; }
+    double GetBinHz() const { return m_sample_rate / FFT_SIZE; }
+    bool HasSpectrum() const { return m_frames > 0; }
+    uint32_t GetFrameCount() const { return m_frames; }
+
+    // Strongest peak between lo_hz and hi_hz that stands out from the rest of the
+    // spectrum, with sub-bin (parabolic) frequency. False if there is none.
+    bool FindPeak(double lo_hz, double hi_hz, double& freq_hz, double* amplitude = nullptr) const;
+    // Strongest peak above MIN_PEAK_HZ, 0 if none (updated every frame)
+    double GetDominantFrequency() const { return m_dominant_hz; }
+    const std::array<float, BINS>& GetAmplitudes() const { return m_amplitude; }
+
+private:
+    void ComputeFrame();
+    void Transform();
+
+    std::array<float, FFT_SIZE> m_ring;
+    int m_write = 0;
+    int m_filled = 0;
+    int m_since_frame = 0;
+    double m_sample_rate = 400.0;
+
+    std::array<double, FFT_SIZE> m_window;
+    std::array<double, BINS> m_cos;
+    std::array<double, BINS> m_sin;
+    std::array<uint16_t, FFT_SIZE> m_bitrev;
+    double m_window_gain = 1.0;
+
+    std::array<double, FFT_SIZE> m_re;
+    std::array<double, FFT_SIZE> m_im;
+    std::array<float, BINS> m_amplitude;
+    uint32_t m_frames = 0;
+    double m_dominant_hz = 0.0;
+    double m_band_mean = 0.0;  // Mean amplitude above MIN_PEAK_HZ, per frame
+};
+
+#endif // SPECTRUMANALYZER_H
@@ -0,0 +1,155 @@
+#include "TelemetryReplay.h"
+#include <fstream>
+#include <sstream>
+#include <cstring>
+#include <cstdlib>
+#include <cmath>
+#include <map>
+#include <algorithm>
+
+namespace {
+
+constexpr double DEFAULT_REPLAY_DT = 0.01;       // AsyncLogger decimates 400Hz -> 100Hz
+constexpr unsigned char DEFAULT_RADIUS_CM = 33;
+constexpr double DEFAULT_DEFLECTION_M = 0.001;   // Avoid "missing data" fallbacks
+
+void CopyName(char* dst, size_t size, const std::string& src) {
+#ifdef _WIN32
+    strncpy_s(dst, size, src.c_str(), _TRUNCATE);
+#else
+    strncpy(dst, src.c_str(), size - 1);
+    dst[size - 1] = '\0';
+#endif
+}
+
+std::string TrimValue(const std::string& s) {
+    size_t start = s.find_first_not_of(" \t\r\n");
+    if (start == std::string::npos) return "";
+    size_t end = s.find_last_not_of(" \t\r\n");
+    return s.substr(start, end - start + 1);
+}
+
+} // namespace
+
+namespace TelemetryReplay {
+
+TelemInfoV01 BuildFrame(double time, double dt, double speed, double lat_accel, double long_accel,
+                        double yaw_rate, double steering, double throttle, double brake,
+                        double slip_angle, double slip_ratio, double grip_front, double grip_rear,
+                        double load_front, double shaft_torque) {
+    TelemInfoV01 t;
+    std::memset(&t, 0, sizeof(t));
+    t.mElapsedTime = time;
+    t.mDeltaTime = dt;
+    t.mLocalVel.z = -speed; // Game uses -Z for forward
+    t.mLocalAccel.x = lat_accel;
+    t.mLocalAccel.z = long_accel;
+    t.mLocalRot.y = yaw_rate;
+    t.mUnfilteredSteering = steering;
+    t.mFilteredSteering = steering;
+    t.mUnfilteredThrottle = throttle;
+    t.mUnfilteredBrake = brake;
+    t.mSteeringShaftTorque = shaft_torque;
+
+    // AsyncLogger stores slip angle as LateralPatchVel / max(1, speed)
+    double ref_speed = (std::max)(1.0, speed);
+    for (int i = 0; i < 4; i++) {
+        TelemWheelV01& w = t.mWheel[i];
+        w.mStaticUndeflectedRadius = DEFAULT_RADIUS_CM;
+        w.mLongitudinalGroundVel = speed;
+        w.mLateralPatchVel = slip_angle * ref_speed;
+        w.mLongitudinalPatchVel = slip_ratio * (std::max)(0.5, speed);
+        w.mRotation = speed / (DEFAULT_RADIUS_CM / 100.0);
+        w.mGripFract = (i < 2) ? grip_front : grip_rear;
+        w.mTireLoad = load_front;
+        w.mSuspForce = load_front;
+        w.mSuspensionDeflection = DEFAULT_DEFLECTION_M;
+        w.mVerticalTireDeflection = DEFAULT_DEFLECTION_M;
+        w.mRideHeight = 0.05;
+        w.mBrakePressure = brake;
+    }
+    return t;
+}
+
+bool LoadCsv(const std::string& filename, ReplayCapture& out, std::string* error) {
+    std::ifstream file(filename);
+    if (!file.is_open()) {
+        if (error) *error = "Cannot open " + filename;
+        return false;
+    }
+
+    out = ReplayCapture();
+    std::map<std::string, int> cols;
+    std::string line;
+    std::vector<double> values;
+    double last_time = -1.0;
+
+    while (std::getline(file, line)) {
+        if (line.empty()) continue;
+        if (line[0] == '#') {
+            if (line.rfind("# Vehicle:", 0) == 0) out.vehicle_name = TrimValue(line.substr(10));
+            else if (line.rfind("# Track:", 0) == 0) out.track_name = TrimValue(line.substr(8));
+            continue;
+        }
+
+        if (cols.empty()) {
+            std::stringstream ss(line);
+            std::string name;
+            int idx = 0;
+            while (std::getline(ss, name, ',')) cols[TrimValue(name)] = idx++;
+            static const char* required[] = { "Time", "Speed", "LatAccel", "FFBShaftTorque" };
+            for (const char* r : required) {
+                if (cols.find(r) == cols.end()) {
+                    if (error) *error = std::string("Missing column: ") + r;
+                    return false;
+                }
+            }
+            continue;
+        }
+
+        values.clear();
+        const char* p = line.c_str();
+        while (*p) {
+            char* end = nullptr;
+            values.push_back(std::strtod(p, &end));
+            p = end;
+            while (*p && *p != ',') p++;
+            if (*p == ',') p++;
+        }
+
+        auto get = [&](const char* name, double def = 0.0) {
+            auto it = cols.find(name);
+            if (it == cols.end() || it->second >= (int)values.size()) return def;
+            return values[it->second];
+        };
+
+        double time = get("Time");
+        double dt = (last_time >= 0.0 && time > last_time) ? (time - last_time) : DEFAULT_REPLAY_DT;
+        last_time = time;
+
+        double slip_angle = (get("SlipAngleFL") + get("SlipAngleFR")) * 0.5;
+        double slip_ratio = (get("SlipRatioFL") + get("SlipRatioFR")) * 0.5;
+        double grip_front = (get("GripFL") + get("GripFR")) * 0.5;
+        double load_front = (get("LoadFL") + get("LoadFR")) * 0.5;
+
+        out.frames.push_back(BuildFrame(time, dt, get("Speed"), get("LatAccel"), get("LongAccel"),
+                                        get("YawRate"), get("Steering"), get("Throttle"), get("Brake"),
+                                        slip_angle, slip_ratio, grip_front, get("CalcGripRear", grip_front),
+                                        load_front, get("FFBShaftTorque")));
+        out.gen_torque.push_back((float)get("FFBGenTorque"));
+    }
+
+    if (out.frames.empty()) {
+        if (error) *error = "No telemetry rows in " + filename;
+        return false;
+    }
+
+    for (auto& f : out.frames) {
+        CopyName(f.mVehicleName, sizeof(f.mVehicleName), out.vehicle_name);
+        CopyName(f.mTrackName, sizeof(f.mTrackName), out.track_name);
+    }
+    out.duration_s = out.frames.back().mElapsedTime - out.frames.front().mElapsedTime;
+    return true;
+}
+
+} // namespace TelemetryReplay
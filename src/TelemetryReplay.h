@@ -0,0 +1,37 @@
+#ifndef TELEMETRYREPLAY_H
+#define TELEMETRYREPLAY_H
+
+#include <string>
+#include <vector>
+#include "lmu_sm_interface/InternalsPluginWrapper.h"
+
+/**
+ * @brief Telemetry reconstructed from an AsyncLogger CSV capture.
+ *
+ * The log only carries the front axle per wheel, so the rear wheels are mirrored from
+ * the front with the logged rear grip. The result is good enough to drive FFBEngine
+ * offline (preset sweeps, regression checks); it is not a bit-exact game recording.
+ */
+struct ReplayCapture {
+    std::string vehicle_name = "Unknown";
+    std::string track_name = "Unknown";
+    std::vector<TelemInfoV01> frames;
+    std::vector<float> gen_torque; // Normalized 400Hz in-game FFB, one per frame
+    double duration_s = 0.0;
+};
+
+namespace TelemetryReplay {
+
+    // Loads a "LMUFFB Telemetry Log v1.0" CSV. Columns are matched by header name.
+    // Returns false (and fills error) if the file cannot be read or lacks required columns.
+    bool LoadCsv(const std::string& filename, ReplayCapture& out, std::string* error = nullptr);
+
+    // Builds a telemetry frame from the logged channels (shared by LoadCsv and tests).
+    TelemInfoV01 BuildFrame(double time, double dt, double speed, double lat_accel, double long_accel,
+                            double yaw_rate, double steering, double throttle, double brake,
+                            double slip_angle, double slip_ratio, double grip_front, double grip_rear,
+                            double load_front, double shaft_torque);
+
+} // namespace TelemetryReplay
+
+#endif // TELEMETRYREPLAY_H
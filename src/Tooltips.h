@@ -15,6 +15,7 @@ namespace Tooltips {
     inline constexpr const char* NO_DEVICE = "Please select your steering wheel from the 'FFB Device' menu above.";
     inline constexpr const char* ALWAYS_ON_TOP = "Keep the lmuFFB window visible over other applications (including the game).";
     inline constexpr const char* SHOW_GRAPHS = "Show real-time physics and output graphs for debugging.\nIncreases window width.";
+    inline constexpr const char* ADD_PLOT_PANEL = "Open a new plot window and pick its signals from the Channels menu.\nEach panel keeps its own history length and refresh rate.";
 
     // Logging
     inline constexpr const char* LOG_STOP = "Finish recording and save the log file.";
@@ -51,6 +52,7 @@ namespace Tooltips {
     inline constexpr const char* INGAME_FFB_GAIN = "Scales the native 400Hz In-Game FFB signal.";
     inline constexpr const char* STEERING_SHAFT_GAIN = "Scales the raw steering torque from the physics engine.";
     inline constexpr const char* STEERING_SHAFT_SMOOTHING = "Low Pass Filter applied ONLY to the raw game force.";
+    inline constexpr const char* TORQUE_PREDICTION = "Forecasts the steering shaft torque this far ahead to hide game latency.\nLearns from your steering and yaw rate while driving, and only blends in\nas far as the forecast beats the raw signal (see Confidence).\n0 = Off. Steering Shaft torque source only.";
     inline constexpr const char* UNDERSTEER_EFFECT = "Scales how much front grip loss reduces steering force.";
     inline constexpr const char* DYNAMIC_WEIGHT = "Scales steering weight based on longitudinal load transfer.\nHeavier under braking, lighter under acceleration.";
     inline constexpr const char* WEIGHT_SMOOTHING = "Filters the Dynamic Weight signal to simulate suspension damping.\nHigher = Smoother weight transfer feel, but less instant.\nRecommended: 0.100s - 0.200s.";
@@ -64,6 +66,7 @@ namespace Tooltips {
     inline constexpr const char* STATIC_NOISE_FILTER = "Fixed frequency notch filter to remove hardware resonance or specific noise.";
     inline constexpr const char* STATIC_NOTCH_FREQ = "Center frequency to suppress.";
     inline constexpr const char* STATIC_NOTCH_WIDTH = "Bandwidth of the notch filter.\nLarger = Blocks more frequencies around the target.";
+    inline constexpr const char* NOTCH_AUTO_TUNE = "Measures the torque spectrum and moves each notch onto the real oscillation peak\nwithin 25% of its expected frequency (wheel rotation, or Target Frequency).\nFalls back to the expected frequency when no clear peak is found.";
 
     // Rear Axle
     inline constexpr const char* OVERSTEER_BOOST = "Increases the Lateral G (SoP) force when the rear tires lose grip.\nMakes the car feel heavier during a slide, helping you judge the momentum.\nShould build up slightly more gradually than Rear Align Torque,\nreflecting the inertia of the car's mass swinging out.\nIt's a sustained force that tells you about the magnitude of the slide\nTuning Goal: Feel the direction of the counter-steer (Rear Align)\nand the effort required to hold it (Lateral G Boost).";
@@ -117,6 +120,9 @@ namespace Tooltips {
     inline constexpr const char* SLIDE_PITCH = "Frequency multiplier for the scrubbing sound/feel.\nHigher = Screeching.\nLower = Grinding.";
     inline constexpr const char* ROAD_DETAILS = "Vibration derived from high-frequency suspension movement.\nFeels road surface, cracks, and bumps.";
     inline constexpr const char* ROAD_GAIN = "Intensity of road details.";
+    inline constexpr const char* ADAPTIVE_SLIP_ANGLE = "Learns where the front tyres' lateral force peaks for each car while you drive,\nand uses it instead of Optimal Slip Angle once found.\nNeeds a few corners driven past the limit. Saved per car.\nRequires mLateralForce (not available on encrypted cars).";
+    inline constexpr const char* CHASSIS_ESTIMATOR = "Fuses speed, acceleration and yaw channels into one filtered chassis state.\nFeeds SoP, Yaw Kick and the kinematic load model with less noise and less lag\nthan the individual smoothing sliders, which it replaces while enabled.";
+    inline constexpr const char* ROAD_PREDICTION = "Learns the road texture along each track and plays it slightly ahead of the car.\nHides telemetry latency so kerbs arrive on time.\nNeeds about two laps per track to build up. 0 = Reactive only.";
     inline constexpr const char* SPIN_VIBRATION = "Vibration when wheels lose traction under acceleration (Wheel Spin).";
     inline constexpr const char* SPIN_STRENGTH = "Intensity of the wheel spin vibration.";
     inline constexpr const char* SPIN_PITCH = "Scales the frequency of the wheel spin vibration.";
@@ -128,6 +134,10 @@ namespace Tooltips {
     inline constexpr const char* FULL_ABOVE = "The speed above which all haptic vibrations reach\ntheir full configured strength.";
     inline constexpr const char* AUTO_START_LOGGING = "Automatically start telemetry logging when entering a driving session.";
     inline constexpr const char* LOG_PATH = "Directory where .csv telemetry logs will be saved.";
+    inline constexpr const char* LOG_COMPRESS = "Write compressed .lmz logs (about a tenth of the CSV size) for long sessions.\nLMUFFB_LogAnalyzer reads them directly or converts them\nback to CSV (decompress command).";
+    inline constexpr const char* FLIGHT_RECORDER = "Keep the last seconds of FFB state in a crash-safe file (log path).\nAfter a jolt, crash or hang, extract it with\nLMUFFB_LogAnalyzer flight. Takes effect at the next start.";
+    inline constexpr const char* ANOMALY_DUMPS = "Save the flight recorder's seconds around torque spikes, NaN values,\nclipping bursts, low sample rates, lock timeouts and stale telemetry\nto <log path>/anomalies (at most 20 files per run).\nTakes effect at the next start.";
+    inline constexpr const char* FLIGHT_RECORDER_SECONDS = "How many seconds the flight recorder keeps (about 0.25 MB per second).\nTakes effect at the next start.";
 
     // Debug Plots
     inline constexpr const char* PLOT_SELECTED_TORQUE = "The torque value currently being used as the base for FFB calculations.";
@@ -138,19 +148,20 @@ namespace Tooltips {
     inline constexpr const char* FINE_TUNE = "Fine Tune: Arrow Keys | Exact: Ctrl+Click";
 
     inline const std::vector<const char*> ALL = {
-        DEVICE_SELECT, DEVICE_RESCAN, DEVICE_UNBIND, MODE_EXCLUSIVE, MODE_SHARED, NO_DEVICE, ALWAYS_ON_TOP, SHOW_GRAPHS,
+        DEVICE_SELECT, DEVICE_RESCAN, DEVICE_UNBIND, MODE_EXCLUSIVE, MODE_SHARED, NO_DEVICE, ALWAYS_ON_TOP, SHOW_GRAPHS, ADD_PLOT_PANEL,
         LOG_STOP, LOG_REC, LOG_MARKER, LOG_START,
         PRESET_NAME, PRESET_SAVE_NEW, PRESET_SAVE_CURRENT, PRESET_RESET, PRESET_DUPLICATE, PRESET_DELETE, PRESET_IMPORT, PRESET_EXPORT,
         USE_INGAME_FFB, INVERT_FFB, DYNAMIC_NORMALIZATION_ENABLE, DYNAMIC_LOAD_NORMALIZATION_ENABLE, MASTER_GAIN, WHEELBASE_MAX_TORQUE, TARGET_RIM_TORQUE, MIN_FORCE,
         SOFT_LOCK_ENABLE, SOFT_LOCK_STIFFNESS, SOFT_LOCK_DAMPING,
-        INGAME_FFB_GAIN, STEERING_SHAFT_GAIN, STEERING_SHAFT_SMOOTHING, UNDERSTEER_EFFECT, DYNAMIC_WEIGHT, WEIGHT_SMOOTHING, TORQUE_SOURCE, PURE_PASSTHROUGH,
-        FLATSPOT_SUPPRESSION, NOTCH_Q, SUPPRESSION_STRENGTH, STATIC_NOISE_FILTER, STATIC_NOTCH_FREQ, STATIC_NOTCH_WIDTH,
+        INGAME_FFB_GAIN, STEERING_SHAFT_GAIN, STEERING_SHAFT_SMOOTHING, TORQUE_PREDICTION, UNDERSTEER_EFFECT, DYNAMIC_WEIGHT, WEIGHT_SMOOTHING, TORQUE_SOURCE, PURE_PASSTHROUGH,
+        FLATSPOT_SUPPRESSION, NOTCH_Q, SUPPRESSION_STRENGTH, STATIC_NOISE_FILTER, STATIC_NOTCH_FREQ, STATIC_NOTCH_WIDTH, NOTCH_AUTO_TUNE,
         OVERSTEER_BOOST, LATERAL_G, REAR_ALIGN_TORQUE, YAW_KICK, YAW_KICK_THRESHOLD, YAW_KICK_RESPONSE, GYRO_DAMPING, GYRO_SMOOTH, SOP_SMOOTHING, GRIP_SMOOTHING, SOP_SCALE,
-        SLIP_ANGLE_SMOOTHING, CHASSIS_INERTIA, OPTIMAL_SLIP_ANGLE, OPTIMAL_SLIP_RATIO,
+        SLIP_ANGLE_SMOOTHING, CHASSIS_INERTIA, CHASSIS_ESTIMATOR, OPTIMAL_SLIP_ANGLE, OPTIMAL_SLIP_RATIO, ADAPTIVE_SLIP_ANGLE,
         SLOPE_DETECTION_ENABLE, SLOPE_FILTER_WINDOW, SLOPE_SENSITIVITY, SLOPE_THRESHOLD, SLOPE_OUTPUT_SMOOTHING, SLOPE_ALPHA_THRESHOLD, SLOPE_DECAY_RATE, SLOPE_CONFIDENCE_GATE,
         LOCKUP_VIBRATION, LOCKUP_STRENGTH, BRAKE_LOAD_CAP, VIBRATION_PITCH, LOCKUP_GAMMA, LOCKUP_START_PCT, LOCKUP_FULL_PCT, LOCKUP_PREDICTION_SENS, LOCKUP_BUMP_REJECT, LOCKUP_REAR_BOOST, ABS_PULSE, ABS_PULSE_GAIN, ABS_PULSE_FREQ,
-        TEXTURE_LOAD_CAP, TACTILE_GAIN, SLIDE_RUMBLE, SLIDE_GAIN, SLIDE_PITCH, ROAD_DETAILS, ROAD_GAIN, SPIN_VIBRATION, SPIN_STRENGTH, SPIN_PITCH, SCRUB_DRAG, BOTTOMING_LOGIC,
-        MUTE_BELOW, FULL_ABOVE, AUTO_START_LOGGING, LOG_PATH,
+        TEXTURE_LOAD_CAP, TACTILE_GAIN, SLIDE_RUMBLE, SLIDE_GAIN, SLIDE_PITCH, ROAD_DETAILS, ROAD_GAIN, ROAD_PREDICTION, SPIN_VIBRATION, SPIN_STRENGTH, SPIN_PITCH, SCRUB_DRAG, BOTTOMING_LOGIC,
+        MUTE_BELOW, FULL_ABOVE, AUTO_START_LOGGING, LOG_PATH, LOG_COMPRESS,
+        FLIGHT_RECORDER, FLIGHT_RECORDER_SECONDS, ANOMALY_DUMPS,
         PLOT_SELECTED_TORQUE, PLOT_SHAFT_TORQUE, PLOT_INGAME_FFB,
         FINE_TUNE
     };
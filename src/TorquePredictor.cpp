@@ -0,0 +1,107 @@
+#include "TorquePredictor.h"
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// Feature scaling keeps the regressors O(1) so one P_INIT suits all of them
+constexpr double TORQUE_SCALE = 0.1;   // 1 / 10 Nm
+constexpr double STEER_RATE_SCALE = 10.0;
+constexpr double YAW_RATE_SCALE = 10.0;
+
+} // namespace
+
+void TorquePredictor::Reset() {
+    for (int i = 0; i < HISTORY; ++i) {
+        m_torque[i] = m_steer[i] = m_yaw[i] = m_forecast[i] = 0.0;
+    }
+    m_head = 0;
+    m_count = 0;
+    m_horizon_ticks = 0;
+    m_weights = Vec();
+    m_P = ffb_math::Matrix<FEATURES, FEATURES>();
+    for (int i = 0; i < FEATURES; ++i) m_P(i, i) = P_INIT;
+    m_err_pred = 0.0;
+    m_err_hold = 0.0;
+    m_confidence = 0.0;
+    m_prediction = 0.0;
+}
+
+TorquePredictor::Vec TorquePredictor::Features(int idx) const {
+    int prev = (idx - SLOPE_TICKS + HISTORY) % HISTORY;
+    Vec x;
+    x(0, 0) = m_torque[idx] * TORQUE_SCALE;
+    x(1, 0) = (m_torque[idx] - m_torque[prev]) * TORQUE_SCALE;
+    x(2, 0) = m_steer[idx];
+    x(3, 0) = (m_steer[idx] - m_steer[prev]) * STEER_RATE_SCALE;
+    x(4, 0) = m_yaw[idx];
+    x(5, 0) = (m_yaw[idx] - m_yaw[prev]) * YAW_RATE_SCALE;
+    x(6, 0) = 1.0;
+    return x;
+}
+
+void TorquePredictor::Train(const Vec& x, double target) {
+    // Recursive least squares with forgetting factor
+    Vec Px = m_P * x;
+    double denom = FORGETTING + (x.Transposed() * Px)(0, 0);
+    double err = target - (m_weights.Transposed() * x)(0, 0);
+    double trace = 0.0;
+    for (int i = 0; i < FEATURES; ++i) {
+        double k = Px(i, 0) / denom;
+        m_weights(i, 0) += k * err;
+        for (int j = 0; j < FEATURES; ++j) m_P(i, j) -= k * Px(j, 0);
+    }
+    for (int i = 0; i < FEATURES; ++i) trace += m_P(i, i);
+    if (trace < P_TRACE_MAX) {
+        for (int i = 0; i < FEATURES; ++i)
+            for (int j = 0; j < FEATURES; ++j) m_P(i, j) /= FORGETTING;
+    }
+}
+
+double TorquePredictor::Process(double torque, double steering, double yaw_rate, double horizon_s, double dt) {
+    if (horizon_s <= 0.0 || dt <= 0.0 || !std::isfinite(torque) || !std::isfinite(steering) || !std::isfinite(yaw_rate)) {
+        if (m_count > 0) Reset();
+        return torque;
+    }
+
+    int horizon = (int)std::lround((std::min)(horizon_s, MAX_HORIZON_S) / dt);
+    horizon = (std::max)(1, (std::min)(HISTORY - SLOPE_TICKS - 1, horizon));
+    if (horizon != m_horizon_ticks) {
+        Reset();
+        m_horizon_ticks = horizon;
+    }
+
+    int idx = m_head;
+    m_torque[idx] = torque;
+    m_steer[idx] = steering;
+    m_yaw[idx] = yaw_rate;
+    m_head = (m_head + 1) % HISTORY;
+    if (m_count < HISTORY) m_count++;
+
+    // 1. Learn from the sample taken `horizon` ago, now that its outcome is known
+    if (m_count > horizon + SLOPE_TICKS) {
+        int past = (idx - horizon + HISTORY) % HISTORY;
+        double actual_change = (torque - m_torque[past]) * TORQUE_SCALE;
+
+        // Score first (the forecast made back then never saw this outcome)
+        double alpha = dt / (ERROR_TAU_S + dt);
+        double e_pred = torque - m_forecast[past];
+        double e_hold = torque - m_torque[past];
+        m_err_pred += alpha * (e_pred * e_pred - m_err_pred);
+        m_err_hold += alpha * (e_hold * e_hold - m_err_hold);
+        m_confidence = (m_err_hold > 1e-9) ? (std::max)(0.0, (std::min)(1.0, 1.0 - m_err_pred / m_err_hold)) : 0.0;
+
+        Train(Features(past), actual_change);
+    }
+
+    // 2. Forecast from now
+    double change = 0.0;
+    if (m_count > SLOPE_TICKS) {
+        change = (m_weights.Transposed() * Features(idx))(0, 0) / TORQUE_SCALE;
+        change = (std::max)(-MAX_STEP_NM, (std::min)(MAX_STEP_NM, change));
+    }
+    m_prediction = torque + change;
+    m_forecast[idx] = m_prediction;
+
+    return torque + m_confidence * change;
+}
@@ -0,0 +1,66 @@
+#ifndef TORQUEPREDICTOR_H
+#define TORQUEPREDICTOR_H
+
+#include "MathUtils.h"
+
+// Torque Predictor (v0.7.112)
+// Forecasts mSteeringShaftTorque a few milliseconds ahead to hide the game-side and
+// shared-memory latency. An online recursive least squares model predicts the torque
+// change over the horizon from the current torque and its slope, the steering input
+// and its rate, and the yaw rate and its rate. The driver's steering arrives with less
+// latency than the torque it causes, which is what the model exploits.
+//
+// The model trains on itself: the features from `horizon` ago are paired with the
+// torque that actually arrived now. The same pairing scores the forecast against
+// simply holding the last value; the output blends from raw to predicted by that
+// confidence, so a model that does not beat the raw signal is never heard.
+//
+// Fixed-size state, constant time per tick, no allocation.
+class TorquePredictor {
+public:
+    static constexpr int FEATURES = 7;
+    static constexpr int HISTORY = 64;           // Ticks kept (160 ms at 400 Hz)
+    static constexpr int SLOPE_TICKS = 4;        // Rate window: 10 ms at 400 Hz, one 100 Hz shaft update
+    static constexpr double MAX_HORIZON_S = 0.05;
+    static constexpr double FORGETTING = 0.999;  // ~1000 ticks (2.5 s) of memory
+    static constexpr double P_INIT = 10.0;
+    static constexpr double P_TRACE_MAX = 1.0e4; // Covariance windup guard on straights
+    static constexpr double ERROR_TAU_S = 0.5;   // Confidence averaging
+    static constexpr double MAX_STEP_NM = 5.0;   // Clamp on the predicted change
+
+    TorquePredictor() { Reset(); }
+
+    void Reset();
+
+    // One FFB tick. Returns the torque to use: raw, predicted, or a blend of both.
+    // horizon_s <= 0 passes the raw torque through (and keeps the model reset).
+    double Process(double torque, double steering, double yaw_rate, double horizon_s, double dt);
+
+    double GetConfidence() const { return m_confidence; }  // 0 = raw, 1 = fully predicted
+    double GetPrediction() const { return m_prediction; }  // Last unblended forecast
+    int GetHorizonTicks() const { return m_horizon_ticks; }
+
+private:
+    using Vec = ffb_math::Matrix<FEATURES, 1>;
+
+    Vec Features(int idx) const;
+    void Train(const Vec& x, double target);
+
+    double m_torque[HISTORY];
+    double m_steer[HISTORY];
+    double m_yaw[HISTORY];
+    double m_forecast[HISTORY];  // Prediction made at each tick, scored `horizon` later
+    int m_head = 0;              // Next write slot
+    int m_count = 0;
+    int m_horizon_ticks = 0;
+
+    Vec m_weights;
+    ffb_math::Matrix<FEATURES, FEATURES> m_P;
+
+    double m_err_pred = 0.0;     // Mean squared error of the forecast
+    double m_err_hold = 0.0;     // Mean squared error of holding the last value
+    double m_confidence = 0.0;
+    double m_prediction = 0.0;
+};
+
+#endif // TORQUEPREDICTOR_H
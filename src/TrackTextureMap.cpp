@@ -0,0 +1,192 @@
+#include "TrackTextureMap.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+
+namespace {
+
+constexpr char FILE_MAGIC[4] = { 'L', 'M', 'T', 'M' };
+constexpr uint32_t FILE_VERSION = 1;
+constexpr int FIELD_BITS = 21;
+constexpr int64_t FIELD_MASK = (1 << FIELD_BITS) - 1;
+
+struct FileCell {
+    uint64_t key;
+    float mean_square;
+    uint32_t samples;
+};
+
+void CopyName(char* dst, size_t size, const char* src) {
+    size_t n = strnlen(src, size - 1);
+    std::memcpy(dst, src, n);
+    dst[n] = '\0';
+}
+
+size_t HashSlot(uint64_t key) {
+    return (size_t)((key * 0x9E3779B97F4A7C15ull) >> (64 - 16)) & (TrackTextureMap::CAPACITY - 1);
+}
+
+} // namespace
+
+uint64_t TrackTextureMap::MakeKey(const TelemVect3& pos) {
+    int64_t ix = (int64_t)std::floor(pos.x / CELL_SIZE_M);
+    int64_t iy = (int64_t)std::floor(pos.y / VERTICAL_CELL_SIZE_M);
+    int64_t iz = (int64_t)std::floor(pos.z / CELL_SIZE_M);
+    // 21 bits per axis (+-2000 km at 2 m): the top bit stays clear so a key never equals EMPTY_KEY
+    return ((uint64_t)(ix & FIELD_MASK) << (2 * FIELD_BITS)) |
+           ((uint64_t)(iy & FIELD_MASK) << FIELD_BITS) |
+           (uint64_t)(iz & FIELD_MASK);
+}
+
+TrackTextureMap::Cell* TrackTextureMap::Find(uint64_t key, bool insert) {
+    size_t i = HashSlot(key);
+    for (size_t probe = 0; probe < CAPACITY; ++probe, i = (i + 1) & (CAPACITY - 1)) {
+        Cell& c = m_cells[i];
+        if (c.key == key) return &c;
+        if (c.key == EMPTY_KEY) {
+            if (!insert || m_count >= MAX_FILL) return nullptr;
+            c.key = key;
+            c.mean_square = 0.0f;
+            c.samples = 0;
+            m_count++;
+            return &c;
+        }
+    }
+    return nullptr;
+}
+
+const TrackTextureMap::Cell* TrackTextureMap::Find(uint64_t key) const {
+    size_t i = HashSlot(key);
+    for (size_t probe = 0; probe < CAPACITY; ++probe, i = (i + 1) & (CAPACITY - 1)) {
+        const Cell& c = m_cells[i];
+        if (c.key == key) return &c;
+        if (c.key == EMPTY_KEY) return nullptr;
+    }
+    return nullptr;
+}
+
+void TrackTextureMap::Clear() {
+    if (!m_cells) m_cells.reset(new Cell[CAPACITY]);
+    for (size_t i = 0; i < CAPACITY; ++i) m_cells[i] = { EMPTY_KEY, 0.0f, 0 };
+    m_count = 0;
+    m_dirty = false;
+}
+
+bool TrackTextureMap::Activate(const char* track_name) {
+    if (!track_name || track_name[0] == '\0') return false;
+    int state = m_state.load(std::memory_order_acquire);
+    if (state == STATE_SWITCHING) return false;
+    if (state == STATE_READY && std::strncmp(m_track, track_name, sizeof(m_track) - 1) == 0) return true;
+
+    CopyName(m_requested, sizeof(m_requested), track_name);
+    m_state.store(STATE_SWITCHING, std::memory_order_release);
+    return false;
+}
+
+void TrackTextureMap::Learn(const TelemVect3& pos, double value) {
+    if (m_state.load(std::memory_order_relaxed) != STATE_READY || !std::isfinite(value)) return;
+    Cell* c = Find(MakeKey(pos), true);
+    if (!c) return;
+    if (c->samples < MAX_AVERAGE_SAMPLES) c->samples++;
+    c->mean_square += (float)((value * value - c->mean_square) / (double)c->samples);
+    m_dirty = true;
+}
+
+double TrackTextureMap::Predict(const TelemVect3& pos, double& amplitude) const {
+    amplitude = 0.0;
+    if (m_state.load(std::memory_order_relaxed) != STATE_READY) return 0.0;
+    const Cell* c = Find(MakeKey(pos));
+    if (!c) return 0.0;
+    amplitude = std::sqrt((double)c->mean_square);
+    return (std::min)(1.0, (double)c->samples / (double)MIN_CONFIDENT_SAMPLES);
+}
+
+std::string TrackTextureMap::GetPath(const std::string& track_name) const {
+    std::string file;
+    for (char ch : track_name) {
+        bool safe = (ch >= 'a' && ch <= 'z') || (ch >= 'A' && ch <= 'Z') || (ch >= '0' && ch <= '9') || ch == '-' || ch == '_';
+        file += safe ? ch : '_';
+    }
+    return m_dir + "/" + file + ".bin";
+}
+
+void TrackTextureMap::ServiceIO() {
+    if (m_state.load(std::memory_order_acquire) != STATE_SWITCHING) return;
+
+    if (m_track[0] != '\0') Save();
+    Clear();
+    CopyName(m_track, sizeof(m_track), m_requested);
+    if (Load(GetPath(m_track))) {
+        std::cout << "[TrackMap] Loaded " << m_count << " cells for " << m_track << std::endl;
+    }
+    m_state.store(STATE_READY, std::memory_order_release);
+}
+
+bool TrackTextureMap::Save() {
+    if (!m_cells || !m_dirty || m_track[0] == '\0') return false;
+
+    std::error_code ec;
+    std::filesystem::create_directories(m_dir, ec);
+    std::string path = GetPath(m_track);
+    std::string tmp_path = path + ".tmp";
+    {
+        std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+        if (!file.is_open()) {
+            std::cerr << "[TrackMap] Failed to save to " << path << std::endl;
+            return false;
+        }
+        uint32_t count = (uint32_t)m_count;
+        float cell_size = (float)CELL_SIZE_M;
+        file.write(FILE_MAGIC, sizeof(FILE_MAGIC));
+        file.write(reinterpret_cast<const char*>(&FILE_VERSION), sizeof(FILE_VERSION));
+        file.write(reinterpret_cast<const char*>(&cell_size), sizeof(cell_size));
+        file.write(reinterpret_cast<const char*>(&count), sizeof(count));
+        for (size_t i = 0; i < CAPACITY; ++i) {
+            const Cell& c = m_cells[i];
+            if (c.key == EMPTY_KEY) continue;
+            FileCell fc = { c.key, c.mean_square, c.samples };
+            file.write(reinterpret_cast<const char*>(&fc), sizeof(fc));
+        }
+        if (!file) return false;
+    }
+    std::filesystem::rename(tmp_path, path, ec);
+    if (ec) {
+        std::filesystem::remove(tmp_path, ec);
+        return false;
+    }
+    m_dirty = false;
+    return true;
+}
+
+bool TrackTextureMap::Load(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return false;
+
+    char magic[4] = {};
+    uint32_t version = 0, count = 0;
+    float cell_size = 0.0f;
+    file.read(magic, sizeof(magic));
+    file.read(reinterpret_cast<char*>(&version), sizeof(version));
+    file.read(reinterpret_cast<char*>(&cell_size), sizeof(cell_size));
+    file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (!file || std::memcmp(magic, FILE_MAGIC, sizeof(magic)) != 0 || version != FILE_VERSION ||
+        cell_size != (float)CELL_SIZE_M) {
+        std::cerr << "[TrackMap] Ignoring incompatible map " << path << std::endl;
+        return false;
+    }
+
+    for (uint32_t n = 0; n < count; ++n) {
+        FileCell fc;
+        if (!file.read(reinterpret_cast<char*>(&fc), sizeof(fc))) break;
+        if (fc.key == EMPTY_KEY || !std::isfinite(fc.mean_square) || fc.mean_square < 0.0f) continue;
+        Cell* c = Find(fc.key, true);
+        if (!c) break;
+        c->mean_square = fc.mean_square;
+        c->samples = (std::min)(fc.samples, MAX_AVERAGE_SAMPLES);
+    }
+    m_dirty = false;
+    return true;
+}
@@ -0,0 +1,80 @@
+#ifndef TRACKTEXTUREMAP_H
+#define TRACKTEXTUREMAP_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+
+#include "lmu_sm_interface/InternalsPluginWrapper.h"
+
+// Track Texture Map (v0.7.112)
+// Learns the road texture amplitude (RMS) per location on a grid-hashed spatial
+// index (2 m cells in the ground plane, 8 m vertical buckets to separate bridges)
+// and persists it per track. The signed texture averages out to zero, its
+// amplitude does not. Looking the map up slightly ahead of the car lets the road
+// texture lead the reactive telemetry signal, so kerbs no longer arrive late.
+//
+// Threading: Learn/Predict/Activate are called from the FFB thread only. Track
+// changes are handed over to ServiceIO() on the main thread, which owns all file
+// I/O; the FFB thread does not touch the table while a switch is pending.
+class TrackTextureMap {
+public:
+    static constexpr double CELL_SIZE_M = 2.0;
+    static constexpr double VERTICAL_CELL_SIZE_M = 8.0;
+    static constexpr size_t CAPACITY = 1u << 16;          // Power of two
+    static constexpr size_t MAX_FILL = CAPACITY * 3 / 4;  // Keep probe chains short
+    static constexpr uint32_t MAX_AVERAGE_SAMPLES = 64;   // Running mean square -> EMA after this
+    static constexpr uint32_t MIN_CONFIDENT_SAMPLES = 24; // ~2 passes at racing speed
+
+    TrackTextureMap() = default;
+    TrackTextureMap(const TrackTextureMap&) = delete;
+    TrackTextureMap& operator=(const TrackTextureMap&) = delete;
+
+    // FFB thread: true when the map for this track is loaded and usable.
+    // A different track name queues a switch for ServiceIO().
+    bool Activate(const char* track_name);
+
+    void Learn(const TelemVect3& pos, double value);
+    // Returns the confidence (0..1) and the learned RMS amplitude at pos.
+    double Predict(const TelemVect3& pos, double& amplitude) const;
+
+    // Main thread: saves the previous track and loads the requested one.
+    void ServiceIO();
+    bool Save();
+
+    void SetDirectory(const std::string& dir) { m_dir = dir; }
+    std::string GetPath(const std::string& track_name) const;
+    const char* GetTrackName() const { return m_track; }
+    size_t GetCellCount() const { return m_count; }
+    bool IsReady() const { return m_state.load(std::memory_order_acquire) == STATE_READY; }
+
+private:
+    struct Cell {
+        uint64_t key;
+        float mean_square;
+        uint32_t samples;
+    };
+
+    static constexpr uint64_t EMPTY_KEY = ~0ull;
+    static constexpr int STATE_IDLE = 0;
+    static constexpr int STATE_READY = 1;
+    static constexpr int STATE_SWITCHING = 2;
+
+    static uint64_t MakeKey(const TelemVect3& pos);
+    Cell* Find(uint64_t key, bool insert);
+    const Cell* Find(uint64_t key) const;
+    void Clear();
+    bool Load(const std::string& path);
+
+    std::unique_ptr<Cell[]> m_cells; // Allocated on first use (isolated engines never pay for it)
+    size_t m_count = 0;
+    bool m_dirty = false;
+    char m_track[64] = "";
+    char m_requested[64] = "";
+    std::atomic<int> m_state{STATE_IDLE};
+    std::string m_dir = "track_maps";
+};
+
+#endif // TRACKTEXTUREMAP_H
@@ -0,0 +1,224 @@
+#include "VehicleProfileStore.h"
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+constexpr char STORE_MAGIC[8] = { 'L', 'M', 'U', 'P', 'R', 'O', 'F', '1' };
+
+} // namespace
+
+static_assert((size_t)ProfileField::Count <= 16, "VehicleProfileRecord::values is full");
+static_assert(sizeof(VehicleProfileRecord) == 208, "VehicleProfileRecord is part of the file format");
+
+VehicleProfileStore& VehicleProfileStore::Get() {
+    static VehicleProfileStore instance;
+    return instance;
+}
+
+VehicleProfileStore::VehicleProfileStore() : m_heap(new unsigned char[FILE_SIZE]) {
+    std::memset(m_heap.get(), 0, FILE_SIZE);
+    m_base = m_heap.get();
+    InitHeader(reinterpret_cast<Header*>(m_base));
+}
+
+VehicleProfileStore::~VehicleProfileStore() {
+    Close();
+}
+
+uint64_t VehicleProfileStore::HashName(const char* name) {
+    // FNV-1a; 0 is reserved for empty slots
+    uint64_t h = 14695981039346656037ull;
+    for (const char* p = name; *p; ++p) {
+        h ^= (unsigned char)*p;
+        h *= 1099511628211ull;
+    }
+    return h ? h : 1;
+}
+
+void VehicleProfileStore::InitHeader(Header* h) const {
+    std::memcpy(h->magic, STORE_MAGIC, sizeof(STORE_MAGIC));
+    h->version = FILE_VERSION;
+    h->capacity = CAPACITY;
+    h->record_size = (uint32_t)sizeof(VehicleProfileRecord);
+    h->reserved = 0;
+}
+
+VehicleProfileRecord* VehicleProfileStore::Slot(const char* vehicle, bool insert) const {
+    if (!vehicle || vehicle[0] == '\0') return nullptr;
+    VehicleProfileRecord* records = reinterpret_cast<VehicleProfileRecord*>(m_base + sizeof(Header));
+    uint64_t hash = HashName(vehicle);
+    uint32_t i = (uint32_t)(hash & (CAPACITY - 1));
+    for (uint32_t probe = 0; probe < CAPACITY; ++probe, i = (i + 1) & (CAPACITY - 1)) {
+        VehicleProfileRecord& r = records[i];
+        if (r.name_hash == hash && std::strncmp(r.name, vehicle, sizeof(r.name) - 1) == 0) return &r;
+        if (r.name_hash == 0) {
+            if (!insert) return nullptr;
+            std::memset(&r, 0, sizeof(r));
+            std::strncpy(r.name, vehicle, sizeof(r.name) - 1);
+            r.name_hash = hash; // Written last: the slot is claimed once the name is complete
+            return &r;
+        }
+    }
+    return nullptr; // Table full
+}
+
+bool VehicleProfileStore::GetField(const char* vehicle, ProfileField field, double& value) const {
+    if (field >= ProfileField::Count) return false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const VehicleProfileRecord* r = Slot(vehicle, false);
+    uint32_t bit = 1u << (uint32_t)field;
+    if (!r || !(r->valid_mask & bit)) return false;
+    value = r->values[(uint32_t)field];
+    return true;
+}
+
+bool VehicleProfileStore::SetField(const char* vehicle, ProfileField field, double value) {
+    if (field >= ProfileField::Count || !std::isfinite(value)) return false;
+    std::lock_guard<std::mutex> lock(m_mutex);
+    VehicleProfileRecord* r = Slot(vehicle, true);
+    if (!r) return false;
+    r->values[(uint32_t)field] = value;
+    r->valid_mask |= 1u << (uint32_t)field;
+    r->update_count++;
+    return true;
+}
+
+bool VehicleProfileStore::Find(const char* vehicle, VehicleProfileRecord& out) const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const VehicleProfileRecord* r = Slot(vehicle, false);
+    if (!r) return false;
+    out = *r;
+    return true;
+}
+
+void VehicleProfileStore::Erase(const char* vehicle) {
+    // Slots are never freed (keeps probe chains intact); the vehicle just loses its values.
+    std::lock_guard<std::mutex> lock(m_mutex);
+    VehicleProfileRecord* r = Slot(vehicle, false);
+    if (r) r->valid_mask = 0;
+}
+
+void VehicleProfileStore::Clear() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    std::memset(m_base + sizeof(Header), 0, sizeof(VehicleProfileRecord) * CAPACITY);
+}
+
+size_t VehicleProfileStore::GetVehicleCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    const VehicleProfileRecord* records = reinterpret_cast<const VehicleProfileRecord*>(m_base + sizeof(Header));
+    size_t count = 0;
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        if (records[i].name_hash != 0 && records[i].valid_mask != 0) count++;
+    }
+    return count;
+}
+
+bool VehicleProfileStore::Open(const std::string& path) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Keep what was learned before the file was available
+    std::vector<VehicleProfileRecord> carry;
+    const VehicleProfileRecord* old_records = reinterpret_cast<const VehicleProfileRecord*>(m_base + sizeof(Header));
+    for (uint32_t i = 0; i < CAPACITY; ++i) {
+        if (old_records[i].name_hash != 0 && old_records[i].valid_mask != 0) carry.push_back(old_records[i]);
+    }
+    Unmap();
+
+#ifdef _WIN32
+    HANDLE file = CreateFileA(path.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ, NULL, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, NULL);
+    if (file == INVALID_HANDLE_VALUE) {
+        std::cerr << "[Profiles] Failed to open " << path << std::endl;
+        return false;
+    }
+    LARGE_INTEGER size = {};
+    GetFileSizeEx(file, &size);
+    bool fresh = (size.QuadPart != (LONGLONG)FILE_SIZE);
+    HANDLE map = CreateFileMappingA(file, NULL, PAGE_READWRITE, 0, (DWORD)FILE_SIZE, NULL);
+    void* view = map ? MapViewOfFile(map, FILE_MAP_ALL_ACCESS, 0, 0, FILE_SIZE) : nullptr;
+    if (!view) {
+        if (map) CloseHandle(map);
+        CloseHandle(file);
+        std::cerr << "[Profiles] Failed to map " << path << std::endl;
+        return false;
+    }
+    m_file_handle = file;
+    m_map_handle = map;
+#else
+    int fd = open(path.c_str(), O_RDWR | O_CREAT, 0644);
+    if (fd < 0) {
+        std::cerr << "[Profiles] Failed to open " << path << std::endl;
+        return false;
+    }
+    struct stat st = {};
+    fstat(fd, &st);
+    bool fresh = (st.st_size != (off_t)FILE_SIZE);
+    void* view = MAP_FAILED;
+    if (ftruncate(fd, (off_t)FILE_SIZE) == 0) {
+        view = mmap(nullptr, FILE_SIZE, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    }
+    if (view == MAP_FAILED) {
+        close(fd);
+        std::cerr << "[Profiles] Failed to map " << path << std::endl;
+        return false;
+    }
+    m_fd = fd;
+#endif
+
+    m_mapping = view;
+    m_base = static_cast<unsigned char*>(view);
+    Header* h = reinterpret_cast<Header*>(m_base);
+    if (fresh || std::memcmp(h->magic, STORE_MAGIC, sizeof(STORE_MAGIC)) != 0 || h->version != FILE_VERSION ||
+        h->capacity != CAPACITY || h->record_size != sizeof(VehicleProfileRecord)) {
+        if (!fresh) std::cout << "[Profiles] Reinitializing incompatible " << path << std::endl;
+        std::memset(m_base, 0, FILE_SIZE);
+        InitHeader(h);
+    }
+
+    for (const auto& rec : carry) {
+        VehicleProfileRecord* r = Slot(rec.name, true);
+        if (!r) break;
+        for (uint32_t f = 0; f < (uint32_t)ProfileField::Count; ++f) {
+            if (rec.valid_mask & (1u << f)) r->values[f] = rec.values[f];
+        }
+        r->valid_mask |= rec.valid_mask;
+        r->update_count += rec.update_count;
+    }
+    return true;
+}
+
+void VehicleProfileStore::Close() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    Unmap();
+}
+
+void VehicleProfileStore::Unmap() {
+    if (!m_mapping) return;
+    if (m_base != m_heap.get()) std::memcpy(m_heap.get(), m_base, FILE_SIZE);
+#ifdef _WIN32
+    FlushViewOfFile(m_mapping, FILE_SIZE);
+    UnmapViewOfFile(m_mapping);
+    CloseHandle((HANDLE)m_map_handle);
+    CloseHandle((HANDLE)m_file_handle);
+    m_map_handle = nullptr;
+    m_file_handle = nullptr;
+#else
+    msync(m_mapping, FILE_SIZE, MS_SYNC);
+    munmap(m_mapping, FILE_SIZE);
+    close(m_fd);
+    m_fd = -1;
+#endif
+    m_mapping = nullptr;
+    m_base = m_heap.get();
+}
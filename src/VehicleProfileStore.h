@@ -0,0 +1,87 @@
+#ifndef VEHICLEPROFILESTORE_H
+#define VEHICLEPROFILESTORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string>
+
+// Learned per-vehicle values (v0.7.112). Slots are part of the file format:
+// append new fields before Count, never reorder.
+enum class ProfileField : uint32_t {
+    StaticFrontLoad = 0,  // N, latched between 2 and 15 m/s
+    SessionPeakTorque,    // Nm, dynamic normalization peak
+    AutoPeakLoad,         // N, tactile normalization peak
+    OptimalSlipAngle,     // rad
+    Count
+};
+
+struct VehicleProfileRecord {
+    uint64_t name_hash;   // 0 = empty slot
+    char name[64];
+    uint32_t valid_mask;  // Bit per ProfileField
+    uint32_t update_count;
+    double values[16];    // Indexed by ProfileField, spare slots for future fields
+};
+
+// Vehicle Profile Store (v0.7.112)
+// Fixed-size open-addressing table of learned per-car values, indexed by a hash of
+// mVehicleName. After Open() the table lives in a memory-mapped file and every
+// update is a store into the mapping: no INI rewrite, the OS writes the pages back.
+// Before Open() (tests, tools) the same table lives on the heap and is not persisted.
+// All calls are short and allocation-free, so the FFB thread may use them directly.
+class VehicleProfileStore {
+public:
+    static constexpr uint32_t CAPACITY = 1024; // Power of two
+    static constexpr uint32_t FILE_VERSION = 1;
+
+    static VehicleProfileStore& Get();
+
+    // Maps the file (created or reinitialized if missing/incompatible). Entries
+    // recorded before Open() are carried over. Returns false if mapping failed;
+    // the store then keeps working in memory.
+    bool Open(const std::string& path);
+    void Close(); // Flushes and unmaps; contents stay available in memory
+    bool IsMapped() const { return m_mapping != nullptr; }
+
+    bool GetField(const char* vehicle, ProfileField field, double& value) const;
+    bool SetField(const char* vehicle, ProfileField field, double value);
+    bool Find(const char* vehicle, VehicleProfileRecord& out) const;
+    void Erase(const char* vehicle);  // Invalidates every field of the vehicle
+    void Clear();
+    size_t GetVehicleCount() const;
+
+    static uint64_t HashName(const char* name);
+
+private:
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t capacity;
+        uint32_t record_size;
+        uint32_t reserved;
+    };
+
+    static constexpr size_t FILE_SIZE = sizeof(Header) + sizeof(VehicleProfileRecord) * CAPACITY;
+
+    VehicleProfileStore();
+    ~VehicleProfileStore();
+
+    VehicleProfileRecord* Slot(const char* vehicle, bool insert) const;
+    void InitHeader(Header* h) const;
+    void Unmap();
+
+    mutable std::mutex m_mutex;
+    std::unique_ptr<unsigned char[]> m_heap;
+    unsigned char* m_base = nullptr;  // Header followed by CAPACITY records
+    void* m_mapping = nullptr;
+#ifdef _WIN32
+    void* m_file_handle = nullptr;
+    void* m_map_handle = nullptr;
+#else
+    int m_fd = -1;
+#endif
+};
+
+#endif // VEHICLEPROFILESTORE_H
@@ -1,90 +1,335 @@
 #include "VehicleUtils.h"
 #include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <mutex>
+#include <queue>
+#include <stdexcept>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
-// Helper: Parse car class from strings (v0.7.44 Refactor)
-// Returns a ParsedVehicleClass enum for internal logic and categorization
-ParsedVehicleClass ParseVehicleClass(const char* className, const char* vehicleName) {
-    std::string cls = className ? className : "";
-    std::string name = vehicleName ? vehicleName : "";
+namespace {
 
-    // Normalize for case-insensitive matching
-    std::transform(cls.begin(), cls.end(), cls.begin(), ::toupper);
-    std::transform(name.begin(), name.end(), name.begin(), ::toupper);
+constexpr size_t CLASS_COUNT = (size_t)ParsedVehicleClass::GT3 + 1;
+constexpr size_t MAX_CACHE_ENTRIES = 256; // Cars seen in one session; cleared when full
 
-    // 1. Primary Identification via Class Name (Hierarchical)
-    if (cls.find("HYPERCAR") != std::string::npos || cls.find("LMH") != std::string::npos || cls.find("LMDH") != std::string::npos) {
-        return ParsedVehicleClass::HYPERCAR;
-    }
-    
-    if (cls.find("LMP2") != std::string::npos) {
-        if (cls.find("ELMS") != std::string::npos || name.find("DERESTRICTED") != std::string::npos) { return ParsedVehicleClass::LMP2_UNRESTRICTED; }
-        volatile bool is_wec = (cls.find("WEC") != std::string::npos);
-        if (is_wec) { return ParsedVehicleClass::LMP2_RESTRICTED; }
-        return ParsedVehicleClass::LMP2_UNSPECIFIED;
-    }
+enum class MatchField : uint8_t { Class, Name };
+
+struct Condition {
+    MatchField field;
+    int pattern; // Index into ClassTable::patterns
+};
+
+// A rule matches when all of its conditions do (1 or 2). First matching rule wins.
+struct Rule {
+    Condition cond[2];
+    int cond_count;
+    ParsedVehicleClass result;
+};
+
+struct BuiltinRule {
+    MatchField field;
+    const char* pattern;
+    MatchField field2;
+    const char* pattern2; // nullptr = single condition
+    ParsedVehicleClass result;
+};
+
+// Built-in classification (v0.7.44 hierarchy). Order is priority: class name first
+// (LMP2 sub-variants before the generic LMP2), then vehicle name keywords.
+constexpr BuiltinRule kBuiltinRules[] = {
+    { MatchField::Class, "HYPERCAR", MatchField::Class, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Class, "LMH",      MatchField::Class, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Class, "LMDH",     MatchField::Class, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Class, "LMP2", MatchField::Class, "ELMS",         ParsedVehicleClass::LMP2_UNRESTRICTED },
+    { MatchField::Class, "LMP2", MatchField::Name,  "DERESTRICTED", ParsedVehicleClass::LMP2_UNRESTRICTED },
+    { MatchField::Class, "LMP2", MatchField::Class, "WEC",          ParsedVehicleClass::LMP2_RESTRICTED },
+    { MatchField::Class, "LMP2",     MatchField::Class, nullptr, ParsedVehicleClass::LMP2_UNSPECIFIED },
+    { MatchField::Class, "LMP3",     MatchField::Class, nullptr, ParsedVehicleClass::LMP3 },
+    { MatchField::Class, "GTE",      MatchField::Class, nullptr, ParsedVehicleClass::GTE },
+    { MatchField::Class, "GT3",      MatchField::Class, nullptr, ParsedVehicleClass::GT3 }, // Also covers LMGT3
 
-    if (cls.find("LMP3") != std::string::npos) return ParsedVehicleClass::LMP3;
-    if (cls.find("GTE") != std::string::npos) return ParsedVehicleClass::GTE;
-    // NOTE: LMGT3 check is redundant here as GT3 would match it first.
-    if (cls.find("GT3") != std::string::npos || cls.find("LMGT3") != std::string::npos) return ParsedVehicleClass::GT3;
-
-    // 2. Secondary Identification via Vehicle Name Keywords (Fallback)
-    if (!name.empty()) {
-        // Hypercars
-        if (name.find("499P") != std::string::npos || name.find("GR010") != std::string::npos ||
-            name.find("963") != std::string::npos || name.find("9X8") != std::string::npos ||
-            name.find("V-SERIES.R") != std::string::npos || name.find("SCG 007") != std::string::npos ||
-            name.find("GLICKENHAUS") != std::string::npos || name.find("VANWALL") != std::string::npos ||
-            name.find("A424") != std::string::npos || name.find("SC63") != std::string::npos ||
-            name.find("VALKYRIE") != std::string::npos || name.find("M HYBRID") != std::string::npos ||
-            name.find("TIPO 6") != std::string::npos || name.find("680") != std::string::npos) {
-            return ParsedVehicleClass::HYPERCAR;
+    // Hypercars
+    { MatchField::Name, "499P",        MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "GR010",       MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "963",         MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "9X8",         MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "V-SERIES.R",  MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "SCG 007",     MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "GLICKENHAUS", MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "VANWALL",     MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "A424",        MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "SC63",        MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "VALKYRIE",    MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "M HYBRID",    MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "TIPO 6",      MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    { MatchField::Name, "680",         MatchField::Name, nullptr, ParsedVehicleClass::HYPERCAR },
+    // LMP2
+    { MatchField::Name, "ORECA",       MatchField::Name, nullptr, ParsedVehicleClass::LMP2_UNSPECIFIED },
+    { MatchField::Name, "07",          MatchField::Name, nullptr, ParsedVehicleClass::LMP2_UNSPECIFIED },
+    // LMP3
+    { MatchField::Name, "LIGIER",      MatchField::Name, nullptr, ParsedVehicleClass::LMP3 },
+    { MatchField::Name, "GINETTA",     MatchField::Name, nullptr, ParsedVehicleClass::LMP3 },
+    { MatchField::Name, "DUQUEINE",    MatchField::Name, nullptr, ParsedVehicleClass::LMP3 },
+    { MatchField::Name, "P320",        MatchField::Name, nullptr, ParsedVehicleClass::LMP3 },
+    { MatchField::Name, "P325",        MatchField::Name, nullptr, ParsedVehicleClass::LMP3 },
+    { MatchField::Name, "G61",         MatchField::Name, nullptr, ParsedVehicleClass::LMP3 },
+    { MatchField::Name, "D09",         MatchField::Name, nullptr, ParsedVehicleClass::LMP3 },
+    // GTE
+    { MatchField::Name, "RSR-19",      MatchField::Name, nullptr, ParsedVehicleClass::GTE },
+    { MatchField::Name, "488 GTE",     MatchField::Name, nullptr, ParsedVehicleClass::GTE },
+    { MatchField::Name, "C8.R",        MatchField::Name, nullptr, ParsedVehicleClass::GTE },
+    { MatchField::Name, "VANTAGE AMR", MatchField::Name, nullptr, ParsedVehicleClass::GTE },
+    // GT3
+    { MatchField::Name, "LMGT3",       MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+    { MatchField::Name, "296 GT3",     MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+    { MatchField::Name, "M4 GT3",      MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+    { MatchField::Name, "Z06 GT3",     MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+    { MatchField::Name, "HURACAN",     MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+    { MatchField::Name, "RC F",        MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+    { MatchField::Name, "720S",        MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+    { MatchField::Name, "MUSTANG",     MatchField::Name, nullptr, ParsedVehicleClass::GT3 },
+};
+
+// Indexed by ParsedVehicleClass
+constexpr double kBuiltinLoads[CLASS_COUNT] = {
+    4500.0, // UNKNOWN
+    9500.0, // HYPERCAR
+    8500.0, // LMP2_UNRESTRICTED
+    7500.0, // LMP2_RESTRICTED
+    8000.0, // LMP2_UNSPECIFIED
+    5800.0, // LMP3
+    5500.0, // GTE
+    4800.0, // GT3
+};
+
+// Aho-Corasick automaton over all rule patterns. Input bytes are folded to
+// upper case and mapped to a compact alphabet, so one pass over each string
+// finds every pattern without copying or transforming it.
+class PatternMatcher {
+public:
+    void Build(const std::vector<std::string>& patterns) {
+        m_pattern_count = patterns.size();
+        std::fill(std::begin(m_symbol), std::end(m_symbol), (uint16_t)0);
+        m_alphabet = 1; // 0 = byte that appears in no pattern
+        for (const auto& p : patterns) {
+            for (unsigned char ch : p) {
+                if (m_symbol[ch] == 0) m_symbol[ch] = (uint16_t)m_alphabet++;
+            }
         }
-        
-        // LMP2
-        if (name.find("ORECA") != std::string::npos || name.find("07") != std::string::npos) {
-            return ParsedVehicleClass::LMP2_UNSPECIFIED;
+        // Lower-case input shares the symbol of its upper-case form
+        for (int ch = 0; ch < 256; ++ch) {
+            int up = std::toupper(ch);
+            if (up != ch && m_symbol[up] != 0) m_symbol[ch] = m_symbol[up];
         }
 
-        // LMP3
-        if (name.find("LIGIER") != std::string::npos || name.find("GINETTA") != std::string::npos ||
-            name.find("DUQUEINE") != std::string::npos || name.find("P320") != std::string::npos ||
-            name.find("P325") != std::string::npos || name.find("G61") != std::string::npos ||
-            name.find("D09") != std::string::npos) {
-            return ParsedVehicleClass::LMP3;
+        // Trie
+        m_next.assign(m_alphabet, -1);
+        m_output.assign(1, {});
+        for (size_t id = 0; id < patterns.size(); ++id) {
+            int state = 0;
+            for (unsigned char ch : patterns[id]) {
+                size_t edge = (size_t)state * m_alphabet + m_symbol[ch];
+                if (m_next[edge] < 0) {
+                    m_next[edge] = (int)m_output.size();
+                    m_output.emplace_back();
+                    m_next.resize(m_next.size() + m_alphabet, -1);
+                }
+                state = m_next[edge];
+            }
+            m_output[state].push_back((int)id);
         }
 
-        // GTE
-        if (name.find("RSR-19") != std::string::npos || name.find("488 GTE") != std::string::npos ||
-            name.find("C8.R") != std::string::npos || name.find("VANTAGE AMR") != std::string::npos) {
-            return ParsedVehicleClass::GTE;
+        // Failure links folded into a full transition table (BFS order)
+        std::vector<int> fail(m_output.size(), 0);
+        std::queue<int> queue;
+        for (size_t s = 0; s < m_alphabet; ++s) {
+            int& next = m_next[s];
+            if (next < 0) { next = 0; continue; }
+            fail[next] = 0;
+            queue.push(next);
         }
+        while (!queue.empty()) {
+            int state = queue.front();
+            queue.pop();
+            const auto& inherited = m_output[fail[state]];
+            m_output[state].insert(m_output[state].end(), inherited.begin(), inherited.end());
+            for (size_t s = 0; s < m_alphabet; ++s) {
+                int& next = m_next[(size_t)state * m_alphabet + s];
+                int via_fail = m_next[(size_t)fail[state] * m_alphabet + s];
+                if (next < 0) { next = via_fail; continue; }
+                fail[next] = via_fail;
+                queue.push(next);
+            }
+        }
+    }
 
-        // GT3
-        if (name.find("LMGT3") != std::string::npos || name.find("296 GT3") != std::string::npos ||
-            name.find("M4 GT3") != std::string::npos || name.find("Z06 GT3") != std::string::npos ||
-            name.find("HURACAN") != std::string::npos || name.find("RC F") != std::string::npos ||
-            name.find("720S") != std::string::npos || name.find("MUSTANG") != std::string::npos) {
-            return ParsedVehicleClass::GT3;
+    // Sets matched[id] for every pattern that occurs in text
+    void Scan(const char* text, std::vector<uint8_t>& matched) const {
+        matched.assign(m_pattern_count, 0);
+        if (!text) return;
+        int state = 0;
+        for (const unsigned char* p = (const unsigned char*)text; *p; ++p) {
+            state = m_next[(size_t)state * m_alphabet + m_symbol[*p]];
+            for (int id : m_output[state]) matched[id] = 1;
         }
     }
 
-    return ParsedVehicleClass::UNKNOWN;
+private:
+    uint16_t m_symbol[256] = {};
+    size_t m_alphabet = 1;
+    size_t m_pattern_count = 0;
+    std::vector<int> m_next;                // state * alphabet + symbol -> state
+    std::vector<std::vector<int>> m_output; // Pattern ids ending at each state
+};
+
+struct CacheEntry {
+    std::string cls;
+    std::string name;
+    ParsedVehicleClass result;
+};
+
+struct ClassTable {
+    std::vector<std::string> patterns;
+    std::vector<Rule> rules;
+    std::vector<Rule> file_rules; // Kept separately so a reload can rebuild the table
+    double loads[CLASS_COUNT];
+    PatternMatcher matcher;
+    std::unordered_map<uint64_t, CacheEntry> cache;
+    std::mutex mutex;
+
+    ClassTable() { Reset(); }
+
+    int Intern(const std::string& pattern) {
+        auto it = std::find(patterns.begin(), patterns.end(), pattern);
+        if (it != patterns.end()) return (int)(it - patterns.begin());
+        patterns.push_back(pattern);
+        return (int)patterns.size() - 1;
+    }
+
+    void Reset() {
+        patterns.clear();
+        rules.clear();
+        file_rules.clear();
+        std::copy(std::begin(kBuiltinLoads), std::end(kBuiltinLoads), loads);
+        Rebuild();
+    }
+
+    void Rebuild() {
+        std::vector<Rule> builtin;
+        for (const auto& b : kBuiltinRules) {
+            Rule r = {};
+            r.cond[0] = { b.field, Intern(b.pattern) };
+            r.cond_count = 1;
+            if (b.pattern2) r.cond[r.cond_count++] = { b.field2, Intern(b.pattern2) };
+            r.result = b.result;
+            builtin.push_back(r);
+        }
+        rules = file_rules;
+        rules.insert(rules.end(), builtin.begin(), builtin.end());
+        matcher.Build(patterns);
+        cache.clear();
+    }
+
+    ParsedVehicleClass Classify(const char* cls, const char* name) const {
+        std::vector<uint8_t> in_class, in_name;
+        matcher.Scan(cls, in_class);
+        matcher.Scan(name, in_name);
+        for (const auto& r : rules) {
+            bool ok = true;
+            for (int c = 0; c < r.cond_count && ok; ++c) {
+                const auto& hits = (r.cond[c].field == MatchField::Class) ? in_class : in_name;
+                ok = hits[r.cond[c].pattern] != 0;
+            }
+            if (ok) return r.result;
+        }
+        return ParsedVehicleClass::UNKNOWN;
+    }
+};
+
+ClassTable& Table() {
+    // Built once on first use (thread-safe static init)
+    static ClassTable table;
+    return table;
+}
+
+uint64_t HashPair(const char* cls, const char* name) {
+    // FNV-1a over "class\0name"
+    uint64_t h = 14695981039346656037ull;
+    for (const char* p = cls; *p; ++p) { h ^= (unsigned char)*p; h *= 1099511628211ull; }
+    h *= 1099511628211ull;
+    for (const char* p = name; *p; ++p) { h ^= (unsigned char)*p; h *= 1099511628211ull; }
+    return h;
+}
+
+std::string Trim(const std::string& s) {
+    size_t b = s.find_first_not_of(" \t\r\n");
+    if (b == std::string::npos) return "";
+    size_t e = s.find_last_not_of(" \t\r\n");
+    return s.substr(b, e - b + 1);
+}
+
+std::string ToUpper(std::string s) {
+    std::transform(s.begin(), s.end(), s.begin(), [](unsigned char c) { return (char)std::toupper(c); });
+    return s;
+}
+
+// Accepts the display name ("LMP2 Unrestricted") or the enum spelling ("LMP2_UNRESTRICTED")
+bool ParseClassName(const std::string& text, ParsedVehicleClass& out) {
+    std::string key = ToUpper(Trim(text));
+    std::replace(key.begin(), key.end(), ' ', '_');
+    for (size_t i = 0; i < CLASS_COUNT; ++i) {
+        std::string candidate = ToUpper(VehicleClassToString((ParsedVehicleClass)i));
+        std::replace(candidate.begin(), candidate.end(), ' ', '_');
+        if (key == candidate) { out = (ParsedVehicleClass)i; return true; }
+    }
+    return false;
+}
+
+// "class:LMP2" or "name:REVUELTO"
+bool ParseCondition(ClassTable& t, const std::string& text, Condition& out) {
+    size_t colon = text.find(':');
+    if (colon == std::string::npos) return false;
+    std::string field = ToUpper(Trim(text.substr(0, colon)));
+    std::string pattern = ToUpper(Trim(text.substr(colon + 1)));
+    if (pattern.empty()) return false;
+    if (field == "CLASS") out.field = MatchField::Class;
+    else if (field == "NAME") out.field = MatchField::Name;
+    else return false;
+    out.pattern = t.Intern(pattern);
+    return true;
+}
+
+} // namespace
+
+// Helper: Parse car class from strings (v0.7.44 Refactor, table-driven since v0.7.112)
+// Returns a ParsedVehicleClass enum for internal logic and categorization
+ParsedVehicleClass ParseVehicleClass(const char* className, const char* vehicleName) {
+    const char* cls = className ? className : "";
+    const char* name = vehicleName ? vehicleName : "";
+
+    ClassTable& t = Table();
+    std::lock_guard<std::mutex> lock(t.mutex);
+    uint64_t key = HashPair(cls, name);
+    auto it = t.cache.find(key);
+    if (it != t.cache.end() && it->second.cls == cls && it->second.name == name) return it->second.result;
+
+    ParsedVehicleClass result = t.Classify(cls, name);
+    if (t.cache.size() >= MAX_CACHE_ENTRIES) t.cache.clear();
+    t.cache[key] = { cls, name, result };
+    return result;
 }
 
 // Lookup table: Map ParsedVehicleClass to Seed Load (Newtons)
 double GetDefaultLoadForClass(ParsedVehicleClass vclass) {
-    switch (vclass) {
-        case ParsedVehicleClass::HYPERCAR:         return 9500.0;
-        case ParsedVehicleClass::LMP2_UNRESTRICTED: return 8500.0;
-        case ParsedVehicleClass::LMP2_RESTRICTED:   return 7500.0;
-        case ParsedVehicleClass::LMP2_UNSPECIFIED:  return 8000.0;
-        case ParsedVehicleClass::LMP3:             return 5800.0;
-        case ParsedVehicleClass::GTE:              return 5500.0;
-        case ParsedVehicleClass::GT3:              return 4800.0;
-        default:                                   return 4500.0;
-    }
+    size_t i = (size_t)vclass;
+    if (i >= CLASS_COUNT) i = (size_t)ParsedVehicleClass::UNKNOWN;
+    ClassTable& t = Table();
+    std::lock_guard<std::mutex> lock(t.mutex);
+    return t.loads[i];
 }
 
 // Helper: String representation of parsed class for logging and UI
@@ -100,3 +345,66 @@ const char* VehicleClassToString(ParsedVehicleClass vclass) {
         default:                                   return "Unknown";
     }
 }
+
+bool LoadVehicleClassTable(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) return false;
+
+    ClassTable& t = Table();
+    std::lock_guard<std::mutex> lock(t.mutex);
+    t.patterns.clear();
+    t.file_rules.clear();
+    std::copy(std::begin(kBuiltinLoads), std::end(kBuiltinLoads), t.loads);
+
+    std::string section, line;
+    int line_no = 0, rule_count = 0;
+    while (std::getline(file, line)) {
+        line_no++;
+        line = Trim(line.substr(0, line.find(';')));
+        if (line.empty()) continue;
+        if (line.front() == '[' && line.back() == ']') {
+            section = ToUpper(line.substr(1, line.size() - 2));
+            continue;
+        }
+        size_t eq = line.rfind('=');
+        if (eq == std::string::npos) {
+            std::cerr << "[VehicleClass] " << path << ":" << line_no << ": missing '='" << std::endl;
+            continue;
+        }
+        std::string lhs = line.substr(0, eq);
+        std::string rhs = Trim(line.substr(eq + 1));
+
+        ParsedVehicleClass vclass;
+        if (section == "RULES") {
+            Rule r = {};
+            size_t plus = lhs.find('+');
+            bool ok = ParseCondition(t, lhs.substr(0, plus), r.cond[0]);
+            r.cond_count = 1;
+            if (ok && plus != std::string::npos) ok = ParseCondition(t, lhs.substr(plus + 1), r.cond[r.cond_count++]);
+            if (!ok || !ParseClassName(rhs, vclass)) {
+                std::cerr << "[VehicleClass] " << path << ":" << line_no << ": invalid rule" << std::endl;
+                continue;
+            }
+            r.result = vclass;
+            t.file_rules.push_back(r);
+            rule_count++;
+        } else if (section == "LOADS") {
+            try {
+                double load = std::stod(rhs);
+                if (!ParseClassName(lhs, vclass) || load <= 0.0) throw std::invalid_argument("load");
+                t.loads[(size_t)vclass] = load;
+            } catch (...) {
+                std::cerr << "[VehicleClass] " << path << ":" << line_no << ": invalid load" << std::endl;
+            }
+        }
+    }
+    t.Rebuild();
+    std::cout << "[VehicleClass] Loaded " << rule_count << " rules from " << path << std::endl;
+    return true;
+}
+
+void ResetVehicleClassTable() {
+    ClassTable& t = Table();
+    std::lock_guard<std::mutex> lock(t.mutex);
+    t.Reset();
+}
@@ -14,7 +14,8 @@ enum class ParsedVehicleClass {
     GT3                // 4800N
 };
 
-// Returns a ParsedVehicleClass enum for internal logic and categorization
+// Returns a ParsedVehicleClass enum for internal logic and categorization.
+// Results are cached per (class, name) pair; thread-safe.
 ParsedVehicleClass ParseVehicleClass(const char* className, const char* vehicleName);
 
 // Lookup table: Map ParsedVehicleClass to Seed Load (Newtons)
@@ -23,4 +24,15 @@ double GetDefaultLoadForClass(ParsedVehicleClass vclass);
 // Helper: String representation of parsed class for logging and UI
 const char* VehicleClassToString(ParsedVehicleClass vclass);
 
+// Extends the built-in classification table from a text file (v0.7.112):
+//   [Rules]   name:REVUELTO = Hypercar
+//             class:LMP2 + name:EVO = LMP2 Unrestricted
+//   [Loads]   GT3 = 5000
+// File rules are checked before the built-in ones. Returns false if the file
+// could not be opened (the built-in table stays active).
+bool LoadVehicleClassTable(const std::string& path);
+
+// Drops file rules/loads and the result cache (tests, reload).
+void ResetVehicleClassTable();
+
 #endif // VEHICLE_UTILS_H
@@ -18,7 +18,13 @@
 #include "Logger.h"    // Added Logger
 #include "RateMonitor.h"
 #include "HealthMonitor.h"
+#include "DiagnosticEvents.h"
+#include "VehicleProfileStore.h"
+#include "FlightRecorder.h"
+#include "AnomalyTrigger.h"
+#include "VehicleUtils.h"
 #include <optional>
+#include <filesystem>
 #include <atomic>
 #include <mutex>
 
@@ -44,11 +50,13 @@ extern std::recursive_mutex g_engine_mutex;
 // --- FFB Loop (High Priority 400Hz) ---
 void FFBThread() {
     std::cout << "[FFB] Loop Started." << std::endl;
-    RateMonitor loopMonitor;
-    RateMonitor telemMonitor;
-    RateMonitor hwMonitor;
-    RateMonitor torqueMonitor;
-    RateMonitor genTorqueMonitor;
+    // Exact sliding-window rates with jitter stats (v0.7.112). Deadlines at 1.5x the
+    // nominal period; torque and hardware events only fire on a change, so no deadline.
+    IntervalRateMonitor loopMonitor(3.75);
+    IntervalRateMonitor telemMonitor(15.0);
+    IntervalRateMonitor hwMonitor;
+    IntervalRateMonitor torqueMonitor;
+    IntervalRateMonitor genTorqueMonitor;
     double lastET = -1.0;
     double lastTorque = -9999.0;
     float lastGenTorque = -9999.0f;
@@ -84,6 +92,13 @@ void FFBThread() {
         loopMonitor.RecordEvent();
         next_tick += target_period;
 
+        // One GetStats() per monitor per tick: each call walks the monitor's interval window
+        const RateStats loopStats = loopMonitor.GetStats();
+        const RateStats telemStats = telemMonitor.GetStats();
+        const RateStats hwStats = hwMonitor.GetStats();
+        const RateStats torqueStats = torqueMonitor.GetStats();
+        const RateStats genTorqueStats = genTorqueMonitor.GetStats();
+
         double force = 0.0;
         double dt = 0.0025; // Default 400Hz
         bool restricted = true;
@@ -92,6 +107,17 @@ void FFBThread() {
             bool in_realtime = GameConnector::Get().CopyTelemetry(g_localData);
             bool is_stale = GameConnector::Get().IsStale(100);
 
+            // Anomaly triggers (v0.7.112): lock timeouts and telemetry stopping mid-session
+            static uint64_t lastLockTimeouts = 0;
+            uint64_t lockTimeouts = GameConnector::Get().GetLockTimeoutCount();
+            if (lockTimeouts != lastLockTimeouts) {
+                AnomalyTrigger::Get().Fire(AnomalyType::LockTimeout, (double)(lockTimeouts - lastLockTimeouts));
+                lastLockTimeouts = lockTimeouts;
+            }
+            static bool was_stale = false;
+            if (in_realtime && is_stale && !was_stale) AnomalyTrigger::Get().Fire(AnomalyType::StaleTelemetry);
+            was_stale = is_stale;
+
             static bool was_in_menu = true;
             if (was_in_menu && in_realtime) {
                 std::cout << "[Game] User entered driving session." << std::endl;
@@ -111,7 +137,7 @@ void FFBThread() {
                     info.slope_alpha_threshold = g_engine.m_slope_alpha_threshold;
                     info.slope_decay_rate = g_engine.m_slope_decay_rate;
                     info.torque_passthrough = g_engine.m_torque_passthrough;
-                    AsyncLogger::Get().Start(info, Config::m_log_path);
+                    AsyncLogger::Get().Start(info, Config::m_log_path, Config::m_log_compress);
                 }
             } else if (!was_in_menu && !in_realtime) {
                 std::cout << "[Game] User exited to menu (FFB Muted)." << std::endl;
@@ -198,27 +224,22 @@ void FFBThread() {
             if (!should_output) force = 0.0;
 
             // Warning for low sample rate (Issue #133)
-            static auto lastWarningTime = std::chrono::steady_clock::now();
 
             HealthStatus health;
             {
                 std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
-                double t_rate = (g_engine.m_torque_source == 1) ? genTorqueMonitor.GetRate() : torqueMonitor.GetRate();
-                health = HealthMonitor::Check(loopMonitor.GetRate(), telemMonitor.GetRate(), t_rate, g_engine.m_torque_source);
+                double t_rate = (g_engine.m_torque_source == 1) ? genTorqueStats.rate_hz : torqueStats.rate_hz;
+                health = HealthMonitor::Check(loopStats.rate_hz, telemStats.rate_hz, t_rate, g_engine.m_torque_source);
             }
 
             if (in_realtime && !health.is_healthy) {
-                 auto now = std::chrono::steady_clock::now();
-                 if (std::chrono::duration_cast<std::chrono::seconds>(now - lastWarningTime).count() >= 5) {
-                     std::string reason = "";
-                     if (health.loop_low) reason += "Loop=" + std::to_string((int)health.loop_rate) + "Hz ";
-                     if (health.telem_low) reason += "Telemetry=" + std::to_string((int)health.telem_rate) + "Hz ";
-                     if (health.torque_low) reason += "Torque=" + std::to_string((int)health.torque_rate) + "Hz (Target " + std::to_string((int)health.expected_torque_rate) + "Hz) ";
-
-                     std::cout << "[WARNING] Low Sample Rate detected: " << reason << std::endl;
-                     Logger::Get().Log("Low Sample Rate detected: %s", reason.c_str());
-                     lastWarningTime = now;
-                 }
+                 double low_rate = health.loop_low ? health.loop_rate : (health.telem_low ? health.telem_rate : health.torque_rate);
+                 AnomalyTrigger::Get().Fire(AnomalyType::LowRate, low_rate);
+                 // v0.7.112: Rate limited (5 s) and logged by the diagnostic event consumer
+                 DiagnosticEvents::Get().Post(DiagEvent::LowSampleRate, nullptr,
+                     health.loop_low ? health.loop_rate : 0.0, health.telem_low ? health.telem_rate : 0.0,
+                     nullptr, nullptr,
+                     health.torque_low ? health.torque_rate : 0.0, health.expected_torque_rate);
             }
         }
 
@@ -229,13 +250,14 @@ void FFBThread() {
             if (dt < 0.0001) dt = 0.0025;
 
             // Push rates to engine for GUI/Snapshot
-            g_engine.m_ffb_rate = loopMonitor.GetRate();
-            g_engine.m_telemetry_rate = telemMonitor.GetRate();
-            g_engine.m_hw_rate = hwMonitor.GetRate();
-            g_engine.m_torque_rate = torqueMonitor.GetRate();
-            g_engine.m_gen_torque_rate = genTorqueMonitor.GetRate();
+            g_engine.m_ffb_rate = loopStats.rate_hz;
+            g_engine.m_telemetry_rate = telemStats.rate_hz;
+            g_engine.m_hw_rate = hwStats.rate_hz;
+            g_engine.m_torque_rate = torqueStats.rate_hz;
+            g_engine.m_gen_torque_rate = genTorqueStats.rate_hz;
 
             force = g_engine.ApplySafetySlew(force, dt, restricted);  // TODO: review for correctedness and bugs
+            FlightRecorder::Get().SetOutput((float)force);
         }
 
         if (DirectInputFFB::Get().UpdateForce(force)) {
@@ -249,8 +271,14 @@ void FFBThread() {
             lastExtLogTime = now;
             if (GameConnector::Get().IsConnected() && g_localData.telemetry.playerHasVehicle) {
                 Logger::Get().Log("--- Telemetry Sample Rates (Hz) ---");
-                Logger::Get().Log("Loop: %.1f, ET: %.1f, HW: %.1f", loopMonitor.GetRate(), telemMonitor.GetRate(), hwMonitor.GetRate());
-                Logger::Get().Log("Torque: Shaft=%.1f, Generic=%.1f", torqueMonitor.GetRate(), genTorqueMonitor.GetRate());
+                Logger::Get().Log("Loop: %.1f, ET: %.1f, HW: %.1f", loopStats.rate_hz, telemStats.rate_hz, hwStats.rate_hz);
+                Logger::Get().Log("Torque: Shaft=%.1f, Generic=%.1f", torqueStats.rate_hz, genTorqueStats.rate_hz);
+                Logger::Get().Log("Loop Interval (ms): mean=%.3f, std=%.3f, min=%.3f, max=%.3f, missed=%zu (total %llu)",
+                    loopStats.mean_ms, loopStats.stddev_ms, loopStats.min_ms, loopStats.max_ms, loopStats.missed,
+                    (unsigned long long)loopStats.missed_total);
+                Logger::Get().Log("ET Interval (ms): mean=%.3f, std=%.3f, min=%.3f, max=%.3f, missed=%zu (total %llu)",
+                    telemStats.mean_ms, telemStats.stddev_ms, telemStats.min_ms, telemStats.max_ms, telemStats.missed,
+                    (unsigned long long)telemStats.missed_total);
                 Logger::Get().Log("Accel: X=%.1f, Y=%.1f, Z=%.1f", mAccX.monitor.GetRate(), mAccY.monitor.GetRate(), mAccZ.monitor.GetRate());
                 Logger::Get().Log("Vel: X=%.1f, Y=%.1f, Z=%.1f", mVelX.monitor.GetRate(), mVelY.monitor.GetRate(), mVelZ.monitor.GetRate());
                 Logger::Get().Log("Rot: X=%.1f, Y=%.1f, Z=%.1f", mRotX.monitor.GetRate(), mRotY.monitor.GetRate(), mRotZ.monitor.GetRate());
@@ -300,9 +328,23 @@ int main(int argc, char* argv[]) noexcept {
     Logger::Get().Log("Application Started. Version: %s", LMUFFB_VERSION);
     if (headless) Logger::Get().Log("Mode: HEADLESS");
     else Logger::Get().Log("Mode: GUI");
+    DiagnosticEvents::Get().Start();
 
     Preset::ApplyDefaultsToEngine(g_engine);
+    // Learned per-car values live in a memory-mapped file, updated in place (v0.7.112)
+    VehicleProfileStore::Get().Open("vehicle_profiles.bin");
+    // Optional user extensions to the vehicle class table (new cars, seed loads)
+    LoadVehicleClassTable("vehicle_classes.ini");
     Config::Load(g_engine);
+    // Always-on crash recorder of the last seconds of FFB state (v0.7.112)
+    if (Config::m_flight_recorder) {
+        std::filesystem::path recorder_path = std::filesystem::path(Config::m_log_path) / "flight_recorder.lmfr";
+        FlightRecorder::Get().Open(recorder_path.string(), Config::m_flight_recorder_seconds);
+    }
+    // Dumps the recorder window around spikes, NaNs, clipping bursts, rate drops (v0.7.112)
+    if (Config::m_anomaly_dumps && FlightRecorder::Get().IsOpen()) {
+        AnomalyTrigger::Get().Start((std::filesystem::path(Config::m_log_path) / "anomalies").string());
+    }
 
     if (!headless) {
         if (!GuiLayer::Init()) {
@@ -330,14 +372,19 @@ int main(int argc, char* argv[]) noexcept {
 
         // Process background save requests from the FFB thread (v0.7.70)
         if (Config::m_needs_save.exchange(false)) {
-            Config::Save(g_engine);
+            Config::RequestSave(g_engine);
         }
 
-        // Maintain a consistent 60Hz message loop even when backgrounded
-        // to ensure DirectInput performance and reliability.
-        std::this_thread::sleep_for(std::chrono::milliseconds(16));
+        // Load/save learned track texture maps off the FFB thread (v0.7.112)
+        g_engine.m_track_map.ServiceIO();
+
+        // Maintain at least a 60Hz message loop even when backgrounded to ensure
+        // DirectInput performance and reliability. Returns early on window input so
+        // the GUI stays responsive while it only redraws when needed (v0.7.112).
+        GuiLayer::WaitForEvents();
     }
     
+    Config::FlushPendingSaves();
     Config::Save(g_engine);
     if (!headless) {
         Logger::Get().Log("Shutting down GUI...");
@@ -349,6 +396,15 @@ int main(int argc, char* argv[]) noexcept {
         ffb_thread.join();
         Logger::Get().Log("FFB Thread Stopped.");
     }
+    AnomalyTrigger::Get().Stop();
+    FlightRecorder::Get().Close();
+    DiagnosticEvents::Get().Stop();
+    g_engine.m_track_map.Save();
+    {
+        std::lock_guard<std::recursive_mutex> lock(g_engine_mutex);
+        g_engine.SaveVehicleProfile();
+    }
+    VehicleProfileStore::Get().Close();
     DirectInputFFB::Get().Shutdown();
     Logger::Get().Log("Main Loop Ended. Clean Exit.");
     
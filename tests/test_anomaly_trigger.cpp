@@ -0,0 +1,157 @@
+#include "test_ffb_common.h"
+#include "../src/AnomalyTrigger.h"
+#include "../src/FlightRecorder.h"
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_anomaly_trigger_window_dump, "Diagnostics") {
+    std::cout << "\nTest: Anomaly trigger waits for the post window and rate limits" << std::endl;
+    const std::string path = "test_logs/test_anomaly_recorder.lmfr";
+    const std::string dir = "test_logs/test_anomalies";
+    AnomalyTrigger& trig = AnomalyTrigger::Get();
+    trig.Stop();
+    trig.Reset();
+    ASSERT_FALSE(trig.Fire(AnomalyType::TorqueSpike, 20.0)); // Not armed
+
+    FlightRecorder& rec = FlightRecorder::Get();
+    ASSERT_TRUE(rec.Open(path, 10));
+    trig.Start(dir, false);
+
+    TelemInfoV01 data = CreateBasicTestTelemetry();
+    FFBSnapshot snap = {};
+    auto record = [&](int from, int to) {
+        for (int i = from; i <= to; ++i) {
+            data.mElapsedTime = i * 0.0025;
+            snap.total_output = (float)i;
+            rec.Record(snap, &data, 0.0f);
+        }
+    };
+    record(1, 2000);
+    ASSERT_TRUE(trig.Fire(AnomalyType::TorqueSpike, 42.0));
+    ASSERT_FALSE(trig.Fire(AnomalyType::TorqueSpike, 43.0)); // Within the type's interval
+    ASSERT_EQ((int)trig.Service(), 0);                        // Post window not recorded yet
+    record(2001, 2400);
+    ASSERT_EQ((int)trig.Service(), 1);
+
+    AnomalyStats stats = trig.GetStats(AnomalyType::TorqueSpike);
+    ASSERT_EQ((int)stats.fired, 1);
+    ASSERT_EQ((int)stats.suppressed, 1);
+    ASSERT_EQ((int)stats.dumped, 1);
+
+    // Pre + post seconds around the trigger
+    std::string dump = trig.GetLastDumpPath();
+    ASSERT_TRUE(dump.find("torque_spike.csv") != std::string::npos);
+    std::ifstream in(dump);
+    ASSERT_TRUE(in.is_open());
+    std::string line;
+    std::getline(in, line);
+    ASSERT_TRUE(line.find("# lmuFFB Anomaly: Torque Spike | Value: 42 | Trigger Seq: 2000") == 0);
+    std::getline(in, line);
+    ASSERT_TRUE(line.find("Seq,Time,Output") == 0);
+    std::getline(in, line);
+    ASSERT_TRUE(line.find("801,") == 0);
+    int rows = 1;
+    while (std::getline(in, line)) rows++;
+    in.close();
+    ASSERT_EQ(rows, (AnomalyTrigger::PRE_SECONDS + AnomalyTrigger::POST_SECONDS) * FlightRecorder::RATE_HZ);
+
+    trig.Stop();
+    ASSERT_FALSE(trig.Fire(AnomalyType::LowRate, 100.0));
+    trig.Reset();
+    rec.Close();
+    std::remove(path.c_str());
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE(test_anomaly_trigger_engine_hooks, "Diagnostics") {
+    std::cout << "\nTest: Engine fires NaN, spike and clipping burst triggers" << std::endl;
+    const std::string path = "test_logs/test_anomaly_engine.lmfr";
+    const std::string dir = "test_logs/test_anomalies_engine";
+    AnomalyTrigger& trig = AnomalyTrigger::Get();
+    trig.Reset();
+    FlightRecorder& rec = FlightRecorder::Get();
+    ASSERT_TRUE(rec.Open(path, 10));
+    trig.Start(dir, false);
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    TelemInfoV01 data = CreateBasicTestTelemetry();
+
+    // Non-finite input torque and non-finite output share one rate limit
+    data.mSteeringShaftTorque = std::nan("");
+    ASSERT_NEAR(engine.calculate_force(&data, "GT3", "911", 0.0f), 0.0, 1e-9);
+    ASSERT_NEAR(engine.ApplySafetySlew(std::nan(""), 0.0025, false), 0.0, 1e-9);
+    ASSERT_EQ((int)trig.GetStats(AnomalyType::NonFinite).fired, 1);
+    ASSERT_EQ((int)trig.GetStats(AnomalyType::NonFinite).suppressed, 1);
+
+    // A sudden 150 Nm is a contextual spike; held there it clips for longer than a burst
+    engine.m_gain = 5.0f;
+    data.mSteeringShaftTorque = 150.0;
+    for (int i = 0; i < 2 * AnomalyTrigger::CLIP_BURST_TICKS; ++i) {
+        data.mElapsedTime = 1.0 + i * 0.0025;
+        engine.calculate_force(&data, "GT3", "911", 0.0f);
+    }
+    ASSERT_EQ((int)trig.GetStats(AnomalyType::TorqueSpike).fired, 1);
+    ASSERT_EQ((int)trig.GetStats(AnomalyType::ClippingBurst).fired, 1);
+
+    // Stopping writes what is pending, even without a full post window
+    trig.Stop();
+    ASSERT_EQ((int)trig.GetDumpCount(), 3);
+    ASSERT_TRUE(std::filesystem::exists(trig.GetLastDumpPath()));
+
+    trig.Reset();
+    rec.Close();
+    std::remove(path.c_str());
+    std::filesystem::remove_all(dir);
+}
+
+TEST_CASE(test_anomaly_trigger_slot_budget, "Diagnostics") {
+    std::cout << "\nTest: Only triggers that claim a slot count against the dump budget" << std::endl;
+    const std::string path = "test_logs/test_anomaly_budget.lmfr";
+    const std::string dir = "test_logs/test_anomalies_budget";
+    AnomalyTrigger& trig = AnomalyTrigger::Get();
+    trig.Stop();
+    trig.Reset();
+    FlightRecorder& rec = FlightRecorder::Get();
+    ASSERT_TRUE(rec.Open(path, 10));
+    trig.Start(dir, false);
+
+    // Fill every pending slot, then one more: dropped, not accepted
+    const int types = (int)AnomalyType::Count;
+    for (size_t i = 0; i < AnomalyTrigger::MAX_PENDING; ++i) {
+        if (i > 0 && i % types == 0) trig.ResetRateLimits();
+        ASSERT_TRUE(trig.Fire((AnomalyType)(i % types), (double)i));
+    }
+    trig.ResetRateLimits();
+    ASSERT_FALSE(trig.Fire(AnomalyType::LowRate, 10.0));
+    ASSERT_EQ((int)trig.GetStats(AnomalyType::LowRate).dropped, 1);
+    ASSERT_EQ((int)trig.GetStats(AnomalyType::LowRate).suppressed, 0);
+    ASSERT_EQ(trig.GetAcceptedCount(), (int)AnomalyTrigger::MAX_PENDING);
+
+    // Freed slots take the rest of the budget; after that triggers are suppressed
+    ASSERT_EQ((int)trig.Service(true), 0); // Nothing recorded yet: no files, slots freed
+    int accepted = trig.GetAcceptedCount();
+    while (accepted < AnomalyTrigger::MAX_DUMPS) {
+        trig.ResetRateLimits();
+        ASSERT_TRUE(trig.Fire(AnomalyType::StaleTelemetry));
+        trig.Service(true);
+        accepted++;
+    }
+    trig.ResetRateLimits();
+    ASSERT_FALSE(trig.Fire(AnomalyType::StaleTelemetry));
+    AnomalyStats stale = trig.GetStats(AnomalyType::StaleTelemetry);
+    ASSERT_EQ((int)stale.suppressed, 1);
+    ASSERT_EQ((int)stale.dropped, 0);
+    ASSERT_EQ(trig.GetAcceptedCount(), AnomalyTrigger::MAX_DUMPS);
+
+    trig.Stop();
+    trig.Reset();
+    rec.Close();
+    std::remove(path.c_str());
+    std::filesystem::remove_all(dir);
+}
+
+} // namespace FFBEngineTests
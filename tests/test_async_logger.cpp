@@ -1,5 +1,6 @@
 #include "test_ffb_common.h"
 #include "../src/AsyncLogger.h"
+#include <fstream>
 #include <thread>
 #include <chrono>
 
@@ -200,4 +201,41 @@ TEST_CASE_TAGGED(test_logger_header_version_check, "Diagnostics", {"Logger"}) {
     std::remove(filename.c_str());
 }
 
+TEST_CASE_TAGGED(test_logger_stop_drains_queued_rows, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: AsyncLogger Stop writes rows queued during the last batch" << std::endl;
+    AsyncLogger::Get().Stop();
+
+    SessionInfo info;
+    info.driver_name = "DrainTest";
+    info.vehicle_name = "TestCarDrain";
+    info.track_name = "TestTrack";
+    info.app_version = "0.7.3-test";
+
+    // Wake the worker with a full batch, give it time to start writing, then queue
+    // more rows and stop right away: the worker is still busy with the first batch
+    AsyncLogger::Get().Start(info, "test_logs");
+    std::string filename = AsyncLogger::Get().GetFilename();
+    LogFrame frame = {};
+    const int rows = 2000;
+    for (int i = 0; i < rows * 4; i++) {
+        frame.timestamp = i * 0.0025;
+        AsyncLogger::Get().Log(frame);
+        if (i == rows * 2) std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    AsyncLogger::Get().Stop();
+    ASSERT_EQ((int)AsyncLogger::Get().GetFrameCount(), rows);
+
+    std::ifstream file(filename);
+    ASSERT_TRUE(file.is_open());
+    std::string line;
+    int data_rows = -1; // Column header
+    while (std::getline(file, line)) {
+        if (!line.empty() && line[0] != '#') data_rows++;
+    }
+    file.close();
+    ASSERT_EQ(data_rows, rows);
+    std::remove(filename.c_str());
+    std::remove(AsyncLogger::Get().GetIndexFilename().c_str());
+}
+
 } // namespace FFBEngineTests
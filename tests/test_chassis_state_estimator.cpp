@@ -0,0 +1,102 @@
+#include "test_ffb_common.h"
+#include "../src/ChassisStateEstimator.h"
+#include <cmath>
+#include <random>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_chassis_estimator_fusion, "Physics") {
+    std::cout << "\nTest: Chassis estimator beats one-pole smoothing on noisy lateral G and yaw accel" << std::endl;
+
+    const double dt = 0.0025;
+    const double tau = 0.01; // Typical user smoothing
+    std::mt19937 rng(7);
+    std::normal_distribution<double> noise(0.0, 1.0);
+
+    ChassisStateEstimator est;
+    double ema_lat = 0.0, ema_yaw = 0.0;
+    double err_kf_lat = 0.0, err_ema_lat = 0.0, err_kf_yaw = 0.0, err_ema_yaw = 0.0;
+    int n = 0;
+    for (int i = 0; i < 4000; ++i) {
+        double t = i * dt;
+        double lat = 15.0 * std::sin(2.0 * ffb_math::PI * 0.5 * t) + 5.0 * std::sin(2.0 * ffb_math::PI * 2.0 * t);
+        double yaw_rate = 0.5 * std::sin(2.0 * ffb_math::PI * 0.5 * t) + 0.1 * std::sin(2.0 * ffb_math::PI * 3.0 * t);
+        double yaw_accel = 0.5 * ffb_math::PI * std::cos(2.0 * ffb_math::PI * 0.5 * t) + 0.6 * ffb_math::PI * std::cos(2.0 * ffb_math::PI * 3.0 * t);
+        double meas_lat = lat + 1.5 * noise(rng);
+        double meas_yaw_accel = yaw_accel + 2.0 * noise(rng);
+
+        est.Update(-50.0, 0.0, meas_lat, yaw_rate + 0.002 * noise(rng), meas_yaw_accel, dt);
+        double alpha = dt / (tau + dt);
+        ema_lat += alpha * (meas_lat - ema_lat);
+        ema_yaw += alpha * (meas_yaw_accel - ema_yaw);
+
+        if (i < 400) continue; // Settle
+        n++;
+        err_kf_lat += std::pow(est.GetLatAccel() - lat, 2);
+        err_ema_lat += std::pow(ema_lat - lat, 2);
+        err_kf_yaw += std::pow(est.GetYawAccel() - yaw_accel, 2);
+        err_ema_yaw += std::pow(ema_yaw - yaw_accel, 2);
+    }
+    double rms_kf_lat = std::sqrt(err_kf_lat / n), rms_ema_lat = std::sqrt(err_ema_lat / n);
+    double rms_kf_yaw = std::sqrt(err_kf_yaw / n), rms_ema_yaw = std::sqrt(err_ema_yaw / n);
+    std::cout << "  Lat RMS: KF " << rms_kf_lat << " vs EMA " << rms_ema_lat
+              << " | Yaw RMS: KF " << rms_kf_yaw << " vs EMA " << rms_ema_yaw << std::endl;
+    ASSERT_TRUE(rms_kf_lat < rms_ema_lat);
+    // Clean yaw rate constrains the noisy yaw acceleration channel
+    ASSERT_TRUE(rms_kf_yaw < rms_ema_yaw * 0.6);
+    ASSERT_NEAR(est.GetLongVel(), -50.0, 0.05);
+
+    // Gap in telemetry restarts from the measurements
+    est.Update(-20.0, 3.0, -4.0, 0.2, 0.0, 0.5);
+    ASSERT_NEAR(est.GetLongVel(), -20.0, 0.001);
+    ASSERT_NEAR(est.GetLatAccel(), -4.0, 0.001);
+    // Non-finite input is ignored
+    est.Update(NAN, 3.0, -4.0, 0.2, 0.0, 0.0025);
+    ASSERT_NEAR(est.GetLongVel(), -20.0, 0.001);
+}
+
+TEST_CASE(test_chassis_estimator_feeds_effects, "Physics") {
+    std::cout << "\nTest: Chassis estimator drives SoP, yaw kick and kinematic load when enabled" << std::endl;
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_sop_effect = 1.0f;
+    engine.m_sop_smoothing_factor = 0.0f; // Heavy smoothing on the legacy path
+    engine.m_chassis_inertia_smoothing = 0.1f;
+    engine.m_chassis_estimator_enabled = true;
+
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0);
+    data.mDeltaTime = 0.0025;
+    data.mLocalAccel.x = 9.81;
+    data.mLocalAccel.z = 9.81;
+    for (int i = 0; i < 200; i++) {
+        data.mElapsedTime += 0.0025;
+        engine.calculate_force(&data);
+    }
+    ASSERT_TRUE(engine.m_chassis_estimator.IsInitialized());
+    ASSERT_NEAR(engine.m_chassis_estimator.GetLatAccel(), 9.81, 0.05);
+
+    // Kinematic load follows the fused accelerations, not the 100 ms inertia smoother
+    FFBEngine legacy;
+    InitializeEngine(legacy);
+    legacy.m_chassis_inertia_smoothing = 0.1f;
+    legacy.calculate_force(&data);
+    double load_fused = engine.calculate_kinematic_load(&data, 0);
+    double load_legacy = legacy.calculate_kinematic_load(&data, 0);
+    ASSERT_TRUE(load_fused > load_legacy);
+
+    // SoP gets the fused 1 G directly instead of the slider-smoothed value
+    FFBCalculationContext ctx;
+    ctx.dt = 0.0025;
+    ctx.car_speed = 30.0;
+    ctx.speed_gate = 1.0;
+    FFBEngineTestAccess::CallCalculateSopLateral(engine, &data, ctx);
+    ASSERT_NEAR(ctx.sop_unboosted_force, 1.0 * engine.m_sop_effect * engine.m_sop_scale, 0.05 * engine.m_sop_scale);
+
+    // Disabling drops the filter state
+    engine.m_chassis_estimator_enabled = false;
+    engine.calculate_force(&data);
+    ASSERT_FALSE(engine.m_chassis_estimator.IsInitialized());
+}
+
+} // namespace FFBEngineTests
@@ -1,4 +1,5 @@
 #include "test_ffb_common.h"
+#include "../src/VehicleProfileStore.h"
 
 namespace FFBEngineTests {
 
@@ -220,4 +221,54 @@ TEST_CASE(test_config_comprehensive_load_v2, "Config") {
     std::remove(test_file);
 }
 
+TEST_CASE(test_config_parser_edge_cases, "Config") {
+    std::cout << "\nTest: Config parser tolerates whitespace, CRLF, aliases and bad values" << std::endl;
+
+    const char* test_file = "tmp_parser_edge_cases.ini";
+    {
+        std::ofstream file(test_file, std::ios::binary);
+        file << "; comment line\r\n";
+        file << "  gain = 0.75 \r\n";
+        file << "smoothing=0.33\r\n";           // Legacy alias for sop_smoothing_factor
+        file << "max_load_factor=1.8\r\n";      // Legacy alias for texture_load_cap
+        file << "lockup_enabled=false\r\n";
+        file << "slope_detection_enabled=true\r\n";
+        file << "slope_sg_window=+21\r\n";
+        file << "gyro_gain=5.0\r\n";            // Clamped on load
+        file << "min_force=abc\r\n";            // Malformed: keeps previous value
+        file << "unknown_key=1\r\n";
+        file << "log_path=C:/logs=x/\r\n";      // Value may contain '='
+        file << "[StaticLoads]\r\n";
+        file << "Parser Test Car=4321.5\r\n";
+        file << "[Preset:Edge]\r\n";
+        file << "gain=0.1\r\n";                 // Preset sections must not touch the engine
+    }
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_min_force = 0.07f;
+    engine.m_lockup_enabled = true;
+    std::string saved_log_path = Config::m_log_path;
+
+    Config::Load(engine, test_file);
+
+    ASSERT_NEAR(engine.m_gain, 0.75f, 0.0001);
+    ASSERT_NEAR(engine.m_sop_smoothing_factor, 0.33f, 0.0001);
+    ASSERT_NEAR(engine.m_texture_load_cap, 1.8f, 0.0001);
+    ASSERT_FALSE(engine.m_lockup_enabled);
+    ASSERT_TRUE(engine.m_slope_detection_enabled);
+    ASSERT_EQ(engine.m_slope_sg_window, 21);
+    ASSERT_NEAR(engine.m_gyro_gain, 1.0f, 0.0001);
+    ASSERT_NEAR(engine.m_min_force, 0.07f, 0.0001);
+    ASSERT_EQ_STR(Config::m_log_path, "C:/logs=x/");
+
+    double load = 0.0;
+    ASSERT_TRUE(Config::GetSavedStaticLoad("Parser Test Car", load));
+    ASSERT_NEAR(load, 4321.5, 0.001);
+
+    Config::m_log_path = saved_log_path;
+    VehicleProfileStore::Get().Erase("Parser Test Car");
+    std::remove(test_file);
+}
+
 } // namespace FFBEngineTests
@@ -36,6 +36,7 @@ TEST_CASE(test_logger_expansion, "Diagnostics") {
     Logger::Get().LogWin32Error("MockContext", 1234);
 
     // 5. Verify file exists and has content (basic check)
+    Logger::Get().Flush();
     std::ifstream file("test_expansion.log");
     ASSERT_TRUE(file.is_open());
     std::string line;
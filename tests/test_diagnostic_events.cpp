@@ -0,0 +1,84 @@
+#include "test_ffb_common.h"
+#include "../src/DiagnosticEvents.h"
+#include <cstring>
+#include <sstream>
+#include <thread>
+#include <vector>
+
+namespace FFBEngineTests {
+
+TEST_CASE_TAGGED(test_diag_events_render_and_rate_limit, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: Diagnostic events render text and are rate limited per type" << std::endl;
+    DiagnosticEvents& diag = DiagnosticEvents::Get();
+    diag.Reset();
+
+    diag.Post(DiagEvent::StaticLoadLatched, "Porsche 963", 4321.0);
+    diag.Post(DiagEvent::StaticLoadLatched, "Porsche 963", 4321.0); // Inside the interval
+    diag.Post(DiagEvent::InvalidDeltaTime, nullptr, 0.0025);
+
+    DiagEventStats latched = diag.GetStats(DiagEvent::StaticLoadLatched);
+    ASSERT_EQ(latched.posted, (uint64_t)1);
+    ASSERT_EQ(latched.suppressed, (uint64_t)1);
+    ASSERT_EQ(diag.GetPostedCount(DiagEvent::InvalidDeltaTime), (uint64_t)1);
+
+    std::stringstream out;
+    ASSERT_EQ(diag.Drain(out), (size_t)2);
+    std::string text = out.str();
+    ASSERT_TRUE(text.find("[FFB] Latched and saved static load for Porsche 963: 4321N") != std::string::npos);
+    ASSERT_TRUE(text.find("Invalid DeltaTime (<=0). Using default 0.0025s.") != std::string::npos);
+    ASSERT_EQ(diag.Drain(out), (size_t)0);
+
+    // Long vehicle names are truncated, never overrun
+    std::string long_name(200, 'X');
+    diag.Post(DiagEvent::StaticLoadUnknown, long_name.c_str());
+    std::stringstream out2;
+    diag.Drain(out2);
+    ASSERT_TRUE(out2.str().find(std::string(63, 'X') + ".") != std::string::npos);
+    ASSERT_EQ_STR(DiagnosticEvents::GetName(DiagEvent::MissingGripFract), "Missing mGripFract");
+
+    // Seeding keeps the raw class next to the detected one
+    DiagEventRecord seeded;
+    seeded.code = DiagEvent::VehicleClassSeeded;
+    seeded.a = 4800.0;
+    std::strcpy(seeded.vehicle, "Porsche 911 GT3 R");
+    std::strcpy(seeded.text, "GT3");
+    std::strcpy(seeded.detail, "LMGT3");
+    ASSERT_EQ(DiagnosticEvents::Render(seeded),
+              std::string("[FFB] Vehicle Identification -> Detected Class: GT3 | Seed Load: 4800N "
+                          "(Raw -> Class: LMGT3, Name: Porsche 911 GT3 R)"));
+
+    // Low sample rate: only the low channels are named, repeats within 5 s are only counted
+    diag.Post(DiagEvent::LowSampleRate, nullptr, 0.0, 82.0, nullptr, nullptr, 64.0, 100.0);
+    diag.Post(DiagEvent::LowSampleRate, nullptr, 300.0, 0.0);
+    DiagEventStats low = diag.GetStats(DiagEvent::LowSampleRate);
+    ASSERT_EQ(low.posted, (uint64_t)1);
+    ASSERT_EQ(low.suppressed, (uint64_t)1);
+    std::stringstream out3;
+    ASSERT_EQ(diag.Drain(out3), (size_t)1);
+    ASSERT_EQ(out3.str(), std::string("[WARNING] Low Sample Rate detected: Telemetry=82Hz Torque=64Hz (Target 100Hz) \n"));
+    diag.Reset();
+}
+
+TEST_CASE_TAGGED(test_diag_events_concurrent_posts, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: Diagnostic events from parallel engines are counted exactly once" << std::endl;
+    DiagnosticEvents& diag = DiagnosticEvents::Get();
+    diag.Reset();
+
+    // Every engine of a fleet reporting the same problem at once: one message, the rest rate limited
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 8; ++t) {
+        threads.emplace_back([&diag]() {
+            for (int i = 0; i < 100; ++i) diag.Post(DiagEvent::MissingSuspForce, "Fleet Car");
+        });
+    }
+    for (auto& th : threads) th.join();
+
+    DiagEventStats st = diag.GetStats(DiagEvent::MissingSuspForce);
+    ASSERT_EQ(st.posted, (uint64_t)1);
+    ASSERT_EQ(st.suppressed, (uint64_t)799);
+    std::stringstream out;
+    ASSERT_EQ(diag.Drain(out), (size_t)1);
+    diag.Reset();
+}
+
+} // namespace FFBEngineTests
@@ -248,6 +248,9 @@ public:
     static void CallCalculateSoftLock(FFBEngine& e, const TelemInfoV01* data, FFBCalculationContext& ctx) {
         e.calculate_soft_lock(data, ctx);
     }
+    static void CallCalculateSopLateral(FFBEngine& e, const TelemInfoV01* data, FFBCalculationContext& ctx) {
+        e.calculate_sop_lateral(data, ctx);
+    }
     static void SetScrubDragGain(FFBEngine& e, float val) { e.m_scrub_drag_gain = val; }
     static void SetBottomingEnabled(FFBEngine& e, bool val) { e.m_bottoming_enabled = val; }
     static void SetBottomingGain(FFBEngine& e, float val) { e.m_bottoming_gain = val; }
@@ -261,8 +264,7 @@ public:
     static void SetRollingAverageTorque(FFBEngine& e, double val) { e.m_rolling_average_torque = val; }
     static void SetLastRawTorque(FFBEngine& e, double val) { e.m_last_raw_torque = val; }
     static void AddSnapshot(FFBEngine& e, const FFBSnapshot& s) {
-        std::lock_guard<std::mutex> lock(e.m_debug_mutex);
-        e.m_debug_buffer.push_back(s);
+        e.m_snapshot_ring.Push(s);
     }
 };
 
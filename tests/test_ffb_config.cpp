@@ -480,4 +480,41 @@ TEST_CASE(test_config_migration_logic, "Config") {
     std::remove(test_file_under);
 }
 
+TEST_CASE(test_config_background_save, "Config") {
+    std::cout << "\nTest: Config::RequestSave coalesces and writes atomically" << std::endl;
+    const char* test_file = "test_async_save.ini";
+    std::remove(test_file);
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_gain = 0.3f;
+    Config::RequestSave(engine, test_file);
+    engine.m_gain = 0.6f;
+    engine.m_sop_effect = 0.7f;
+    Config::RequestSave(engine, test_file); // Supersedes the first snapshot
+    engine.m_gain = 0.9f;                   // Changes after the request are not captured
+    Config::FlushPendingSaves();
+
+    FFBEngine loaded;
+    InitializeEngine(loaded);
+    Config::Load(loaded, test_file);
+    ASSERT_NEAR(loaded.m_gain, 0.6f, 0.0001);
+    ASSERT_NEAR(loaded.m_sop_effect, 0.7f, 0.0001);
+
+    std::string tmp_path = std::string(test_file) + ".tmp";
+    std::ifstream tmp(tmp_path);
+    ASSERT_FALSE(tmp.is_open());
+
+    // A synchronous Save supersedes a queued one for the same file
+    engine.m_gain = 0.2f;
+    Config::RequestSave(engine, test_file);
+    engine.m_gain = 1.1f;
+    Config::Save(engine, test_file);
+    Config::FlushPendingSaves();
+    Config::Load(loaded, test_file);
+    ASSERT_NEAR(loaded.m_gain, 1.1f, 0.0001);
+
+    std::remove(test_file);
+}
+
 } // namespace FFBEngineTests
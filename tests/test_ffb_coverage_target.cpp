@@ -114,7 +114,7 @@ TEST_CASE(test_ffb_engine_full_integration_target, "Coverage") {
     engine.calculate_force(&data); // Hits Line 1938 & 1947
     
     // Verify snapshots in batch
-    // Snapshots are stored in m_debug_buffer (Line 1625)
+    // Snapshots are stored in m_snapshot_ring
     // and retrieved with GetDebugBatch (Line 594)
     auto batch = engine.GetDebugBatch();
     ASSERT_FALSE(batch.empty());
@@ -1,6 +1,7 @@
 #include "test_ffb_common.h"
 #include "Config.h"
 #include "FFBEngine.h"
+#include "VehicleProfileStore.h"
 #include <fstream>
 #include <cstdio>
 
@@ -19,7 +20,7 @@ TEST_CASE(Config_StaticLoadParsing, "PersistentLoad") {
 
     // 2. Load the config
     FFBEngine engine;
-    Config::m_saved_static_loads.clear();
+    VehicleProfileStore::Get().Clear();
     Config::Load(engine, test_ini);
 
     // 3. Verify map content using thread-safe getter
@@ -46,7 +47,7 @@ TEST_CASE(Engine_UsesSavedStaticLoad, "PersistentLoad") {
 
 TEST_CASE(Engine_SavesNewStaticLoadUponLatching, "PersistentLoad") {
     FFBEngine engine;
-    Config::m_saved_static_loads.clear();
+    VehicleProfileStore::Get().Clear();
     Config::m_needs_save = false;
 
     // Initialize with a car that has NO saved load
@@ -73,5 +74,85 @@ TEST_CASE(Engine_SavesNewStaticLoadUponLatching, "PersistentLoad") {
     double saved_val = 0.0;
     ASSERT_TRUE(Config::GetSavedStaticLoad("Oreca 07", saved_val));
     ASSERT_NEAR(saved_val, FFBEngineTestAccess::GetStaticFrontLoad(engine), 1.0);
-    ASSERT_TRUE(Config::m_needs_save.load());
+    // v0.7.112: Stored in place in the vehicle profile, no full config save
+    ASSERT_FALSE(Config::m_needs_save.load());
+}
+
+TEST_CASE(ProfileStore_MappedFileRoundTrip, "PersistentLoad") {
+    const char* path = "test_vehicle_profiles.bin";
+    std::remove(path);
+    VehicleProfileStore& store = VehicleProfileStore::Get();
+    store.Clear();
+
+    // Learned before the file is opened: carried into the mapping
+    store.SetField("Early Car", ProfileField::StaticFrontLoad, 3900.0);
+    ASSERT_TRUE(store.Open(path));
+    ASSERT_TRUE(store.IsMapped());
+    store.SetField("Porsche 963", ProfileField::StaticFrontLoad, 5200.0);
+    store.SetField("Porsche 963", ProfileField::SessionPeakTorque, 31.5);
+    store.Close();
+    ASSERT_FALSE(store.IsMapped());
+
+    // Simulated restart: nothing in memory, everything comes back from the file
+    store.Clear();
+    double v = 0.0;
+    ASSERT_FALSE(store.GetField("Porsche 963", ProfileField::StaticFrontLoad, v));
+    ASSERT_TRUE(store.Open(path));
+    ASSERT_TRUE(store.GetField("Porsche 963", ProfileField::StaticFrontLoad, v));
+    ASSERT_NEAR(v, 5200.0, 1e-9);
+    ASSERT_TRUE(store.GetField("Porsche 963", ProfileField::SessionPeakTorque, v));
+    ASSERT_NEAR(v, 31.5, 1e-9);
+    ASSERT_TRUE(store.GetField("Early Car", ProfileField::StaticFrontLoad, v));
+    ASSERT_FALSE(store.GetField("Porsche 963", ProfileField::OptimalSlipAngle, v));
+    ASSERT_EQ(store.GetVehicleCount(), (size_t)2);
+
+    VehicleProfileRecord rec;
+    ASSERT_TRUE(store.Find("Porsche 963", rec));
+    ASSERT_EQ(rec.update_count, (uint32_t)2);
+    store.Erase("Porsche 963");
+    ASSERT_FALSE(store.GetField("Porsche 963", ProfileField::StaticFrontLoad, v));
+    ASSERT_FALSE(store.SetField("Nan Car", ProfileField::AutoPeakLoad, std::nan("")));
+    store.Close();
+
+    // A corrupt file is reinitialized rather than trusted
+    {
+        std::ofstream f(path, std::ios::binary | std::ios::trunc);
+        f << "garbage";
+    }
+    store.Clear();
+    ASSERT_TRUE(store.Open(path));
+    ASSERT_EQ(store.GetVehicleCount(), (size_t)0);
+    store.Close();
+    store.Clear();
+    std::remove(path);
+}
+
+TEST_CASE(Engine_RestoresLearnedPeaksPerCar, "PersistentLoad") {
+    VehicleProfileStore::Get().Clear();
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_dynamic_normalization_enabled = true;
+    engine.m_auto_load_normalization_enabled = true;
+    TelemInfoV01 data = CreateBasicTestTelemetry(20.0);
+
+    // Two cars of the same class: only the full name tells them apart
+    engine.calculate_force(&data, "GT3", "Profile Car A");
+    double seed_peak = FFBEngineTestAccess::GetSessionPeakTorque(engine);
+    FFBEngineTestAccess::SetSessionPeakTorque(engine, 27.0);
+    FFBEngineTestAccess::SetAutoPeakLoad(engine, 6100.0);
+
+    // Switching car stores A's peaks and starts B from its seeds
+    engine.calculate_force(&data, "GT3", "Profile Car B");
+    ASSERT_NEAR(FFBEngineTestAccess::GetSessionPeakTorque(engine), seed_peak, 0.5);
+    double stored = 0.0;
+    ASSERT_TRUE(VehicleProfileStore::Get().GetField("Profile Car A", ProfileField::AutoPeakLoad, stored));
+    ASSERT_NEAR(stored, 6100.0, 1e-9);
+    ASSERT_FALSE(VehicleProfileStore::Get().GetField("Profile Car B", ProfileField::AutoPeakLoad, stored));
+
+    // Back to A: learned peaks resume
+    engine.calculate_force(&data, "GT3", "Profile Car A");
+    ASSERT_NEAR(FFBEngineTestAccess::GetSessionPeakTorque(engine), 27.0, 0.5);
+    ASSERT_NEAR(FFBEngineTestAccess::GetAutoPeakLoad(engine), 6100.0, 1.0);
+    ASSERT_TRUE(VehicleProfileStore::Get().GetField("Profile Car B", ProfileField::AutoPeakLoad, stored));
+    VehicleProfileStore::Get().Clear();
 }
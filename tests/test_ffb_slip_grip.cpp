@@ -1,4 +1,5 @@
 #include "test_ffb_common.h"
+#include "../src/DiagnosticEvents.h"
 
 namespace FFBEngineTests {
 
@@ -507,28 +508,27 @@ TEST_CASE(test_missing_telemetry_warnings, "SlipGrip") {
     data.mVehicleName[sizeof(data.mVehicleName) - 1] = '\0';
 #endif
 
-    // Capture stdout
+    // Warnings are posted to the diagnostic event channel (v0.7.112) and rendered by its consumer
+    DiagnosticEvents& diag = DiagnosticEvents::Get();
+    diag.Reset();
     std::stringstream buffer;
-    std::streambuf* prev_cout_buf = std::cout.rdbuf(buffer.rdbuf());
 
     // --- Case 1: Missing Grip ---
     // Trigger missing grip: grip < 0.0001 AND load > 100.
     // CreateBasicTestTelemetry sets grip=0, load=4000. So this should trigger.
     engine.calculate_force(&data);
-    
+    diag.Drain(buffer);
+
     std::string output = buffer.str();
     bool grip_warn = output.find("Warning: Data for mGripFract from the game seems to be missing for this car (TestCar_GT3). (Likely Encrypted/DLC Content)") != std::string::npos;
-    
+    ASSERT_EQ(diag.GetPostedCount(DiagEvent::MissingGripFract), (uint64_t)1);
+
     if (grip_warn) {
-        std::cout.rdbuf(prev_cout_buf); // Restore cout
         std::cout << "[PASS] Grip warning triggered with car name." << std::endl;
         g_tests_passed++;
-        std::cout.rdbuf(buffer.rdbuf()); // Redirect again
     } else {
-        std::cout.rdbuf(prev_cout_buf);
         std::cout << "[FAIL] Grip warning missing or format incorrect." << std::endl;
         g_tests_failed++;
-        std::cout.rdbuf(buffer.rdbuf());
     }
 
     // --- Case 2: Missing Suspension Force ---
@@ -543,20 +543,17 @@ TEST_CASE(test_missing_telemetry_warnings, "SlipGrip") {
     for(int i=0; i<60; i++) {
         engine.calculate_force(&data);
     }
+    diag.Drain(buffer);
     
     output = buffer.str();
     bool susp_warn = output.find("Warning: Data for mSuspForce from the game seems to be missing for this car (TestCar_GT3). (Likely Encrypted/DLC Content)") != std::string::npos;
     
      if (susp_warn) {
-        std::cout.rdbuf(prev_cout_buf);
         std::cout << "[PASS] SuspForce warning triggered with car name." << std::endl;
         g_tests_passed++;
-        std::cout.rdbuf(buffer.rdbuf());
     } else {
-        std::cout.rdbuf(prev_cout_buf);
         std::cout << "[FAIL] SuspForce warning missing or format incorrect." << std::endl;
         g_tests_failed++;
-        std::cout.rdbuf(buffer.rdbuf());
     }
 
     // --- Case 3: Missing Vertical Tire Deflection (NEW) ---
@@ -573,24 +570,18 @@ TEST_CASE(test_missing_telemetry_warnings, "SlipGrip") {
     for(int i=0; i<60; i++) {
         engine.calculate_force(&data);
     }
+    diag.Drain(buffer);
     
     output = buffer.str();
     bool vert_warn = output.find("[WARNING] mVerticalTireDeflection is missing") != std::string::npos;
     
     if (vert_warn) {
-        std::cout.rdbuf(prev_cout_buf);
         std::cout << "[PASS] Vertical Deflection warning triggered." << std::endl;
         g_tests_passed++;
-        std::cout.rdbuf(buffer.rdbuf());
     } else {
-        std::cout.rdbuf(prev_cout_buf);
         std::cout << "[FAIL] Vertical Deflection warning missing." << std::endl;
         g_tests_failed++;
-        std::cout.rdbuf(buffer.rdbuf());
     }
-
-    // Restore cout
-    std::cout.rdbuf(prev_cout_buf);
 }
 
 TEST_CASE(test_sanity_checks, "SlipGrip") {
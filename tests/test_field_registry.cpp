@@ -0,0 +1,118 @@
+#include "test_ffb_common.h"
+#include "../src/FieldRegistry.h"
+#include <sstream>
+
+namespace FFBEngineTests {
+
+static Preset CreateNonDefaultPreset() {
+    Preset p("Registry Test");
+    p.SetGain(0.8f).SetUndersteer(0.4f).SetSoP(1.2f).SetShaftSmoothing(0.02f)
+     .SetLockup(false, 1.5f, 3.0f, 9.0f, 2.0f).SetSpin(false, 0.9f, 1.3f)
+     .SetSlopeDetection(true, 21, -0.4f, -1.5f, 0.06f).SetSlopeAdvanced(80.0f, false, 0.7f)
+     .SetTorqueSource(1, true).SetBottoming(1).SetSpeedGate(2.0f, 7.0f);
+    p.tactile_gain = 1.4f;
+    p.auto_load_normalization_enabled = true;
+    return p;
+}
+
+TEST_CASE(test_field_registry_apply_capture_roundtrip, "Config") {
+    std::cout << "\nTest: FieldRegistry Apply/Capture round trip and dirty check" << std::endl;
+    Preset original = CreateNonDefaultPreset();
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    original.Apply(engine);
+    ASSERT_NEAR(engine.m_steering_shaft_smoothing, 0.02f, 0.0001);
+    ASSERT_EQ(engine.m_slope_sg_window, 21);
+    ASSERT_FALSE(engine.m_slope_use_torque);
+    ASSERT_TRUE(engine.m_torque_passthrough);
+
+    Preset captured;
+    captured.UpdateFromEngine(engine);
+    ASSERT_TRUE(captured.Equals(original));
+    ASSERT_TRUE(FieldRegistry::Matches(original, engine));
+
+    // A single flipped flag or nudged float makes the engine dirty
+    engine.m_slope_use_torque = true;
+    ASSERT_FALSE(FieldRegistry::Matches(original, engine));
+    engine.m_slope_use_torque = false;
+    engine.m_speed_gate_upper += 0.01f;
+    ASSERT_FALSE(FieldRegistry::Matches(original, engine));
+    engine.m_speed_gate_upper -= 0.01f;
+
+    // Device settings are not part of a preset
+    engine.m_invert_force = !engine.m_invert_force;
+    ASSERT_TRUE(FieldRegistry::Matches(original, engine));
+
+    // Apply and Validate keep their pre-registry asymmetries: torque_source is only
+    // clamped by Validate, yaw_kick_threshold and speed_gate_lower only by Apply
+    Preset odd;
+    odd.torque_source = 2;
+    odd.yaw_kick_threshold = -1.0f;
+    odd.speed_gate_lower = -2.0f;
+    odd.Apply(engine);
+    ASSERT_EQ(engine.m_torque_source, 2);
+    ASSERT_NEAR(engine.m_yaw_kick_threshold, 0.0f, 1e-9);
+    ASSERT_NEAR(engine.m_speed_gate_lower, 0.0f, 1e-9);
+    odd.Validate();
+    ASSERT_EQ(odd.torque_source, 1);
+    ASSERT_NEAR(odd.yaw_kick_threshold, -1.0f, 1e-9);
+    ASSERT_NEAR(odd.speed_gate_lower, -2.0f, 1e-9);
+}
+
+TEST_CASE(test_field_registry_write_parse_roundtrip, "Config") {
+    std::cout << "\nTest: FieldRegistry Write/Parse round trip" << std::endl;
+    Preset original = CreateNonDefaultPreset();
+
+    std::stringstream ss;
+    FieldRegistry::Write(ss, original);
+
+    Preset parsed;
+    std::string line;
+    int lines = 0, unknown = 0;
+    while (std::getline(ss, line)) {
+        size_t eq = line.find('=');
+        if (eq == std::string::npos) continue;
+        lines++;
+        auto res = FieldRegistry::Parse(std::string_view(line).substr(0, eq), std::string_view(line).substr(eq + 1), parsed);
+        if (res != FieldRegistry::ParseResult::Ok) unknown++;
+    }
+    ASSERT_GT(lines, 70);
+    ASSERT_EQ(unknown, 0);
+    ASSERT_TRUE(parsed.Equals(original));
+}
+
+TEST_CASE(test_field_registry_parse_rules, "Config") {
+    std::cout << "\nTest: FieldRegistry aliases, clamps and error results" << std::endl;
+    Preset p;
+    using FieldRegistry::ParseResult;
+
+    ASSERT_TRUE(FieldRegistry::Parse("max_load_factor", "1.7", p) == ParseResult::Ok);
+    ASSERT_NEAR(p.texture_load_cap, 1.7f, 0.0001);
+    ASSERT_TRUE(FieldRegistry::Parse("slope_negative_threshold", "-0.5", p) == ParseResult::Ok);
+    ASSERT_NEAR(p.slope_min_threshold, -0.5f, 0.0001);
+
+    // Legacy load-time clamp
+    ASSERT_TRUE(FieldRegistry::Parse("lockup_gain", "7.0", p) == ParseResult::Ok);
+    ASSERT_NEAR(p.lockup_gain, 3.0f, 0.0001);
+
+    ASSERT_TRUE(FieldRegistry::Parse("invert_force", "1", p) == ParseResult::Unknown);
+    ASSERT_TRUE(FieldRegistry::Parse("no_such_key", "1", p) == ParseResult::Unknown);
+    ASSERT_TRUE(FieldRegistry::Parse("gain", "loud", p) == ParseResult::Invalid);
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    ASSERT_TRUE(FieldRegistry::Parse("invert_force", "0", engine) == ParseResult::Ok);
+    ASSERT_FALSE(engine.m_invert_force);
+
+    // Validate applies the registry ranges plus the odd SG window rule
+    p.slope_sg_window = 100;
+    p.notch_q = -1.0f;
+    p.torque_source = 5;
+    p.Validate();
+    ASSERT_EQ(p.slope_sg_window, 41);
+    ASSERT_NEAR(p.notch_q, 0.1f, 0.0001);
+    ASSERT_EQ(p.torque_source, 1);
+}
+
+} // namespace FFBEngineTests
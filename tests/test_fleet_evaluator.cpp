@@ -0,0 +1,191 @@
+#include "test_ffb_common.h"
+#include "../src/FleetEvaluator.h"
+#include "../src/VehicleProfileStore.h"
+#include <memory>
+
+extern FFBEngine g_engine;
+
+namespace FFBEngineTests {
+
+// Builds a shared memory copy with `count` cars, each cornering a little harder than the previous.
+static std::unique_ptr<SharedMemoryObjectOut> CreateFleetData(int count) {
+    auto data = std::make_unique<SharedMemoryObjectOut>();
+    data->telemetry.activeVehicles = (uint8_t)count;
+    data->telemetry.playerVehicleIdx = 0;
+    data->telemetry.playerHasVehicle = true;
+    data->scoring.scoringInfo.mNumVehicles = count;
+    for (int i = 0; i < count; ++i) {
+        TelemInfoV01 t = CreateBasicTestTelemetry(20.0 + i, 0.02 * (i + 1));
+        t.mID = 100 + i;
+        t.mLocalAccel.x = 2.0 * (i + 1);
+        snprintf(t.mVehicleName, sizeof(t.mVehicleName), "Car %d", i);
+        data->telemetry.telemInfo[i] = t;
+
+        VehicleScoringInfoV01& s = data->scoring.vehScoringInfo[i];
+        s.mID = 100 + i;
+        s.mIsPlayer = (i == 0);
+        snprintf(s.mVehicleName, sizeof(s.mVehicleName), "Car %d", i);
+        snprintf(s.mVehicleClass, sizeof(s.mVehicleClass), "GT3");
+    }
+    return data;
+}
+
+static void StepFleet(SharedMemoryObjectOut& data, int count) {
+    for (int i = 0; i < count; ++i) {
+        data.telemetry.telemInfo[i].mElapsedTime += 0.0025;
+        data.telemetry.telemInfo[i].mSteeringShaftTorque = 5.0 + i + std::sin(data.telemetry.telemInfo[i].mElapsedTime * 10.0);
+    }
+}
+
+TEST_CASE(test_fleet_parallel_matches_serial, "Internal") {
+    std::cout << "\nTest: FleetEvaluator parallel results match single-threaded results" << std::endl;
+    const int cars = 8;
+    auto data_par = CreateFleetData(cars);
+    auto data_ser = CreateFleetData(cars);
+
+    FleetEvaluator parallel(4);
+    FleetEvaluator serial(1);
+    ASSERT_EQ(parallel.GetThreadCount(), 4u);
+    ASSERT_EQ(serial.GetThreadCount(), 1u);
+
+    int evaluated = 0;
+    for (int frame = 0; frame < 200; ++frame) {
+        StepFleet(*data_par, cars);
+        StepFleet(*data_ser, cars);
+        evaluated += parallel.Evaluate(*data_par);
+        serial.Evaluate(*data_ser);
+    }
+    ASSERT_EQ(evaluated, 200 * cars);
+
+    bool identical = true;
+    bool finite = true;
+    for (int i = 0; i < cars; ++i) {
+        FleetVehicleResult a = parallel.GetResult(i);
+        FleetVehicleResult b = serial.GetResult(i);
+        if (a.snapshot.total_output != b.snapshot.total_output) identical = false;
+        if (a.snapshot.calc_front_grip != b.snapshot.calc_front_grip) identical = false;
+        if (!std::isfinite(a.snapshot.total_output)) finite = false;
+    }
+    ASSERT_TRUE(identical);
+    ASSERT_TRUE(finite);
+    ASSERT_EQ(parallel.GetActiveCount(), cars);
+    ASSERT_TRUE(parallel.GetResult(0).is_player);
+    ASSERT_EQ_STR(parallel.GetResult(3).vehicle_name, "Car 3");
+
+    // Different cars produce different forces (independent engines)
+    ASSERT_TRUE(parallel.GetResult(0).snapshot.total_output != parallel.GetResult(cars - 1).snapshot.total_output);
+}
+
+TEST_CASE(test_fleet_isolation_from_global_state, "Internal") {
+    std::cout << "\nTest: FleetEvaluator engines do not feed GUI buffer or persist loads" << std::endl;
+    auto data = CreateFleetData(3);
+
+    // Drain anything left by other tests
+    g_engine.GetDebugBatch();
+    double dummy = 0.0;
+    bool had_saved = Config::GetSavedStaticLoad("Car 1", dummy);
+
+    FleetEvaluator fleet(2);
+    for (int frame = 0; frame < 50; ++frame) {
+        StepFleet(*data, 3);
+        fleet.Evaluate(*data);
+    }
+
+    ASSERT_TRUE(g_engine.GetDebugBatch().empty());
+    ASSERT_EQ(Config::GetSavedStaticLoad("Car 1", dummy), had_saved);
+}
+
+TEST_CASE(test_fleet_trace_and_slot_reuse, "Internal") {
+    std::cout << "\nTest: FleetEvaluator trace ring buffer and slot ID re-use" << std::endl;
+    auto data = CreateFleetData(2);
+    FleetEvaluator fleet(2);
+
+    const int frames = (int)FleetEvaluator::TRACE_CAPACITY + 10;
+    for (int frame = 0; frame < frames; ++frame) {
+        StepFleet(*data, 2);
+        fleet.Evaluate(*data);
+    }
+
+    std::vector<FleetSample> trace = fleet.GetTrace(1);
+    ASSERT_EQ(trace.size(), FleetEvaluator::TRACE_CAPACITY);
+    ASSERT_TRUE(trace.front().elapsed_time < trace.back().elapsed_time);
+    ASSERT_NEAR(trace.back().elapsed_time, data->telemetry.telemInfo[1].mElapsedTime, 1e-9);
+
+    // Excluding the player leaves only slot 1 active
+    ASSERT_EQ(fleet.Evaluate(*data, false), 1);
+    ASSERT_FALSE(fleet.GetResult(0).active);
+
+    // A new car takes over slot 1: its engine and trace restart
+    data->telemetry.telemInfo[1].mID = 999;
+    data->scoring.vehScoringInfo[1].mID = 999;
+    StepFleet(*data, 2);
+    fleet.Evaluate(*data);
+    ASSERT_EQ(fleet.GetResult(1).id, 999L);
+    ASSERT_EQ(fleet.GetTrace(1).size(), (size_t)1);
+
+    // Out of range / unused slots are safe
+    ASSERT_FALSE(fleet.GetResult(-1).active);
+    ASSERT_FALSE(fleet.GetResult(50).active);
+    ASSERT_TRUE(fleet.GetTrace(50).empty());
+
+    fleet.Reset();
+    ASSERT_EQ(fleet.GetActiveCount(), 0);
+}
+
+TEST_CASE(test_fleet_configure_applies_preset, "Internal") {
+    std::cout << "\nTest: FleetEvaluator::Configure applies tuning and forces shaft torque source" << std::endl;
+    auto data = CreateFleetData(2);
+    FleetEvaluator low(1), high(1);
+
+    Preset p_low;
+    p_low.gain = 0.2f;
+    p_low.torque_source = 1;
+    Preset p_high;
+    p_high.gain = 1.0f;
+    low.Configure(p_low);
+    high.Configure(p_high);
+
+    auto data2 = CreateFleetData(2);
+    for (int frame = 0; frame < 100; ++frame) {
+        StepFleet(*data, 2);
+        StepFleet(*data2, 2);
+        low.Evaluate(*data);
+        high.Evaluate(*data2);
+    }
+
+    // Shaft torque is used even though the preset asked for In-Game FFB (which would yield 0 here)
+    ASSERT_GT(std::abs(low.GetResult(1).snapshot.total_output), 0.0f);
+    ASSERT_LT(std::abs(low.GetResult(1).snapshot.total_output), std::abs(high.GetResult(1).snapshot.total_output));
+}
+
+TEST_CASE(test_fleet_seeds_on_caller_thread, "Internal") {
+    std::cout << "\nTest: Car changes are resolved before dispatch, workers do not reseed" << std::endl;
+    VehicleProfileStore& profiles = VehicleProfileStore::Get();
+    profiles.Clear();
+    profiles.SetField("Seed Car", ProfileField::AutoPeakLoad, 7100.0);
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_isolated = true;
+    engine.m_auto_load_normalization_enabled = true;
+
+    FFBEngine::VehicleSeed seed = FFBEngine::ResolveVehicleSeed("GT3", "Seed Car");
+    ASSERT_EQ((int)seed.vclass, (int)ParsedVehicleClass::GT3);
+    ASSERT_NEAR(seed.learned_peak_load, 7100.0, 1e-9);
+    ASSERT_FALSE(seed.has_static_load);
+
+    ASSERT_FALSE(engine.IsSeededFor("GT3", "Seed Car"));
+    engine.SeedVehicle("GT3", "Seed Car", seed);
+    ASSERT_TRUE(engine.IsSeededFor("GT3", "Seed Car"));
+    ASSERT_FALSE(engine.IsSeededFor("GT3", "Other Car"));
+    ASSERT_NEAR(FFBEngineTestAccess::GetAutoPeakLoad(engine), 7100.0, 1e-9);
+
+    // calculate_force finds the engine seeded and does not look the profile up again
+    profiles.SetField("Seed Car", ProfileField::AutoPeakLoad, 9000.0);
+    TelemInfoV01 data = CreateBasicTestTelemetry(20.0);
+    engine.calculate_force(&data, "GT3", "Seed Car");
+    ASSERT_NEAR(FFBEngineTestAccess::GetAutoPeakLoad(engine), 7100.0, 100.0);
+    profiles.Clear();
+}
+
+} // namespace FFBEngineTests
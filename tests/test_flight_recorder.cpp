@@ -0,0 +1,124 @@
+#include "test_ffb_common.h"
+#include "../src/FlightRecorder.h"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_flight_recorder_ring, "Diagnostics") {
+    std::cout << "\nTest: Flight recorder wraps, validates records and survives reopen" << std::endl;
+    const std::string path = "test_logs/test_flight_recorder.lmfr";
+    const std::string prev = FlightRecorder::PreviousPath(path);
+    ASSERT_EQ(prev, std::string("test_logs/test_flight_recorder.prev.lmfr"));
+    std::remove(prev.c_str());
+
+    FlightRecorder& rec = FlightRecorder::Get();
+    ASSERT_TRUE(rec.Open(path, 1)); // Clamped to MIN_SECONDS
+    ASSERT_EQ((int)rec.GetCapacity(), FlightRecorder::MIN_SECONDS * FlightRecorder::RATE_HZ);
+
+    TelemInfoV01 data = CreateBasicTestTelemetry();
+    FFBSnapshot snap = {};
+    for (int i = 1; i <= 5000; ++i) {
+        data.mElapsedTime = i * 0.0025;
+        snap.total_output = (float)i;
+        rec.Record(snap, &data, 0.1f);
+        rec.SetOutput((float)i * 0.5f);
+        rec.SetOutput(-1.0f); // Only the first call completes a record
+    }
+    ASSERT_EQ((long long)rec.GetHead(), 5000LL);
+
+    // Overwritten records are gone, the rest copy out intact
+    std::vector<FlightRecord> window;
+    ASSERT_EQ((int)rec.Copy(900, 200, window), 99);
+    ASSERT_EQ((long long)window.front().seq, 1001LL);
+    ASSERT_NEAR(window.back().snapshot.total_output, 1099.0f, 1e-6);
+    ASSERT_NEAR(window.back().output_force, 549.5f, 1e-6);
+    ASSERT_NEAR(window.back().inputs.tire_load[0], data.mWheel[0].mTireLoad, 1e-3);
+
+    // The output arrives after the record is published and republishes it intact
+    rec.Record(snap, &data, 0.1f);
+    window.clear();
+    ASSERT_EQ((int)rec.Copy(5001, 1, window), 1);
+    ASSERT_TRUE(std::isnan(window[0].output_force));
+    rec.SetOutput(0.75f);
+    window.clear();
+    ASSERT_EQ((int)rec.Copy(5001, 1, window), 1);
+    ASSERT_NEAR(window[0].output_force, 0.75f, 1e-6);
+    ASSERT_EQ((long long)window[0].seq_end, 5001LL);
+
+    // The file is readable while the recorder is live, oldest record first
+    std::vector<FlightRecord> records;
+    FlightRecorderInfo info;
+    ASSERT_TRUE(FlightRecorder::Load(path, records, &info));
+    ASSERT_EQ((int)records.size(), 4000);
+    ASSERT_EQ((long long)records.front().seq, 1002LL);
+    ASSERT_EQ((long long)info.head, 5001LL);
+    ASSERT_EQ((int)info.rate_hz, FlightRecorder::RATE_HZ);
+
+    // A record torn by a crash mid-write is skipped
+    std::ifstream in(path, std::ios::binary);
+    std::string file((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    size_t torn = file.size() - sizeof(FlightRecord) + offsetof(FlightRecord, seq_end);
+    file[torn] ^= 0x5A;
+    records.clear();
+    ASSERT_TRUE(FlightRecorder::LoadBuffer(file.data(), file.size(), records));
+    ASSERT_EQ((int)records.size(), 3999);
+    std::string error;
+    ASSERT_FALSE(FlightRecorder::LoadBuffer(file.data(), 64, records, nullptr, &error));
+    ASSERT_FALSE(error.empty());
+
+    // Reopening keeps the last session aside
+    ASSERT_TRUE(rec.Open(path, 10));
+    ASSERT_EQ((long long)rec.GetHead(), 0LL);
+    records.clear();
+    ASSERT_TRUE(FlightRecorder::Load(prev, records));
+    ASSERT_EQ((int)records.size(), 4000);
+    ASSERT_EQ((long long)records.back().seq, 5001LL);
+    rec.Close();
+    ASSERT_FALSE(rec.IsOpen());
+
+    std::remove(path.c_str());
+    std::remove(prev.c_str());
+}
+
+TEST_CASE(test_flight_recorder_engine_jolt, "Diagnostics") {
+    std::cout << "\nTest: Engine ticks land in the flight recorder and the jolt is found" << std::endl;
+    const std::string path = "test_logs/test_flight_recorder_engine.lmfr";
+    FlightRecorder& rec = FlightRecorder::Get();
+    ASSERT_TRUE(rec.Open(path, 10));
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    TelemInfoV01 data = CreateBasicTestTelemetry();
+    for (int i = 0; i < 800; ++i) {
+        data.mElapsedTime = 10.0 + i * 0.0025;
+        double force = engine.calculate_force(&data, "GT3", "911", 0.1f);
+        rec.SetOutput((i >= 600) ? 0.9f : (float)force * 0.1f); // Step at tick 600
+    }
+    rec.Close();
+
+    std::vector<FlightRecord> records;
+    ASSERT_TRUE(FlightRecorder::Load(path, records));
+    ASSERT_EQ((int)records.size(), 800);
+    ASSERT_NEAR(records[10].inputs.elapsed_time, 10.025, 1e-9);
+    ASSERT_NEAR(records[10].inputs.steering, data.mUnfilteredSteering, 1e-6);
+    ASSERT_TRUE(std::fabs(records[10].snapshot.raw_car_speed) > 1.0f);
+    size_t jolt = FlightRecorder::FindLargestStep(records);
+    ASSERT_EQ((int)jolt, 600);
+
+    // One CSV row per record, every snapshot channel named
+    std::ostringstream csv;
+    FlightRecorder::WriteCsv(csv, records.data() + jolt - 4, 8);
+    std::string text = csv.str();
+    ASSERT_EQ((int)std::count(text.begin(), text.end(), '\n'), 9);
+    ASSERT_TRUE(text.find("Seq,Time,Output,delta_time") == 0);
+    ASSERT_TRUE(text.find(",wheel_load_rr,") != std::string::npos);
+    ASSERT_TRUE(text.find("\n601,") != std::string::npos);
+
+    std::remove(path.c_str());
+}
+
+} // namespace FFBEngineTests
@@ -0,0 +1,116 @@
+#include "test_ffb_common.h"
+#include "../src/LogAnalyzer.h"
+#include "../src/AsyncLogger.h"
+#include <cmath>
+#include <cstdio>
+#include <sstream>
+
+namespace FFBEngineTests {
+
+TEST_CASE_TAGGED(test_log_analyzer_chunked_stats, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: Native log analyzer matches a direct computation for any thread count" << std::endl;
+
+    // 30 s at 100 Hz with a 2 s slope oscillation burst at t = 10 s
+    const int rows = 3000;
+    std::ostringstream csv;
+    csv << "# LMUFFB Telemetry Log v1.0\n# Driver: Chunky\n# SoP Effect: 0.4\n";
+    csv << "Time,Speed,LatAccel,CalcSlipAngle,dG_dt,dAlpha_dt,SlopeCurrent,GripFactor,Marker\n";
+    std::vector<double> slope(rows);
+    int active = 0, floor_hits = 0, singular = 0, crossings = 0;
+    for (int i = 0; i < rows; i++) {
+        double t = i * 0.01;
+        bool burst = (i >= 1000 && i < 1200);
+        slope[i] = burst ? ((i % 2) ? 30.0 : -30.0) : 2.0 * std::sin(t * 0.7);
+        double dalpha = (i % 3 == 0) ? 0.1 : 0.01;
+        double grip = (i % 50 == 0) ? 0.2 : 0.97;
+        csv << t << ",30," << std::sin(t) << ",0.01," << std::cos(t) << "," << dalpha << "," << slope[i] << "," << grip << ",0\n";
+        if (dalpha > 0.02) active++;
+        if (grip <= 0.21) floor_hits++;
+        if (std::fabs(slope[i]) > 10.0 && dalpha < 0.05) singular++;
+        auto sign = [](double x) { return (x > 0) - (x < 0); };
+        if (i > 0 && sign(slope[i]) != sign(slope[i - 1])) crossings++;
+    }
+    double mean = 0.0, var = 0.0;
+    for (double s : slope) mean += s / rows;
+    for (double s : slope) var += (s - mean) * (s - mean) / (rows - 1);
+    std::string text = csv.str();
+
+    LogAnalyzerOptions one;
+    one.threads = 1;
+    LogAnalyzerOptions many;
+    many.threads = 7;
+    LogAnalysis a, b;
+    ASSERT_TRUE(LogAnalyzer::AnalyzeBuffer(text.data(), text.size(), a, one));
+    ASSERT_TRUE(LogAnalyzer::AnalyzeBuffer(text.data(), text.size(), b, many));
+
+    ASSERT_EQ((int)a.frames, rows);
+    ASSERT_EQ((int)b.frames, rows);
+    ASSERT_EQ(b.threads_used, 7u);
+    ASSERT_NEAR(a.slope.slope_mean, mean, 1e-4);
+    ASSERT_NEAR(b.slope.slope_std, std::sqrt(var), 1e-4);
+    ASSERT_NEAR(*b.slope.active_percentage, active * 100.0 / rows, 1e-9);
+    ASSERT_NEAR(*b.slope.floor_percentage, floor_hits * 100.0 / rows, 1e-9);
+    ASSERT_NEAR(*a.slope.zero_crossing_rate, *b.slope.zero_crossing_rate, 1e-12);
+    ASSERT_NEAR(*b.slope.zero_crossing_rate, crossings / 29.99, 1e-3);
+    ASSERT_EQ(b.singularity_count, singular);
+    ASSERT_NEAR(b.worst_singularity, 30.0, 1e-6);
+    ASSERT_NEAR(*a.grip.grip_vs_latg, *b.grip.grip_vs_latg, 1e-9);
+
+    // The burst is the only oscillation, found identically across chunk borders
+    ASSERT_EQ((int)b.oscillations.size(), 1);
+    ASSERT_EQ((int)a.oscillations.size(), 1);
+    ASSERT_EQ((int)a.oscillations[0].frame_start, (int)b.oscillations[0].frame_start);
+    ASSERT_TRUE(b.oscillations[0].start_time > 9.6 && b.oscillations[0].end_time < 12.4);
+    ASSERT_NEAR(b.oscillations[0].amplitude, 30.0, 1e-6);
+    ASSERT_EQ(b.meta.driver_name, std::string("Chunky"));
+    ASSERT_NEAR(b.meta.sop_effect, 0.4f, 1e-6);
+}
+
+TEST_CASE_TAGGED(test_log_analyzer_logger_round_trip, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: Native log analyzer reads AsyncLogger files and writes the text report" << std::endl;
+    AsyncLogger::Get().Stop();
+
+    SessionInfo info = {};
+    info.driver_name = "TestDriver";
+    info.vehicle_name = "TestCarAnalyzer";
+    info.track_name = "TestTrack";
+    info.app_version = "0.7.112-test";
+    info.gain = 0.8f;
+    info.slope_enabled = true;
+    AsyncLogger::Get().Start(info, "test_logs");
+    std::string filename = AsyncLogger::Get().GetFilename();
+
+    LogFrame frame = {};
+    for (int i = 0; i < 400; i++) { // Decimated to 100 rows
+        frame.timestamp = i * 0.0025;
+        frame.slope_current = (i % 40 < 20) ? 1.0f : -1.0f;
+        frame.dAlpha_dt = 0.1f;
+        frame.ffb_grip_factor = 1.0f;
+        AsyncLogger::Get().Log(frame);
+    }
+    AsyncLogger::Get().Stop();
+
+    LogAnalysis a;
+    std::string error;
+    ASSERT_TRUE(LogAnalyzer::AnalyzeFile(filename, a, {}, &error));
+    ASSERT_EQ((int)a.frames, 100);
+    ASSERT_EQ((int)a.skipped_lines, 0);
+    ASSERT_EQ(a.meta.vehicle_name, std::string("TestCarAnalyzer"));
+    ASSERT_TRUE(a.meta.slope_enabled);
+    ASSERT_NEAR(*a.slope.active_percentage, 100.0, 1e-9);
+
+    std::string report = LogAnalyzer::FormatTextReport(a);
+    ASSERT_TRUE(report.find("LMUFFB DIAGNOSTIC REPORT") != std::string::npos);
+    ASSERT_TRUE(report.find("Driver:       TestDriver") != std::string::npos);
+    ASSERT_TRUE(report.find("Gain:               0.80") != std::string::npos);
+    ASSERT_TRUE(report.find("Singularities:     0 events detected (Worst: 0.0)") != std::string::npos);
+    std::remove(filename.c_str());
+
+    // Unreadable file and logs without the slope channel are rejected
+    ASSERT_FALSE(LogAnalyzer::AnalyzeFile("test_logs/does_not_exist.csv", a, {}, &error));
+    std::string no_slope = "Time,Speed\n0.0,1.0\n";
+    ASSERT_FALSE(LogAnalyzer::AnalyzeBuffer(no_slope.data(), no_slope.size(), a, {}, &error));
+    ASSERT_TRUE(error.find("SlopeCurrent") != std::string::npos);
+}
+
+} // namespace FFBEngineTests
@@ -0,0 +1,154 @@
+#include "test_ffb_common.h"
+#include "../src/AsyncLogger.h"
+#include "../src/LogAnalyzer.h"
+#include "../src/LogCodec.h"
+#include "../src/LogIndex.h"
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <sstream>
+
+namespace FFBEngineTests {
+
+namespace {
+
+// Driving-like rows at 100 Hz: smooth channels, sensor noise, slow and constant ones
+LogFrame MakeCodecFrame(int i, uint32_t& seed) {
+    auto noise = [&seed]() {
+        seed = seed * 1664525u + 1013904223u;
+        return (float)((seed >> 8) & 0xFFFF) / 65536.0f - 0.5f;
+    };
+    double t = i * 0.01;
+    LogFrame f = {};
+    f.timestamp = 100.0 + t;
+    f.delta_time = 0.0025;
+    f.speed = 55.0f + 20.0f * (float)std::sin(t * 0.3);
+    f.steering = 0.3f * (float)std::sin(t * 0.9);
+    f.throttle = (std::sin(t * 0.3) > 0.0) ? 1.0f : 0.2f;
+    f.lat_accel = 12.0f * (float)std::sin(t * 0.9) + 0.4f * noise();
+    f.long_accel = 3.0f * (float)std::cos(t * 0.3) + 0.3f * noise();
+    f.yaw_rate = 0.4f * (float)std::sin(t * 0.9);
+    f.slip_angle_fl = f.slip_angle_fr = 0.05f * (float)std::sin(t * 0.9);
+    f.grip_fl = f.grip_fr = f.grip_rl = f.grip_rr = 1.0f;
+    f.load_fl = f.load_fr = 4000.0f + 500.0f * (float)std::sin(t * 0.9);
+    f.load_rl = f.load_rr = 4500.0f;
+    for (int w = 0; w < 4; ++w) {
+        f.calc_load[w] = 4200.0f;
+        f.calc_grip[w] = 0.98f;
+    }
+    f.calc_slip_angle_front = f.slip_angle_fl;
+    f.calc_grip_front = f.calc_grip_rear = 0.98f;
+    f.slope_current = 2.0f + 0.5f * noise();
+    f.confidence = 1.0f;
+    f.ffb_total = 0.6f * (float)std::sin(t * 0.9) + 0.02f * noise();
+    f.ffb_base = f.ffb_shaft_torque = 12.0f * (float)std::sin(t * 0.9);
+    f.ffb_grip_factor = 1.0f;
+    f.speed_gate = 1.0f;
+    f.load_peak_ref = 4500.0f;
+    f.marker = (i == 1234);
+    return f;
+}
+
+} // namespace
+
+TEST_CASE(test_log_codec_round_trip, "Diagnostics") {
+    std::cout << "\nTest: LogCodec blocks decode back to the CSV rows" << std::endl;
+
+    const std::string header = "# LMUFFB Telemetry Log v1.0\nTime,DeltaTime\n";
+    std::string file;
+    LogCodec::AppendFileHeader(file, header);
+    ASSERT_TRUE(LogCodec::IsCompressed(file.data(), file.size()));
+
+    std::string expected = header;
+    std::ostringstream row;
+    LogCodec::BlockEncoder encoder;
+    uint32_t seed = 12345;
+    std::vector<size_t> block_ends;
+    for (int i = 0; i < 2500; ++i) {
+        LogFrame f = MakeCodecFrame(i, seed);
+        row.str("");
+        AsyncLogger::FormatRow(row, f);
+        expected += row.str();
+        encoder.Add(f);
+        if (encoder.GetCount() == (size_t)LogCodec::BLOCK_FRAMES) {
+            encoder.Encode(file);
+            block_ends.push_back(file.size());
+        }
+    }
+    encoder.Encode(file);
+    block_ends.push_back(file.size());
+    ASSERT_EQ((int)encoder.GetCount(), 0);
+
+    std::string csv;
+    size_t frames = 0;
+    ASSERT_TRUE(LogCodec::DecodeToCsv(file.data(), file.size(), csv, nullptr, &frames));
+    ASSERT_EQ((int)frames, 2500);
+    ASSERT_TRUE(csv == expected);
+
+    // The same channels cost about a tenth of the CSV
+    double ratio = (double)expected.size() / (double)file.size();
+    std::cout << "  CSV " << expected.size() << " bytes -> " << file.size() << " bytes (" << ratio << "x)" << std::endl;
+    ASSERT_TRUE(ratio > 10.0);
+
+    // A torn last block (interrupted session) decodes up to the previous one
+    ASSERT_TRUE(LogCodec::DecodeToCsv(file.data(), block_ends[2] - 7, csv, nullptr, &frames));
+    ASSERT_EQ((int)frames, 2000);
+    std::vector<LogFrame> block;
+    ASSERT_EQ((int)LogCodec::DecodeBlock(file.data() + block_ends[1], block_ends[2] - block_ends[1] - 1, block), 0);
+
+    std::string error;
+    ASSERT_FALSE(LogCodec::DecodeToCsv(expected.data(), expected.size(), csv, &error));
+    ASSERT_FALSE(error.empty());
+}
+
+TEST_CASE_TAGGED(test_log_codec_async_logger, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: AsyncLogger compressed output, index and analyzer" << std::endl;
+    AsyncLogger::Get().Stop();
+
+    SessionInfo info;
+    info.driver_name = "TestDriver";
+    info.vehicle_name = "TestCarCodec";
+    info.track_name = "TestTrack";
+    info.app_version = "0.7.112-test";
+    AsyncLogger::Get().Start(info, "test_logs", true);
+    ASSERT_TRUE(AsyncLogger::Get().IsLogging());
+
+    // 4800 ticks at decimation 4 -> 1200 rows: one full block and a partial one
+    uint32_t seed = 99;
+    for (int i = 0; i < 4800; ++i) AsyncLogger::Get().Log(MakeCodecFrame(i, seed));
+    AsyncLogger::Get().Stop();
+
+    std::string path = AsyncLogger::Get().GetFilename();
+    std::string idx_path = AsyncLogger::Get().GetIndexFilename();
+    ASSERT_TRUE(path.size() > 4 && path.substr(path.size() - 4) == ".lmz");
+
+    std::ifstream in(path, std::ios::binary);
+    ASSERT_TRUE(in.is_open());
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    ASSERT_EQ((long long)data.size(), (long long)AsyncLogger::Get().GetFileSizeBytes());
+
+    // Index chunks are the compressed blocks
+    LogIndex index;
+    ASSERT_TRUE(index.Load(idx_path));
+    ASSERT_EQ((int)index.GetChunks().size(), 2);
+    const LogIndex::Chunk& second = index.GetChunks()[1];
+    ASSERT_EQ((long long)second.end_offset, (long long)data.size());
+    std::vector<LogFrame> block;
+    size_t used = LogCodec::DecodeBlock(data.data() + second.offset, data.size() - second.offset, block);
+    ASSERT_EQ((long long)used, (long long)(second.end_offset - second.offset));
+    ASSERT_EQ((int)block.size(), 200);
+    ASSERT_NEAR(block[0].timestamp, second.time_start, 1e-4);
+
+    // The analyzer reads compressed logs directly
+    LogAnalysis a;
+    std::string error;
+    ASSERT_TRUE(LogAnalyzer::AnalyzeFile(path, a, {}, &error));
+    ASSERT_EQ((int)a.frames, 1200);
+    ASSERT_EQ(a.meta.vehicle_name, std::string("TestCarCodec"));
+
+    std::remove(path.c_str());
+    std::remove(idx_path.c_str());
+}
+
+} // namespace FFBEngineTests
@@ -0,0 +1,139 @@
+#include "test_ffb_common.h"
+#include "../src/AsyncLogger.h"
+#include "../src/LogIndex.h"
+#include <cstdio>
+#include <fstream>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_log_index_chunks_and_marks, "Diagnostics") {
+    std::cout << "\nTest: LogIndex chunks, seek queries and sidecar round trip" << std::endl;
+
+    // 250 rows of 10 bytes in chunks of 100: lap 1 -> 2 at row 120, marker at row 180
+    LogIndex index(100);
+    LogFrame frame = {};
+    for (int i = 0; i < 250; ++i) {
+        frame.timestamp = i * 0.01;
+        frame.lap = (i < 120) ? 1 : 2;
+        frame.marker = (i == 180);
+        frame.lat_accel = (i >= 150 && i < 160) ? 30.0f : 5.0f;
+        frame.speed = (float)i;
+        index.AddFrame(frame, 100 + (uint64_t)i * 10);
+    }
+    ASSERT_EQ((int)index.GetChunks().size(), 2); // Last chunk is still open
+    index.Finish(100 + 250 * 10);
+
+    const auto& chunks = index.GetChunks();
+    ASSERT_EQ((int)chunks.size(), 3);
+    ASSERT_EQ((int)chunks[1].first_frame, 100);
+    ASSERT_EQ((int)chunks[1].offset, 1100);
+    ASSERT_EQ((int)chunks[1].end_offset, 2100);
+    ASSERT_EQ((int)chunks[2].frame_count, 50);
+    ASSERT_EQ(chunks[1].lap, 1);
+    ASSERT_NEAR(chunks[1].min[LogIndex::SPEED], 100.0, 0.001);
+    ASSERT_NEAR(chunks[1].max[LogIndex::SPEED], 199.0, 0.001);
+
+    // Time lookup and range skipping: only chunk 1 saw lateral G above 20
+    ASSERT_EQ(index.FindChunk(1.55), 1);
+    ASSERT_EQ(index.FindChunk(-1.0), -1);
+    std::vector<int> hits = index.FindChunks(LogIndex::FindChannel("LatAccel"), 20.0f, 1e9f);
+    ASSERT_EQ((int)hits.size(), 1);
+    ASSERT_EQ(hits[0], 1);
+
+    const LogIndexMark* marker = index.FindMarker(0);
+    ASSERT_TRUE(marker != nullptr);
+    ASSERT_EQ((int)marker->offset, 1900);
+    ASSERT_TRUE(index.FindMarker(1) == nullptr);
+    const LogIndexMark* lap2 = index.FindLap(2);
+    ASSERT_TRUE(lap2 != nullptr);
+    ASSERT_EQ((int)lap2->frame, 120);
+    ASSERT_NEAR(lap2->time, 1.2, 1e-6);
+
+    // Sidecar round trip, first as an interrupted session (no end record)
+    std::string path = "test_log_index.idx";
+    {
+        std::ofstream out(path);
+        size_t chunks_written = 0, marks_written = 0;
+        LogIndex::WriteHeader(out, "test.csv", 100);
+        index.WriteRecords(out, chunks_written, marks_written);
+        ASSERT_EQ((int)chunks_written, 3);
+        ASSERT_EQ((int)marks_written, 3);
+    }
+    LogIndex loaded;
+    ASSERT_TRUE(loaded.Load(path));
+    ASSERT_FALSE(loaded.IsComplete());
+    ASSERT_EQ(loaded.GetChunkFrames(), 100);
+    ASSERT_EQ((int)loaded.GetChunks().size(), 3);
+    ASSERT_EQ((int)loaded.GetMarks().size(), 3);
+    ASSERT_NEAR(loaded.GetChunks()[1].max[LogIndex::LAT_ACCEL], 30.0, 0.001);
+    ASSERT_EQ(loaded.FindChunk(1.55), 1);
+
+    {
+        std::ofstream out(path, std::ios::app);
+        index.WriteEnd(out);
+    }
+    ASSERT_TRUE(loaded.Load(path));
+    ASSERT_TRUE(loaded.IsComplete());
+    ASSERT_EQ((int)loaded.GetFrameCount(), 250);
+    std::remove(path.c_str());
+}
+
+TEST_CASE_TAGGED(test_log_index_seeks_async_log, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: AsyncLogger writes a seekable index" << std::endl;
+    AsyncLogger::Get().Stop();
+
+    SessionInfo info;
+    info.driver_name = "TestDriver";
+    info.vehicle_name = "TestCarIndex";
+    info.track_name = "TestTrack";
+    info.app_version = "0.7.112-test";
+    AsyncLogger::Get().Start(info, "test_logs");
+    ASSERT_TRUE(AsyncLogger::Get().IsLogging());
+
+    // 4800 ticks at decimation 4 -> 1200 rows (two chunks), lap change and one marker
+    LogFrame frame = {};
+    for (int i = 0; i < 4800; ++i) {
+        frame.timestamp = i * 0.0025;
+        frame.lap = (i < 3000) ? 3 : 4;
+        frame.speed = (float)(i % 400);
+        if (i == 2001) AsyncLogger::Get().SetMarker();
+        AsyncLogger::Get().Log(frame);
+    }
+    AsyncLogger::Get().Stop();
+
+    std::string csv_path = AsyncLogger::Get().GetFilename();
+    std::string idx_path = AsyncLogger::Get().GetIndexFilename();
+    LogIndex index;
+    ASSERT_TRUE(index.Load(idx_path));
+    ASSERT_TRUE(index.IsComplete());
+    ASSERT_EQ((int)index.GetChunks().size(), 2);
+
+    std::ifstream csv(csv_path, std::ios::binary);
+    ASSERT_TRUE(csv.is_open());
+    csv.seekg(0, std::ios::end);
+    ASSERT_EQ((long long)csv.tellg(), (long long)AsyncLogger::Get().GetFileSizeBytes());
+    ASSERT_EQ((long long)index.GetChunks().back().end_offset, (long long)AsyncLogger::Get().GetFileSizeBytes());
+
+    // Chunk offsets are row starts: the first field is the chunk's start time
+    std::string line;
+    const LogIndex::Chunk& second = index.GetChunks()[1];
+    csv.seekg((std::streamoff)second.offset);
+    std::getline(csv, line);
+    ASSERT_NEAR(std::stod(line.substr(0, line.find(','))), second.time_start, 1e-4);
+
+    const LogIndexMark* marker = index.FindMarker(0);
+    ASSERT_TRUE(marker != nullptr);
+    csv.seekg((std::streamoff)marker->offset);
+    std::getline(csv, line);
+    ASSERT_TRUE(line.size() > 2 && line.substr(line.size() - 2) == ",1");
+
+    const LogIndexMark* lap4 = index.FindLap(4);
+    ASSERT_TRUE(lap4 != nullptr);
+    ASSERT_NEAR(lap4->time, 3000 * 0.0025, 0.01); // First logged row of the lap (decimation 4)
+
+    csv.close();
+    std::remove(csv_path.c_str());
+    std::remove(idx_path.c_str());
+}
+
+} // namespace FFBEngineTests
@@ -0,0 +1,112 @@
+#include "test_ffb_common.h"
+#include "../src/Logger.h"
+#include <cstdio>
+#include <thread>
+#include <vector>
+
+#ifndef _WIN32
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+namespace FFBEngineTests {
+
+static std::vector<std::string> ReadLogLines(const char* path) {
+    std::vector<std::string> lines;
+    std::ifstream f(path);
+    std::string line;
+    while (std::getline(f, line)) lines.push_back(line);
+    return lines;
+}
+
+TEST_CASE_TAGGED(test_logger_async_order, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: Logger ring preserves order and reaches disk on Flush" << std::endl;
+    const char* path = "test_logger_order.log";
+    Logger::Get().Init(path);
+    for (int i = 0; i < 100; ++i) Logger::Get().Log("Order %d", i);
+    Logger::Get().Flush();
+
+    int expected = 0;
+    bool in_order = true;
+    for (const auto& line : ReadLogLines(path)) {
+        size_t p = line.find("Order ");
+        if (p == std::string::npos) continue;
+        if (std::atoi(line.c_str() + p + 6) != expected) in_order = false;
+        expected++;
+    }
+    ASSERT_EQ(expected, 100);
+    ASSERT_TRUE(in_order);
+    ASSERT_TRUE(ReadLogLines(path).front().find("Logger Initialized") != std::string::npos);
+    std::remove(path);
+}
+
+TEST_CASE_TAGGED(test_logger_async_concurrency, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: Logger concurrent producers and overflow accounting" << std::endl;
+    const char* path = "test_logger_threads.log";
+    Logger::Get().Init(path);
+    Logger::Get().Flush();
+
+    // 4 x 50 fits in the ring: nothing may be lost
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([t]() {
+            for (int i = 0; i < 50; ++i) Logger::Get().Log("Thread %d msg %d", t, i);
+        });
+    }
+    for (auto& th : threads) th.join();
+    Logger::Get().Flush();
+
+    int count = 0;
+    for (const auto& line : ReadLogLines(path)) {
+        if (line.find("Thread ") != std::string::npos) count++;
+    }
+    ASSERT_EQ(count, 200);
+
+    // A burst larger than the ring drops instead of blocking; every message is accounted for
+    size_t dropped_before = Logger::Get().GetDroppedCount();
+    const int burst = (int)Logger::RING_SIZE * 4;
+    for (int i = 0; i < burst; ++i) Logger::Get().Log("Burst %d", i);
+    Logger::Get().Flush();
+
+    int written = 0;
+    for (const auto& line : ReadLogLines(path)) {
+        if (line.find("] Burst ") != std::string::npos) written++;
+    }
+    size_t dropped = Logger::Get().GetDroppedCount() - dropped_before;
+    ASSERT_EQ((size_t)written + dropped, (size_t)burst);
+    ASSERT_GE(written, (int)Logger::RING_SIZE);
+    std::remove(path);
+}
+
+#ifndef _WIN32
+TEST_CASE_TAGGED(test_logger_fatal_signal_writes_queue, "Diagnostics", {"Logger"}) {
+    std::cout << "\nTest: Fatal signal appends queued messages with raw writes" << std::endl;
+    const char* path = "test_logger_fatal.log";
+    Logger::Get().Init(path);
+    Logger::Get().Flush();
+
+    // The forked child has no writer thread, so its messages are still queued at the crash
+    pid_t pid = fork();
+    if (pid == 0) {
+        for (int i = 0; i < 3; ++i) Logger::Get().Log("Before crash %d", i);
+        std::raise(SIGABRT);
+        _exit(0); // Not reached
+    }
+    ASSERT_TRUE(pid > 0);
+    int status = 0;
+    waitpid(pid, &status, 0);
+    ASSERT_TRUE(WIFSIGNALED(status) && WTERMSIG(status) == SIGABRT);
+
+    int queued = 0;
+    bool note = false;
+    for (const auto& line : ReadLogLines(path)) {
+        if (line.find("Before crash ") == 0) queued++;
+        if (line == "[Logger] Fatal signal: SIGABRT") note = true;
+    }
+    ASSERT_EQ(queued, 3);
+    ASSERT_TRUE(note);
+    std::remove(path);
+}
+#endif
+
+} // namespace FFBEngineTests
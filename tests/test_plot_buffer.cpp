@@ -0,0 +1,98 @@
+#include "test_ffb_common.h"
+#include "../src/PlotBuffer.h"
+#include <algorithm>
+#include <cmath>
+#include <deque>
+#include <random>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_plot_buffer_range_queries, "GUI") {
+    std::cout << "\nTest: Plot buffer min/max pyramid matches a full scan" << std::endl;
+
+    PlotBuffer buf(1000);
+    ASSERT_EQ(buf.GetCount(), 0);
+    ASSERT_NEAR(buf.GetCurrent(), 0.0f, 1e-9);
+    ASSERT_NEAR(buf.GetMin(), 0.0f, 1e-9);
+
+    std::mt19937 rng(17);
+    std::uniform_real_distribution<float> dist(-50.0f, 50.0f);
+    std::deque<float> ref;
+    int mismatches = 0;
+    for (int i = 0; i < 3500; i++) { // Wraps the ring several times
+        float v = dist(rng);
+        buf.Add(v);
+        ref.push_back(v);
+        if (ref.size() > 1000) ref.pop_front();
+
+        if (i % 7 == 0) {
+            auto mm = std::minmax_element(ref.begin(), ref.end());
+            if (buf.GetMin() != *mm.first || buf.GetMax() != *mm.second) mismatches++;
+            int first = (int)(rng() % ref.size());
+            int count = 1 + (int)(rng() % (ref.size() - first));
+            float lo = 0.0f, hi = 0.0f;
+            buf.GetRange(first, count, lo, hi);
+            auto rm = std::minmax_element(ref.begin() + first, ref.begin() + first + count);
+            if (lo != *rm.first || hi != *rm.second) mismatches++;
+        }
+    }
+    ASSERT_EQ(mismatches, 0);
+    ASSERT_EQ(buf.GetCount(), 1000);
+    ASSERT_NEAR(buf.GetCurrent(), ref.back(), 1e-9);
+
+    float lo = 0.0f, hi = 0.0f;
+    ASSERT_FALSE(buf.GetRange(990, 20, lo, hi));
+    ASSERT_FALSE(buf.GetRange(0, 0, lo, hi));
+
+    // Resize starts a fresh history
+    buf.Resize(64);
+    ASSERT_EQ(buf.GetCapacity(), 64);
+    ASSERT_EQ(buf.GetCount(), 0);
+    buf.Add(3.0f);
+    ASSERT_NEAR(buf.GetMax(), 3.0f, 1e-9);
+}
+
+TEST_CASE(test_plot_buffer_envelope, "GUI") {
+    std::cout << "\nTest: Plot buffer envelope keeps spikes and leaves the unfilled history empty" << std::endl;
+
+    const int capacity = 4000;
+    const int columns = 300;
+    PlotBuffer buf(capacity);
+
+    // Half full: the older half of the window has no data yet
+    for (int i = 0; i < capacity / 2; i++) buf.Add(std::sin(i * 0.01f));
+    std::vector<float> mn(columns), mx(columns);
+    ASSERT_EQ(buf.BuildEnvelope(columns, mn.data(), mx.data()), columns);
+    ASSERT_TRUE(std::isnan(mn[0]) && std::isnan(mx[columns / 2 - 1]));
+    ASSERT_FALSE(std::isnan(mn[columns / 2 + 1]));
+    ASSERT_FALSE(std::isnan(mx[columns - 1]));
+
+    // Fill up with one single-sample spike; every column matches a brute-force scan
+    std::vector<float> ref;
+    for (int i = 0; i < capacity; i++) {
+        float v = (i == 2500) ? 9.0f : std::sin(i * 0.01f);
+        buf.Add(v);
+        ref.push_back(v);
+    }
+    buf.BuildEnvelope(columns, mn.data(), mx.data());
+    int mismatches = 0;
+    float env_max = -1e9f;
+    for (int c = 0; c < columns; c++) {
+        int b = c * capacity / columns, e = (c + 1) * capacity / columns;
+        auto mm = std::minmax_element(ref.begin() + b, ref.begin() + e);
+        if (mn[c] != *mm.first || mx[c] != *mm.second) mismatches++;
+        env_max = (std::max)(env_max, mx[c]);
+    }
+    ASSERT_EQ(mismatches, 0);
+    ASSERT_NEAR(env_max, 9.0f, 1e-6); // A plain decimation would likely drop the spike
+
+    // More columns than samples repeats samples instead of reading past the end
+    PlotBuffer small(8);
+    for (int i = 0; i < 8; i++) small.Add((float)i);
+    std::vector<float> smn(20), smx(20);
+    small.BuildEnvelope(20, smn.data(), smx.data());
+    ASSERT_NEAR(smn[0], 0.0f, 1e-9);
+    ASSERT_NEAR(smx[19], 7.0f, 1e-9);
+}
+
+} // namespace FFBEngineTests
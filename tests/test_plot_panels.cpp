@@ -0,0 +1,118 @@
+#include "test_ffb_common.h"
+#include "../src/PlotPanels.h"
+#include <cmath>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_plot_panel_channel_selection, "GUI") {
+    std::cout << "\nTest: Plot panels buffer only their selected channels" << std::endl;
+
+    int total = FindPlotChannel("total_output");
+    int load_rr = FindPlotChannel("wheel_load_rr");
+    ASSERT_TRUE(total >= 0 && load_rr >= 0);
+    ASSERT_EQ(FindPlotChannel("no_such_channel"), -1);
+
+    FFBSnapshot snap = {};
+    snap.total_output = 0.25f;
+    snap.wheel_load[3] = 4200.0f;
+    ASSERT_NEAR(GetPlotChannel(total).Read(snap), 0.25f, 1e-6);
+    ASSERT_NEAR(GetPlotChannel(load_rr).Read(snap), 4200.0f, 1e-3);
+
+    PlotPanel panel(1);
+    panel.SetChannel(load_rr, true);
+    panel.SetChannel(load_rr, true); // Duplicate ignored
+    panel.SetHistorySeconds(1.0f);   // 400 samples
+    ASSERT_EQ((int)panel.GetChannels().size(), 1);
+
+    for (int i = 0; i < 1000; i++) {
+        snap.wheel_load[3] = (float)i;
+        panel.Feed(snap);
+    }
+    auto t0 = std::chrono::steady_clock::now();
+    ASSERT_TRUE(panel.Refresh(100, t0));
+    const PlotPanel::Trace& tr = panel.GetTrace(0);
+    // Only the last second of history is kept, oldest sample 600
+    ASSERT_NEAR(tr.current, 999.0f, 1e-3);
+    ASSERT_NEAR(tr.min_val, 600.0f, 1e-3);
+    ASSERT_NEAR(tr.max_val, 999.0f, 1e-3);
+    ASSERT_EQ((int)tr.env_min.size(), 100);
+
+    panel.SetChannel(load_rr, false);
+    ASSERT_TRUE(panel.GetChannels().empty());
+}
+
+TEST_CASE(test_plot_panel_refresh_and_persistence, "GUI") {
+    std::cout << "\nTest: Plot panels refresh at their own rate and round-trip through config" << std::endl;
+
+    PlotPanelSet set;
+    ASSERT_EQ((int)set.GetRefreshInterval().count(), 0);
+
+    PlotPanel& fast = set.Add();
+    fast.SetChannel(FindPlotChannel("raw_gen_torque"), true);
+    fast.SetRefreshHz(50.0f);
+    PlotPanel& slow = set.Add();
+    slow.SetTitle("Loads|Grip;");
+    slow.SetChannel(FindPlotChannel("wheel_load_fl"), true);
+    slow.SetChannel(FindPlotChannel("calc_front_grip"), true);
+    slow.SetRefreshHz(2.0f);
+    slow.SetHistorySeconds(30.0f);
+    slow.auto_scale = true;
+    ASSERT_EQ((int)set.GetRefreshInterval().count(), 20);
+
+    // Cached traces are reused until the interval passes or the width changes
+    PlotPanel& p = set.GetPanels()[1];
+    auto t0 = std::chrono::steady_clock::now();
+    ASSERT_TRUE(p.Refresh(200, t0));
+    bool early = p.Refresh(200, t0 + std::chrono::milliseconds(100));
+    bool resized = p.Refresh(150, t0 + std::chrono::milliseconds(120));
+    bool due = p.Refresh(150, t0 + std::chrono::milliseconds(700));
+    ASSERT_FALSE(early);
+    ASSERT_TRUE(resized);
+    ASSERT_TRUE(due);
+
+    std::string text = set.Serialize();
+    PlotPanelSet loaded;
+    loaded.Deserialize(text + ";Old|5|10|0|removed_channel,total_output;Empty|10|30|0|");
+    ASSERT_EQ((int)loaded.GetPanels().size(), 4);
+    const PlotPanel& l = loaded.GetPanels()[1];
+    ASSERT_EQ((int)l.GetChannels().size(), 2);
+    ASSERT_NEAR(l.GetHistorySeconds(), 30.0f, 1e-6);
+    ASSERT_NEAR(l.GetRefreshHz(), 2.0f, 1e-6);
+    ASSERT_TRUE(l.auto_scale);
+    ASSERT_TRUE(l.GetTitle().find('|') == std::string::npos && l.GetTitle().find(';') == std::string::npos);
+    ASSERT_EQ((int)loaded.GetPanels()[2].GetChannels().size(), 1); // Unknown key skipped
+    ASSERT_TRUE(loaded.GetPanels()[3].GetChannels().empty());
+
+    loaded.GetPanels()[0].open = false;
+    ASSERT_TRUE(loaded.RemoveClosed());
+    ASSERT_EQ((int)loaded.GetPanels().size(), 3);
+}
+
+TEST_CASE(test_plot_panel_set_in_place_torn_gap, "GUI") {
+    std::cout << "\nTest: Snapshots overwritten while plotted in place become a break" << std::endl;
+    PlotPanelSet set;
+    PlotPanel& panel = set.Add();
+    panel.SetChannel(FindPlotChannel("total_output"), true);
+    panel.SetHistorySeconds(1.0f); // 400 samples
+
+    FFBSnapshotRing ring;
+    FFBSnapshotRing::Reader reader(ring);
+    FFBSnapshot snap = {};
+    for (int i = 0; i < 300; i++) {
+        snap.total_output = 1.0f;
+        ring.Push(snap);
+    }
+    FFBSnapshotRing::View view = reader.Read();
+    set.Feed(view);
+    for (int i = 0; i < (int)FFBSnapshotRing::CAPACITY; i++) ring.Push(snap); // Writer laps the view
+    size_t torn = reader.Validate(view);
+    ASSERT_EQ((int)torn, 300);
+    set.AddGap((int64_t)torn);
+
+    ASSERT_TRUE(panel.Refresh(40, std::chrono::steady_clock::now()));
+    const PlotPanel::Trace& tr = panel.GetTrace(0);
+    ASSERT_TRUE(std::isnan(tr.env_min.back()) && std::isnan(tr.env_max.back()));
+    ASSERT_NEAR(tr.max_val, 1.0f, 1e-6);
+}
+
+} // namespace FFBEngineTests
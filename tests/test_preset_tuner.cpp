@@ -0,0 +1,150 @@
+#include "test_ffb_common.h"
+#include "../src/PresetTuner.h"
+#include "../src/TelemetryReplay.h"
+#include <cstdio>
+
+namespace FFBEngineTests {
+
+// 20 s of sinusoidal cornering at 100Hz with a 60Hz ripple on the shaft torque.
+static ReplayCapture CreateSweepCapture() {
+    ReplayCapture cap;
+    cap.vehicle_name = "Test GT3";
+    for (int i = 0; i < 2000; ++i) {
+        double t = i * 0.01;
+        double steer = 0.3 * std::sin(t * 1.1);
+        double torque = steer * 40.0 + std::sin(t * 60.0) * 1.5;
+        cap.frames.push_back(TelemetryReplay::BuildFrame(t, 0.01, 40.0, steer * 25.0, 0.0, 0.0, steer, 0.7, 0.0,
+                                                         steer * 0.1, 0.0, 1.0, 1.0, 5000.0, torque));
+        cap.gen_torque.push_back(0.0f);
+    }
+    cap.duration_s = 19.99;
+    return cap;
+}
+
+TEST_CASE(test_tuner_param_parsing, "Config") {
+    std::cout << "\nTest: PresetTuner parameter parsing and field table" << std::endl;
+    TunerParam p;
+    ASSERT_TRUE(PresetTuner::ParseParam("gain=0.5:1.5:3", p));
+    ASSERT_EQ_STR(p.key, "gain");
+    ASSERT_NEAR(p.min_val, 0.5f, 1e-6);
+    ASSERT_NEAR(p.max_val, 1.5f, 1e-6);
+    ASSERT_EQ(p.steps, 3);
+
+    ASSERT_TRUE(PresetTuner::ParseParam("sop=2:1", p)); // Reversed range, default steps
+    ASSERT_NEAR(p.min_val, 1.0f, 1e-6);
+    ASSERT_EQ(p.steps, 5);
+
+    ASSERT_FALSE(PresetTuner::ParseParam("not_a_key=0:1:2", p));
+    ASSERT_FALSE(PresetTuner::ParseParam("gain=abc", p));
+    ASSERT_FALSE(PresetTuner::ParseParam("gain=0:1:0", p));
+
+    Preset preset;
+    ASSERT_TRUE(PresetTuner::SetField(preset, "understeer", 0.25f));
+    ASSERT_NEAR(preset.understeer, 0.25f, 1e-6);
+    ASSERT_FALSE(PresetTuner::SetField(preset, "bogus", 1.0f));
+    ASSERT_GT(PresetTuner::TunableKeys().size(), (size_t)10);
+}
+
+TEST_CASE(test_tuner_candidate_generation, "Config") {
+    std::cout << "\nTest: PresetTuner grid and random search candidates" << std::endl;
+    Preset base;
+    std::vector<TunerParam> params(2);
+    PresetTuner::ParseParam("gain=0.2:1.0:3", params[0]);
+    PresetTuner::ParseParam("sop=0:2:4", params[1]);
+
+    auto grid = PresetTuner::BuildGrid(base, params);
+    ASSERT_EQ(grid.size(), (size_t)12);
+    ASSERT_NEAR(grid.front().preset.gain, 0.2f, 1e-6);
+    ASSERT_NEAR(grid.back().preset.gain, 1.0f, 1e-6);
+    ASSERT_NEAR(grid.back().preset.sop, 2.0f, 1e-6);
+    ASSERT_EQ(grid.back().values.size(), (size_t)2);
+
+    auto r1 = PresetTuner::BuildRandom(base, params, 8, 42);
+    auto r2 = PresetTuner::BuildRandom(base, params, 8, 42);
+    ASSERT_EQ(r1.size(), (size_t)8);
+    bool same = true, in_range = true;
+    for (size_t i = 0; i < r1.size(); ++i) {
+        if (r1[i].preset.gain != r2[i].preset.gain) same = false;
+        if (r1[i].preset.gain < 0.2f || r1[i].preset.gain > 1.0f) in_range = false;
+    }
+    ASSERT_TRUE(same);
+    ASSERT_TRUE(in_range);
+}
+
+TEST_CASE(test_tuner_metrics, "Config") {
+    std::cout << "\nTest: PresetTuner metrics respond to gain and smoothing" << std::endl;
+    ReplayCapture cap = CreateSweepCapture();
+
+    Preset low, high, smooth;
+    low.gain = 0.3f;
+    high.gain = 3.0f;
+    smooth.steering_shaft_smoothing = 0.05f;
+
+    TunerMetrics m_low = PresetTuner::Evaluate(low, cap);
+    TunerMetrics m_high = PresetTuner::Evaluate(high, cap);
+    TunerMetrics m_def = PresetTuner::Evaluate(Preset(), cap);
+    TunerMetrics m_smooth = PresetTuner::Evaluate(smooth, cap);
+
+    ASSERT_NEAR(m_low.clipping_ratio, 0.0, 1e-9);
+    ASSERT_GT(m_high.clipping_ratio, 0.1);
+    ASSERT_GE(m_high.saturation_ratio, m_high.clipping_ratio);
+    ASSERT_LT(m_low.output_rms, m_high.output_rms);
+
+    // Shaft smoothing removes ripple but adds lag
+    ASSERT_LT(m_smooth.hf_energy, m_def.hf_energy);
+    ASSERT_GT(m_smooth.latency_ms, m_def.latency_ms);
+}
+
+TEST_CASE(test_tuner_parallel_ranking, "Config") {
+    std::cout << "\nTest: PresetTuner parallel run is deterministic and ranked" << std::endl;
+    ReplayCapture cap = CreateSweepCapture();
+    std::vector<TunerParam> params(1);
+    PresetTuner::ParseParam("gain=0.2:3.0:6", params[0]);
+
+    auto serial = PresetTuner::BuildGrid(Preset(), params);
+    auto parallel = serial;
+    PresetTuner::Run(serial, cap, 1);
+    PresetTuner::Run(parallel, cap, 4);
+
+    bool sorted = true, identical = true;
+    for (size_t i = 0; i < parallel.size(); ++i) {
+        if (i > 0 && parallel[i].metrics.score < parallel[i - 1].metrics.score) sorted = false;
+        if (parallel[i].metrics.score != serial[i].metrics.score) identical = false;
+    }
+    ASSERT_TRUE(sorted);
+    ASSERT_TRUE(identical);
+    // The heaviest gain clips most of the time and must not win
+    ASSERT_LT(parallel.front().preset.gain, 3.0f);
+}
+
+TEST_CASE(test_replay_csv_loading, "Config") {
+    std::cout << "\nTest: TelemetryReplay loads AsyncLogger CSV" << std::endl;
+    const char* path = "test_replay_capture.csv";
+    {
+        std::ofstream f(path);
+        f << "# LMUFFB Telemetry Log v1.0\n# Vehicle: Porsche 963\n# Track: Spa\n";
+        f << "Time,DeltaTime,Speed,LatAccel,LongAccel,YawRate,Steering,Throttle,Brake,SlipAngleFL,SlipAngleFR,"
+          << "GripFL,GripFR,LoadFL,LoadFR,CalcGripRear,FFBShaftTorque,FFBGenTorque,Clipping,Marker\n";
+        f << "10.00,0.0025,50.0,5.0,1.0,0.1,0.2,1.0,0.0,0.05,0.07,0.9,0.8,4000,6000,0.7,12.5,0.3,0,0\n";
+        f << "10.01,0.0025,51.0,5.5,1.0,0.1,0.2,1.0,0.0,0.05,0.07,0.9,0.8,4000,6000,0.7,13.0,0.3,0,0\n";
+    }
+
+    ReplayCapture cap;
+    std::string err;
+    ASSERT_TRUE(TelemetryReplay::LoadCsv(path, cap, &err));
+    ASSERT_EQ(cap.frames.size(), (size_t)2);
+    ASSERT_EQ_STR(cap.vehicle_name, "Porsche 963");
+    ASSERT_EQ_STR(cap.frames[0].mTrackName, "Spa");
+    ASSERT_NEAR(cap.frames[1].mDeltaTime, 0.01, 1e-6);        // From timestamps, not the logged 400Hz dt
+    ASSERT_NEAR(cap.frames[0].mLocalVel.z, -50.0, 1e-6);
+    ASSERT_NEAR(cap.frames[0].mWheel[0].mLateralPatchVel, 0.06 * 50.0, 1e-6);
+    ASSERT_NEAR(cap.frames[0].mWheel[0].mTireLoad, 5000.0, 1e-6);
+    ASSERT_NEAR(cap.frames[0].mWheel[2].mGripFract, 0.7, 1e-6);
+    ASSERT_NEAR(cap.frames[1].mSteeringShaftTorque, 13.0, 1e-6);
+    ASSERT_NEAR(cap.gen_torque[0], 0.3f, 1e-6);
+    std::remove(path);
+
+    ASSERT_FALSE(TelemetryReplay::LoadCsv("does_not_exist.csv", cap, &err));
+}
+
+} // namespace FFBEngineTests
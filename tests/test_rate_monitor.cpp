@@ -1,5 +1,7 @@
 #include "test_ffb_common.h"
 #include "../src/RateMonitor.h"
+#include <atomic>
+#include <cmath>
 #include <thread>
 #include <chrono>
 
@@ -86,3 +88,74 @@ TEST_CASE(test_channel_monitor_logic, "Diagnostics") {
     // Should be exactly 3.0 Hz
     ASSERT_NEAR(ch.monitor.GetRate(), 3.0, 0.1);
 }
+
+TEST_CASE(test_interval_rate_monitor_window, "Diagnostics") {
+    std::cout << "\nTest: IntervalRateMonitor exact window, jitter and missed deadlines" << std::endl;
+    IntervalRateMonitor monitor(3.75); // 400 Hz loop, deadline 1.5x the period
+    auto start = std::chrono::steady_clock::now();
+    ASSERT_NEAR(monitor.GetStatsAt(start).rate_hz, 0.0, 1e-9);
+
+    // 400 Hz with alternating 2.4 / 2.6 ms intervals: exact before a full second has passed
+    auto t = start;
+    for (int i = 0; i < 200; ++i) {
+        t += std::chrono::microseconds((i % 2) ? 2600 : 2400);
+        monitor.RecordEventAt(t);
+    }
+    RateStats s = monitor.GetStatsAt(t);
+    ASSERT_EQ((int)s.intervals, 199);
+    ASSERT_NEAR(s.rate_hz, 400.0, 0.5);
+    ASSERT_NEAR(s.mean_ms, 2.5, 0.002);
+    ASSERT_NEAR(s.stddev_ms, 0.1, 0.002);
+    ASSERT_NEAR(s.min_ms, 2.4, 1e-6);
+    ASSERT_NEAR(s.max_ms, 2.6, 1e-6);
+    ASSERT_EQ((int)s.missed, 0);
+
+    // One 10 ms stall is a missed deadline and shows in the window right away
+    t += std::chrono::milliseconds(10);
+    monitor.RecordEventAt(t);
+    s = monitor.GetStatsAt(t);
+    ASSERT_EQ((int)s.missed, 1);
+    ASSERT_EQ((int)s.missed_total, 1);
+    ASSERT_NEAR(s.max_ms, 10.0, 1e-6);
+    ASSERT_NEAR(s.instant_hz, 100.0, 1e-6);
+
+    // The window slides: 2 s of steady 100 Hz replace the 400 Hz history
+    for (int i = 0; i < 200; ++i) {
+        t += std::chrono::milliseconds(10);
+        monitor.RecordEventAt(t);
+    }
+    s = monitor.GetStatsAt(t);
+    ASSERT_NEAR(s.rate_hz, 100.0, 0.01);
+    ASSERT_NEAR(s.stddev_ms, 0.0, 1e-6);
+    ASSERT_EQ((int)s.missed, 100);
+    ASSERT_EQ((int)s.missed_total, 201);
+
+    // When events stop, the rate decays instead of holding
+    ASSERT_NEAR(monitor.GetStatsAt(t + std::chrono::milliseconds(500)).rate_hz, 50.0, 0.01);
+    ASSERT_NEAR(monitor.GetStatsAt(t + std::chrono::milliseconds(1001)).rate_hz, 0.0, 1e-9);
+}
+
+TEST_CASE(test_interval_rate_monitor_concurrent, "Diagnostics") {
+    std::cout << "\nTest: IntervalRateMonitor single writer, concurrent readers" << std::endl;
+    IntervalRateMonitor monitor(0.0, 100.0);
+    std::atomic<bool> done{false};
+    std::atomic<int> bad{0};
+
+    auto reader = [&]() {
+        while (!done.load()) {
+            RateStats s = monitor.GetStats();
+            if (s.intervals > 0 && (s.min_ms <= 0.0 || s.max_ms < s.min_ms || !std::isfinite(s.rate_hz))) bad++;
+        }
+    };
+    std::thread r1(reader), r2(reader);
+    auto t = std::chrono::steady_clock::now();
+    for (int i = 0; i < 200000; ++i) {
+        t += std::chrono::microseconds(50);
+        monitor.RecordEventAt(t); // Timestamps strictly increase: any torn read shows up as <= 0
+    }
+    done = true;
+    r1.join();
+    r2.join();
+    ASSERT_EQ(bad.load(), 0);
+    ASSERT_EQ((long long)monitor.GetStatsAt(t).events, 200000LL);
+}
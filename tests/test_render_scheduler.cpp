@@ -0,0 +1,84 @@
+#include "test_ffb_common.h"
+#include "../src/RenderScheduler.h"
+#include "../src/GuiLayer.h"
+#include <chrono>
+
+using namespace FFBEngineTests;
+
+namespace {
+
+using State = RenderScheduler::WindowState;
+
+// Pumps the scheduler like the main loop does (waiting GetWaitTimeAt between pumps)
+// for `seconds` and returns the number of frames drawn.
+int PumpFor(RenderScheduler& sched, std::chrono::steady_clock::time_point& now, double seconds,
+            State state, bool data_changed, bool graphs_visible, bool input = false) {
+    auto end = now + std::chrono::milliseconds((long)(seconds * 1000.0));
+    int drawn = 0;
+    auto max_wait = std::chrono::milliseconds(0);
+    while (now < end) {
+        if (input) sched.NotifyInputAt(now);
+        if (sched.ShouldDrawAt(now, state, data_changed, graphs_visible)) drawn++;
+        auto wait = sched.GetWaitTimeAt(now);
+        if (wait > max_wait) max_wait = wait;
+        now += (wait.count() > 0) ? wait : std::chrono::milliseconds(1);
+    }
+    ASSERT_TRUE(max_wait <= RenderScheduler::PUMP_INTERVAL); // DirectInput keeps its message pump
+    return drawn;
+}
+
+} // namespace
+
+TEST_CASE(test_render_scheduler_rates, "GUI") {
+    std::cout << "\nTest: Render scheduler redraw rate follows input and live data" << std::endl;
+    RenderScheduler sched;
+    auto now = std::chrono::steady_clock::now();
+
+    // First pump always draws
+    ASSERT_TRUE(sched.ShouldDrawAt(now, State::Visible, false, false));
+
+    int idle = PumpFor(sched, now, 10.0, State::Visible, false, false);
+    int live_readouts = PumpFor(sched, now, 10.0, State::Visible, true, false);
+    int live_graphs = PumpFor(sched, now, 10.0, State::Visible, true, true);
+    int input = PumpFor(sched, now, 10.0, State::Visible, false, false, true);
+    std::cout << "  Frames in 10 s: idle " << idle << ", readouts " << live_readouts
+              << ", graphs " << live_graphs << ", input " << input << std::endl;
+
+    ASSERT_TRUE(idle >= 19 && idle <= 21);                  // 2 Hz
+    ASSERT_TRUE(live_readouts >= 190 && live_readouts <= 220); // 20 Hz
+    ASSERT_TRUE(live_graphs >= 550 && live_graphs <= 640);     // ~60 Hz
+    ASSERT_TRUE(input >= 550 && input <= 640);
+
+    // Input holds full rate briefly, then decays to idle
+    sched.NotifyInputAt(now);
+    int after_input = PumpFor(sched, now, 0.4, State::Visible, false, false);
+    ASSERT_TRUE(after_input >= 20);
+    PumpFor(sched, now, 0.2, State::Visible, false, false);
+    ASSERT_TRUE(sched.GetInterval() == RenderScheduler::IDLE_INTERVAL);
+}
+
+TEST_CASE(test_render_scheduler_background_suspension, "GUI") {
+    std::cout << "\nTest: Render scheduler stops drawing while minimized or occluded" << std::endl;
+    RenderScheduler sched;
+    auto now = std::chrono::steady_clock::now();
+    PumpFor(sched, now, 1.0, State::Visible, true, true);
+
+    // Hidden: no frames even with live data and input, but the pump keeps its cadence
+    uint64_t skipped_before = sched.GetFramesSkipped();
+    ASSERT_EQ(PumpFor(sched, now, 5.0, State::Minimized, true, true, true), 0);
+    ASSERT_EQ(PumpFor(sched, now, 5.0, State::Occluded, true, true), 0);
+    ASSERT_TRUE(sched.GetFramesSkipped() - skipped_before >= 600); // 10 s at 16 ms
+    ASSERT_TRUE(sched.GetWaitTimeAt(now) == RenderScheduler::PUMP_INTERVAL);
+
+    // Back in view: redraw on the very first pump, even when idle
+    ASSERT_TRUE(sched.ShouldDrawAt(now, State::Visible, false, false));
+    ASSERT_FALSE(sched.ShouldDrawAt(now + std::chrono::milliseconds(16), State::Visible, false, false));
+
+    // Headless stubs: Render keeps the loop alive and the wait still paces it
+    FFBEngine engine;
+    auto t0 = std::chrono::steady_clock::now();
+    ASSERT_TRUE(GuiLayer::Render(engine));
+    GuiLayer::WaitForEvents();
+    auto waited = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - t0);
+    ASSERT_TRUE(waited.count() >= 10);
+}
@@ -0,0 +1,107 @@
+#include "test_ffb_common.h"
+#include "../src/SlipPeakEstimator.h"
+#include "../src/VehicleProfileStore.h"
+#include <cmath>
+
+namespace FFBEngineTests {
+
+// Pacejka-style lateral curve with its peak at peak_rad
+static double LateralMu(double slip, double peak_rad) {
+    const double C = 1.9, D = 1.6;
+    double B = std::tan(3.14159265358979 / (2.0 * C)) / peak_rad;
+    return D * std::sin(C * std::atan(B * slip));
+}
+
+static void DriveSweep(SlipPeakEstimator& est, double peak_rad, double max_slip, double load, int samples) {
+    uint32_t seed = 12345;
+    for (int i = 0; i < samples; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        double slip = 0.01 + (max_slip - 0.01) * ((seed >> 8) / 16777216.0);
+        double noise = 1.0 + 0.02 * (((seed >> 4) & 0xFF) / 255.0 - 0.5);
+        double sign = (i & 1) ? 1.0 : -1.0; // Both directions
+        est.Update(sign * slip, sign * LateralMu(slip, peak_rad) * load * noise, load, 40.0);
+    }
+}
+
+TEST_CASE(test_slip_peak_estimator_fit, "Physics") {
+    std::cout << "\nTest: SlipPeakEstimator finds the lateral force peak from streaming samples" << std::endl;
+
+    // Never past the peak: no estimate (no extrapolation)
+    SlipPeakEstimator below;
+    DriveSweep(below, 0.09, 0.07, 4000.0, 6000);
+    double slip = 0.0;
+    ASSERT_FALSE(below.GetLearnedPeak(slip));
+    ASSERT_FALSE(below.GetPeak(4000.0, slip));
+
+    // Explored past the peak: vertex lands near the true peak
+    SlipPeakEstimator est;
+    DriveSweep(est, 0.09, 0.18, 4000.0, 6000);
+    ASSERT_TRUE(est.GetLearnedPeak(slip));
+    ASSERT_NEAR(slip, 0.09, 0.012);
+
+    // A second load bucket with a different peak stays separate
+    DriveSweep(est, 0.06, 0.14, 8000.0, 6000);
+    double low = 0.0, high = 0.0;
+    ASSERT_TRUE(est.GetPeak(4000.0, low));
+    ASSERT_TRUE(est.GetPeak(8000.0, high));
+    ASSERT_NEAR(low, 0.09, 0.012);
+    ASSERT_NEAR(high, 0.06, 0.010);
+    // Unvisited bucket borrows the nearest fitted one
+    ASSERT_TRUE(est.GetPeak(1000.0, slip));
+    ASSERT_NEAR(slip, low, 1e-12);
+
+    // Encrypted cars (mLateralForce = 0) and slow samples are ignored
+    SlipPeakEstimator blind;
+    for (int i = 0; i < 2000; ++i) blind.Update(0.1, 0.0, 4000.0, 40.0);
+    for (int i = 0; i < 2000; ++i) blind.Update(0.1, 5000.0, 4000.0, 3.0);
+    ASSERT_EQ((int)blind.GetSampleCount(), 0);
+
+    // Seed is reported until a fit exists, and is not a "learned" value
+    blind.Seed(0.11);
+    ASSERT_TRUE(blind.GetPeak(4000.0, slip));
+    ASSERT_NEAR(slip, 0.11, 1e-12);
+    ASSERT_FALSE(blind.GetLearnedPeak(slip));
+}
+
+TEST_CASE(test_adaptive_slip_angle_profile, "Physics") {
+    std::cout << "\nTest: Learned slip angle peak is used by the grip fallback and stored per car" << std::endl;
+    VehicleProfileStore::Get().Clear();
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_optimal_slip_angle = 0.10f;
+    engine.m_adaptive_slip_angle = true;
+
+    TelemInfoV01 data = CreateBasicTestTelemetry(20.0);
+    // Same class for both cars: the full name alone must select the profile
+    auto switch_car = [&](const char* name) { engine.calculate_force(&data, "GT3", name); };
+
+    switch_car("Slip Car A");
+    ASSERT_NEAR(engine.GetEffectiveOptimalSlipAngle(4000.0), 0.10, 1e-6);
+    DriveSweep(engine.m_slip_estimator, 0.08, 0.16, 4000.0, 6000);
+    double learned = engine.GetEffectiveOptimalSlipAngle(4000.0);
+    ASSERT_NEAR(learned, 0.08, 0.012);
+
+    // Car change persists A's peak; B starts from the user value
+    switch_car("Slip Car B");
+    ASSERT_NEAR(engine.GetEffectiveOptimalSlipAngle(4000.0), 0.10, 1e-6);
+    double stored = 0.0;
+    ASSERT_TRUE(VehicleProfileStore::Get().GetField("Slip Car A", ProfileField::OptimalSlipAngle, stored));
+    ASSERT_NEAR(stored, learned, 1e-9);
+    DriveSweep(engine.m_slip_estimator, 0.12, 0.20, 4000.0, 6000);
+    double learned_b = engine.GetEffectiveOptimalSlipAngle(4000.0);
+
+    // Back to A: resumes from the stored peak, B's estimate is kept under B
+    switch_car("Slip Car A");
+    ASSERT_NEAR(engine.GetEffectiveOptimalSlipAngle(4000.0), stored, 1e-9);
+    double stored_b = 0.0;
+    ASSERT_TRUE(VehicleProfileStore::Get().GetField("Slip Car B", ProfileField::OptimalSlipAngle, stored_b));
+    ASSERT_NEAR(stored_b, learned_b, 1e-9);
+    ASSERT_TRUE(stored_b > stored + 0.02);
+
+    // Disabled: user value again
+    engine.m_adaptive_slip_angle = false;
+    ASSERT_NEAR(engine.GetEffectiveOptimalSlipAngle(4000.0), 0.10, 1e-6);
+    VehicleProfileStore::Get().Clear();
+}
+
+} // namespace FFBEngineTests
@@ -0,0 +1,124 @@
+#include "test_ffb_common.h"
+#include "../src/SnapshotRing.h"
+#include "../src/PlotBuffer.h"
+#include <cmath>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_snapshot_ring_views_and_gaps, "System") {
+    std::cout << "\nTest: Snapshot ring hands out in-place views with gap detection" << std::endl;
+
+    SnapshotRing<int, 16, 4> ring; // 12 readable slots
+    SnapshotRing<int, 16, 4>::Reader reader(ring);
+    ASSERT_TRUE(reader.Read().empty());
+
+    for (int i = 0; i < 10; i++) ring.Push(i);
+    auto view = reader.Read();
+    ASSERT_EQ((int)view.size(), 10);
+    ASSERT_EQ((int)view.GetDropped(), 0);
+    ASSERT_EQ(view[9], 9);
+
+    // Wraps the ring: two segments, still consecutive and pointing into the ring
+    for (int i = 10; i < 20; i++) ring.Push(i);
+    view = reader.Read();
+    ASSERT_EQ((int)view.GetFirstSeq(), 10);
+    ASSERT_EQ((int)view.GetSegmentSize(0), 6);
+    ASSERT_EQ((int)view.GetSegmentSize(1), 4);
+    int expected = 10, out_of_order = 0;
+    view.ForEach([&](int v) { if (v != expected++) out_of_order++; });
+    ASSERT_EQ(out_of_order, 0);
+
+    // A stalled reader loses the oldest and is told how many
+    for (int i = 20; i < 50; i++) ring.Push(i);
+    view = reader.Read();
+    ASSERT_EQ((int)view.size(), 12);
+    ASSERT_EQ((int)view.GetDropped(), 18);
+    ASSERT_EQ(view[0], 38);
+    ASSERT_EQ((int)reader.GetTotalDropped(), 18);
+
+    // Readers are independent, a capped read keeps the newest
+    SnapshotRing<int, 16, 4>::Reader late(ring);
+    for (int i = 50; i < 55; i++) ring.Push(i);
+    view = late.Read(3);
+    ASSERT_EQ((int)view.size(), 3);
+    ASSERT_EQ(view[0], 52);
+    ASSERT_EQ((int)view.GetDropped(), 2);
+    ASSERT_EQ((int)reader.Read().size(), 5);
+}
+
+TEST_CASE(test_snapshot_ring_validate_after_consume, "System") {
+    std::cout << "\nTest: Snapshot ring discards slots overwritten while a view was consumed" << std::endl;
+
+    SnapshotRing<int, 16, 4> ring;
+    SnapshotRing<int, 16, 4>::Reader reader(ring);
+    for (int i = 0; i < 10; i++) ring.Push(i);
+
+    // The writer runs 8 slots further while the reader is walking the view: it has
+    // published up to 17 and is filling slot 18, which is where 2 used to be
+    auto view = reader.Read();
+    int sum = 0;
+    view.ForEach([&](int v) {
+        sum += v;
+        if (v == 0) for (int i = 10; i < 18; i++) ring.Push(i);
+    });
+    ASSERT_EQ((int)reader.Validate(view), 3);
+    ASSERT_EQ((int)view.size(), 7);
+    ASSERT_EQ((int)view.GetFirstSeq(), 3);
+    ASSERT_EQ(view[0], 3);
+    ASSERT_EQ((int)view.GetDropped(), 3);
+    ASSERT_EQ((int)reader.GetTotalDropped(), 3);
+    ASSERT_EQ((int)reader.Validate(view), 0); // Nothing further overwritten
+
+    // Wrapped two-segment view trimmed past its first segment
+    view = reader.Read(); // 10..17: slots 10..15 + 0..1
+    ASSERT_EQ((int)view.GetSegmentSize(1), 2);
+    for (int i = 18; i < 32; i++) ring.Push(i);
+    ASSERT_EQ((int)reader.Validate(view), 7);
+    ASSERT_EQ((int)view.size(), 1);
+    ASSERT_EQ(view[0], 17);
+
+    // ReadCopy hands back only intact copies
+    std::vector<int> copy;
+    auto copied = reader.ReadCopy(copy);
+    ASSERT_EQ((int)copied.size(), 12);
+    ASSERT_EQ((int)copy.size(), 12);
+    ASSERT_EQ(copied[0], 20);
+    ASSERT_EQ(copied[11], 31);
+    ASSERT_EQ((int)copied.GetDropped(), 2); // 18 and 19 fell out of the readable window
+}
+
+TEST_CASE(test_snapshot_ring_engine_handoff, "System") {
+    std::cout << "\nTest: Engine publishes every frame to the ring and plots show gaps" << std::endl;
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    TelemInfoV01 data = CreateBasicTestTelemetry();
+    FFBSnapshotRing::Reader gui(engine.GetSnapshotRing());
+    uint32_t seq0 = engine.GetFrameSequence();
+
+    for (int i = 0; i < 300; i++) engine.calculate_force(&data, "GT3", "911", 0.1f);
+
+    // The GUI reader sees all 300 frames, the legacy batch only the newest 100
+    auto view = gui.Read();
+    ASSERT_EQ((int)view.size(), 300);
+    ASSERT_EQ((int)view.GetDropped(), 0);
+    ASSERT_EQ((int)(engine.GetFrameSequence() - seq0), 300);
+    auto batch = engine.GetDebugBatch();
+    ASSERT_EQ((int)batch.size(), 100); // DEBUG_BUFFER_CAP
+    ASSERT_NEAR(batch.back().total_output, view[299].total_output, 1e-6);
+
+    // Lost snapshots become a break in the envelope, not a joined line
+    PlotBuffer buf(100);
+    for (int i = 0; i < 40; i++) buf.Add(1.0f);
+    buf.AddGap(20);
+    for (int i = 0; i < 40; i++) buf.Add(2.0f);
+    float env_min[10], env_max[10];
+    buf.BuildEnvelope(10, env_min, env_max);
+    ASSERT_TRUE(std::isnan(env_min[4]) && std::isnan(env_max[5]));
+    ASSERT_NEAR(env_max[3], 1.0f, 1e-6);
+    ASSERT_NEAR(env_min[6], 2.0f, 1e-6);
+    ASSERT_NEAR(buf.GetMin(), 1.0f, 1e-6);
+    ASSERT_NEAR(buf.GetCurrent(), 2.0f, 1e-6);
+}
+
+} // namespace FFBEngineTests
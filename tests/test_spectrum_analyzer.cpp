@@ -0,0 +1,131 @@
+#include "test_ffb_common.h"
+#include "../src/SpectrumAnalyzer.h"
+#include <cmath>
+#include <random>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_spectrum_analyzer_peak_detection, "Physics") {
+    std::cout << "\nTest: Spectrum analyzer locates a torque oscillation and ignores plain noise" << std::endl;
+
+    const double dt = 0.0025;
+    std::mt19937 rng(3);
+    std::normal_distribution<double> noise(0.0, 0.2);
+
+    SpectrumAnalyzer spectrum;
+    int frames = 0;
+    for (int i = 0; i < 2000; i++) {
+        double t = i * dt;
+        double sample = 2.0 + 0.5 * std::sin(2.0 * ffb_math::PI * 0.5 * t) // Steering load
+                      + 1.0 * std::sin(2.0 * ffb_math::PI * 23.7 * t) + noise(rng);
+        if (spectrum.Push(sample, dt)) frames++;
+    }
+    ASSERT_TRUE(spectrum.HasSpectrum());
+    ASSERT_EQ(frames, (2000 - SpectrumAnalyzer::FFT_SIZE) / SpectrumAnalyzer::HOP + 1);
+    ASSERT_NEAR(spectrum.GetBinHz(), 400.0 / SpectrumAnalyzer::FFT_SIZE, 0.01);
+
+    double freq = 0.0, amp = 0.0;
+    ASSERT_TRUE(spectrum.FindPeak(18.0, 30.0, freq, &amp));
+    std::cout << "  Peak: " << freq << " Hz, " << amp << " Nm" << std::endl;
+    ASSERT_NEAR(freq, 23.7, 0.5);
+    ASSERT_NEAR(amp, 1.0, 0.3);
+    ASSERT_NEAR(spectrum.GetDominantFrequency(), 23.7, 0.5);
+    ASSERT_FALSE(spectrum.FindPeak(40.0, 80.0, freq)); // Only noise up there
+
+    // White noise alone has no dominant peak
+    SpectrumAnalyzer noisy;
+    for (int i = 0; i < 2000; i++) noisy.Push(noise(rng), dt);
+    ASSERT_NEAR(noisy.GetDominantFrequency(), 0.0, 1e-9);
+
+    // Reset forgets the spectrum
+    spectrum.Reset();
+    ASSERT_FALSE(spectrum.HasSpectrum());
+    ASSERT_FALSE(spectrum.FindPeak(18.0, 30.0, freq));
+}
+
+// RMS of the conditioned torque over the last second of a 5 s run with the oscillation
+// off the theoretical wheel frequency (e.g. a tyre radius that differs from the static one)
+static double RunOffsetOscillation(bool auto_tune, double& notch_freq, double& wheel_freq) {
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_flatspot_suppression = true;
+    engine.m_flatspot_strength = 1.0f;
+    engine.m_notch_auto_tune = auto_tune;
+
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0);
+    FFBCalculationContext ctx;
+    ctx.dt = 0.0025;
+    ctx.car_speed = 30.0;
+
+    const double circumference = 2.0 * ffb_math::PI * data.mWheel[0].mStaticUndeflectedRadius / 100.0;
+    const double actual_freq = 1.15 * ctx.car_speed / circumference;
+    double sum_sq = 0.0;
+    int n = 0;
+    for (int i = 0; i < 2000; i++) {
+        data.mElapsedTime = i * ctx.dt;
+        double torque = 3.0 + 1.0 * std::sin(2.0 * ffb_math::PI * actual_freq * data.mElapsedTime);
+        double out = FFBEngineTestAccess::CallApplySignalConditioning(engine, torque, &data, ctx);
+        if (i >= 1600) { sum_sq += (out - 3.0) * (out - 3.0); n++; }
+    }
+    notch_freq = engine.m_flatspot_notch_freq;
+    wheel_freq = engine.m_theoretical_freq;
+    return std::sqrt(sum_sq / n);
+}
+
+TEST_CASE(test_spectrum_notch_auto_tune, "Physics") {
+    std::cout << "\nTest: Auto-tuned notch follows the measured oscillation instead of the theoretical one" << std::endl;
+
+    double notch_fixed = 0.0, notch_tuned = 0.0, wheel_freq = 0.0;
+    double rms_fixed = RunOffsetOscillation(false, notch_fixed, wheel_freq);
+    double rms_tuned = RunOffsetOscillation(true, notch_tuned, wheel_freq);
+    std::cout << "  Wheel " << wheel_freq << " Hz, oscillation " << wheel_freq * 1.15 << " Hz, notch fixed "
+              << notch_fixed << " Hz / tuned " << notch_tuned << " Hz, residual " << rms_fixed << " -> " << rms_tuned << std::endl;
+
+    ASSERT_NEAR(notch_fixed, wheel_freq, 1e-9);
+    ASSERT_NEAR(notch_tuned, wheel_freq * 1.15, 0.5);
+    ASSERT_TRUE(rms_tuned < rms_fixed * 0.5);
+
+    // Setting survives the preset round trip
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_notch_auto_tune = true;
+    Preset p;
+    p.UpdateFromEngine(engine);
+    ASSERT_TRUE(p.notch_auto_tune);
+}
+
+TEST_CASE(test_spectrum_notch_toggle_forgets_peak, "Physics") {
+    std::cout << "\nTest: Re-enabling auto-tune does not reuse a peak from before it was switched off" << std::endl;
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_flatspot_suppression = true;
+    engine.m_flatspot_strength = 1.0f;
+    engine.m_notch_auto_tune = true;
+
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0);
+    FFBCalculationContext ctx;
+    ctx.dt = 0.0025;
+    ctx.car_speed = 30.0;
+    const double circumference = 2.0 * ffb_math::PI * data.mWheel[0].mStaticUndeflectedRadius / 100.0;
+    const double actual_freq = 1.15 * ctx.car_speed / circumference;
+    auto tick = [&](int i) {
+        data.mElapsedTime = i * ctx.dt;
+        double torque = 3.0 + 1.0 * std::sin(2.0 * ffb_math::PI * actual_freq * data.mElapsedTime);
+        FFBEngineTestAccess::CallApplySignalConditioning(engine, torque, &data, ctx);
+    };
+    int i = 0;
+    for (; i < 1200; i++) tick(i);
+    ASSERT_NEAR(engine.m_flatspot_notch_freq, engine.m_theoretical_freq * 1.15, 0.5);
+
+    // Off for one tick, back on: the notch starts from the theoretical frequency
+    // until the next spectrum frame measures the peak again
+    engine.m_notch_auto_tune = false;
+    tick(i++);
+    engine.m_notch_auto_tune = true;
+    tick(i++);
+    ASSERT_NEAR(engine.m_flatspot_notch_freq, engine.m_theoretical_freq, 1e-9);
+    for (int n = 0; n < SpectrumAnalyzer::HOP; n++) tick(i++);
+    ASSERT_NEAR(engine.m_flatspot_notch_freq, engine.m_theoretical_freq * 1.15, 0.5);
+}
+
+} // namespace FFBEngineTests
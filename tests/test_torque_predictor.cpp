@@ -0,0 +1,114 @@
+#include "test_ffb_common.h"
+#include "../src/TorquePredictor.h"
+#include "../src/TelemetryReplay.h"
+#include <cmath>
+#include <random>
+#include <vector>
+
+namespace FFBEngineTests {
+
+// Capture where the shaft torque follows the steering through a 20 ms tyre lag, then
+// arrives 30 ms late and only refreshes at 100 Hz (every 4th tick), as from the game.
+static void BuildDelayedCapture(ReplayCapture& cap, std::vector<double>& truth, int ticks) {
+    const double dt = 0.0025;
+    const int delay = 12; // 30 ms
+    std::mt19937 rng(11);
+    std::normal_distribution<double> noise(0.0, 0.05);
+    truth.assign(ticks, 0.0);
+    std::vector<double> steer(ticks);
+    double lagged = 0.0;
+    for (int i = 0; i < ticks; i++) {
+        double t = i * dt;
+        steer[i] = 0.3 * std::sin(2.0 * ffb_math::PI * 0.4 * t) + 0.15 * std::sin(2.0 * ffb_math::PI * 1.1 * t + 1.0)
+                 + 0.05 * std::sin(2.0 * ffb_math::PI * 2.3 * t + 2.0);
+        lagged += dt / (0.02 + dt) * (20.0 * steer[i] - lagged);
+        truth[i] = lagged;
+    }
+    cap.frames.clear();
+    for (int i = 0; i < ticks; i++) {
+        int src = (std::max)(0, i - delay) / 4 * 4;
+        cap.frames.push_back(TelemetryReplay::BuildFrame(i * dt, dt, 40.0, 0.0, 0.0, 0.8 * steer[i], steer[i],
+                                                         0.5, 0.0, 0.0, 0.0, 1.0, 1.0, 4000.0, truth[src] + noise(rng)));
+    }
+}
+
+// Shift (in ticks) that best aligns the signal with the truth over the second half
+static int MeasureLagTicks(const std::vector<double>& out, const std::vector<double>& truth) {
+    int best = 0;
+    double best_err = 1e18;
+    int n = (int)out.size();
+    for (int lag = 0; lag < 40; lag++) {
+        double err = 0.0;
+        for (int i = n / 2; i < n; i++) err += std::pow(out[i] - truth[i - lag], 2);
+        if (err < best_err) { best_err = err; best = lag; }
+    }
+    return best;
+}
+
+TEST_CASE(test_torque_predictor_latency_reduction, "Physics") {
+    std::cout << "\nTest: Torque predictor reduces shaft torque latency on a replayed capture" << std::endl;
+
+    ReplayCapture cap;
+    std::vector<double> truth;
+    BuildDelayedCapture(cap, truth, 20000);
+
+    std::vector<double> raw, predicted;
+    TorquePredictor pred;
+    for (const auto& f : cap.frames) {
+        raw.push_back(f.mSteeringShaftTorque);
+        predicted.push_back(pred.Process(f.mSteeringShaftTorque, f.mUnfilteredSteering, f.mLocalRot.y, 0.030, f.mDeltaTime));
+    }
+    int lag_raw = MeasureLagTicks(raw, truth);
+    int lag_pred = MeasureLagTicks(predicted, truth);
+    std::cout << "  Latency: raw " << lag_raw * 2.5 << " ms -> predicted " << lag_pred * 2.5
+              << " ms (confidence " << pred.GetConfidence() << ")" << std::endl;
+    ASSERT_TRUE(lag_raw >= 12);
+    ASSERT_TRUE(lag_raw - lag_pred >= 8); // At least 20 ms recovered
+    ASSERT_TRUE(pred.GetConfidence() > 0.8);
+
+    // Torque unrelated to the inputs: the blend stays on the raw signal
+    TorquePredictor unrelated;
+    std::mt19937 rng(5);
+    std::normal_distribution<double> noise(0.0, 1.0);
+    double torque = 0.0, max_dev = 0.0;
+    for (int i = 0; i < 20000; i++) {
+        if (i % 4 == 0) torque += 0.5 * noise(rng);
+        double out = unrelated.Process(torque, 0.1 * noise(rng), 0.0, 0.030, 0.0025);
+        if (i > 10000) max_dev = (std::max)(max_dev, std::abs(out - torque));
+    }
+    ASSERT_TRUE(unrelated.GetConfidence() < 0.1);
+    ASSERT_TRUE(max_dev < 0.5);
+}
+
+TEST_CASE(test_torque_predictor_engine_gating, "Physics") {
+    std::cout << "\nTest: Torque predictor is a passthrough when off or on the in-game torque source" << std::endl;
+
+    TorquePredictor pred;
+    ASSERT_NEAR(pred.Process(7.5, 0.2, 0.1, 0.0, 0.0025), 7.5, 1e-12);
+    ASSERT_TRUE(std::isnan(pred.Process(NAN, 0.2, 0.1, 0.030, 0.0025))); // Non-finite passes through untouched
+    ASSERT_EQ(pred.GetHorizonTicks(), 0);
+    pred.Process(7.5, 0.2, 0.1, 0.030, 0.0025);
+    ASSERT_EQ(pred.GetHorizonTicks(), 12);
+    ASSERT_NEAR(pred.GetConfidence(), 0.0, 1e-12); // Untrained model is never heard
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_torque_prediction_ms = 30.0f;
+    FFBEngineTestAccess::SetTorqueSource(engine, 1);
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0);
+    data.mDeltaTime = 0.0025;
+    data.mSteeringShaftTorque = 5.0;
+    engine.calculate_force(&data, nullptr, nullptr, 0.3f);
+    ASSERT_EQ(engine.m_torque_predictor.GetHorizonTicks(), 0);
+
+    FFBEngineTestAccess::SetTorqueSource(engine, 0);
+    engine.calculate_force(&data);
+    ASSERT_EQ(engine.m_torque_predictor.GetHorizonTicks(), 12);
+
+    // Setting survives the preset round trip
+    Preset p;
+    p.UpdateFromEngine(engine);
+    ASSERT_NEAR(p.torque_prediction_ms, 30.0f, 0.001f);
+}
+
+} // namespace FFBEngineTests
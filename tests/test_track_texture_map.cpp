@@ -0,0 +1,180 @@
+#include "test_ffb_common.h"
+#include "../src/TrackTextureMap.h"
+#include <cstdio>
+#include <filesystem>
+
+namespace FFBEngineTests {
+
+static TelemVect3 Pos(double x, double y, double z) {
+    TelemVect3 v;
+    v.Set(x, y, z);
+    return v;
+}
+
+TEST_CASE(test_track_map_learn_and_predict, "Texture") {
+    std::cout << "\nTest: TrackTextureMap learns per location and hands over track switches" << std::endl;
+    TrackTextureMap map;
+    map.SetDirectory("test_track_maps");
+
+    // Nothing usable until the main thread services the switch
+    ASSERT_FALSE(map.Activate("Spa"));
+    ASSERT_FALSE(map.Activate("Spa"));
+    map.ServiceIO();
+    ASSERT_TRUE(map.Activate("Spa"));
+    ASSERT_EQ_STR(map.GetTrackName(), "Spa");
+
+    for (int lap = 0; lap < 30; ++lap) {
+        map.Learn(Pos(100.5, 0.0, 50.5), (lap % 2) ? 2.0 : -2.0); // Kerb: signed texture averages to zero
+        map.Learn(Pos(120.5, 0.0, 50.5), -0.5);
+    }
+    double v = 0.0;
+    ASSERT_NEAR(map.Predict(Pos(101.0, 1.0, 51.0), v), 1.0, 1e-9); // Same 2 m cell
+    ASSERT_NEAR(v, 2.0, 1e-5);                                      // RMS amplitude
+    ASSERT_NEAR(map.Predict(Pos(120.1, 0.0, 50.1), v), 1.0, 1e-9);
+    ASSERT_NEAR(v, 0.5, 1e-5);
+    ASSERT_NEAR(map.Predict(Pos(140.0, 0.0, 50.0), v), 0.0, 1e-9); // Unvisited
+    ASSERT_NEAR(map.Predict(Pos(100.5, 20.0, 50.5), v), 0.0, 1e-9); // Bridge above the kerb
+    map.Learn(Pos(200.0, 0.0, 0.0), 1.0);
+    ASSERT_LT(map.Predict(Pos(200.0, 0.0, 0.0), v), 0.1);          // One sample is not trusted
+    ASSERT_EQ(map.GetCellCount(), (size_t)3);
+
+    // Switching away saves Spa; coming back restores it from disk
+    ASSERT_FALSE(map.Activate("Monza"));
+    map.ServiceIO();
+    ASSERT_TRUE(map.Activate("Monza"));
+    ASSERT_EQ(map.GetCellCount(), (size_t)0);
+    ASSERT_TRUE(std::filesystem::exists(map.GetPath("Spa")));
+
+    map.Activate("Spa");
+    map.ServiceIO();
+    ASSERT_TRUE(map.Activate("Spa"));
+    ASSERT_EQ(map.GetCellCount(), (size_t)3);
+    map.Predict(Pos(100.5, 0.0, 50.5), v);
+    ASSERT_NEAR(v, 2.0, 1e-5);
+
+    std::error_code ec;
+    std::filesystem::remove_all("test_track_maps", ec);
+}
+
+TEST_CASE(test_road_texture_prediction_leads, "Texture") {
+    std::cout << "\nTest: Predictive road texture plays the learned kerb ahead of the car" << std::endl;
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_road_texture_enabled = true;
+    engine.m_road_texture_gain = 1.0f;
+    engine.m_road_prediction = 1.0f;
+    engine.m_track_map.SetDirectory("test_track_maps");
+
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0);
+    strncpy(data.mTrackName, "Test Ring", sizeof(data.mTrackName) - 1);
+    data.mOri[0].Set(1.0, 0.0, 0.0);
+    data.mOri[1].Set(0.0, 1.0, 0.0);
+    data.mOri[2].Set(0.0, 0.0, 1.0);
+    data.mLocalVel.z = 30.0; // World +z through the identity orientation
+    data.mDeltaTime = 0.0025;
+
+    engine.calculate_force(&data);
+    engine.m_track_map.ServiceIO(); // Main thread loads (empty) map for "Test Ring"
+
+    // Kerb at z = 100..102 m shows up as deflection spikes. Returns the peak road
+    // texture felt in the 0.9 m (lookahead distance) before reaching the kerb, and
+    // optionally the mean texture felt on the kerb.
+    auto drive_lap = [&](bool kerb_in_telemetry, double* kerb_mean = nullptr) {
+        double peak_before_kerb = 0.0;
+        double kerb_sum = 0.0;
+        int kerb_ticks = 0;
+        for (int i = 0; i < 1600; ++i) {
+            double z = i * 30.0 * 0.0025;
+            data.mPos.Set(0.0, 0.0, z);
+            bool on_kerb = kerb_in_telemetry && z >= 100.0 && z < 102.0;
+            double defl = (on_kerb && (i % 2)) ? 0.004 : 0.0;
+            data.mWheel[0].mVerticalTireDeflection = defl;
+            data.mWheel[1].mVerticalTireDeflection = defl;
+            engine.calculate_force(&data);
+            auto batch = engine.GetDebugBatch();
+            if (z > 99.1 && z < 100.0 && !batch.empty()) {
+                peak_before_kerb = (std::max)(peak_before_kerb, (double)std::abs(batch.back().texture_road));
+            }
+            if (z >= 100.5 && z < 101.5 && !batch.empty()) {
+                kerb_sum += std::abs(batch.back().texture_road);
+                kerb_ticks++;
+            }
+        }
+        if (kerb_mean) *kerb_mean = kerb_ticks ? kerb_sum / kerb_ticks : 0.0;
+        return peak_before_kerb;
+    };
+
+    double reactive_kerb = 0.0;
+    ASSERT_NEAR(drive_lap(true, &reactive_kerb), 0.0, 1e-9); // Nothing learned yet: purely reactive
+    ASSERT_GT(reactive_kerb, 0.01);
+    for (int lap = 0; lap < 3; ++lap) drive_lap(true);
+    ASSERT_GT(engine.m_track_map.GetCellCount(), (size_t)50);
+
+    // The kerb is now felt before the telemetry reports it
+    ASSERT_GT(drive_lap(false), 0.01);
+
+    // ...and a learned kerb is not attenuated once the telemetry reports it
+    double predicted_kerb = 0.0;
+    drive_lap(true, &predicted_kerb);
+    ASSERT_GE(predicted_kerb, reactive_kerb - 1e-9);
+
+    double kerb_value = 0.0;
+    TelemVect3 kerb;
+    kerb.Set(0.0, 0.0, 101.0);
+    ASSERT_GT(engine.m_track_map.Predict(kerb, kerb_value), 0.9);
+    ASSERT_GT(kerb_value, 0.01);
+
+    std::error_code ec;
+    std::filesystem::remove_all("test_track_maps", ec);
+}
+
+TEST_CASE(test_road_texture_prediction_silent_live, "Texture") {
+    std::cout << "\nTest: Predicted lead does not alternate while the live texture is silent" << std::endl;
+    FFBEngine engine;
+    InitializeEngine(engine);
+    engine.m_road_texture_enabled = true;
+    engine.m_road_texture_gain = 1.0f;
+    engine.m_road_prediction = 1.0f;
+    engine.m_track_map.SetDirectory("test_track_maps_silent");
+
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0);
+    strncpy(data.mTrackName, "Silent Ring", sizeof(data.mTrackName) - 1);
+    data.mOri[0].Set(1.0, 0.0, 0.0);
+    data.mOri[1].Set(0.0, 1.0, 0.0);
+    data.mOri[2].Set(0.0, 0.0, 1.0);
+    data.mLocalVel.z = 30.0;
+    data.mDeltaTime = 0.0025;
+    engine.calculate_force(&data);
+    engine.m_track_map.ServiceIO();
+
+    // Learn a kerb at z = 100..102 m, then drive it with the deflection channel silent
+    int flips = 0, active = 0;
+    for (int lap = 0; lap < 5; ++lap) {
+        bool silent = (lap == 4);
+        float prev = 0.0f;
+        for (int i = 0; i < 1600; ++i) {
+            double z = i * 30.0 * 0.0025;
+            data.mPos.Set(0.0, 0.0, z);
+            bool on_kerb = !silent && z >= 100.0 && z < 102.0;
+            double defl = (on_kerb && (i % 2)) ? 0.004 : 0.0;
+            data.mWheel[0].mVerticalTireDeflection = defl;
+            data.mWheel[1].mVerticalTireDeflection = defl;
+            engine.calculate_force(&data);
+            auto batch = engine.GetDebugBatch();
+            if (!silent || batch.empty()) continue;
+            float road = batch.back().texture_road;
+            if (road != 0.0f) {
+                active++;
+                if (prev != 0.0f && (road > 0.0f) != (prev > 0.0f)) flips++;
+                prev = road;
+            }
+        }
+    }
+    ASSERT_GT(active, 10); // The learned kerb is still played
+    ASSERT_EQ(flips, 0);   // ...without a loop-rate square wave
+
+    std::error_code ec;
+    std::filesystem::remove_all("test_track_maps_silent", ec);
+}
+
+} // namespace FFBEngineTests
@@ -1,5 +1,7 @@
 #include "test_ffb_common.h"
 #include "VehicleUtils.h"
+#include <cstdio>
+#include <fstream>
 
 namespace FFBEngineTests {
 
@@ -95,4 +97,59 @@ TEST_CASE(test_vehicle_class_to_string, "Internal") {
     ASSERT_EQ_STR(VehicleClassToString(ParsedVehicleClass::UNKNOWN), "Unknown");
 }
 
+TEST_CASE(test_vehicle_class_cache_consistency, "Internal") {
+    ResetVehicleClassTable();
+    // Repeated lookups (cache hits) must agree with the first classification
+    for (int i = 0; i < 3; ++i) {
+        ASSERT_EQ((int)ParseVehicleClass("LMP2", "Oreca 07 Derestricted"), (int)ParsedVehicleClass::LMP2_UNRESTRICTED);
+        ASSERT_EQ((int)ParseVehicleClass("lmp2 wec", "Oreca 07"), (int)ParsedVehicleClass::LMP2_RESTRICTED);
+        ASSERT_EQ((int)ParseVehicleClass("", "Ferrari 499P #50"), (int)ParsedVehicleClass::HYPERCAR);
+        ASSERT_EQ((int)ParseVehicleClass("Unknown Series", "Ford Mustang LMGT3"), (int)ParsedVehicleClass::GT3);
+    }
+    // Same strings split differently between class and name are different keys
+    ASSERT_EQ((int)ParseVehicleClass("GT3", ""), (int)ParsedVehicleClass::GT3);
+    ASSERT_EQ((int)ParseVehicleClass("", "GT3"), (int)ParsedVehicleClass::UNKNOWN);
+    // Class hierarchy still wins over name keywords
+    ASSERT_EQ((int)ParseVehicleClass("GTE", "Porsche 963"), (int)ParsedVehicleClass::GTE);
+    // Overlapping patterns in one pass ("LMGT3" contains "GT3", "680" inside a longer token)
+    ASSERT_EQ((int)ParseVehicleClass("LMGT3", ""), (int)ParsedVehicleClass::GT3);
+    ASSERT_EQ((int)ParseVehicleClass("", "Isotta Tipo6-680X"), (int)ParsedVehicleClass::HYPERCAR);
+}
+
+TEST_CASE(test_vehicle_class_table_from_file, "Internal") {
+    const char* path = "test_vehicle_classes.ini";
+    {
+        std::ofstream f(path);
+        f << "; user additions\n"
+          << "[Rules]\n"
+          << "name:Revuelto = Hypercar\n"
+          << "class:LMP2 + name:EVO = LMP2_UNRESTRICTED\n"
+          << "name:Mustang = GTE ; overrides the built-in GT3 keyword\n"
+          << "bogus line\n"
+          << "name:X = NotAClass\n"
+          << "[Loads]\n"
+          << "GT3 = 5100\n"
+          << "LMP2 Restricted = 7000\n";
+    }
+    ASSERT_TRUE(ParseVehicleClass("", "Lamborghini Revuelto") == ParsedVehicleClass::UNKNOWN);
+    ASSERT_TRUE(LoadVehicleClassTable(path));
+
+    ASSERT_EQ((int)ParseVehicleClass("", "Lamborghini Revuelto"), (int)ParsedVehicleClass::HYPERCAR);
+    ASSERT_EQ((int)ParseVehicleClass("LMP2", "Oreca Evo"), (int)ParsedVehicleClass::LMP2_UNRESTRICTED);
+    ASSERT_EQ((int)ParseVehicleClass("", "Ford Mustang"), (int)ParsedVehicleClass::GTE);
+    ASSERT_EQ((int)ParseVehicleClass("", "BMW M4 GT3"), (int)ParsedVehicleClass::GT3); // Built-ins still active
+    ASSERT_EQ(GetDefaultLoadForClass(ParsedVehicleClass::GT3), 5100.0);
+    ASSERT_EQ(GetDefaultLoadForClass(ParsedVehicleClass::LMP2_RESTRICTED), 7000.0);
+    ASSERT_EQ(GetDefaultLoadForClass(ParsedVehicleClass::HYPERCAR), 9500.0);
+
+    ASSERT_FALSE(LoadVehicleClassTable("does_not_exist_vehicle_classes.ini"));
+    ASSERT_EQ((int)ParseVehicleClass("", "Lamborghini Revuelto"), (int)ParsedVehicleClass::HYPERCAR);
+
+    ResetVehicleClassTable();
+    std::remove(path);
+    ASSERT_EQ((int)ParseVehicleClass("", "Lamborghini Revuelto"), (int)ParsedVehicleClass::UNKNOWN);
+    ASSERT_EQ((int)ParseVehicleClass("", "Ford Mustang"), (int)ParsedVehicleClass::GT3);
+    ASSERT_EQ(GetDefaultLoadForClass(ParsedVehicleClass::GT3), 4800.0);
+}
+
 } // namespace FFBEngineTests
@@ -0,0 +1,83 @@
+#include "test_ffb_common.h"
+#include <cmath>
+
+namespace FFBEngineTests {
+
+TEST_CASE(test_wheel_states_independent_corners, "Physics") {
+    std::cout << "\nTest: Per-wheel states keep each corner's load, grip and slip separate" << std::endl;
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0);
+
+    // Front-left locked under braking, right-hand corners loaded
+    data.mWheel[0].mRotation = 0.0;
+    data.mWheel[0].mLongitudinalPatchVel = -30.0;
+    data.mWheel[1].mTireLoad = 6000.0;
+    data.mWheel[3].mTireLoad = 5000.0;
+
+    double prev1 = 0.0, prev2 = 0.0;
+    bool warned = false;
+    GripResult grip = engine.calculate_grip(data.mWheel[0], data.mWheel[1], 5000.0, warned, prev1, prev2,
+                                            30.0, 0.0025, "Test", &data, true);
+    // The locked wheel loses grip on its own instead of being averaged first
+    ASSERT_TRUE(grip.wheel_grip[0] < 0.5);
+    ASSERT_NEAR(grip.wheel_grip[1], 1.0, 0.001);
+    ASSERT_TRUE(grip.approximated);
+
+    FFBCalculationContext ctx;
+    engine.update_wheel_states(&data, ctx);
+    ASSERT_NEAR(ctx.wheels[0].load, 4000.0, 0.001);
+    ASSERT_NEAR(ctx.wheels[1].load, 6000.0, 0.001);
+    ASSERT_NEAR(ctx.wheels[2].load, 4000.0, 0.001);
+    ASSERT_NEAR(ctx.wheels[3].load, 5000.0, 0.001);
+    ASSERT_TRUE(ctx.wheels[0].slip_ratio < -0.5);
+    ASSERT_NEAR(ctx.wheels[1].slip_ratio, 0.0, 0.05);
+    ASSERT_FALSE(ctx.wheels[0].load_approximated);
+
+    // Missing tire load: each wheel falls back on its own
+    data.mWheel[0].mSuspForce = 3000.0;
+    data.mWheel[1].mSuspForce = 0.0;
+    FFBCalculationContext missing;
+    missing.frame_warn_load = true;
+    engine.update_wheel_states(&data, missing);
+    ASSERT_TRUE(missing.wheels[0].load_approximated);
+    ASSERT_NEAR(missing.wheels[0].load, engine.approximate_load(data.mWheel[0]), 0.001);
+    ASSERT_NEAR(missing.wheels[1].load, engine.calculate_kinematic_load(&data, 1), 0.001);
+    ASSERT_NEAR(missing.wheels[2].load, engine.approximate_rear_load(data.mWheel[2]), 0.001);
+}
+
+TEST_CASE(test_wheel_states_snapshot_four_corners, "Physics") {
+    std::cout << "\nTest: Snapshot carries all four wheel states; symmetric input stays symmetric" << std::endl;
+
+    FFBEngine engine;
+    InitializeEngine(engine);
+    TelemInfoV01 data = CreateBasicTestTelemetry(30.0, 0.05);
+    data.mWheel[2].mTireLoad = 3000.0;
+    data.mWheel[3].mTireLoad = 3500.0;
+    engine.GetDebugBatch(); // Drain
+
+    for (int i = 0; i < 10; i++) {
+        data.mElapsedTime += 0.01;
+        engine.calculate_force(&data);
+    }
+    auto batch = engine.GetDebugBatch();
+    ASSERT_TRUE(!batch.empty());
+    const FFBSnapshot& snap = batch.back();
+
+    ASSERT_NEAR(snap.wheel_load[0], 4000.0, 0.5);
+    ASSERT_NEAR(snap.wheel_load[1], 4000.0, 0.5);
+    ASSERT_NEAR(snap.wheel_load[2], 3000.0, 0.5);
+    ASSERT_NEAR(snap.wheel_load[3], 3500.0, 0.5);
+    ASSERT_FALSE(snap.wheel_load_approx[0]);
+    ASSERT_TRUE(snap.wheel_grip_approx[0]);
+    ASSERT_TRUE(snap.wheel_grip_approx[3]);
+
+    // Identical front wheels: per-wheel pipeline reproduces the axle value
+    ASSERT_NEAR(snap.wheel_grip[0], snap.wheel_grip[1], 0.0001);
+    ASSERT_NEAR(snap.wheel_slip_angle[0], snap.wheel_slip_angle[1], 0.0001);
+    ASSERT_NEAR(snap.wheel_slip_angle[0], snap.calc_front_slip_angle_smoothed, 0.0001);
+    ASSERT_TRUE(snap.wheel_slip_angle[2] > 0.0);
+}
+
+} // namespace FFBEngineTests
@@ -0,0 +1,274 @@
+// lmuFFB Log Analyzer (native)
+// ---------------------------------------------------------------------------
+// Single-pass, multi-threaded analysis of AsyncLogger CSV logs. Same metrics and
+// report layout as the Python tool in tools/lmuffb_log_analyzer, without loading
+// the whole file into a DataFrame, so multi-hour endurance logs stay fast.
+//
+// Usage:
+//   LMUFFB_LogAnalyzer <info|analyze|report> <log.csv> [--output FILE] [--threads T]
+//   LMUFFB_LogAnalyzer index <log.csv> [--channel NAME --min LO --max HI]
+//   LMUFFB_LogAnalyzer decompress <log.lmz> [--output FILE.csv]
+//   LMUFFB_LogAnalyzer flight <flight_recorder.lmfr> [--at T] [--before S] [--after S] [--output FILE.csv]
+// Compressed (.lmz) logs are accepted by every command.
+// ---------------------------------------------------------------------------
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+#include "FlightRecorder.h"
+#include "LogAnalyzer.h"
+#include "LogCodec.h"
+#include "LogIndex.h"
+
+static void PrintUsage() {
+    std::cout << "Usage: LMUFFB_LogAnalyzer <command> <log.csv> [options]\n"
+              << "Commands:\n"
+              << "  info      Session info from the log header\n"
+              << "  analyze   Slope stability, oscillation, singularity and grip correlation summary\n"
+              << "  report    Full diagnostic report (same layout as the Python analyzer)\n"
+              << "  index     Laps, markers and chunks from the log's .idx sidecar\n"
+              << "  decompress  Convert a compressed .lmz log back to CSV\n"
+              << "  flight    Extract a window of a flight recorder file (.lmfr) to CSV\n"
+              << "Options:\n"
+              << "  --output FILE   Write the report to FILE instead of stdout\n"
+              << "  --threads T     Worker threads (default: all cores)\n"
+              << "  --channel NAME  (index) Only list chunks where NAME can lie in [--min, --max]\n"
+              << "  --at T          (flight) Center on game time T (default: largest output step)\n"
+              << "  --before S      (flight) Seconds before the center (default 5)\n"
+              << "  --after S       (flight) Seconds after the center (default 1)\n";
+}
+
+static void PrintInfo(const LogAnalysis& a) {
+    printf("Session Information\n\n");
+    printf("Driver: %s\n", a.meta.driver_name.c_str());
+    printf("Vehicle: %s\n", a.meta.vehicle_name.c_str());
+    printf("Track: %s\n", a.meta.track_name.c_str());
+    printf("Duration: %.1f seconds\n", a.duration_s);
+    printf("Frames: %zu\n", a.frames);
+    printf("App Version: %s\n", a.meta.app_version.c_str());
+    if (a.skipped_lines > 0) printf("Skipped rows: %zu (incomplete)\n", a.skipped_lines);
+}
+
+static void Row(const char* metric, const std::string& value, const char* status) {
+    printf("  %-20s %-18s %s\n", metric, value.c_str(), status);
+}
+
+static std::string Fmt(const char* fmt, double v) {
+    char buf[64];
+    snprintf(buf, sizeof(buf), fmt, v);
+    return buf;
+}
+
+static void PrintAnalysis(const LogAnalysis& a) {
+    const SlopeStabilityResult& s = a.slope;
+    printf("Slope Detection Analysis\n");
+    Row("Metric", "Value", "Status");
+    Row("Slope Std Dev", Fmt("%.2f", s.slope_std), s.slope_std > 5.0 ? "HIGH" : "OK");
+    Row("Slope Range", Fmt("%.1f", s.slope_min) + " to " + Fmt("%.1f", s.slope_max),
+        (s.slope_max - s.slope_min) > 20.0 ? "WIDE" : "OK");
+    if (s.active_percentage) Row("Active %", Fmt("%.1f%%", *s.active_percentage), *s.active_percentage < 30.0 ? "LOW" : "OK");
+    if (s.floor_percentage) Row("Floor Hits", Fmt("%.1f%%", *s.floor_percentage), *s.floor_percentage > 5.0 ? "HIGH" : "OK");
+    Row("Oscillation Events", std::to_string(a.oscillations.size()), a.oscillations.size() > 3 ? "MANY" : "OK");
+    Row("Singularity Events", std::to_string(a.singularity_count), a.singularity_count > 0 ? "CRITICAL" : "OK");
+    if (a.singularity_count > 0) {
+        Row("Worst Singularity", Fmt("%.1f", a.worst_singularity), a.worst_singularity > 20.0 ? "SEVERE" : "WARN");
+    }
+    if (a.grip.grip_vs_slip) Row("Grip vs Slip corr", Fmt("%.3f", *a.grip.grip_vs_slip), "");
+    if (a.grip.grip_vs_latg) Row("Grip vs Lat G corr", Fmt("%.3f", *a.grip.grip_vs_latg), "");
+
+    if (!s.issues.empty()) {
+        printf("\nIssues Detected:\n");
+        for (const auto& issue : s.issues) printf("  - %s\n", issue.c_str());
+    } else {
+        printf("\nNo issues detected in slope analysis.\n");
+    }
+    for (const auto& ev : a.oscillations) {
+        printf("  Oscillation %.2f-%.2f s (%.2f s, amplitude %.1f)\n", ev.start_time, ev.end_time, ev.duration, ev.amplitude);
+    }
+}
+
+static int PrintIndex(const std::string& log_path, const std::string& channel_name, float lo, float hi) {
+    LogIndex index;
+    std::string error;
+    if (!index.Load(LogIndex::PathFor(log_path), &error)) {
+        std::cerr << "[LogAnalyzer] " << error << std::endl;
+        return 1;
+    }
+    printf("Log Index\n\n");
+    printf("Frames: %llu%s\n", (unsigned long long)index.GetFrameCount(),
+           index.IsComplete() ? "" : " (interrupted session, index ends at the last full chunk)");
+    printf("Chunks: %zu x %d frames\n", index.GetChunks().size(), index.GetChunkFrames());
+    for (const auto& m : index.GetMarks()) {
+        printf("  %-6s lap %-3d %10.2f s  frame %-8llu offset %llu\n", (m.type == LogIndexMark::Type::Lap) ? "Lap" : "Marker",
+               m.lap, m.time, (unsigned long long)m.frame, (unsigned long long)m.offset);
+    }
+
+    if (channel_name.empty()) return 0;
+    int channel = LogIndex::FindChannel(channel_name);
+    if (channel < 0) {
+        std::cerr << "[LogAnalyzer] " << channel_name << " is not indexed" << std::endl;
+        return 1;
+    }
+    std::vector<int> hits = index.FindChunks(channel, lo, hi);
+    printf("\nChunks with %s in [%g, %g]: %zu of %zu\n", channel_name.c_str(), lo, hi, hits.size(), index.GetChunks().size());
+    for (int i : hits) {
+        const LogIndex::Chunk& c = index.GetChunks()[i];
+        printf("  %10.2f-%.2f s  lap %-3d bytes %llu-%llu  %s %.3f to %.3f\n", c.time_start, c.time_end, c.lap,
+               (unsigned long long)c.offset, (unsigned long long)c.end_offset, channel_name.c_str(), c.min[channel], c.max[channel]);
+    }
+    return 0;
+}
+
+static int Decompress(const std::string& log_path, std::string output_path) {
+    std::ifstream in(log_path, std::ios::binary);
+    if (!in.is_open()) {
+        std::cerr << "[LogAnalyzer] Cannot open " << log_path << std::endl;
+        return 1;
+    }
+    std::string data((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    std::string csv, error;
+    size_t frames = 0;
+    if (!LogCodec::DecodeToCsv(data.data(), data.size(), csv, &error, &frames)) {
+        std::cerr << "[LogAnalyzer] " << error << std::endl;
+        return 1;
+    }
+    if (output_path.empty()) {
+        size_t dot = log_path.find_last_of('.');
+        output_path = ((dot == std::string::npos) ? log_path : log_path.substr(0, dot)) + ".csv";
+    }
+    std::ofstream out(output_path, std::ios::binary);
+    if (!out.is_open()) {
+        std::cerr << "[LogAnalyzer] Cannot write " << output_path << std::endl;
+        return 1;
+    }
+    out << csv;
+    printf("%zu frames, %zu -> %zu bytes (%.1fx): %s\n", frames, data.size(), csv.size(),
+           data.empty() ? 0.0 : (double)csv.size() / (double)data.size(), output_path.c_str());
+    return 0;
+}
+
+static int ExtractFlight(const std::string& path, std::string output_path, double at, double before, double after) {
+    std::vector<FlightRecord> records;
+    FlightRecorderInfo info;
+    std::string error;
+    if (!FlightRecorder::Load(path, records, &info, &error)) {
+        std::cerr << "[LogAnalyzer] " << error << std::endl;
+        return 1;
+    }
+    printf("Flight Recorder\n\n");
+    printf("App Version: %s\n", info.app_version.c_str());
+    printf("Records: %zu of %u (last sequence %llu)\n", records.size(), info.capacity, (unsigned long long)info.head);
+    if (records.empty()) return 0;
+    printf("Game time: %.3f-%.3f s\n", records.front().inputs.elapsed_time, records.back().inputs.elapsed_time);
+
+    // Center on the requested time, else on the jolt
+    size_t center = FlightRecorder::FindLargestStep(records);
+    if (at >= 0.0) {
+        center = 0;
+        for (size_t i = 0; i < records.size(); ++i) {
+            if (records[i].inputs.elapsed_time <= at) center = i;
+        }
+    } else if (center > 0) {
+        printf("Largest output step: %.3f -> %.3f at %.3f s\n", records[center - 1].output_force,
+               records[center].output_force, records[center].inputs.elapsed_time);
+    }
+    double t0 = records[center].inputs.elapsed_time;
+    size_t first = center, last = center;
+    while (first > 0 && records[first - 1].inputs.elapsed_time >= t0 - before) first--;
+    while (last + 1 < records.size() && records[last + 1].inputs.elapsed_time <= t0 + after) last++;
+
+    if (output_path.empty()) {
+        size_t dot = path.find_last_of('.');
+        output_path = ((dot == std::string::npos) ? path : path.substr(0, dot)) + "_window.csv";
+    }
+    std::ofstream out(output_path);
+    if (!out.is_open()) {
+        std::cerr << "[LogAnalyzer] Cannot write " << output_path << std::endl;
+        return 1;
+    }
+    FlightRecorder::WriteCsv(out, records.data() + first, last - first + 1);
+    printf("%zu records (%.3f-%.3f s) written to %s\n", last - first + 1, records[first].inputs.elapsed_time,
+           records[last].inputs.elapsed_time, output_path.c_str());
+    return 0;
+}
+
+int main(int argc, char* argv[]) {
+    std::string command, log_path, output_path, channel_name;
+    float range_lo = -1e30f, range_hi = 1e30f;
+    double flight_at = -1.0, flight_before = 5.0, flight_after = 1.0;
+    LogAnalyzerOptions options;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&](const char* name) -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << name << std::endl;
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--help" || arg == "-h") { PrintUsage(); return 0; }
+        else if (arg == "--output" || arg == "-o") output_path = next("--output");
+        else if (arg == "--threads") options.threads = (unsigned int)std::strtoul(next("--threads").c_str(), nullptr, 10);
+        else if (arg == "--channel") channel_name = next("--channel");
+        else if (arg == "--min") range_lo = std::strtof(next("--min").c_str(), nullptr);
+        else if (arg == "--max") range_hi = std::strtof(next("--max").c_str(), nullptr);
+        else if (arg == "--at") flight_at = std::strtod(next("--at").c_str(), nullptr);
+        else if (arg == "--before") flight_before = std::strtod(next("--before").c_str(), nullptr);
+        else if (arg == "--after") flight_after = std::strtod(next("--after").c_str(), nullptr);
+        else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown option " << arg << std::endl;
+            PrintUsage();
+            return 2;
+        }
+        else if (command.empty()) command = arg;
+        else log_path = arg;
+    }
+
+    if (log_path.empty() || (command != "info" && command != "analyze" && command != "report" && command != "index" &&
+                              command != "decompress" && command != "flight")) {
+        PrintUsage();
+        return 2;
+    }
+    if (command == "index") return PrintIndex(log_path, channel_name, range_lo, range_hi);
+    if (command == "decompress") return Decompress(log_path, output_path);
+    if (command == "flight") return ExtractFlight(log_path, output_path, flight_at, flight_before, flight_after);
+
+    LogAnalysis analysis;
+    std::string error;
+    auto start = std::chrono::steady_clock::now();
+    if (!LogAnalyzer::AnalyzeFile(log_path, analysis, options, &error)) {
+        std::cerr << "[LogAnalyzer] " << error << std::endl;
+        return 1;
+    }
+    double elapsed_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    std::cerr << "[LogAnalyzer] " << analysis.frames << " frames in " << (int)elapsed_ms << " ms ("
+              << analysis.threads_used << " threads)" << std::endl;
+
+    if (command == "info") {
+        PrintInfo(analysis);
+    } else if (command == "analyze") {
+        PrintAnalysis(analysis);
+    } else {
+        std::string report = LogAnalyzer::FormatTextReport(analysis);
+        if (output_path.empty()) {
+            std::cout << report << std::endl;
+        } else {
+            std::ofstream out(output_path);
+            if (!out.is_open()) {
+                std::cerr << "[LogAnalyzer] Cannot write " << output_path << std::endl;
+                return 1;
+            }
+            out << report;
+            std::cout << "Report saved to: " << output_path << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,146 @@
+// lmuFFB Preset Tuner
+// ---------------------------------------------------------------------------
+// Replays a telemetry log recorded by lmuFFB (AsyncLogger CSV) through FFBEngine
+// for many preset variations in parallel and prints a ranked list.
+//
+// Usage:
+//   LMUFFB_Tuner <log.csv> [--preset NAME] [--param key=min:max[:steps]]...
+//                [--random N] [--seed S] [--threads T] [--top K]
+//                [--class CLASS] [--export best.ini] [--list-keys]
+// ---------------------------------------------------------------------------
+
+#include <iostream>
+#include <iomanip>
+#include <mutex>
+#include <string>
+#include <vector>
+#include <chrono>
+#include <cstdlib>
+
+#include "Config.h"
+#include "PresetTuner.h"
+#include "TelemetryReplay.h"
+
+// FFBEngine/Config reference the application's global engine lock.
+std::recursive_mutex g_engine_mutex;
+
+static void PrintUsage() {
+    std::cout << "Usage: LMUFFB_Tuner <log.csv> [options]\n"
+              << "  --preset NAME            Base preset (default: built-in defaults)\n"
+              << "  --param key=min:max[:n]  Parameter range to sweep (repeatable, n defaults to 5)\n"
+              << "  --random N               Random search with N samples instead of a full grid\n"
+              << "  --seed S                 Random seed (default: 1)\n"
+              << "  --threads T              Worker threads (default: all cores)\n"
+              << "  --top K                  Number of ranked results to print (default: 10)\n"
+              << "  --class CLASS            Vehicle class used for load seeding\n"
+              << "  --export FILE            Write the best candidate as an importable preset\n"
+              << "  --list-keys              List tunable parameter keys\n";
+}
+
+int main(int argc, char* argv[]) {
+    std::string log_path, preset_name, vehicle_class, export_path;
+    std::vector<TunerParam> params;
+    int random_count = 0;
+    unsigned int seed = 1;
+    unsigned int threads = 0;
+    int top = 10;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        auto next = [&](const char* name) -> std::string {
+            if (i + 1 >= argc) {
+                std::cerr << "Missing value for " << name << std::endl;
+                std::exit(2);
+            }
+            return argv[++i];
+        };
+
+        if (arg == "--help" || arg == "-h") { PrintUsage(); return 0; }
+        else if (arg == "--list-keys") {
+            for (const auto& k : PresetTuner::TunableKeys()) std::cout << k << "\n";
+            return 0;
+        }
+        else if (arg == "--preset") preset_name = next("--preset");
+        else if (arg == "--param") {
+            TunerParam p;
+            std::string text = next("--param");
+            if (!PresetTuner::ParseParam(text, p)) {
+                std::cerr << "Invalid --param '" << text << "' (expected key=min:max[:steps], see --list-keys)" << std::endl;
+                return 2;
+            }
+            params.push_back(p);
+        }
+        else if (arg == "--random") random_count = std::atoi(next("--random").c_str());
+        else if (arg == "--seed") seed = (unsigned int)std::strtoul(next("--seed").c_str(), nullptr, 10);
+        else if (arg == "--threads") threads = (unsigned int)std::strtoul(next("--threads").c_str(), nullptr, 10);
+        else if (arg == "--top") top = std::atoi(next("--top").c_str());
+        else if (arg == "--class") vehicle_class = next("--class");
+        else if (arg == "--export") export_path = next("--export");
+        else if (!arg.empty() && arg[0] == '-') {
+            std::cerr << "Unknown option " << arg << std::endl;
+            PrintUsage();
+            return 2;
+        }
+        else log_path = arg;
+    }
+
+    if (log_path.empty()) {
+        PrintUsage();
+        return 2;
+    }
+
+    ReplayCapture capture;
+    std::string error;
+    if (!TelemetryReplay::LoadCsv(log_path, capture, &error)) {
+        std::cerr << "[Tuner] " << error << std::endl;
+        return 1;
+    }
+    std::cout << "[Tuner] Loaded " << capture.frames.size() << " frames (" << std::fixed << std::setprecision(1)
+              << capture.duration_s << " s) | Vehicle: " << capture.vehicle_name << " | Track: " << capture.track_name << std::endl;
+
+    Preset base;
+    if (!preset_name.empty()) {
+        Config::LoadPresets();
+        bool found = false;
+        for (const auto& p : Config::presets) {
+            if (p.name == preset_name) { base = p; found = true; break; }
+        }
+        if (!found) {
+            std::cerr << "[Tuner] Preset not found: " << preset_name << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<TunerCandidate> candidates = (random_count > 0)
+        ? PresetTuner::BuildRandom(base, params, random_count, seed)
+        : PresetTuner::BuildGrid(base, params);
+
+    auto start = std::chrono::steady_clock::now();
+    PresetTuner::Run(candidates, capture, threads, vehicle_class.empty() ? nullptr : vehicle_class.c_str());
+    double elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::cout << "[Tuner] Evaluated " << candidates.size() << " candidates in " << std::setprecision(2) << elapsed << " s" << std::endl;
+
+    std::cout << "\nRank  Score    Clip%   Sat%    HF(e-3)  Lat(ms)  RMS    Parameters\n";
+    int shown = 0;
+    for (const auto& c : candidates) {
+        if (shown >= top) break;
+        const TunerMetrics& m = c.metrics;
+        std::cout << std::setw(4) << ++shown << "  "
+                  << std::setprecision(4) << std::setw(7) << m.score << "  "
+                  << std::setprecision(2) << std::setw(6) << m.clipping_ratio * 100.0 << "  "
+                  << std::setw(6) << m.saturation_ratio * 100.0 << "  "
+                  << std::setprecision(3) << std::setw(7) << m.hf_energy * 1000.0 << "  "
+                  << std::setprecision(1) << std::setw(7) << m.latency_ms << "  "
+                  << std::setprecision(3) << std::setw(5) << m.output_rms << "  ";
+        for (const auto& v : c.values) std::cout << v.first << "=" << v.second << " ";
+        std::cout << "\n";
+    }
+
+    if (!export_path.empty() && !candidates.empty()) {
+        Preset best = candidates.front().preset;
+        best.name = (preset_name.empty() ? std::string("Default") : preset_name) + " (Tuned)";
+        best.is_builtin = false;
+        Config::ExportPreset(best, export_path);
+    }
+    return 0;
+}